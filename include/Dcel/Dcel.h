@@ -23,8 +23,8 @@ class Dcel : public DcelModel
 	/*******************************************************************************************************************
 	* Private methods
 	*******************************************************************************************************************/
-	static void  quicksort(Vertex *origin, Vertex *list, int first, int last);
-	static int	 movePivot(Vertex *origin, Vertex *list, int first, int last);
+	void  quicksort(int first, int last);
+	int	  movePivot(int first, int last);
 
 public:
 	/*******************************************************************************************************************
@@ -32,26 +32,42 @@ public:
     *******************************************************************************************************************/
     Dcel() = default;
     explicit Dcel(vector<Point<TYPE>> &v) : DcelModel(v) {};
+    explicit Dcel(vector<Point<TYPE>> &&v) : DcelModel(std::move(v)) {};
 	~Dcel() = default;
 
 	// Check functions.
-	bool isExternalEdge(int edgeIndex);
-	bool hasNegativeVertex(int edgeID);
+	bool isExternalEdge(int edgeIndex) const;
+	bool hasNegativeVertex(int edgeID) const;
 	int	 getCollinear(int pointIndex, int edgeID);
 
 	// PENDING. Move to set? point?
 	void sort();
 	int  getIndexLowest(bool (*f)(Point<TYPE> *, Point<TYPE> *));
 	int  getIndexHighest(bool (*f)(const Point<TYPE> *, const Point<TYPE> *));
-	enum Turn_T returnTurn(const Point<TYPE> *p, int sourcePoint, int destPoint);
+	enum Turn_T returnTurn(const Point<TYPE> *p, int sourcePoint, int destPoint) const;
 	double 		signedArea(int id1, int id2, int id3);
 
 	// Figures? PENDING. Move to another module?
-    bool getEdgeIntersection(Line &line, int face, queue<int> &qEdges);
-	bool 	findPath(vector<int> &vExtremeFaces, Line &line, vector<int> &vFacesId);
+    bool getEdgeIntersection(Line &line, int face, queue<int> &qEdges) const;
+	bool 	findPath(vector<int> &vExtremeFaces, Line &line, vector<int> &vFacesId) const;
 
 	bool isInsideFace(const Point<TYPE> &p, int faceId);
 
+    /**
+     * @fn                  walkToFace
+     * @brief               Locates the face that contains a point walking from a start face. The walk moves through
+     *                      any edge that leaves the point at its right and checks all faces if it does not finish in
+     *                      as many steps as faces. First edge checked changes every step so the walk does not cycle in
+     *                      non Delaunay triangulations
+     *
+     * @param point         (IN) Point to locate
+     * @param walkFace      (IN/OUT) Face where walk starts. Updated to the last interior face visited
+     * @param faceId        (OUT) Face that contains the point. External face if point is out of convex hull
+     * @return              true if face found
+     *                      false otherwise
+     */
+    bool walkToFace(const Point<TYPE> &point, int &walkFace, int &faceId) const;
+
     /**
      * @fn                  imaginaryFace
      * @brief               Checks if any of the vertex of the face is imaginary (only incremental algorithms)
@@ -59,7 +75,7 @@ public:
      * @param faceId        (IN) Face id to check
      * @return
      */
-    bool imaginaryFace(int faceId);
+    bool imaginaryFace(int faceId) const;
 
     /**
      * @fn              getPoints
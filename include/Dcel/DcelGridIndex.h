@@ -0,0 +1,124 @@
+#ifndef DELAUNAY_DCELGRIDINDEX_H
+#define DELAUNAY_DCELGRIDINDEX_H
+
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "Dcel.h"
+#include "defines.h"
+#include "MappedDcel.h"
+#include "Point.h"
+
+#include <vector>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+// Minimum number of vertices or grid rows processed by a thread when index is built.
+#define GRID_INDEX_MIN_ELEMENTS_THREAD          (16384)
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+/**
+ * Point location index of a built Dcel. Bounding box of the Dcel points is split in a uniform grid with roughly one
+ * vertex per cell (at most one cell per vertex along every side) and every cell stores a seed face close to the cell.
+ * A point is located walking from the seed face of its cell so the history graph is not needed. The index does not own
+ * the Dcel, which must outlive it. The Dcel is read through any Dcel accessor (see DcelQueries): DcelGridIndex indexes
+ * a Dcel and MappedDcelGridIndex indexes a mapped Dcel file without copying it.
+ */
+template <class M> class BasicDcelGridIndex
+{
+    /*******************************************************************************************************************
+    * Class members
+    *******************************************************************************************************************/
+    const M     *dcel;              // Indexed dcel.
+    Point<TYPE> minPoint;           // Grid bottom left corner.
+    TYPE        cellSize;           // Cells side length.
+    size_t      szNumColumns;       // # cells per row.
+    size_t      szNumRows;          // # rows.
+    vector<int> vSeeds;             // Seed face of every cell. Row major order.
+
+    /*******************************************************************************************************************
+    * Private methods declarations
+    *******************************************************************************************************************/
+    int  getRealFace(int pointIndex) const;
+    void fillEmptyCells(size_t szNumThreads);
+
+    friend class GridIndexReader;
+    friend class GridIndexWriter;
+
+public:
+    /*******************************************************************************************************************
+    * Public methods declarations
+    *******************************************************************************************************************/
+    BasicDcelGridIndex() : dcel(nullptr), cellSize(0.0), szNumColumns(0), szNumRows(0) {};
+
+    /**
+     * @fn                  build
+     * @brief               Builds the index of a Dcel that contains at least one triangle. Cells of the vertices are
+     *                      computed in parallel and empty cells take the seed of the closest non empty cell in their
+     *                      row (or the closest non empty row)
+     *
+     * @param dcelIn        (IN) Dcel to index
+     * @param szNumThreads  (IN) Number of threads. All available cores if zero
+     * @return              true if index built
+     *                      false otherwise
+     */
+    bool build(const M &dcelIn, size_t szNumThreads=0);
+
+    /**
+     * @fn                  attach
+     * @brief               Attaches a Dcel to an index read from file. Dcel must be the one the index was built from
+     *
+     * @param dcelIn        (IN) Indexed Dcel
+     * @return              true if all seeds are faces of the Dcel
+     *                      false otherwise
+     */
+    bool attach(const M &dcelIn);
+
+    /**
+     * @fn                  reset
+     * @brief               Removes index data and detaches Dcel
+     */
+    void reset();
+
+    /**
+     * @fn                  findFace
+     * @brief               Locates the face that contains a point walking from the seed face of its cell. Points
+     *                      out of the grid start at the closest border cell
+     *
+     * @param point         (IN) Point to locate
+     * @param faceId        (OUT) Face that contains the point. External face if point is out of convex hull
+     * @return              true if face found
+     *                      false otherwise
+     */
+    bool findFace(const Point<TYPE> &point, int &faceId) const;
+
+    /**
+     * @fn                  update
+     * @brief               Sets a new or modified face as seed of the cells of its vertices. Seeds of other cells are
+     *                      still valid walk starts so only changed faces must be updated
+     *
+     * @param faceId        (IN) Face whose vertices cells are updated
+     */
+    void update(int faceId);
+
+    /*******************************************************************************************************************
+    * Getters
+    *******************************************************************************************************************/
+    bool isBuilt() const { return !vSeeds.empty(); }
+    size_t getNumColumns() const { return szNumColumns; }
+    size_t getNumRows() const { return szNumRows; }
+    int getSeed(size_t szCell) const { return vSeeds.at(szCell); }
+    size_t getCell(const Point<TYPE> &point) const;
+};
+
+typedef BasicDcelGridIndex<Dcel>            DcelGridIndex;
+typedef BasicDcelGridIndex<MappedDcel>      MappedDcelGridIndex;
+
+#endif //DELAUNAY_DCELGRIDINDEX_H
@@ -8,6 +8,11 @@
 #include "Face.h"
 #include "Vertex.h"
 
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
 
 /***********************************************************************************************************************
 * Defines
@@ -17,6 +22,37 @@
 #define     FACE_MIN_NUM_POINTS   	(3)
 
 
+/***********************************************************************************************************************
+* Access policies
+***********************************************************************************************************************/
+/**
+ * Bounds checked access to dcel arrays. Throws std::out_of_range if index is not valid.
+ */
+struct DcelCheckedAccess
+{
+    template <class T> static inline T &get(vector<T> &v, size_t index) { return v.at(index); };
+    template <class T> static inline const T &get(const vector<T> &v, size_t index) { return v.at(index); };
+};
+
+/**
+ * Raw access to dcel arrays used in hot paths when no bounds checking is required.
+ */
+struct DcelUncheckedAccess
+{
+    template <class T> static inline T &get(vector<T> &v, size_t index) { return v[index]; };
+    template <class T> static inline const T &get(const vector<T> &v, size_t index) { return v[index]; };
+};
+
+// Bounds checking is enabled in debug and coverage builds and in the DelaunayChecked test target (see CMakeLists.txt).
+#ifdef DCEL_BOUNDS_CHECK
+typedef DcelCheckedAccess   DcelAccess;
+#else
+typedef DcelUncheckedAccess DcelAccess;
+#endif
+
+class EdgeRef;
+
+
 /***********************************************************************************************************************
 * Class declaration
 ***********************************************************************************************************************/
@@ -26,10 +62,23 @@ protected:
     /*******************************************************************************************************************
     * Class members
     *******************************************************************************************************************/
-    vector<Vertex>	vVertex;
-    vector<Edge> 	vEdges;
-    vector<Face> 	vFaces;
+    // Vertex data: point coordinates and edge departing from point.
+    vector<Point<TYPE>> vPoints;
+    vector<int>         vPointEdge;
+
+    // Edge data: one array per field.
+    vector<int>         vOrigin;
+    vector<int>         vTwin;
+    vector<int>         vPrevious;
+    vector<int>         vNext;
+    vector<int>         vEdgeFace;
 
+    // Face data.
+    vector<Face>        vFaces;
+
+    friend class CompressedReader;
+    friend class ContainerReader;
+    friend class ContainerWriter;
     friend class DcelWriter;
 
 public:
@@ -44,37 +93,48 @@ public:
             throw std::runtime_error(&"Minimum number of points to create a Dcel must be " [ FACE_MIN_NUM_POINTS]);
         }
 
-        for (auto point : v)
+        vPoints = v;
+        vPointEdge.assign(v.size(), INVALID);
+    };
+    explicit DcelModel(vector<Point<TYPE>> &&v)
+    {
+        if (v.size() < FACE_MIN_NUM_POINTS)
         {
-            Vertex vertex(INVALID, point);
-            vVertex.push_back(vertex);
+            throw std::runtime_error(&"Minimum number of points to create a Dcel must be " [ FACE_MIN_NUM_POINTS]);
         }
+
+        vPoints = std::move(v);
+        vPointEdge.assign(vPoints.size(), INVALID);
     };
     ~DcelModel() = default;
     DcelModel & operator=(const DcelModel &d) = default;
 
-    Point<TYPE> *getRefPoint(int index) { return this->vVertex.at(index).getRefPoint(); };
-    Edge *getRefEdge(int index) { return &this->vEdges.at(index); };
-    Face *getRefFace(int index) { return &this->vFaces.at(index); };
+    Point<TYPE> *getRefPoint(int index) { return &DcelAccess::get(this->vPoints, index); };
+    const Point<TYPE> *getRefPoint(int index) const { return &DcelAccess::get(this->vPoints, index); };
+    const vector<Point<TYPE>> &getRefPoints() const { return this->vPoints; };
+    inline EdgeRef getRefEdge(int index);
+    Face *getRefFace(int index) { return &DcelAccess::get(this->vFaces, index); };
 
-    size_t getNumVertex() const { return vVertex.size(); };
-    size_t getNumEdges()  const { return vEdges.size(); };
+    size_t getNumVertex() const { return vPoints.size(); };
+    size_t getNumEdges()  const { return vOrigin.size(); };
     size_t getNumFaces()  const { return vFaces.size(); };
 
     // Access to POINTS fields.
-    int getPointEdge(int pointIndex) {return(this->vVertex.at(pointIndex).getOrigin());};
+    int getPointEdge(int pointIndex) const {return(DcelAccess::get(this->vPointEdge, pointIndex));};
+    Vertex getVertex(int pointIndex) const;
 
     // Access to EDGES fields.
-    int getOrigin(int edgeIndex) {return(this->vEdges.at(edgeIndex).getOrigin());};
-    int getTwin(int edgeIndex) {return(this->vEdges.at(edgeIndex).getTwin());};
-    int getPrevious(int edgeIndex) {return(this->vEdges.at(edgeIndex).getPrevious());};
-    int getNext(int edgeIndex) {return(this->vEdges.at(edgeIndex).getNext());};
-    int getFace(int edgeIndex) {return(this->vEdges.at(edgeIndex).getFace());};
-    void setOrigin(int edgeIndex, int v) {this->vEdges.at(edgeIndex).setOrigin(v);};
-    void setTwin(int edgeIndex, int v) {this->vEdges.at(edgeIndex).setTwin(v);};
-    void setPrevious(int edgeIndex, int v) {this->vEdges.at(edgeIndex).setPrevious(v);};
-    void setNext(int edgeIndex, int v) {this->vEdges.at(edgeIndex).setNext(v);};
-    void setFace(int edgeIndex, int v) {this->vEdges.at(edgeIndex).setFace(v);};
+    int getOrigin(int edgeIndex) const {return(DcelAccess::get(this->vOrigin, edgeIndex));};
+    int getTwin(int edgeIndex) const {return(DcelAccess::get(this->vTwin, edgeIndex));};
+    int getPrevious(int edgeIndex) const {return(DcelAccess::get(this->vPrevious, edgeIndex));};
+    int getNext(int edgeIndex) const {return(DcelAccess::get(this->vNext, edgeIndex));};
+    int getFace(int edgeIndex) const {return(DcelAccess::get(this->vEdgeFace, edgeIndex));};
+    void setOrigin(int edgeIndex, int v) {DcelAccess::get(this->vOrigin, edgeIndex) = v;};
+    void setTwin(int edgeIndex, int v) {DcelAccess::get(this->vTwin, edgeIndex) = v;};
+    void setPrevious(int edgeIndex, int v) {DcelAccess::get(this->vPrevious, edgeIndex) = v;};
+    void setNext(int edgeIndex, int v) {DcelAccess::get(this->vNext, edgeIndex) = v;};
+    void setFace(int edgeIndex, int v) {DcelAccess::get(this->vEdgeFace, edgeIndex) = v;};
+    Edge getEdge(int edgeIndex) const;
 
     // Add / Delete functions.
     void addVertex(const Point<TYPE> *p, int edge);
@@ -98,11 +158,11 @@ public:
      * @param origin        (OUT) Origin edge point
      * @param dest          (OUT) Destination edge point
      */
-    void getEdgePoints(int edgeIndex, Point<TYPE> &origin, Point<TYPE> &dest);
+    void getEdgePoints(int edgeIndex, Point<TYPE> &origin, Point<TYPE> &dest) const;
 
     // Access to FACES fields.
-    int  getFaceEdge(int faceId) { return vFaces.at(faceId).getEdge();};
-    void setFaceEdge(int faceIndex, int v) { vFaces.at(faceIndex).setEdge(v);};
+    int  getFaceEdge(int faceId) const { return DcelAccess::get(vFaces, faceId).getEdge();};
+    void setFaceEdge(int faceIndex, int v) { DcelAccess::get(vFaces, faceIndex).setEdge(v);};
 
     /**
      * @fn                  getFaceVertices
@@ -111,7 +171,7 @@ public:
      * @param faceIndex     (IN) Face whose vertex id are returned
      * @param ids           (OUT) Face vertex
      */
-    void getFaceVertices(int faceIndex, int *ids);
+    void getFaceVertices(int faceIndex, int *ids) const;
 
     /**
      * @fn                  getFacePoints
@@ -133,10 +193,96 @@ public:
 
     /**
      * @fn              reset
-     * @brief           Resets dcel data
+     * @brief           Resets dcel data. Memory is kept so a new triangulation can be built without reallocations
      */
     void reset(bool isResetPoints = true);
+
+    /**
+     * @fn                  reserve
+     * @brief               Reserves memory so no reallocation is done while points, edges and faces are added
+     *
+     * @param szNumPoints   (IN) Number of points
+     * @param szNumEdges    (IN) Number of edges
+     * @param szNumFaces    (IN) Number of faces (including external face)
+     * @param isHugePages   (IN) Flag to advise the kernel to back edges arrays with huge pages
+     */
+    void reserve(size_t szNumPoints, size_t szNumEdges, size_t szNumFaces, bool isHugePages=false);
+
+    /**
+     * @fn                  reserveTriangulation
+     * @brief               Reserves memory for a triangulation of szNumVertex vertices. A triangulation of n vertices
+     *                      has at most 2n-5 triangles and 3n-6 edges so the dcel has at most 6n-12 edges and 2n-4
+     *                      faces (including external face). Points already stored are not changed.
+     *
+     * @param szNumVertex   (IN) Number of vertices (imaginary points included)
+     * @param isHugePages   (IN) Flag to advise the kernel to back edges arrays with huge pages
+     */
+    void reserveTriangulation(size_t szNumVertex, bool isHugePages=false);
+
+    /**
+     * @fn                  swapEdges
+     * @brief               Swaps edges and faces arrays with other dcel. Points are not changed. Lets a triangulation
+     *                      build its edges in memory supplied by the caller (see TriangulationArena)
+     *
+     * @param other         (IN/OUT) Dcel to swap edges and faces with
+     */
+    void swapEdges(DcelModel &other);
+
+    /**
+     * @fn                  resize
+     * @brief               Resizes edges and faces arrays so they can be set by index from different threads. New
+     *                      edges and faces fields are invalid. Points are not changed.
+     *
+     * @param szNumEdges    (IN) Number of edges
+     * @param szNumFaces    (IN) Number of faces (including external face)
+     */
+    void resize(size_t szNumEdges, size_t szNumFaces);
+
+    size_t getEdgesCapacity() const { return vOrigin.capacity(); };
+    size_t getFacesCapacity() const { return vFaces.capacity(); };
+};
+
+
+
+
+/***********************************************************************************************************************
+* Edge reference declaration
+***********************************************************************************************************************/
+/**
+ * Handle to an edge stored in a DcelModel. Gives the same interface than Edge so code that used Edge pointers keeps
+ * working with the struct of arrays storage.
+ */
+class EdgeRef
+{
+    DcelModel   *dcel;
+    int         index;
+
+public:
+    EdgeRef() : dcel(nullptr), index(INVALID) {};
+    EdgeRef(DcelModel *dcelIn, int indexIn) : dcel(dcelIn), index(indexIn) {};
+
+    inline int getOrigin() const { return dcel->getOrigin(index); };
+    inline int getTwin() const { return dcel->getTwin(index); };
+    inline int getPrevious() const { return dcel->getPrevious(index); };
+    inline int getNext() const { return dcel->getNext(index); };
+    inline int getFace() const { return dcel->getFace(index); };
+
+    inline void setOrigin(int value) { dcel->setOrigin(index, value); };
+    inline void setTwin(int value) { dcel->setTwin(index, value); };
+    inline void setPrevious(int value) { dcel->setPrevious(index, value); };
+    inline void setNext(int value) { dcel->setNext(index, value); };
+    inline void setFace(int value) { dcel->setFace(index, value); };
+
+    string toStr() const { return dcel->getEdge(index).toStr(); };
+
+    // Allows pointer like syntax used with Edge pointers.
+    EdgeRef *operator->() { return this; };
 };
 
 
+EdgeRef DcelModel::getRefEdge(int index)
+{
+    return EdgeRef(this, index);
+}
+
 #endif //DELAUNAY_DCELMODEL_H
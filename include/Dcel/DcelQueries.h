@@ -0,0 +1,538 @@
+#ifndef DELAUNAY_DCELQUERIES_H
+#define DELAUNAY_DCELQUERIES_H
+
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "DcelModel.h"
+#include "defines.h"
+#include "Point.h"
+#include "Predicates.h"
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Types definition
+***********************************************************************************************************************/
+/**
+ * Caller owned data used by neighbourhood expansions (see DcelQueries::expandClosest). Every thread uses its own
+ * context so a triangulation can be queried from many threads at the same time.
+ */
+struct ExpansionContext
+{
+    vector<pair<TYPE,int>> vCandidates;     // Neighbourhood expansion heap (distance, point index).
+    vector<unsigned int> vVisited;          // Expansion stamp of every point already pushed to heap.
+    unsigned int stamp;                     // Current expansion stamp.
+
+    ExpansionContext() : stamp(0) {};
+};
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+/**
+ * Read only queries over any Dcel accessor (Dcel, MappedDcel or TriangleMeshView) so they run on mapped files and
+ * triangle meshes without building a Dcel. The accessor must provide getNumVertex, getNumEdges, getNumFaces,
+ * getRefPoint, getPointEdge, getOrigin, getTwin, getPrevious, getNext, getFace and getFaceEdge with the same ids and
+ * indexes than DcelModel. History graph queries read any graph accessor (Graph or MappedGraph) that provides isLeaf,
+ * getNChildren, getiChild, getVertices and getFace.
+ */
+class DcelQueries
+{
+public:
+    /*******************************************************************************************************************
+    * Public class methods
+    *******************************************************************************************************************/
+    /**
+     * @fn          imaginaryFace
+     * @brief       Checks if the face is the external face or any of its vertex is imaginary (only incremental
+     *              algorithms)
+     *
+     * @param dcel      (IN) Triangulation
+     * @param faceId    (IN) Face id to check
+     * @return          true if face is external or imaginary
+     *                  false otherwise
+     */
+    template <class M> static bool imaginaryFace(const M &dcel, int faceId)
+    {
+        int edgeIndex = dcel.getFaceEdge(faceId) - 1;
+        return (faceId == EXTERNAL_FACE) ||
+               (dcel.getOrigin(edgeIndex) < 0) ||
+               (dcel.getOrigin(dcel.getNext(edgeIndex)-1) < 0) ||
+               (dcel.getOrigin(dcel.getPrevious(edgeIndex)-1) < 0);
+    }
+
+    /**
+     * @fn              isExternalEdge
+     * @brief           Checks if the edge or its twin belong to the external face
+     *
+     * @param dcel      (IN) Triangulation
+     * @param edgeIndex (IN) Edge index
+     * @return          true if edge is in the convex hull
+     *                  false otherwise
+     */
+    template <class M> static bool isExternalEdge(const M &dcel, int edgeIndex)
+    {
+        return (dcel.getFace(edgeIndex) == EXTERNAL_FACE) ||
+               (dcel.getFace(dcel.getTwin(edgeIndex) - 1) == EXTERNAL_FACE);
+    }
+
+    /**
+     * @fn              hasNegativeVertex
+     * @brief           Checks if any extreme of the edge is an imaginary point
+     *
+     * @param dcel      (IN) Triangulation
+     * @param edgeId    (IN) Edge id
+     * @return          true if origin or destination is imaginary
+     *                  false otherwise
+     */
+    template <class M> static bool hasNegativeVertex(const M &dcel, int edgeId)
+    {
+        return (dcel.getOrigin(edgeId - 1) < 0) || (dcel.getOrigin(dcel.getNext(edgeId - 1) - 1) < 0);
+    }
+
+    /**
+     * @fn              getFaceVertices
+     * @brief           Gets the vertices ids of a triangle
+     *
+     * @param dcel      (IN) Triangulation
+     * @param faceId    (IN) Face id
+     * @param ids       (OUT) NPOINTS_TRIANGLE vertices ids
+     */
+    template <class M> static void getFaceVertices(const M &dcel, int faceId, int *ids)
+    {
+        int edgeIndex = dcel.getFaceEdge(faceId) - 1;
+        ids[0] = dcel.getOrigin(edgeIndex);
+        ids[1] = dcel.getOrigin(dcel.getNext(edgeIndex)-1);
+        ids[2] = dcel.getOrigin(dcel.getPrevious(edgeIndex)-1);
+    }
+
+    /**
+     * @fn                  getEdgePoints
+     * @brief               Gets the origin and destination points of an edge with real extremes
+     *
+     * @param dcel          (IN) Triangulation
+     * @param edgeIndex     (IN) Edge index
+     * @param originPoint   (OUT) Origin point
+     * @param destPoint     (OUT) Destination point
+     */
+    template <class M> static void getEdgePoints(const M &dcel, int edgeIndex, Point<TYPE> &originPoint,
+                                                 Point<TYPE> &destPoint)
+    {
+        originPoint = *dcel.getRefPoint(dcel.getOrigin(edgeIndex)-1);
+        destPoint = *dcel.getRefPoint(dcel.getOrigin(dcel.getTwin(edgeIndex)-1)-1);
+    }
+
+    /**
+     * @fn                  returnTurn
+     * @brief               Computes the turn of a point with respect to the segment between two vertices. Imaginary
+     *                      points P_MINUS_1 and P_MINUS_2 are placed as incremental algorithms do, so vertex 1 must be
+     *                      the highest point if the triangulation has imaginary points
+     *
+     * @param dcel          (IN) Triangulation
+     * @param p             (IN) Point to check
+     * @param sourcePoint   (IN) Segment origin vertex id
+     * @param destPoint     (IN) Segment destination vertex id
+     * @return              turn of p
+     */
+    template <class M> static enum Turn_T returnTurn(const M &dcel, const Point<TYPE> *p, int sourcePoint,
+                                                     int destPoint);
+
+    /**
+     * @fn                  walkToFace
+     * @brief               Locates the face that contains a point walking from a start face. The walk moves through
+     *                      any edge that leaves the point at its right and checks all faces if it does not finish in
+     *                      as many steps as faces. First edge checked changes every step so the walk does not cycle in
+     *                      non Delaunay triangulations
+     *
+     * @param dcel          (IN) Triangulation
+     * @param point         (IN) Point to locate
+     * @param walkFace      (IN/OUT) Face where walk starts. Updated to the last interior face visited
+     * @param faceId        (OUT) Face that contains the point. External face if point is out of convex hull
+     * @return              true if face found
+     *                      false otherwise
+     */
+    template <class M> static bool walkToFace(const M &dcel, const Point<TYPE> &point, int &walkFace, int &faceId);
+
+    /**
+     * @fn                  locateNode
+     * @brief               Locates the leaf node of an incremental Delaunay history graph that contains a point
+     *
+     * @param graph         (IN) History graph of the triangulation
+     * @param dcel          (IN) Triangulation
+     * @param point         (IN) Point to locate
+     * @param nodeIndex     (OUT) Leaf node that contains the point
+     * @return              true if node found
+     *                      false if point is not interior to any child of a node
+     */
+    template <class G, class M> static bool locateNode(const G &graph, const M &dcel, const Point<TYPE> &point,
+                                                       int &nodeIndex);
+
+    /**
+     * @fn                  locateFace
+     * @brief               Locates the face that contains a point using the history graph. Imaginary faces are
+     *                      returned as the external face
+     *
+     * @param graph         (IN) History graph of the triangulation
+     * @param dcel          (IN) Triangulation
+     * @param point         (IN) Point to locate
+     * @param faceId        (OUT) Face that contains the point
+     * @return              true if face found
+     *                      false otherwise
+     */
+    template <class G, class M> static bool locateFace(const G &graph, const M &dcel, const Point<TYPE> &point,
+                                                       int &faceId);
+
+    /**
+     * @fn                  findClosestPoint
+     * @brief               Finds the closest point starting at the closest real vertex of the face that contains the
+     *                      point and moving to the closest neighbour while it is closer than current point
+     *
+     * @param dcel          (IN) Triangulation
+     * @param in            (IN) Point whose closest point is returned
+     * @param ids           (IN) NPOINTS_TRIANGLE vertices ids of the face that contains the point
+     * @param pointIndex    (OUT) Dcel index of the closest point
+     * @return              true if closest point found
+     *                      false if the face has no real vertex
+     */
+    template <class M> static bool findClosestPoint(const M &dcel, const Point<TYPE> &in, const int *ids,
+                                                    int &pointIndex);
+
+    /**
+     * @fn                  expandClosest
+     * @brief               Expands Delaunay neighbours from the closest point in distance order using a min heap. Every
+     *                      popped point is the next closest point because it is a neighbour of one of the points
+     *                      already popped. Points pushed to the heap are marked with the context stamp so marks are
+     *                      not cleared between queries
+     *
+     * @param dcel          (IN) Triangulation
+     * @param in            (IN) Query point
+     * @param pointIndex    (IN) Dcel index of the closest point
+     * @param szMaxPoints   (IN) Maximum number of output points
+     * @param radius        (IN) Maximum distance of output points
+     * @param vPointsIndex  (OUT) Dcel index of points sorted by distance
+     * @param context       (IN/OUT) Thread expansion context
+     */
+    template <class M> static void expandClosest(const M &dcel, const Point<TYPE> &in, int pointIndex,
+                                                 size_t szMaxPoints, TYPE radius, vector<int> &vPointsIndex,
+                                                 ExpansionContext &context);
+};
+
+
+/***********************************************************************************************************************
+* Template methods definitions
+***********************************************************************************************************************/
+template <class M> enum Turn_T DcelQueries::returnTurn(const M &dcel, const Point<TYPE> *p, int sourcePoint,
+                                                        int destPoint)
+{
+    enum Turn_T turn;         // Return value.
+
+    // Normal source point.
+    if (sourcePoint > 0)
+    {
+        // Normal destination point.
+        if (destPoint > 0)
+        {
+            // If turn right then point is not in triangle.
+            turn = Predicates::turn(*dcel.getRefPoint(sourcePoint-1), *dcel.getRefPoint(destPoint-1), *p);
+        }
+        // Destination point is P-2.
+        else if (destPoint == P_MINUS_2)
+        {
+            if (sourcePoint == 1)
+            {
+                turn = LEFT_TURN;
+            }
+            // Check if point is over line from source_Index point to P-2.
+            else if (Point<TYPE>::higher_Point(p, dcel.getRefPoint(sourcePoint-1), &Point<TYPE>::lexicographicHigher))
+            {
+                turn = RIGHT_TURN;
+            }
+            else
+            {
+                turn = LEFT_TURN;
+            }
+        }
+        // Destination point is P-1.
+        else
+        {
+            // Check if point is over line from source_Index point to P-1.
+            if (Point<TYPE>::higher_Point(p, dcel.getRefPoint(sourcePoint-1), &Point<TYPE>::lexicographicHigher))
+            {
+                turn = LEFT_TURN;
+            }
+            else
+            {
+                turn = RIGHT_TURN;
+            }
+        }
+    }
+    else
+    {
+        // Source point is P-1 and destination cannot be p-2.
+        if (sourcePoint == P_MINUS_1)
+        {
+            if (destPoint == 1)
+            {
+                turn = LEFT_TURN;
+            }
+            // Check if point is over line from P-1 point to dest_Index point.
+            else if (Point<TYPE>::higher_Point(p, dcel.getRefPoint(destPoint-1), &Point<TYPE>::lexicographicHigher))
+            {
+                turn = RIGHT_TURN;
+            }
+            else
+            {
+                turn = LEFT_TURN;
+            }
+        }
+        // Source point is P-2.
+        else
+        {
+            // Check destination point.
+            if (destPoint != P_MINUS_1)
+            {
+                if (Point<TYPE>::higher_Point(p, dcel.getRefPoint(destPoint-1), &Point<TYPE>::lexicographicHigher))
+                {
+                    turn = LEFT_TURN;
+                }
+                else
+                {
+                    turn = RIGHT_TURN;
+                }
+            }
+            else
+            {
+                // Points can only do a left turn.
+                turn = LEFT_TURN;
+            }
+        }
+    }
+
+    return turn;
+}
+
+
+template <class M> bool DcelQueries::walkToFace(const M &dcel, const Point<TYPE> &point, int &walkFace, int &faceId)
+{
+    size_t szNumFaces = dcel.getNumFaces();
+    if (szNumFaces <= 1)
+    {
+        return false;
+    }
+
+    int current = ((walkFace > EXTERNAL_FACE) && (walkFace < (int) szNumFaces)) ? walkFace : 1;
+    for (size_t szStep=0; szStep<szNumFaces ; szStep++)
+    {
+        // First edge checked changes every step so the walk does not cycle in non Delaunay triangulations
+        int edgeIndex = dcel.getFaceEdge(current) - 1;
+        for (size_t i=0; i<(szStep % NPOINTS_TRIANGLE) ;i++)
+        {
+            edgeIndex = dcel.getNext(edgeIndex) - 1;
+        }
+
+        int nextFace = current;
+        for (size_t i=0; (i<NPOINTS_TRIANGLE) && (nextFace == current) ;i++)
+        {
+            int origin = dcel.getOrigin(edgeIndex);
+            int dest = dcel.getOrigin(dcel.getNext(edgeIndex) - 1);
+            if (DcelQueries::returnTurn(dcel, &point, origin, dest) == RIGHT_TURN)
+            {
+                nextFace = dcel.getFace(dcel.getTwin(edgeIndex) - 1);
+            }
+            edgeIndex = dcel.getNext(edgeIndex) - 1;
+        }
+
+        // Point is interior to current face or at the right of a convex hull edge
+        if ((nextFace == current) || (nextFace == EXTERNAL_FACE))
+        {
+            walkFace = current;
+            faceId = nextFace;
+            return true;
+        }
+        current = nextFace;
+    }
+
+    // Walk failed -> check all faces.
+    for (faceId=1; faceId<(int) szNumFaces ; faceId++)
+    {
+        int ids[NPOINTS_TRIANGLE];
+        DcelQueries::getFaceVertices(dcel, faceId, ids);
+        if ((DcelQueries::returnTurn(dcel, &point, ids[0], ids[1]) != RIGHT_TURN) &&
+            (DcelQueries::returnTurn(dcel, &point, ids[1], ids[2]) != RIGHT_TURN) &&
+            (DcelQueries::returnTurn(dcel, &point, ids[2], ids[0]) != RIGHT_TURN))
+        {
+            walkFace = faceId;
+            return true;
+        }
+    }
+
+    // Point is not interior to any face
+    faceId = EXTERNAL_FACE;
+    return true;
+}
+
+
+template <class G, class M> bool DcelQueries::locateNode(const G &graph, const M &dcel, const Point<TYPE> &point,
+                                                         int &nodeIndex)
+{
+    // Move to the child that contains the point until a leaf is reached
+    nodeIndex = 0;
+    while (!graph.isLeaf(nodeIndex))
+    {
+        int child = INVALID;
+        for (int i=0; (i<graph.getNChildren(nodeIndex)) && (child == INVALID) ;i++)
+        {
+            int ids[NPOINTS_TRIANGLE];
+            graph.getVertices(graph.getiChild(nodeIndex, i), ids[0], ids[1], ids[2]);
+            if ((DcelQueries::returnTurn(dcel, &point, ids[0], ids[1]) != RIGHT_TURN) &&
+                (DcelQueries::returnTurn(dcel, &point, ids[1], ids[2]) != RIGHT_TURN) &&
+                (DcelQueries::returnTurn(dcel, &point, ids[2], ids[0]) != RIGHT_TURN))
+            {
+                child = graph.getiChild(nodeIndex, i);
+            }
+        }
+
+        if (child == INVALID)
+        {
+            return false;
+        }
+        nodeIndex = child;
+    }
+
+    return true;
+}
+
+
+template <class G, class M> bool DcelQueries::locateFace(const G &graph, const M &dcel, const Point<TYPE> &point,
+                                                         int &faceId)
+{
+    int nodeIndex=0;
+    if (!DcelQueries::locateNode(graph, dcel, point, nodeIndex))
+    {
+        return false;
+    }
+
+    faceId = graph.getFace(nodeIndex);
+    if (DcelQueries::imaginaryFace(dcel, faceId))
+    {
+        faceId = EXTERNAL_FACE;
+    }
+
+    return true;
+}
+
+
+template <class M> bool DcelQueries::findClosestPoint(const M &dcel, const Point<TYPE> &in, const int *ids,
+                                                      int &pointIndex)
+{
+    // Start at the closest real point of the face (imaginary points ids are negative).
+    pointIndex = INVALID;
+    TYPE lowestDistance = 0.0;
+    for (size_t i=0; i<NPOINTS_TRIANGLE ;i++)
+    {
+        if (ids[i] > 0)
+        {
+            TYPE distance = in.distance(*dcel.getRefPoint(ids[i]-1));
+            if ((pointIndex == INVALID) || (distance < lowestDistance))
+            {
+                lowestDistance = distance;
+                pointIndex = ids[i]-1;
+            }
+        }
+    }
+
+    if (pointIndex == INVALID)
+    {
+        return false;
+    }
+
+    // Move to the closest neighbour while it is closer than current point.
+    bool isMoved=true;
+    while (isMoved)
+    {
+        isMoved = false;
+
+        int iCurrentPoint = pointIndex;
+        int iFirstEdgeIdx = dcel.getPointEdge(iCurrentPoint) - 1;
+        int iEdgeIdx = iFirstEdgeIdx;
+        do
+        {
+            int destId = dcel.getOrigin(dcel.getTwin(iEdgeIdx)-1);
+            if (destId > 0)
+            {
+                TYPE distance = in.distance(*dcel.getRefPoint(destId-1));
+                if (distance < lowestDistance)
+                {
+                    lowestDistance = distance;
+                    pointIndex = destId-1;
+                    isMoved = true;
+                }
+            }
+
+            // Get next edge departing from current point
+            iEdgeIdx = dcel.getTwin(dcel.getPrevious(iEdgeIdx)-1) - 1;
+        } while (iEdgeIdx != iFirstEdgeIdx);
+    }
+
+    return true;
+}
+
+
+template <class M> void DcelQueries::expandClosest(const M &dcel, const Point<TYPE> &in, int pointIndex,
+                                                   size_t szMaxPoints, TYPE radius, vector<int> &vPointsIndex,
+                                                   ExpansionContext &context)
+{
+    // New stamp. Reset marks if triangulation changed or stamp overflows.
+    vPointsIndex.clear();
+    size_t szNumVertex = dcel.getNumVertex();
+    context.stamp++;
+    if ((context.vVisited.size() != szNumVertex) || (context.stamp == 0))
+    {
+        context.vVisited.assign(szNumVertex, 0);
+        context.stamp = 1;
+    }
+
+    auto &vHeap = context.vCandidates;
+    auto isFurther = std::greater<pair<TYPE,int>>();
+    vHeap.clear();
+    vHeap.emplace_back(in.distance(*dcel.getRefPoint(pointIndex)), pointIndex);
+    context.vVisited[pointIndex] = context.stamp;
+    while (!vHeap.empty() && (vPointsIndex.size() < szMaxPoints))
+    {
+        std::pop_heap(vHeap.begin(), vHeap.end(), isFurther);
+        pair<TYPE,int> candidate = vHeap.back();
+        vHeap.pop_back();
+        if (candidate.first > radius)
+        {
+            break;
+        }
+        vPointsIndex.push_back(candidate.second);
+
+        // Push real neighbours not pushed yet.
+        int iFirstEdgeIdx = dcel.getPointEdge(candidate.second) - 1;
+        int iEdgeIdx = iFirstEdgeIdx;
+        do
+        {
+            int destId = dcel.getOrigin(dcel.getTwin(iEdgeIdx)-1);
+            if ((destId > 0) && (context.vVisited[destId-1] != context.stamp))
+            {
+                context.vVisited[destId-1] = context.stamp;
+                vHeap.emplace_back(in.distance(*dcel.getRefPoint(destId-1)), destId-1);
+                std::push_heap(vHeap.begin(), vHeap.end(), isFurther);
+            }
+
+            // Get next edge departing from current point
+            iEdgeIdx = dcel.getTwin(dcel.getPrevious(iEdgeIdx)-1) - 1;
+        } while (iEdgeIdx != iFirstEdgeIdx);
+    }
+}
+
+#endif //DELAUNAY_DCELQUERIES_H
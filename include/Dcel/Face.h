@@ -35,7 +35,7 @@ public:
 
 	// Get / Set.
 	inline void setEdge(int value) { this->edge = value; };
-	inline int 	getEdge() { return(this->edge); };
+	inline int 	getEdge() const { return(this->edge); };
 
 	// Operators.
 	Face& operator=(Face other)
@@ -0,0 +1,137 @@
+#ifndef DELAUNAY_MAPPEDDCEL_H
+#define DELAUNAY_MAPPEDDCEL_H
+
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "Dcel.h"
+#include "defines.h"
+#include "MappedFile.h"
+#include "Point.h"
+
+#include <string>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+#define MAPPED_DCEL_MAGIC               "DCELMAP"
+
+
+/***********************************************************************************************************************
+* Types declaration
+***********************************************************************************************************************/
+// Arrays stored in a mapped Dcel file. Same arrays as DcelModel.
+enum MappedDcelSection_T
+{
+    MAPPED_DCEL_POINTS,
+    MAPPED_DCEL_POINT_EDGE,
+    MAPPED_DCEL_ORIGIN,
+    MAPPED_DCEL_TWIN,
+    MAPPED_DCEL_PREVIOUS,
+    MAPPED_DCEL_NEXT,
+    MAPPED_DCEL_EDGE_FACE,
+    MAPPED_DCEL_FACES,
+    MAPPED_DCEL_NUM_SECTIONS
+};
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+/**
+ * Read only Dcel whose arrays point into a memory mapped file written by DcelWriter::writeMapped. Opening the file
+ * only validates its header so pages are loaded by the kernel when they are first accessed. Getters have the same
+ * names and indexes than DcelModel ones so DcelQueries, MappedDcelGridIndex and MappedVoronoiView read the file in
+ * place. Algorithms that modify a Dcel get a copy using toDcel.
+ */
+class MappedDcel
+{
+    /*******************************************************************************************************************
+    * Class members
+    *******************************************************************************************************************/
+    MappedFile          file;
+    const Point<TYPE>   *points;
+    const int           *pointEdge;
+    const int           *origin;
+    const int           *twin;
+    const int           *previous;
+    const int           *next;
+    const int           *edgeFace;
+    const int           *faces;
+    size_t              szNumVertex;
+    size_t              szNumEdges;
+    size_t              szNumFaces;
+
+public:
+    /*******************************************************************************************************************
+    * Public methods declarations
+    *******************************************************************************************************************/
+    MappedDcel() { this->close(); };
+
+    /**
+     * @fn                  open
+     * @brief               Maps a Dcel file and checks its layout
+     *
+     * @param strFileName   (IN) File name
+     * @return              true if file mapped and valid
+     *                      false otherwise
+     */
+    bool open(const string &strFileName);
+
+    /**
+     * @fn      close
+     * @brief   Releases the mapping
+     */
+    void close();
+
+    /**
+     * @fn          toDcel
+     * @brief       Copies mapped data to a Dcel
+     *
+     * @param dcel  (OUT) Dcel to update
+     * @return      true if data copied
+     *              false if file is not mapped
+     */
+    bool toDcel(Dcel &dcel) const;
+
+    /**
+     * @fn                  getFaceVertices
+     * @brief               Gets the vertices ids of a face
+     *
+     * @param faceIndex     (IN) Face index
+     * @param ids           (OUT) NPOINTS_TRIANGLE vertices ids
+     */
+    void getFaceVertices(int faceIndex, int *ids) const;
+
+    /**
+     * @fn                  getEdgePoints
+     * @brief               Gets the origin and destination points of an edge
+     *
+     * @param edgeIndex     (IN) Edge index
+     * @param originPoint   (OUT) Origin point
+     * @param destPoint     (OUT) Destination point
+     */
+    void getEdgePoints(int edgeIndex, Point<TYPE> &originPoint, Point<TYPE> &destPoint) const;
+
+    /*******************************************************************************************************************
+    * Getters/Setters
+    *******************************************************************************************************************/
+    bool isOpen() const { return this->file.isOpen(); };
+    size_t getNumVertex() const { return this->szNumVertex; };
+    size_t getNumEdges() const { return this->szNumEdges; };
+    size_t getNumFaces() const { return this->szNumFaces; };
+
+    const Point<TYPE> *getRefPoint(int index) const { return &this->points[index]; };
+    int getPointEdge(int pointIndex) const { return this->pointEdge[pointIndex]; };
+    int getOrigin(int edgeIndex) const { return this->origin[edgeIndex]; };
+    int getTwin(int edgeIndex) const { return this->twin[edgeIndex]; };
+    int getPrevious(int edgeIndex) const { return this->previous[edgeIndex]; };
+    int getNext(int edgeIndex) const { return this->next[edgeIndex]; };
+    int getFace(int edgeIndex) const { return this->edgeFace[edgeIndex]; };
+    int getFaceEdge(int faceId) const { return this->faces[faceId]; };
+};
+
+#endif //DELAUNAY_MAPPEDDCEL_H
@@ -0,0 +1,142 @@
+#ifndef DELAUNAY_TRIANGLEMESH_H
+#define DELAUNAY_TRIANGLEMESH_H
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "defines.h"
+#include "Dcel.h"
+#include "Point.h"
+
+#include <vector>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+// Twin value of edges in the convex hull (their twin is in the external face).
+#define NO_TWIN                 (INVALID)
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+/**
+ * Compact half-edge representation of a triangulation. The three edges of every triangle are stored consecutively so
+ * only the origin vertex and twin edge are stored per edge. Next, previous and face are computed from the edge index.
+ * Edges and faces ids are 1-based as in Dcel: edge id e belongs to face (e-1)/3 + 1 and face 0 is the external face,
+ * which is not stored. Meshes built keeping the imaginary faces of an incremental triangulation store the imaginary
+ * points as negative corners (see TriangleMeshView to read the mesh as a Dcel).
+ */
+class TriangleMesh
+{
+    /*******************************************************************************************************************
+    * Class members
+    *******************************************************************************************************************/
+    vector<Point<TYPE>> vPoints;    // Set of points.
+    vector<int>         vCorners;   // Origin point id of every edge.
+    vector<int>         vTwins;     // Twin edge id of every edge (NO_TWIN in convex hull edges).
+
+    friend class CompressedWriter;
+
+public:
+    /*******************************************************************************************************************
+    * Public methods
+    *******************************************************************************************************************/
+    TriangleMesh() = default;
+    explicit TriangleMesh(Dcel &dcel, bool isImaginaryKept=false) { fromDcel(dcel, isImaginaryKept); };
+    ~TriangleMesh() = default;
+
+    /**
+     * @fn      fromDcel
+     * @brief   Builds the mesh from the triangles in the dcel. The external face is not included so edges that are
+     *          twin of its edges are stored as convex hull edges. Faces with imaginary points are also skipped unless
+     *          they are kept: then mesh faces have the same ids than dcel faces (needed by Voronoi, see
+     *          TriangleMeshView)
+     *
+     * @param   dcel            (IN) Triangulation dcel
+     * @param   isImaginaryKept (IN) Keep faces with imaginary points
+     */
+    void fromDcel(Dcel &dcel, bool isImaginaryKept=false);
+
+    /**
+     * @fn      toDcel
+     * @brief   Builds a dcel with the mesh triangles. Convex hull edges twins are created in the external face.
+     *
+     * @param   dcel    (OUT) Triangulation dcel
+     * @return  true if dcel built
+     *          false if convex hull is not a simple polygon
+     */
+    bool toDcel(Dcel &dcel) const;
+
+    /**
+     * @fn      set
+     * @brief   Replaces the mesh points and triangles. Input vectors content is moved into the mesh
+     *
+     * @param   vPointsIn   (IN/OUT)    Set of points
+     * @param   vCornersIn  (IN/OUT)    Origin point id of every edge. Triangles must be counterclockwise
+     * @param   vTwinsIn    (IN/OUT)    Twin edge id of every edge (NO_TWIN in convex hull edges)
+     */
+    void set(vector<Point<TYPE>> &vPointsIn, vector<int> &vCornersIn, vector<int> &vTwinsIn);
+
+    /**
+     * @fn      reset
+     * @brief   Removes points and triangles
+     */
+    void reset();
+
+    /**
+     * @fn      hasImaginaryFaces
+     * @brief   Checks if any triangle has an imaginary point (see fromDcel)
+     *
+     * @return  true if any corner is an imaginary point
+     *          false otherwise
+     */
+    bool hasImaginaryFaces() const;
+
+    /*******************************************************************************************************************
+    * Getters/Setters
+    *******************************************************************************************************************/
+    size_t getNumVertex() const { return vPoints.size(); };
+    size_t getNumEdges() const { return vCorners.size(); };
+    size_t getNumFaces() const { return vCorners.size() / NPOINTS_TRIANGLE + 1; };
+
+    Point<TYPE> *getRefPoint(int index) { return &this->vPoints.at(index); };
+    const Point<TYPE> *getRefPoint(int index) const { return &this->vPoints.at(index); };
+
+    // Edges fields access (edge index is 0-based as in Dcel).
+    int getOrigin(int edgeIndex) const { return this->vCorners.at(edgeIndex); };
+    int getTwin(int edgeIndex) const { return this->vTwins.at(edgeIndex); };
+    static int getNext(int edgeIndex)
+    {
+        return (edgeIndex % NPOINTS_TRIANGLE == NPOINTS_TRIANGLE-1) ? edgeIndex - 1 : edgeIndex + 2;
+    };
+    static int getPrevious(int edgeIndex)
+    {
+        return (edgeIndex % NPOINTS_TRIANGLE == 0) ? edgeIndex + NPOINTS_TRIANGLE : edgeIndex;
+    };
+    static int getFace(int edgeIndex) { return edgeIndex / NPOINTS_TRIANGLE + 1; };
+    static int getFaceEdge(int faceId) { return (faceId - 1)*NPOINTS_TRIANGLE + 1; };
+    bool isExternalEdge(int edgeIndex) const { return this->getTwin(edgeIndex) == NO_TWIN; };
+
+    /**
+     * @fn      getFaceVertices
+     * @brief   Gets the points ids of a face
+     *
+     * @param   faceId  (IN)    Face id
+     * @param   ids     (OUT)   Face points ids
+     */
+    void getFaceVertices(int faceId, int *ids) const;
+
+    /**
+     * @fn      getFacePoints
+     * @brief   Gets the points coordinates of a face. Face must not have imaginary points
+     *
+     * @param   faceId      (IN)    Face id
+     * @param   vFacePoints (OUT)   Face points
+     */
+    void getFacePoints(int faceId, vector<Point<TYPE>> &vFacePoints) const;
+};
+
+#endif //DELAUNAY_TRIANGLEMESH_H
@@ -0,0 +1,111 @@
+#ifndef DELAUNAY_TRIANGLEMESHVIEW_H
+#define DELAUNAY_TRIANGLEMESHVIEW_H
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "defines.h"
+#include "DcelModel.h"
+#include "Point.h"
+#include "TriangleMesh.h"
+
+#include <vector>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+/**
+ * Read only Dcel view of a triangle mesh. Getters have the same names, ids and indexes than DcelModel ones and return
+ * the Dcel that TriangleMesh::toDcel builds: mesh edges are followed by the external face edges, which are twins of
+ * the convex hull edges in mesh edge order. Only the point edges and the external face edges are stored, so Dcel
+ * consumers (see DcelQueries) read the mesh without copying its triangles. The mesh must outlive the view.
+ */
+class TriangleMeshView
+{
+    /*******************************************************************************************************************
+    * Class members
+    *******************************************************************************************************************/
+    const TriangleMesh  *mesh;
+    int                 numMeshEdges;   // # edges stored in the mesh.
+    int                 firstHullEdge;  // External face edge id.
+    vector<int>         vPointEdge;     // First edge id that departs from every point (INVALID if none).
+    vector<int>         vHullEdge;      // External face edge id that departs from every point (see getSlot).
+    vector<int>         vHullTwin;      // Convex hull edge id that is twin of every external face edge.
+    vector<int>         vHullPrevious;  // Previous edge id of every external face edge.
+    vector<int>         vHullNext;      // Next edge id of every external face edge.
+
+    /*******************************************************************************************************************
+    * Private methods
+    *******************************************************************************************************************/
+    // Imaginary points P_MINUS_1 and P_MINUS_2 use the two slots after the real points.
+    size_t getSlot(int pointId) const
+    {
+        return (pointId > 0) ? (size_t) (pointId - 1) : this->vPointEdge.size() - pointId - 1;
+    };
+
+public:
+    /*******************************************************************************************************************
+    * Public methods
+    *******************************************************************************************************************/
+    explicit TriangleMeshView(const TriangleMesh &meshIn) : mesh(&meshIn), numMeshEdges(0), firstHullEdge(INVALID) {};
+
+    /**
+     * @fn      build
+     * @brief   Computes the point edges and links the external face edges. Must be called again if mesh changes
+     *
+     * @return  true if view built
+     *          false if a corner is not a point id or convex hull is not a simple polygon
+     */
+    bool build();
+
+    /*******************************************************************************************************************
+    * Getters
+    *******************************************************************************************************************/
+    size_t getNumVertex() const { return this->mesh->getNumVertex(); };
+    size_t getNumEdges() const { return this->numMeshEdges + this->vHullTwin.size(); };
+    size_t getNumFaces() const { return this->mesh->getNumFaces(); };
+
+    const Point<TYPE> *getRefPoint(int index) const { return this->mesh->getRefPoint(index); };
+    int getPointEdge(int pointIndex) const { return this->vPointEdge[pointIndex]; };
+
+    int getOrigin(int edgeIndex) const
+    {
+        return (edgeIndex < this->numMeshEdges) ? this->mesh->getOrigin(edgeIndex) :
+               this->mesh->getOrigin(TriangleMesh::getNext(this->vHullTwin[edgeIndex - this->numMeshEdges] - 1) - 1);
+    };
+    int getTwin(int edgeIndex) const
+    {
+        if (edgeIndex >= this->numMeshEdges)
+        {
+            return this->vHullTwin[edgeIndex - this->numMeshEdges];
+        }
+
+        // Convex hull edge twin departs from the edge destination
+        int twin = this->mesh->getTwin(edgeIndex);
+        return (twin != NO_TWIN) ? twin :
+               this->vHullEdge[this->getSlot(this->mesh->getOrigin(TriangleMesh::getNext(edgeIndex) - 1))];
+    };
+    int getPrevious(int edgeIndex) const
+    {
+        return (edgeIndex < this->numMeshEdges) ? TriangleMesh::getPrevious(edgeIndex) :
+               this->vHullPrevious[edgeIndex - this->numMeshEdges];
+    };
+    int getNext(int edgeIndex) const
+    {
+        return (edgeIndex < this->numMeshEdges) ? TriangleMesh::getNext(edgeIndex) :
+               this->vHullNext[edgeIndex - this->numMeshEdges];
+    };
+    int getFace(int edgeIndex) const
+    {
+        return (edgeIndex < this->numMeshEdges) ? TriangleMesh::getFace(edgeIndex) : EXTERNAL_FACE;
+    };
+    int getFaceEdge(int faceId) const
+    {
+        return (faceId == EXTERNAL_FACE) ? this->firstHullEdge : TriangleMesh::getFaceEdge(faceId);
+    };
+    const TriangleMesh *getMesh() const { return this->mesh; };
+};
+
+#endif //DELAUNAY_TRIANGLEMESHVIEW_H
@@ -79,6 +79,17 @@ public:
      */
 	bool inCircle(Point<TYPE> &p);
 
+    /**
+     * @fn          computeCentre
+     * @brief       Computes the circumcentre of a triangle without creating a circle
+     *
+     * @param   p       (IN)    First triangle point
+     * @param   q       (IN)    Second triangle point
+     * @param   r       (IN)    Third triangle point
+     * @param   centre  (OUT)   Circumcentre
+     */
+    static void computeCentre(const Point<TYPE> &p, const Point<TYPE> &q, const Point<TYPE> &r, Point<TYPE> &centre);
+
     /*******************************************************************************************************************
     * Getter/Setter
     *******************************************************************************************************************/
@@ -82,7 +82,7 @@ public:
 	*/
 
 	// Distance.
-	A_Type distance(const Point &p);
+	A_Type distance(const Point &p) const;
 	double signedArea(const Point &p, const Point &q);
 
 	// Location interface.
@@ -141,7 +141,7 @@ public:
  * Output: 		Euclidean distance from point p to point q
  * Complexity:	O(1)
 *****************************************************************************/
-template <class A_Type> A_Type Point<A_Type>::distance(const Point &p)
+template <class A_Type> A_Type Point<A_Type>::distance(const Point &p) const
 {
 	 // Compute Euclidean distance.
 	return sqrt(pow(this->x - p.x, 2) + pow(this->y - p.y, 2));
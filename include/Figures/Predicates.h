@@ -0,0 +1,84 @@
+#ifndef DELAUNAY_PREDICATES_H
+#define DELAUNAY_PREDICATES_H
+
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "defines.h"
+#include "Point.h"
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+/**
+ * Adaptive precision geometric predicates. Determinants are computed in floating point and the result is returned if
+ * its absolute value is higher than the rounding error bound. Otherwise the determinant sign is computed using exact
+ * expansion arithmetic so results are always consistent.
+ */
+class Predicates
+{
+public:
+    /*******************************************************************************************************************
+    * Public methods
+    *******************************************************************************************************************/
+    /**
+     * @fn      orient
+     * @brief   Computes twice the signed area of the triangle a-b-c
+     *
+     * @param   a   (IN)    First point
+     * @param   b   (IN)    Second point
+     * @param   c   (IN)    Third point
+     * @return  positive value if a-b-c is counterclockwise, negative if clockwise and zero if points are collinear.
+     *          The sign is exact although the value is an approximation.
+     */
+    static double orient(const Point<TYPE> &a, const Point<TYPE> &b, const Point<TYPE> &c);
+
+    /**
+     * @fn      turn
+     * @brief   Computes the turn of point c with respect to line a-b
+     *
+     * @param   a   (IN)    Line origin
+     * @param   b   (IN)    Line destination
+     * @param   c   (IN)    Point to check
+     * @return  LEFT_TURN, RIGHT_TURN or COLLINEAR (only if points are exactly collinear)
+     */
+    static Turn_T turn(const Point<TYPE> &a, const Point<TYPE> &b, const Point<TYPE> &c);
+
+    /**
+     * @fn      inCircleDet
+     * @brief   Computes in circle determinant of point d with respect to circle a-b-c
+     *
+     * @param   a   (IN)    First point of the circle
+     * @param   b   (IN)    Second point of the circle
+     * @param   c   (IN)    Third point of the circle
+     * @param   d   (IN)    Point to check
+     * @return  positive value if d is inside circle and a-b-c is counterclockwise, negative if outside and zero if d is
+     *          in the circumference. Sign is reversed if a-b-c is clockwise. The sign is exact.
+     */
+    static double inCircleDet(const Point<TYPE> &a, const Point<TYPE> &b, const Point<TYPE> &c,
+                              const Point<TYPE> &d);
+
+    /**
+     * @fn      inCircle
+     * @brief   Checks if point d is inside the circle defined by counterclockwise points a-b-c
+     *
+     * @return  true if d is strictly inside the circle
+     *          false otherwise
+     */
+    static bool inCircle(const Point<TYPE> &a, const Point<TYPE> &b, const Point<TYPE> &c, const Point<TYPE> &d)
+    {
+        return inCircleDet(a, b, c, d) > 0.0;
+    }
+
+private:
+    /*******************************************************************************************************************
+    * Private methods
+    *******************************************************************************************************************/
+    static double orientExact(const Point<TYPE> &a, const Point<TYPE> &b, const Point<TYPE> &c);
+    static double inCircleExact(const Point<TYPE> &a, const Point<TYPE> &b, const Point<TYPE> &c,
+                                const Point<TYPE> &d);
+};
+
+#endif //DELAUNAY_PREDICATES_H
@@ -0,0 +1,100 @@
+#ifndef DELAUNAY_SPATIALSORT_H
+#define DELAUNAY_SPATIALSORT_H
+
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "defines.h"
+#include "Point.h"
+
+#include <cstdint>
+#include <vector>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+// Number of bits per coordinate used to compute Hilbert curve index.
+#define HILBERT_ORDER               (16)
+
+// Maximum number of rounds in biased randomized insertion order.
+#define BRIO_MAX_ROUNDS             (32)
+
+
+/***********************************************************************************************************************
+* Types definition
+***********************************************************************************************************************/
+// Biased randomized insertion order sort key: round (negative) and Hilbert index, and point index.
+typedef pair<pair<int, uint64_t>, int> BrioKey;
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+class SpatialSort
+{
+public:
+    /*******************************************************************************************************************
+    * Public methods
+    *******************************************************************************************************************/
+    /**
+     * @fn      getHilbertIndex
+     * @brief   Computes the position of a point in the Hilbert curve that covers the input bounding box
+     *
+     * @param   p           (IN)    Point whose index is computed
+     * @param   minPoint    (IN)    Bounding box bottom left corner
+     * @param   maxPoint    (IN)    Bounding box top right corner
+     * @return  position in Hilbert curve
+     */
+    static uint64_t getHilbertIndex(const Point<TYPE> &p, const Point<TYPE> &minPoint, const Point<TYPE> &maxPoint);
+
+    /**
+     * @fn      hilbertSort
+     * @brief   Sorts a subset of points along the Hilbert curve of their bounding box so consecutive points are close
+     *
+     * @param   vPoints     (IN)        Set of points
+     * @param   vIndex      (IN/OUT)    Indexes of the points to sort
+     */
+    static void hilbertSort(const vector<Point<TYPE>> &vPoints, vector<int> &vIndex);
+
+    /**
+     * @fn      brio
+     * @brief   Sorts a subset of points in biased randomized insertion order. Every point is assigned to a round with
+     *          probability 1/2 of moving to previous round, rounds are sorted from smallest to largest and points in
+     *          every round are sorted along Hilbert curve.
+     *
+     * @param   vPoints     (IN)        Set of points
+     * @param   vIndex      (IN/OUT)    Indexes of the points to sort
+     * @param   seed        (IN)        Random generator seed
+     */
+    static void brio(const vector<Point<TYPE>> &vPoints, vector<int> &vIndex, unsigned int seed=0);
+
+    /**
+     * @fn      brio
+     * @brief   Sorts a subset of points in biased randomized insertion order using caller owned keys, so no memory
+     *          is allocated if the keys capacity is at least the number of indexes
+     *
+     * @param   vPoints     (IN)        Set of points
+     * @param   vIndex      (IN/OUT)    Indexes of the points to sort
+     * @param   vKeys       (OUT)       Sort keys of every index
+     * @param   seed        (IN)        Random generator seed
+     */
+    static void brio(const vector<Point<TYPE>> &vPoints, vector<int> &vIndex, vector<BrioKey> &vKeys,
+                     unsigned int seed=0);
+
+    /**
+     * @fn      getBoundingBox
+     * @brief   Computes the bounding box of a subset of points
+     *
+     * @param   vPoints     (IN)    Set of points
+     * @param   vIndex      (IN)    Indexes of the points
+     * @param   minPoint    (OUT)   Bounding box bottom left corner
+     * @param   maxPoint    (OUT)   Bounding box top right corner
+     */
+    static void getBoundingBox(const vector<Point<TYPE>> &vPoints, const vector<int> &vIndex, Point<TYPE> &minPoint,
+                               Point<TYPE> &maxPoint);
+};
+
+#endif //DELAUNAY_SPATIALSORT_H
@@ -6,11 +6,22 @@
 ***********************************************************************************************************************/
 #include "Dcel.h"
 #include "Voronoi.h"
+#include "VoronoiView.h"
 
+#include <cstdint>
 #include <iostream>
+#include <stdexcept>
+#include <vector>
 using namespace std;
 
 
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+// Minimum number of bitset words (64 edges each) computed by a thread.
+#define GABRIEL_MIN_WORDS_THREAD        (256)
+
+
 /***********************************************************************************************************************
 * Class declaration
 ***********************************************************************************************************************/
@@ -19,31 +30,79 @@ class Gabriel
     /*******************************************************************************************************************
     * Class members
     *******************************************************************************************************************/
-    vector<bool> vValidEdges;	// Valid edge array.
+    vector<uint64_t> vValidEdges;	// Valid edge bitset. One bit per edge.
+    size_t  szNumEdges;         // # edges in bitset.
 	Dcel 	dcel;				// DCELto check.
 	Voronoi voronoi;			// Voronoi graph associated to DCEL.
+    const Dcel *triangulation;  // Triangulation checked in place. Null if the DCEL copy is used.
+    const TriangleMeshView *meshView;   // Triangle mesh checked in place. Null if not used.
+    const VoronoiView *view;    // Voronoi view of the triangulation checked in place. Null if not used.
     bool    isBuilt;
 
     /*******************************************************************************************************************
     * Private methods
     *******************************************************************************************************************/
 	void validateEdges(int edgeIndex);
+    bool buildVoronoi();
+    template <class M> bool buildInPlace(const M &dcelIn, size_t szNumThreads);
+    template <class M> static bool isGabrielEdge(const M &dcelIn, int edgeIndex);
+    void setInPlace(const Dcel &dcelIn) { this->triangulation = &dcelIn; };
+    void setInPlace(const TriangleMeshView &meshIn) { this->meshView = &meshIn; };
 
 protected:
 
     /*******************************************************************************************************************
     * Protected methods
     *******************************************************************************************************************/
-    void set(int index) { this->vValidEdges.at(index) = true; };
-    bool at(int index) const { return this->vValidEdges.at(index); };
+    void set(int index) { this->checkIndex(index); this->vValidEdges[index >> 6] |= (uint64_t(1) << (index & 63)); };
+    bool at(int index) const { this->checkIndex(index); return (this->vValidEdges[index >> 6] >> (index & 63)) & 1; };
+    void checkIndex(int index) const
+    {
+        if ((index < 0) || ((size_t) index >= this->szNumEdges))
+        {
+            throw std::out_of_range("Gabriel edge index out of range");
+        }
+    };
 
+	friend class ContainerReader;
+	friend class ContainerWriter;
 	friend class GabrielIO;
 public:
 
     /*******************************************************************************************************************
      * Public methods declaration
      *******************************************************************************************************************/
-	Gabriel(Dcel &dcelIn, Voronoi &voronoiIn) : dcel(dcelIn), voronoi(voronoiIn), vValidEdges(dcelIn.getNumEdges()), isBuilt(false) {};
+	Gabriel(Dcel &dcelIn, Voronoi &voronoiIn) : vValidEdges((dcelIn.getNumEdges() + 63) / 64),
+                                                szNumEdges(dcelIn.getNumEdges()), dcel(dcelIn), voronoi(voronoiIn),
+                                                triangulation(nullptr), meshView(nullptr), view(nullptr),
+                                                isBuilt(false) {};
+
+    /**
+     * @fn                  Gabriel
+     * @brief               Creates a Gabriel graph that checks a Delaunay triangulation in place. The triangulation is
+     *                      not copied and no Voronoi diagram is needed, so the triangulation must outlive the graph.
+     *                      It is read through a Dcel accessor: a Dcel or a built TriangleMeshView
+     *
+     * @param dcelIn        (IN) Delaunay triangulation
+     */
+    template <class M> explicit Gabriel(const M &dcelIn) : vValidEdges((dcelIn.getNumEdges() + 63) / 64),
+                                                           szNumEdges(dcelIn.getNumEdges()), triangulation(nullptr),
+                                                           meshView(nullptr), view(nullptr), isBuilt(false)
+    {
+        this->setInPlace(dcelIn);
+    };
+
+    /**
+     * @fn                  Gabriel
+     * @brief               Creates a Gabriel graph that intersects every edge of a Delaunay triangulation with its dual
+     *                      Voronoi edge read from a Voronoi view. Neither the triangulation nor the view are copied
+     *
+     * @param dcelIn        (IN) Delaunay triangulation
+     * @param viewIn        (IN) Built Voronoi view of the triangulation
+     */
+    Gabriel(const Dcel &dcelIn, const VoronoiView &viewIn) : vValidEdges((dcelIn.getNumEdges() + 63) / 64),
+                                                             szNumEdges(dcelIn.getNumEdges()), triangulation(&dcelIn),
+                                                             meshView(nullptr), view(&viewIn), isBuilt(false) {};
 	~Gabriel() = default;
 
     Gabriel(const Gabriel &d)
@@ -52,13 +111,29 @@ public:
         {
             this->dcel = d.dcel;
             this->voronoi = d.voronoi;
+            this->triangulation = d.triangulation;
+            this->meshView = d.meshView;
+            this->view = d.view;
             this->vValidEdges = d.vValidEdges;
+            this->szNumEdges = d.szNumEdges;
             this->isBuilt = d.isBuilt;
         }
     }
 
-	bool isSet(int index) { return(this->vValidEdges.at(index)); };
-    bool build();
+	bool isSet(int index) const { return this->at(index); };
+
+    /**
+     * @fn                  build
+     * @brief               Builds the Gabriel graph. An edge is valid if its diametral circle does not contain any other
+     *                      point. A DCEL copy or a Voronoi view is checked intersecting every edge with its dual
+     *                      Voronoi edge. Otherwise the triangulation is checked in parallel testing the opposite vertex
+     *                      of both edge triangles, which is enough in a Delaunay triangulation
+     *
+     * @param szNumThreads  (IN) Number of threads used in place. All available cores if zero
+     * @return              true if graph built
+     *                      false otherwise
+     */
+    bool build(size_t szNumThreads=0);
 
     /**
      * @fn      reset
@@ -71,8 +146,11 @@ public:
     * Getters/Setters
     *******************************************************************************************************************/
     bool isValid() const { return isBuilt; };
-	int  getSize() const { return this->vValidEdges.size(); };
-	Dcel *getDcel() {return &this->dcel; };
+	int  getSize() const { return (int) this->szNumEdges; };
+    bool isInPlace() const { return (triangulation != nullptr) || (meshView != nullptr); };
+    bool isVoronoiUsed() const { return !isInPlace() || (view != nullptr); };
+	const Dcel *getDcel() const { return isInPlace() ? this->triangulation : &this->dcel; };
+    const TriangleMeshView *getMeshView() const { return this->meshView; };
 };
 
 #endif /* INCLUDE_GABRIEL_H_ */
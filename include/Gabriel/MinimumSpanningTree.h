@@ -0,0 +1,80 @@
+#ifndef DELAUNAY_MINIMUMSPANNINGTREE_H
+#define DELAUNAY_MINIMUMSPANNINGTREE_H
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "Dcel.h"
+
+#include <vector>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+// Minimum number of edges sorted by a thread.
+#define MST_MIN_EDGES_THREAD            (65536)
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+/**
+ * Euclidean minimum spanning tree of the points of a Delaunay triangulation. The tree is a subgraph of the
+ * triangulation so it is computed running Kruskal over the real Delaunay edges only. The Dcel must outlive the tree.
+ */
+class MinimumSpanningTree
+{
+    /*******************************************************************************************************************
+    * Class members
+    *******************************************************************************************************************/
+    vector<bool> vValidEdges;       // Tree edges (both half-edges are set).
+    const Dcel   *dcel;             // Delaunay triangulation.
+    size_t       szNumTreeEdges;    // # edges in tree.
+    TYPE         length;            // Sum of tree edges length.
+    bool         isBuilt;
+
+    /*******************************************************************************************************************
+    * Private methods
+    *******************************************************************************************************************/
+    void validateEdges(int edgeIndex);
+    static int findRoot(vector<int> &vParents, int index);
+
+public:
+
+    /*******************************************************************************************************************
+     * Public methods declaration
+     *******************************************************************************************************************/
+    explicit MinimumSpanningTree(const Dcel &dcelIn) : vValidEdges(dcelIn.getNumEdges()), dcel(&dcelIn),
+                                                       szNumTreeEdges(0), length(0.0), isBuilt(false) {};
+
+    /**
+     * @fn                  build
+     * @brief               Builds the tree. Real edges are sorted by length in parallel and added to the tree in
+     *                      order if they join two different components (union-find)
+     *
+     * @param szNumThreads  (IN) Number of threads used to sort edges. All available cores if zero
+     * @return              true if tree built
+     *                      false otherwise
+     */
+    bool build(size_t szNumThreads=0);
+
+    /**
+     * @fn      reset
+     * @brief   Resets data
+     */
+    void reset();
+
+    /*******************************************************************************************************************
+    * Getters/Setters
+    *******************************************************************************************************************/
+    bool isSet(int index) const { return this->vValidEdges.at(index); };
+    bool isValid() const { return isBuilt; };
+    int  getSize() const { return this->vValidEdges.size(); };
+    size_t getNumTreeEdges() const { return szNumTreeEdges; };
+    TYPE getLength() const { return length; };
+    const Dcel *getDcel() const { return this->dcel; };
+};
+
+#endif //DELAUNAY_MINIMUMSPANNINGTREE_H
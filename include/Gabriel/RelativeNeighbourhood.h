@@ -0,0 +1,77 @@
+#ifndef DELAUNAY_RELATIVENEIGHBOURHOOD_H
+#define DELAUNAY_RELATIVENEIGHBOURHOOD_H
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "Dcel.h"
+
+#include <vector>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+// Minimum number of half-edges checked by a thread.
+#define RNG_MIN_EDGES_THREAD            (16384)
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+/**
+ * Relative neighbourhood graph of the points of a Delaunay triangulation. An edge pq is valid if no other point is
+ * closer to both p and q than they are to each other (the lune of the edge is empty). The graph is a subgraph of the
+ * triangulation so only real Delaunay edges are checked. The Dcel must outlive the graph.
+ */
+class RelativeNeighbourhood
+{
+    /*******************************************************************************************************************
+    * Class members
+    *******************************************************************************************************************/
+    vector<bool> vValidEdges;       // Valid edge array.
+    const Dcel   *dcel;             // Delaunay triangulation.
+    bool         isBuilt;
+
+    /*******************************************************************************************************************
+    * Private methods
+    *******************************************************************************************************************/
+    bool isEmptyLune(int edgeIndex, vector<int> &vStack, vector<unsigned int> &vVisited, unsigned int stamp) const;
+    static bool isInLune(const Point<TYPE> &point, const Point<TYPE> &origin, const Point<TYPE> &dest,
+                         TYPE squaredLength);
+
+public:
+
+    /*******************************************************************************************************************
+     * Public methods declaration
+     *******************************************************************************************************************/
+    explicit RelativeNeighbourhood(const Dcel &dcelIn) : vValidEdges(dcelIn.getNumEdges()), dcel(&dcelIn),
+                                                         isBuilt(false) {};
+
+    /**
+     * @fn                  build
+     * @brief               Builds the graph checking the lune of every real edge in parallel
+     *
+     * @param szNumThreads  (IN) Number of threads. All available cores if zero
+     * @return              true if graph built
+     *                      false otherwise
+     */
+    bool build(size_t szNumThreads=0);
+
+    /**
+     * @fn      reset
+     * @brief   Resets data
+     */
+    void reset();
+
+    /*******************************************************************************************************************
+    * Getters/Setters
+    *******************************************************************************************************************/
+    bool isSet(int index) const { return this->vValidEdges.at(index); };
+    bool isValid() const { return isBuilt; };
+    int  getSize() const { return this->vValidEdges.size(); };
+    const Dcel *getDcel() const { return this->dcel; };
+};
+
+#endif //DELAUNAY_RELATIVENEIGHBOURHOOD_H
@@ -0,0 +1,55 @@
+#ifndef DELAUNAY_HUGEPAGES_H
+#define DELAUNAY_HUGEPAGES_H
+
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include <cstdint>
+#include <sys/mman.h>
+#include <vector>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+// Transparent huge page size. Kernel only backs 2 MB aligned ranges with huge pages.
+#define HUGE_PAGE_SIZE          (2*1024*1024)
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+/**
+ * Helpers that advise the kernel to back large arrays with transparent huge pages. Advice must be given before the
+ * memory is written, so arrays are advised right after they are reserved.
+ */
+class HugePages
+{
+public:
+    /*******************************************************************************************************************
+    * Public methods declarations
+    *******************************************************************************************************************/
+    /**
+     * @fn      advise
+     * @brief   Advises the kernel to use huge pages for the 2 MB aligned ranges in the vector allocated memory. Vectors
+     *          smaller than a huge page are not advised
+     *
+     * @param   v   (IN)    Vector whose memory is advised
+     */
+    template <class T>
+    static void advise(vector<T> &v)
+    {
+#ifdef MADV_HUGEPAGE
+        auto begin = ((uintptr_t) v.data() + HUGE_PAGE_SIZE - 1) & ~((uintptr_t) HUGE_PAGE_SIZE - 1);
+        auto end = ((uintptr_t) (v.data() + v.capacity())) & ~((uintptr_t) HUGE_PAGE_SIZE - 1);
+        if (end > begin)
+        {
+            madvise((void *) begin, end - begin, MADV_HUGEPAGE);
+        }
+#endif
+    }
+};
+
+#endif //DELAUNAY_HUGEPAGES_H
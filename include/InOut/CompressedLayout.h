@@ -0,0 +1,127 @@
+#ifndef DELAUNAY_COMPRESSEDLAYOUT_H
+#define DELAUNAY_COMPRESSEDLAYOUT_H
+
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include <cstddef>
+#include <cstdint>
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+#define COMPRESSED_MAGIC                "DLNYCMPR"
+#define COMPRESSED_MAGIC_LENGTH         (8)
+#define COMPRESSED_VERSION              (1)
+#define COMPRESSED_ENDIAN_TAG           (0x01020304)
+#define COMPRESSED_BLOCK_SIZE           (65536)     // Points or triangles per block.
+
+// Header flags.
+#define COMPRESSED_FLAG_QUANTIZED       (1)         // Coordinates are stored as grid cells.
+
+// Triangle corner tags. Tags 0 to 2 mean the corner is the same as that corner of the previous triangle.
+#define COMPRESSED_TAG_BITS             (2)
+#define COMPRESSED_TAG_MASK             (3)
+#define COMPRESSED_TAG_LITERAL          (3)         // Corner stored as delta to same corner of previous triangle.
+
+// Maximum bytes of a 64 bits varint.
+#define COMPRESSED_MAX_VARINT           (10)
+
+
+/***********************************************************************************************************************
+* Types declaration
+***********************************************************************************************************************/
+/**
+ * Compressed triangulation header. Written in native byte order: readers reject files whose endian tag does not match.
+ * Header is followed by the byte size (uint64_t) of every points block and every triangles block and then by the
+ * blocks data. Every block holds blockSize elements (except the last one) and is decoded independently.
+ *
+ * Points blocks store the coordinates of the file type (typeSize) or, if quantized, the grid cell of every point as
+ * varint zigzag deltas to the previous point of the block. Grid origin is (minX, minY). Triangles blocks store one
+ * tags byte per triangle followed by a varint zigzag delta for every corner tagged as literal.
+ */
+struct CompressedHeader
+{
+    char        arrMagic[COMPRESSED_MAGIC_LENGTH];
+    uint32_t    version;
+    uint32_t    endianTag;
+    uint32_t    typeSize;
+    uint32_t    flags;
+    uint64_t    numPoints;
+    uint64_t    numTriangles;
+    uint32_t    blockSize;
+    uint32_t    reserved;
+    double      cellSize;
+    double      minX;
+    double      minY;
+};
+
+
+/***********************************************************************************************************************
+* Inline functions
+***********************************************************************************************************************/
+/**
+ * @fn          zigzagEncode
+ * @brief       Maps signed values to unsigned values so small absolute values have small codes
+ */
+inline uint64_t zigzagEncode(int64_t value)
+{
+    return (((uint64_t) value) << 1) ^ (uint64_t) (value >> 63);
+}
+
+
+inline int64_t zigzagDecode(uint64_t code)
+{
+    return (int64_t) (code >> 1) ^ -((int64_t) (code & 1));
+}
+
+
+/**
+ * @fn          writeVarint
+ * @brief       Writes a value using 7 bits per byte. Highest bit is set in all bytes except the last one
+ *
+ * @param value (IN) Value to write
+ * @param ptr   (IN) Output buffer. Must have room for COMPRESSED_MAX_VARINT bytes
+ * @return      pointer to the byte after the value
+ */
+inline unsigned char *writeVarint(uint64_t value, unsigned char *ptr)
+{
+    while (value >= 0x80)
+    {
+        *ptr++ = (unsigned char) (value | 0x80);
+        value >>= 7;
+    }
+    *ptr++ = (unsigned char) value;
+    return ptr;
+}
+
+
+/**
+ * @fn          readVarint
+ * @brief       Reads a value written by writeVarint
+ *
+ * @param ptr   (IN/OUT) Input position. Updated to the byte after the value
+ * @param end   (IN) End of input data
+ * @param value (OUT) Value read
+ * @return      true if value read
+ *              false if data ends before the value or value is longer than COMPRESSED_MAX_VARINT bytes
+ */
+inline bool readVarint(const unsigned char *&ptr, const unsigned char *end, uint64_t &value)
+{
+    value = 0;
+    for (int shift=0; (ptr < end) && (shift < 7*COMPRESSED_MAX_VARINT) ; shift+=7)
+    {
+        unsigned char byte = *ptr++;
+        value |= ((uint64_t) (byte & 0x7F)) << shift;
+        if (byte < 0x80)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+#endif //DELAUNAY_COMPRESSEDLAYOUT_H
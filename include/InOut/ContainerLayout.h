@@ -0,0 +1,79 @@
+#ifndef DELAUNAY_CONTAINERLAYOUT_H
+#define DELAUNAY_CONTAINERLAYOUT_H
+
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include <cstddef>
+#include <cstdint>
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+#define CONTAINER_MAGIC                 "DLNYCONT"
+#define CONTAINER_MAGIC_LENGTH          (8)
+#define CONTAINER_VERSION               (1)
+#define CONTAINER_ENDIAN_TAG            (0x01020304)
+#define CONTAINER_ALIGNMENT             (8)
+#define CONTAINER_MAX_SECTIONS          (64)
+
+// Section flags.
+#define CONTAINER_FLAG_COORDINATES      (1)     // Section elements are points stored with file coordinates type.
+
+
+/***********************************************************************************************************************
+* Types declaration
+***********************************************************************************************************************/
+/**
+ * Data sets stored in a container. Every data set has one section per array. Dcel and Voronoi arrays are indexed by
+ * MappedDcelSection_T and graph arrays by MappedGraphSection_T.
+ */
+enum ContainerGroup_T
+{
+    CONTAINER_POINTS,
+    CONTAINER_DCEL,
+    CONTAINER_GRAPH,
+    CONTAINER_VORONOI,
+    CONTAINER_GABRIEL,
+    CONTAINER_NUM_GROUPS
+};
+
+// Gabriel arrays.
+enum ContainerGabrielSection_T
+{
+    CONTAINER_GABRIEL_BITSET,
+    CONTAINER_GABRIEL_NUM_EDGES
+};
+
+/**
+ * Container header. Written in native byte order: readers reject files whose endian tag does not match. Coordinates
+ * type size tells if points were written by a float or a double build.
+ */
+struct ContainerHeader
+{
+    char        arrMagic[CONTAINER_MAGIC_LENGTH];
+    uint32_t    version;
+    uint32_t    endianTag;
+    uint32_t    typeSize;
+    uint32_t    numSections;
+    uint32_t    tableCrc;           // CRC of the sections table.
+    uint32_t    headerCrc;          // CRC of the header with this field set to zero.
+};
+
+/**
+ * Section table entry. Sections follow the table in the same order, aligned to CONTAINER_ALIGNMENT bytes.
+ */
+struct ContainerSection
+{
+    uint16_t    group;              // ContainerGroup_T.
+    uint16_t    array;              // Array in group.
+    uint32_t    elementSize;        // Bytes per element.
+    uint64_t    offset;             // Offset from file start.
+    uint64_t    count;              // Number of elements.
+    uint32_t    crc;                // CRC of the section data.
+    uint32_t    flags;              // CONTAINER_FLAG_* values.
+};
+
+#endif //DELAUNAY_CONTAINERLAYOUT_H
@@ -0,0 +1,37 @@
+#ifndef DELAUNAY_CRC32_H
+#define DELAUNAY_CRC32_H
+
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include <cstddef>
+#include <cstdint>
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+/**
+ * CRC-32 (IEEE 802.3 polynomial, same values as zlib crc32) used to detect truncated or corrupted files.
+ */
+class Crc32
+{
+public:
+    /*******************************************************************************************************************
+    * Public class methods
+    *******************************************************************************************************************/
+    /**
+     * @fn              compute
+     * @brief           Computes the CRC of a buffer. A buffer can be processed in parts passing the CRC of the
+     *                  previous parts
+     *
+     * @param data      (IN) Buffer
+     * @param szSize    (IN) Buffer length in bytes
+     * @param crc       (IN) CRC of the previous parts. Zero for the first part
+     * @return          CRC of the buffer and the previous parts
+     */
+    static uint32_t compute(const void *data, size_t szSize, uint32_t crc=0);
+};
+
+#endif //DELAUNAY_CRC32_H
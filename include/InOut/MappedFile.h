@@ -0,0 +1,60 @@
+#ifndef DELAUNAY_MAPPEDFILE_H
+#define DELAUNAY_MAPPEDFILE_H
+
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include <cstddef>
+#include <string>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+/**
+ * Read only memory mapping of a whole file. The mapping is released when the object is closed or destroyed.
+ */
+class MappedFile
+{
+    /*******************************************************************************************************************
+    * Class members
+    *******************************************************************************************************************/
+    const char  *data;
+    size_t      szSize;
+
+public:
+    /*******************************************************************************************************************
+    * Public class methods
+    *******************************************************************************************************************/
+    MappedFile() : data(nullptr), szSize(0) {};
+    ~MappedFile() { this->close(); };
+    MappedFile(const MappedFile&) = delete;
+    MappedFile &operator=(const MappedFile&) = delete;
+
+    /**
+     * @fn                  open
+     * @brief               Maps a file in memory. Any previous mapping is released
+     *
+     * @param strFileName   (IN) File name
+     * @return              true if file mapped
+     *                      false otherwise
+     */
+    bool open(const string &strFileName);
+
+    /**
+     * @fn      close
+     * @brief   Releases the mapping
+     */
+    void close();
+
+    /*******************************************************************************************************************
+    * Getters/Setters
+    *******************************************************************************************************************/
+    bool isOpen() const { return this->data != nullptr; };
+    const char *getData() const { return this->data; };
+    size_t getSize() const { return this->szSize; };
+};
+
+#endif //DELAUNAY_MAPPEDFILE_H
@@ -0,0 +1,103 @@
+#ifndef DELAUNAY_MAPPEDLAYOUT_H
+#define DELAUNAY_MAPPEDLAYOUT_H
+
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+#define MAPPED_MAGIC_LENGTH         (8)
+#define MAPPED_VERSION              (1)
+#define MAPPED_ENDIAN_TAG           (0x01020304)
+#define MAPPED_ALIGNMENT            (64)
+#define MAPPED_MAX_SECTIONS         (8)
+
+
+/***********************************************************************************************************************
+* Types declaration
+***********************************************************************************************************************/
+/**
+ * Array stored in a mapped file: offset from file start (aligned to MAPPED_ALIGNMENT) and number of elements.
+ */
+struct MappedSection
+{
+    uint64_t    offset;
+    uint64_t    count;
+};
+
+/**
+ * Mapped file header. Written in native byte order: readers reject files whose endian tag or coordinates size do not
+ * match the running build.
+ */
+struct MappedHeader
+{
+    char            arrMagic[MAPPED_MAGIC_LENGTH];
+    uint32_t        version;
+    uint32_t        endianTag;
+    uint32_t        typeSize;
+    uint32_t        numSections;
+    MappedSection   arrSections[MAPPED_MAX_SECTIONS];
+};
+
+/**
+ * Array to write in a mapped file.
+ */
+struct MappedArray
+{
+    const void  *data;
+    size_t      szCount;
+    size_t      szElementSize;
+};
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+/**
+ * Versioned file layout that can be memory mapped and used in place: a header followed by arrays aligned to
+ * MAPPED_ALIGNMENT bytes so every array can be accessed through a typed pointer without copying it.
+ */
+class MappedLayout
+{
+public:
+    /*******************************************************************************************************************
+    * Public class methods
+    *******************************************************************************************************************/
+    /**
+     * @fn                  write
+     * @brief               Writes the header and the arrays straight from their memory
+     *
+     * @param strFileName   (IN) File name
+     * @param strMagic      (IN) File kind magic (at most MAPPED_MAGIC_LENGTH characters)
+     * @param vArrays       (IN) Arrays to write (at most MAPPED_MAX_SECTIONS)
+     * @return              true if file written
+     *                      false otherwise
+     */
+    static bool write(const string &strFileName, const string &strMagic, const vector<MappedArray> &vArrays);
+
+    /**
+     * @fn                  check
+     * @brief               Checks a mapped file has the expected magic, version, byte order and coordinates size and
+     *                      that all its arrays are aligned and inside the file
+     *
+     * @param data          (IN) File data
+     * @param szSize        (IN) File size
+     * @param strMagic      (IN) Expected magic
+     * @param vElementSizes (IN) Expected element size of every array
+     * @return              file header if file is valid
+     *                      null otherwise
+     */
+    static const MappedHeader *check(const char *data, size_t szSize, const string &strMagic,
+                                     const vector<size_t> &vElementSizes);
+};
+
+#endif //DELAUNAY_MAPPEDLAYOUT_H
@@ -0,0 +1,106 @@
+#ifndef DELAUNAY_COMPRESSEDREADER_H
+#define DELAUNAY_COMPRESSEDREADER_H
+
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "CompressedLayout.h"
+#include "Dcel.h"
+#include "TriangleMesh.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+// Empty open edges table slot. Point ids are positive so no edge key is zero.
+#define NO_OPEN_EDGE            (0)
+
+// Fibonacci hashing multiplier of open edges keys.
+#define OPEN_EDGE_HASH          (0x9E3779B97F4A7C15ULL)
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+/**
+ * Reads triangulations written by CompressedWriter. Blocks are decoded in parallel from the mapped file and twin
+ * edges are computed from the triangles corners. Every block is checked to be decoded using all its bytes.
+ */
+class CompressedReader
+{
+    /*******************************************************************************************************************
+    * Types declaration
+    *******************************************************************************************************************/
+    struct OpenEdge
+    {
+        uint64_t    key;            // Origin point id in high 32 bits and destination point id in low 32 bits.
+        int         edgeIndex;      // Edge index (0-based).
+    };
+
+    /*******************************************************************************************************************
+    * Private class methods
+    *******************************************************************************************************************/
+    static bool decodePoints(const CompressedHeader &header, const vector<const unsigned char *> &vBlocks,
+                             vector<Point<TYPE>> &vPoints, size_t szNumThreads);
+    static bool decodeTriangles(const CompressedHeader &header, const vector<const unsigned char *> &vBlocks,
+                                vector<int> &vCorners, size_t szNumThreads);
+    static void computeTwins(size_t szNumPoints, const vector<int> &vCorners, vector<int> &vTwins,
+                             vector<int> &vPointEdge, size_t szNumThreads);
+    static void matchEdge(const vector<int> &vCorners, int edgeIndex, vector<OpenEdge> &vTable, size_t &szNumOpen,
+                          vector<int> &vTwins);
+    static void getOpenEdges(const vector<OpenEdge> &vTable, vector<int> &vEdges);
+    static size_t getSlot(uint64_t key, size_t szMask)
+    {
+        return (size_t) ((key * OPEN_EDGE_HASH) >> 32) & szMask;
+    };
+    static bool decodeFile(const string &strFileName, vector<Point<TYPE>> &vPoints, vector<int> &vCorners,
+                           vector<int> &vTwins, vector<int> &vPointEdge, size_t szNumThreads);
+    static bool buildDcel(Dcel &dcel, size_t szNumThreads);
+
+public:
+    /*******************************************************************************************************************
+    * Public class methods
+    *******************************************************************************************************************/
+    /**
+     * @fn                  isCompressed
+     * @brief               Checks if a file starts with the compressed format magic
+     *
+     * @param strFileName   (IN) File name
+     * @return              true if file is in compressed format
+     *                      false otherwise
+     */
+    static bool isCompressed(const string &strFileName);
+
+    /**
+     * @fn                  read
+     * @brief               Reads a triangle mesh in compressed format
+     *
+     * @param strFileName   (IN) File name
+     * @param mesh          (OUT) Triangle mesh
+     * @param szNumThreads  (IN) Number of threads. All available cores if zero
+     * @return              true if read successfully
+     *                      false otherwise
+     */
+    static bool read(const string &strFileName, TriangleMesh &mesh, size_t szNumThreads=0);
+
+    /**
+     * @fn                  read
+     * @brief               Reads a triangle mesh in compressed format and builds its Dcel. Dcel is equal to the one
+     *                      built by TriangleMesh::toDcel
+     *
+     * @param strFileName   (IN) File name
+     * @param dcel          (OUT) Triangulation dcel
+     * @param szNumThreads  (IN) Number of threads. All available cores if zero
+     * @return              true if read successfully
+     *                      false otherwise
+     */
+    static bool read(const string &strFileName, Dcel &dcel, size_t szNumThreads=0);
+};
+
+#endif //DELAUNAY_COMPRESSEDREADER_H
@@ -0,0 +1,130 @@
+#ifndef DELAUNAY_CONTAINERREADER_H
+#define DELAUNAY_CONTAINERREADER_H
+
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "ContainerLayout.h"
+#include "Dcel.h"
+#include "Gabriel.h"
+#include "Graph.h"
+#include "Point.h"
+#include "Voronoi.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+/**
+ * Reads data sets from a container file. Opening the file only reads and checks the header and the sections table so
+ * every data set is read on demand and the sections of other data sets are skipped. Every section read is checked
+ * against its CRC. Points written by a build with a different coordinates type are converted.
+ */
+class ContainerReader
+{
+    /*******************************************************************************************************************
+    * Class members
+    *******************************************************************************************************************/
+    ifstream                    ifs;
+    string                      strFileName;
+    ContainerHeader             header;
+    vector<ContainerSection>    vSections;
+
+    /*******************************************************************************************************************
+    * Private methods declarations
+    *******************************************************************************************************************/
+    const ContainerSection *findSection(ContainerGroup_T group, int array) const;
+    bool readSection(const ContainerSection &section, void *data);
+    bool readCoordinates(ContainerGroup_T group, int array, vector<Point<TYPE>> &vPoints);
+    bool readDcelSections(ContainerGroup_T group, DcelModel &dcel);
+    bool logError(const string &strText, int value) const;
+
+    template <class T> bool readArray(ContainerGroup_T group, int array, vector<T> &v)
+    {
+        const ContainerSection *section = this->findSection(group, array);
+        if ((section == nullptr) || (section->elementSize != sizeof(T)))
+        {
+            return this->logError("Missing or invalid section in group ", group);
+        }
+
+        v.resize(section->count);
+        return this->readSection(*section, v.data());
+    };
+
+public:
+    /*******************************************************************************************************************
+    * Public methods declarations
+    *******************************************************************************************************************/
+    ContainerReader() : header() {};
+
+    /**
+     * @fn                  isContainer
+     * @brief               Checks if a file starts with the container magic
+     *
+     * @param strFileName   (IN) File name
+     * @return              true if file is a container
+     *                      false otherwise
+     */
+    static bool isContainer(const string &strFileName);
+
+    /**
+     * @fn                  open
+     * @brief               Opens a container and checks its magic, version, byte order, header and table CRCs and
+     *                      that all sections are inside the file
+     *
+     * @param strFileNameIn (IN) File name
+     * @return              true if file is a valid container
+     *                      false otherwise
+     */
+    bool open(const string &strFileNameIn);
+
+    /**
+     * @fn      close
+     * @brief   Closes the container
+     */
+    void close();
+
+    /**
+     * @fn          hasGroup
+     * @brief       Checks if the container has a data set
+     *
+     * @param group (IN) Data set
+     * @return      true if any section of the data set is stored
+     *              false otherwise
+     */
+    bool hasGroup(ContainerGroup_T group) const;
+
+    /*******************************************************************************************************************
+    * Data sets readers. Return false if the data set is not stored or a section CRC does not match
+    *******************************************************************************************************************/
+    bool readPoints(vector<Point<TYPE>> &vPoints);
+    bool readDcel(Dcel &dcel);
+    bool readGraph(Graph &graph);
+    bool readVoronoi(Voronoi &voronoi);
+
+    /**
+     * @fn              readGabriel
+     * @brief           Reads Gabriel graph edges. Gabriel graph must have the same number of edges (it must be
+     *                  constructed from the triangulation the container stores)
+     *
+     * @param gabriel   (OUT) Gabriel graph
+     * @return          true if read successfully
+     *                  false otherwise
+     */
+    bool readGabriel(Gabriel &gabriel);
+
+    /*******************************************************************************************************************
+    * Getters/Setters
+    *******************************************************************************************************************/
+    bool isOpen() const { return this->ifs.is_open(); };
+    size_t getTypeSize() const { return this->header.typeSize; };
+    size_t getNumSections() const { return this->vSections.size(); };
+};
+
+#endif //DELAUNAY_CONTAINERREADER_H
@@ -0,0 +1,45 @@
+#ifndef DELAUNAY_GRIDINDEXREADER_H
+#define DELAUNAY_GRIDINDEXREADER_H
+
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "DcelGridIndex.h"
+
+#include <string>
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+class GridIndexReader
+{
+
+    /*******************************************************************************************************************
+    * Private class methods
+    *******************************************************************************************************************/
+    static bool isValidSize(size_t szNumColumns, size_t szNumRows, size_t szMaxCells);
+    template <class M> static bool readFlat(const string &strFileName, BasicDcelGridIndex<M> &index);
+    template <class M> static bool readBinary(const string &strFileName, BasicDcelGridIndex<M> &index);
+
+public:
+
+    /*******************************************************************************************************************
+    * Public class methods
+    *******************************************************************************************************************/
+    /**
+     * @fn          read
+     * @brief       reads the grid index data from a file in plain or binary format depending on file extension and
+     *              attaches it to the Dcel the index was built from
+     *
+     * @param   fileName  (IN) File name
+     * @param   dcel      (IN) Indexed Dcel (Dcel or MappedDcel)
+     * @param   index     (OUT) Grid index to update
+     * @return  true if read successfully
+     *          false otherwise
+     */
+    template <class M> static bool read(const string &fileName, const M &dcel, BasicDcelGridIndex<M> &index);
+};
+
+#endif //DELAUNAY_GRIDINDEXREADER_H
@@ -0,0 +1,62 @@
+#ifndef DELAUNAY_POINTSPARSER_H
+#define DELAUNAY_POINTSPARSER_H
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "defines.h"
+#include "Point.h"
+
+#include <cstddef>
+#include <vector>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+// Minimum number of bytes parsed by a thread.
+#define POINTS_PARSER_MIN_BYTES_THREAD          (1 << 20)
+
+// Longest number parsed (longer numbers are errors).
+#define POINTS_PARSER_MAX_NUMBER_LENGTH         (64)
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+/**
+ * Parser of points in text format: coordinates separated by white spaces and an optional comma between them, with
+ * any number of points per line. Text is split in chunks at line boundaries (or at a white space if a chunk has no
+ * line end) and every chunk is parsed in a different thread without locale or stream overhead.
+ */
+class PointsParser
+{
+    /*******************************************************************************************************************
+    * Private class methods
+    *******************************************************************************************************************/
+    static void split(const char *data, size_t szSize, size_t szNumChunks, vector<size_t> &vBounds);
+    static bool parseChunk(const char *data, size_t szSize, vector<TYPE> &vCoordinates, size_t &szNumLines);
+    static bool parseNumber(const char *&ptr, const char *end, TYPE &value);
+
+public:
+    /*******************************************************************************************************************
+    * Public class methods
+    *******************************************************************************************************************/
+    /**
+     * @fn                  parse
+     * @brief               Parses points and appends them to the points set in the same order than in the text
+     *
+     * @param data          (IN) Text
+     * @param szSize        (IN) Text length
+     * @param vPoints       (OUT) Points set
+     * @param szNumThreads  (IN) Number of threads. All available cores if zero
+     * @return              true if text parsed
+     *                      false if text has an invalid number or an odd number of coordinates. Error is logged and
+     *                      no point is appended
+     */
+    static bool parse(const char *data, size_t szSize, vector<Point<TYPE>> &vPoints, size_t szNumThreads=0);
+};
+
+
+#endif //DELAUNAY_POINTSPARSER_H
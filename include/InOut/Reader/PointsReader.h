@@ -15,7 +15,6 @@ class PointsReader
     /*******************************************************************************************************************
     * Private class methods
     *******************************************************************************************************************/
-    static bool readFlat(const string &strFileName, vector<Point<TYPE>> &vPoints);
     static bool readBinary(const string &strFileName, vector<Point<TYPE>> &vPoints);
 
 public:
@@ -32,6 +31,30 @@ public:
      * @return
      */
     static bool read(const string &strFileName, vector<Point<TYPE>> &vPoints);
+
+    /**
+     * @fn      readText
+     * @brief   reads the set of points from a text file. File is mapped in memory and parsed by several threads.
+     *          Coordinates are separated by white spaces and an optional comma
+     *
+     * @param   strFileName     (IN) File name
+     * @param   vPoints         (OUT) Points set. Points are appended
+     * @param   szNumThreads    (IN) Number of threads. All available cores if zero
+     * @return  true if file read successfully
+     *          false if file cannot be opened or has an invalid number (its line is logged)
+     */
+    static bool readText(const string &strFileName, vector<Point<TYPE>> &vPoints, size_t szNumThreads=0);
+
+    /**
+     * @fn      readFlat
+     * @brief   reads the set of points from a text file using stream extraction. Reference for readText
+     *
+     * @param   strFileName     (IN) File name
+     * @param   vPoints         (OUT) Points set. Points are appended
+     * @return  true if file read successfully
+     *          false otherwise
+     */
+    static bool readFlat(const string &strFileName, vector<Point<TYPE>> &vPoints);
 };
 
 
@@ -36,13 +36,14 @@ public:
     /***************************************************************************
     * Name: 	write
     * IN:		fileName		file name to write data to.
+    * 			isBackground	write buffers in an I/O thread.
     * OUT:		NONE
     * RETURN:	false			if error writing data.
     * 			true			i.o.c.
     * GLOBAL:	NONE
     * Description: 	writes the voronoi data to "fileName" file.
     ***************************************************************************/
-    static bool write(const string &strFileName, const Voronoi &voronoi);
+    static bool write(const string &strFileName, const Voronoi &voronoi, bool isBackground=false);
 };
 
 
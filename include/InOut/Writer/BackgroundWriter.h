@@ -0,0 +1,76 @@
+#ifndef DELAUNAY_BACKGROUNDWRITER_H
+#define DELAUNAY_BACKGROUNDWRITER_H
+
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include <thread>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+/**
+ * Runs a write function in a worker thread so the caller can build the next data set while the previous one is
+ * written. Data written must not change until wait returns. Only one write is in progress at a time: starting a new
+ * write waits for the previous one.
+ */
+class BackgroundWriter
+{
+    /*******************************************************************************************************************
+    * Class members
+    *******************************************************************************************************************/
+    std::thread thread;         // Worker thread.
+    bool        isSuccess;      // Result of last write.
+
+public:
+    /*******************************************************************************************************************
+    * Public methods
+    *******************************************************************************************************************/
+    BackgroundWriter() : isSuccess(true) {};
+    ~BackgroundWriter() { this->wait(); };
+    BackgroundWriter(const BackgroundWriter&) = delete;
+    BackgroundWriter &operator=(const BackgroundWriter&) = delete;
+
+    /**
+     * @fn              start
+     * @brief           Waits for the previous write and starts a new one. Function result is returned by wait
+     *
+     * @param function  (IN) Function that writes the data set and returns true if written
+     * @return          true if previous write succeeded
+     *                  false otherwise
+     */
+    template <class Function>
+    bool start(Function function)
+    {
+        bool isPreviousSuccess = this->wait();
+        this->thread = std::thread([this, function]() { this->isSuccess = function(); });
+        return isPreviousSuccess;
+    };
+
+    /**
+     * @fn      wait
+     * @brief   Waits until current write finishes
+     *
+     * @return  true if last write succeeded (or no write started)
+     *          false otherwise
+     */
+    bool wait()
+    {
+        if (this->thread.joinable())
+        {
+            this->thread.join();
+        }
+
+        return this->isSuccess;
+    };
+
+    /*******************************************************************************************************************
+    * Getters/Setters
+    *******************************************************************************************************************/
+    bool isRunning() const { return this->thread.joinable(); };
+};
+
+#endif //DELAUNAY_BACKGROUNDWRITER_H
@@ -0,0 +1,203 @@
+#ifndef DELAUNAY_BUFFEREDWRITER_H
+#define DELAUNAY_BUFFEREDWRITER_H
+
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+// Default size of the writer buffers.
+#define BUFFERED_WRITER_SIZE        (4*1024*1024)
+
+// Maximum length of a formatted number (sign, digits, point and exponent).
+#define BUFFERED_MAX_NUMBER_LENGTH  (32)
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+/**
+ * Sequential file writer that formats records in a fixed size buffer and writes it to the file only when it is full,
+ * so memory is bounded by the buffer size and records are never flushed one by one. In background mode a second
+ * buffer is filled while an I/O thread writes the previous one. Numbers are formatted as ostream does by default
+ * (reals with 6 significant digits) so files are equal to those written using operator<<.
+ */
+class BufferedWriter
+{
+    /*******************************************************************************************************************
+    * Class members
+    *******************************************************************************************************************/
+    int                     fd;             // File descriptor (negative if not open).
+    vector<char>            vBuffers[2];    // Buffer being filled and buffer being written in background.
+    size_t                  szIndex;        // Index of the buffer being filled.
+    char                    *ptrCurrent;    // Next free byte in buffer being filled.
+    char                    *ptrEnd;        // End of buffer being filled.
+    bool                    isError;        // Write error flag.
+
+    // Background mode data (protected by mutex).
+    bool                    isBackground;   // I/O thread flag.
+    std::thread             thread;         // I/O thread.
+    std::mutex              mutex;
+    std::condition_variable condition;
+    bool                    isPending;      // Buffer pending to be written by I/O thread.
+    size_t                  szPendingIndex; // Index of pending buffer.
+    size_t                  szPendingBytes; // Bytes to write from pending buffer.
+    bool                    isStopped;      // I/O thread stop flag.
+
+    /*******************************************************************************************************************
+    * Private methods
+    *******************************************************************************************************************/
+    void flush();
+    void run();
+    static bool writeAll(int fd, const char *data, size_t szSize);
+    static char *formatReal(double value, char *ptr);
+
+    /**
+     * @fn      reserve
+     * @brief   Flushes the buffer if it has less than szSize free bytes
+     *
+     * @param   szSize  (IN) Number of bytes to write
+     */
+    inline void reserve(size_t szSize)
+    {
+        if ((size_t) (this->ptrEnd - this->ptrCurrent) < szSize)
+        {
+            this->flush();
+        }
+    };
+
+public:
+    /*******************************************************************************************************************
+    * Public methods
+    *******************************************************************************************************************/
+    BufferedWriter() : fd(-1), szIndex(0), ptrCurrent(nullptr), ptrEnd(nullptr), isError(false),
+                       isBackground(false), isPending(false), szPendingIndex(0),
+                       szPendingBytes(0), isStopped(false) {};
+    ~BufferedWriter() { this->close(); };
+    BufferedWriter(const BufferedWriter&) = delete;
+    BufferedWriter &operator=(const BufferedWriter&) = delete;
+
+    /**
+     * @fn                  open
+     * @brief               Creates (or truncates) a file to write. Any previous file is closed
+     *
+     * @param strFileName   (IN) File name
+     * @param isBackground  (IN) Write buffers in an I/O thread while next buffer is filled
+     * @param szBufferSize  (IN) Size of every buffer
+     * @return              true if file opened
+     *                      false otherwise
+     */
+    bool open(const string &strFileName, bool isBackground=false, size_t szBufferSize=BUFFERED_WRITER_SIZE);
+
+    /**
+     * @fn      close
+     * @brief   Writes pending data and closes the file
+     *
+     * @return  true if all data written
+     *          false if any write failed
+     */
+    bool close();
+
+    /**
+     * @fn          write
+     * @brief       Writes raw bytes
+     *
+     * @param data    (IN) Data to write
+     * @param szSize  (IN) Number of bytes
+     */
+    void write(const void *data, size_t szSize)
+    {
+        auto ptr = (const char *) data;
+        while (szSize > (size_t) (this->ptrEnd - this->ptrCurrent))
+        {
+            size_t szFree = this->ptrEnd - this->ptrCurrent;
+            memcpy(this->ptrCurrent, ptr, szFree);
+            this->ptrCurrent += szFree;
+            ptr += szFree;
+            szSize -= szFree;
+            this->flush();
+        }
+        memcpy(this->ptrCurrent, ptr, szSize);
+        this->ptrCurrent += szSize;
+    };
+
+    /**
+     * @fn          writeValue
+     * @brief       Writes the binary representation of a value
+     *
+     * @param value (IN) Value to write
+     */
+    template <class T> void writeValue(const T &value) { this->write(&value, sizeof(T)); };
+
+    /**
+     * @fn          writeChar
+     * @brief       Writes a character
+     *
+     * @param c     (IN) Character to write
+     */
+    void writeChar(char c)
+    {
+        this->reserve(1);
+        *this->ptrCurrent++ = c;
+    };
+
+    /**
+     * @fn          writeInt
+     * @brief       Writes an integer in decimal format
+     *
+     * @param value (IN) Value to write
+     */
+    void writeInt(long long value)
+    {
+        this->reserve(BUFFERED_MAX_NUMBER_LENGTH);
+        auto absolute = (unsigned long long) value;
+        if (value < 0)
+        {
+            *this->ptrCurrent++ = '-';
+            absolute = 0ULL - absolute;
+        }
+
+        char arrDigits[BUFFERED_MAX_NUMBER_LENGTH];
+        int nDigits=0;
+        do
+        {
+            arrDigits[nDigits++] = (char) ('0' + absolute % 10);
+            absolute /= 10;
+        } while (absolute != 0);
+
+        while (nDigits > 0)
+        {
+            *this->ptrCurrent++ = arrDigits[--nDigits];
+        }
+    };
+
+    /**
+     * @fn          writeReal
+     * @brief       Writes a real number with 6 significant digits as ostream does by default ("%g" format)
+     *
+     * @param value (IN) Value to write
+     */
+    void writeReal(double value)
+    {
+        this->reserve(BUFFERED_MAX_NUMBER_LENGTH);
+        this->ptrCurrent = formatReal(value, this->ptrCurrent);
+    };
+
+    /*******************************************************************************************************************
+    * Getters/Setters
+    *******************************************************************************************************************/
+    bool isOpen() const { return this->fd >= 0; };
+};
+
+#endif //DELAUNAY_BUFFEREDWRITER_H
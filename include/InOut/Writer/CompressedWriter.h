@@ -0,0 +1,75 @@
+#ifndef DELAUNAY_COMPRESSEDWRITER_H
+#define DELAUNAY_COMPRESSEDWRITER_H
+
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "CompressedLayout.h"
+#include "Dcel.h"
+#include "TriangleMesh.h"
+
+#include <string>
+#include <vector>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+/**
+ * Writes triangulations in the compressed format. Only triangles corners are stored: twins, next, previous and faces
+ * are computed by the reader so the file stores the triangle mesh of the triangulation (see TriangleMesh). Points and
+ * triangles are encoded in independent blocks in parallel. Readers compute twins faster if adjacent triangles are
+ * stored close, so Dcel triangles are sorted along a Hilbert curve.
+ */
+class CompressedWriter
+{
+    /*******************************************************************************************************************
+    * Private class methods
+    *******************************************************************************************************************/
+    static bool encodePoints(const TriangleMesh &mesh, double cellSize, CompressedHeader &header,
+                             vector<vector<unsigned char>> &vBlocks, size_t szNumThreads);
+    static void sortTriangles(const TriangleMesh &mesh, vector<int> &vCorners, size_t szNumThreads);
+    static void encodeTriangles(const vector<int> &vCorners, vector<vector<unsigned char>> &vBlocks,
+                                size_t szNumThreads);
+    static bool writeFile(const string &strFileName, const CompressedHeader &header,
+                          const vector<vector<unsigned char>> &vBlocks);
+
+public:
+    /*******************************************************************************************************************
+    * Public class methods
+    *******************************************************************************************************************/
+    /**
+     * @fn                  write
+     * @brief               Writes a triangle mesh in compressed format. Triangles are written in mesh order so the
+     *                      mesh read has the same points, edges and faces ids
+     *
+     * @param strFileName   (IN) File name
+     * @param mesh          (IN) Triangle mesh to write
+     * @param cellSize      (IN) Grid cell size coordinates are rounded to. Zero writes full precision coordinates
+     * @param szNumThreads  (IN) Number of threads. All available cores if zero
+     * @return              true if file written
+     *                      false otherwise
+     */
+    static bool write(const string &strFileName, const TriangleMesh &mesh, double cellSize=0.0,
+                      size_t szNumThreads=0);
+
+    /**
+     * @fn                  write
+     * @brief               Writes the real triangles of a Dcel in compressed format. Faces with imaginary points are
+     *                      not written (see TriangleMesh::fromDcel) and triangles are sorted along the Hilbert curve
+     *                      of their centroids. Only points ids are kept: faces and edges are renumbered and every face
+     *                      read has the corners of a real face of the Dcel in the same order
+     *
+     * @param strFileName   (IN) File name
+     * @param dcel          (IN) Triangulation dcel
+     * @param cellSize      (IN) Grid cell size coordinates are rounded to. Zero writes full precision coordinates
+     * @param szNumThreads  (IN) Number of threads. All available cores if zero
+     * @return              true if file written
+     *                      false otherwise
+     */
+    static bool write(const string &strFileName, Dcel &dcel, double cellSize=0.0, size_t szNumThreads=0);
+};
+
+#endif //DELAUNAY_COMPRESSEDWRITER_H
@@ -0,0 +1,83 @@
+#ifndef DELAUNAY_CONTAINERWRITER_H
+#define DELAUNAY_CONTAINERWRITER_H
+
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "ContainerLayout.h"
+#include "Dcel.h"
+#include "Gabriel.h"
+#include "Graph.h"
+#include "Point.h"
+#include "Voronoi.h"
+
+#include <string>
+#include <vector>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+/**
+ * Writes data sets to a container file. Data sets are added by reference and must not change until the container is
+ * written. File is written to a temporary file that is renamed when complete so a failed write never leaves a half
+ * written container with the final name.
+ */
+class ContainerWriter
+{
+    /*******************************************************************************************************************
+    * Types declaration
+    *******************************************************************************************************************/
+    struct Array
+    {
+        const void  *data;
+        uint64_t    numBytes;
+    };
+
+    /*******************************************************************************************************************
+    * Class members
+    *******************************************************************************************************************/
+    vector<ContainerSection>    vSections;
+    vector<Array>               vArrays;
+    uint64_t                    numEdgesGabriel;
+
+    /*******************************************************************************************************************
+    * Private methods declarations
+    *******************************************************************************************************************/
+    void addSection(ContainerGroup_T group, int array, const void *data, size_t szCount, size_t szElementSize,
+                    uint32_t flags=0);
+    void addDcelSections(ContainerGroup_T group, const DcelModel &dcel);
+    bool writeFile(const string &strFileName);
+
+public:
+    /*******************************************************************************************************************
+    * Public methods declarations
+    *******************************************************************************************************************/
+    ContainerWriter() : numEdgesGabriel(0) {};
+
+    void addPoints(const vector<Point<TYPE>> &vPoints);
+    void addDcel(const DcelModel &dcel) { this->addDcelSections(CONTAINER_DCEL, dcel); };
+    void addGraph(const Graph &graph);
+    void addVoronoi(const Voronoi &voronoi);
+    void addGabriel(const Gabriel &gabriel);
+
+    /**
+     * @fn                  write
+     * @brief               Writes header, sections table and all data sets added
+     *
+     * @param strFileName   (IN) File name
+     * @return              true if file written
+     *                      false otherwise
+     */
+    bool write(const string &strFileName);
+
+    /**
+     * @fn      clear
+     * @brief   Removes all data sets added
+     */
+    void clear();
+};
+
+#endif //DELAUNAY_CONTAINERWRITER_H
@@ -5,7 +5,9 @@
 /***********************************************************************************************************************
 * Includes
 ***********************************************************************************************************************/
+#include "BufferedWriter.h"
 #include "Dcel.h"
+#include "TriangleMesh.h"
 
 #include <string>
 
@@ -18,8 +20,10 @@ class DcelWriter
     /*******************************************************************************************************************
     * Private class methods
     *******************************************************************************************************************/
-    static bool writeFlat(const string &fileName, const DcelModel &dcel);
-    static bool writeBinary(const string &fileName, const DcelModel &dcel);
+    template <class M> static bool writeDcel(const string &fileName, const M &dcel, bool isBackground);
+    template <class M> static bool writeFlat(const string &fileName, const M &dcel, bool isBackground);
+    template <class M> static bool writeBinary(const string &fileName, const M &dcel, bool isBackground);
+    static bool close(BufferedWriter &writer, const string &fileName);
 
 public:
     /*******************************************************************************************************************
@@ -27,14 +31,39 @@ public:
     *******************************************************************************************************************/
     /**
      * @fn          write
-     * @brief       Writes Dcel to file
+     * @brief       Writes Dcel to file. Data is streamed through a fixed size buffer
+     *
+     * @param fileName      (IN) File name
+     * @param dcel          (IN) Dcel data to write
+     * @param isBackground  (IN) Write buffers in an I/O thread while next records are formatted
+     * @return              true if file written
+     *                      false otherwise
+     */
+    static bool write(const string &fileName, const DcelModel &dcel, bool isBackground=false);
+
+    /**
+     * @fn          write
+     * @brief       Writes triangle mesh to file in Dcel format. Mesh is read through a TriangleMeshView so the file
+     *              is equal to the one written from TriangleMesh::toDcel without building the Dcel
+     *
+     * @param fileName      (IN) File name
+     * @param mesh          (IN) Triangle mesh to write
+     * @param isBackground  (IN) Write buffers in an I/O thread while next records are formatted
+     * @return              true if file written
+     *                      false otherwise
+     */
+    static bool write(const string &fileName, const TriangleMesh &mesh, bool isBackground=false);
+
+    /**
+     * @fn          writeMapped
+     * @brief       Writes Dcel arrays in a layout that MappedDcel maps and uses without copying
      *
      * @param fileName  (IN) File name
      * @param dcel      (IN) Dcel data to write
      * @return          true if file written
      *                  false otherwise
      */
-    static bool write(const string &fileName, const DcelModel &dcel);
+    static bool writeMapped(const string &fileName, const DcelModel &dcel);
 
     /**
      * @fn          print
@@ -4,6 +4,7 @@
 /***********************************************************************************************************************
 * Includes
 ***********************************************************************************************************************/
+#include "BufferedWriter.h"
 #include "Graph.h"
 
 #include <string>
@@ -18,8 +19,9 @@ class GraphWriter
     /*******************************************************************************************************************
     * Private methods declarations
     *******************************************************************************************************************/
-    static bool writeFlat(const string &strFileName, const Graph &graph);
-    static bool writeBinary(const string &strFileName, const Graph &graph);
+    static bool writeFlat(const string &strFileName, const Graph &graph, bool isBackground);
+    static bool writeBinary(const string &strFileName, const Graph &graph, bool isBackground);
+    static bool close(BufferedWriter &writer, const string &strFileName);
 
 public:
     /*******************************************************************************************************************
@@ -27,14 +29,27 @@ public:
     *******************************************************************************************************************/
     /**
      * @fn                  write
-     * @brief               Writes graph to output file in flat format or binary depending on isBinary value
+     * @brief               Writes graph to output file in flat format or binary depending on isBinary value. Data is
+     *                      streamed through a fixed size buffer
      *
      * @param strFileName   (IN)    File name to write to
      * @param graph         (IN)    Graph to write to file
+     * @param isBackground  (IN)    Write buffers in an I/O thread while next nodes are formatted
      * @return              true if written successfully
      *                      false otherwise
      */
-    static bool write(const string &strFileName, const Graph &graph);
+    static bool write(const string &strFileName, const Graph &graph, bool isBackground=false);
+
+    /**
+     * @fn                  writeMapped
+     * @brief               Writes graph arrays in a layout that MappedGraph maps and uses without copying
+     *
+     * @param strFileName   (IN)    File name to write to
+     * @param graph         (IN)    Graph to write to file
+     * @return              true if written successfully
+     *                      false otherwise
+     */
+    static bool writeMapped(const string &strFileName, const Graph &graph);
 
 
     /**
@@ -0,0 +1,42 @@
+#ifndef DELAUNAY_GRIDINDEXWRITER_H
+#define DELAUNAY_GRIDINDEXWRITER_H
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "DcelGridIndex.h"
+
+#include <string>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+class GridIndexWriter
+{
+    /*******************************************************************************************************************
+    * Private methods declarations
+    *******************************************************************************************************************/
+    template <class M> static bool writeFlat(const string &strFileName, const BasicDcelGridIndex<M> &index);
+    template <class M> static bool writeBinary(const string &strFileName, const BasicDcelGridIndex<M> &index);
+
+public:
+    /*******************************************************************************************************************
+    * Public methods declarations
+    *******************************************************************************************************************/
+    /**
+     * @fn                  write
+     * @brief               Writes grid index to output file in flat or binary format depending on file extension.
+     *                      Index is written next to its Dcel file and attached to the Dcel after reading
+     *
+     * @param strFileName   (IN)    File name to write to
+     * @param index         (IN)    Grid index to write to file
+     * @return              true if written successfully
+     *                      false otherwise
+     */
+    template <class M> static bool write(const string &strFileName, const BasicDcelGridIndex<M> &index);
+};
+
+
+#endif //DELAUNAY_GRIDINDEXWRITER_H
@@ -0,0 +1,191 @@
+#ifndef DELAUNAY_PARALLEL_H
+#define DELAUNAY_PARALLEL_H
+
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include <algorithm>
+#include <thread>
+#include <vector>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+/**
+ * Helpers that split a range of elements in consecutive chunks processed by different threads. The calling thread
+ * always processes the first chunk so small ranges never create threads.
+ */
+class Parallel
+{
+public:
+    /*******************************************************************************************************************
+    * Public methods declarations
+    *******************************************************************************************************************/
+    /**
+     * @fn                  getNumThreads
+     * @brief               Gets the number of threads to use
+     *
+     * @param szNumThreads  (IN) Requested number of threads. All available cores if zero
+     * @return              number of threads (at least one)
+     */
+    static size_t getNumThreads(size_t szNumThreads)
+    {
+        if (szNumThreads == 0)
+        {
+            szNumThreads = std::thread::hardware_concurrency();
+        }
+
+        return max(szNumThreads, (size_t) 1);
+    }
+
+    /**
+     * @fn      runChunks
+     * @brief   Splits range [0, szSize) in consecutive chunks and calls function for every chunk in a different thread
+     *
+     * @param   szSize          (IN)    Number of elements to process
+     * @param   szMinChunk      (IN)    Minimum number of elements of a chunk so small ranges use the calling thread
+     * @param   szNumThreads    (IN)    Number of threads. All available cores if zero
+     * @param   function        (IN)    Function called with the [first, last) range of every chunk
+     * @return  true if function succeeds in all chunks
+     *          false otherwise
+     */
+    template <class Function>
+    static bool runChunks(size_t szSize, size_t szMinChunk, size_t szNumThreads, Function function)
+    {
+        szMinChunk = max(szMinChunk, (size_t) 1);
+        size_t szNumChunks = min(getNumThreads(szNumThreads), (szSize + szMinChunk - 1) / szMinChunk);
+        szNumChunks = max(szNumChunks, (size_t) 1);
+        size_t szChunkSize = (szSize + szNumChunks - 1) / szNumChunks;
+
+        vector<char> vSuccess(szNumChunks, true);
+        auto runChunk = [&](size_t chunk)
+        {
+            size_t first = min(chunk*szChunkSize, szSize);
+            vSuccess[chunk] = function(first, min(first + szChunkSize, szSize));
+        };
+
+        vector<std::thread> vThreads;
+        for (size_t chunk=1; chunk<szNumChunks ; chunk++)
+        {
+            vThreads.emplace_back(runChunk, chunk);
+        }
+        runChunk(0);
+
+        for (auto &thread : vThreads)
+        {
+            thread.join();
+        }
+
+        return std::all_of(vSuccess.begin(), vSuccess.end(), [](char isSuccess) { return isSuccess; });
+    }
+
+    /**
+     * @fn      sort
+     * @brief   Sorts every chunk of a vector in a different thread and merges pairs of sorted chunks until the whole
+     *          vector is sorted. Every merge pass splits its output in chunks too, so the last passes (that merge
+     *          fewer pairs than threads) still use all threads
+     *
+     * @param   vElements       (IN/OUT)    Elements to sort
+     * @param   szMinChunk      (IN)        Minimum number of elements sorted or merged by a thread
+     * @param   szNumThreads    (IN)        Number of threads. All available cores if zero
+     * @param   compare         (IN)        Strict weak ordering of elements
+     */
+    template <class T, class Compare>
+    static void sort(vector<T> &vElements, size_t szMinChunk, size_t szNumThreads, Compare compare)
+    {
+        // Sort chunks
+        size_t szSize = vElements.size();
+        szMinChunk = max(szMinChunk, (size_t) 1);
+        size_t szNumChunks = min(getNumThreads(szNumThreads), (szSize + szMinChunk - 1) / szMinChunk);
+        szNumChunks = max(szNumChunks, (size_t) 1);
+        size_t szChunkSize = (szSize + szNumChunks - 1) / szNumChunks;
+        runChunks(szNumChunks, 1, szNumChunks, [&](size_t first, size_t last)
+        {
+            for (size_t chunk=first; chunk<last ;chunk++)
+            {
+                auto itFirst = vElements.begin() + min(chunk*szChunkSize, szSize);
+                std::sort(itFirst, vElements.begin() + min((chunk + 1)*szChunkSize, szSize), compare);
+            }
+            return true;
+        });
+        if (szChunkSize >= szSize)
+        {
+            return;
+        }
+
+        // Merge pairs of consecutive sorted ranges into buffer. Every thread writes a range of the output
+        vector<T> vBuffer(szSize);
+        for (size_t szRange=szChunkSize; szRange<szSize ; szRange*=2)
+        {
+            runChunks(szSize, szMinChunk, szNumChunks, [&](size_t first, size_t last)
+            {
+                while (first < last)
+                {
+                    // Pair of sorted ranges [pairFirst, middle) and [middle, pairLast) that contains output position
+                    size_t pairFirst = (first / (2*szRange))*2*szRange;
+                    size_t middle = min(pairFirst + szRange, szSize);
+                    size_t pairLast = min(pairFirst + 2*szRange, szSize);
+                    size_t outLast = min(last, pairLast);
+
+                    auto itLeft = vElements.begin() + pairFirst;
+                    auto itRight = vElements.begin() + middle;
+                    size_t szLeft = middle - pairFirst;
+                    size_t szRight = pairLast - middle;
+                    size_t leftFirst = splitMerge(itLeft, szLeft, itRight, szRight, first - pairFirst, compare);
+                    size_t leftLast = splitMerge(itLeft, szLeft, itRight, szRight, outLast - pairFirst, compare);
+                    std::merge(itLeft + leftFirst, itLeft + leftLast,
+                               itRight + (first - pairFirst - leftFirst), itRight + (outLast - pairFirst - leftLast),
+                               vBuffer.begin() + first, compare);
+                    first = outLast;
+                }
+                return true;
+            });
+            vElements.swap(vBuffer);
+        }
+    }
+
+private:
+    /*******************************************************************************************************************
+    * Private methods declarations
+    *******************************************************************************************************************/
+    /**
+     * @fn      splitMerge
+     * @brief   Computes how many of the first szNumOut elements of the merge of two sorted ranges come from the left
+     *          range. Equal elements are taken from the left range first, like std::merge
+     *
+     * @param   itLeft      (IN)    First element of left sorted range
+     * @param   szLeft      (IN)    Number of elements of left range
+     * @param   itRight     (IN)    First element of right sorted range
+     * @param   szRight     (IN)    Number of elements of right range
+     * @param   szNumOut    (IN)    Number of merged elements
+     * @param   compare     (IN)    Strict weak ordering of elements
+     * @return  number of elements taken from left range
+     */
+    template <class Iterator, class Compare>
+    static size_t splitMerge(Iterator itLeft, size_t szLeft, Iterator itRight, size_t szRight, size_t szNumOut,
+                             Compare compare)
+    {
+        size_t low = (szNumOut > szRight) ? szNumOut - szRight : 0;
+        size_t high = min(szNumOut, szLeft);
+        while (low < high)
+        {
+            // Left element goes after last right element taken -> take fewer left elements
+            size_t szNumLeft = (low + high)/2;
+            if (compare(itRight[szNumOut - szNumLeft - 1], itLeft[szNumLeft]))
+            {
+                high = szNumLeft;
+            }
+            else
+            {
+                low = szNumLeft + 1;
+            }
+        }
+
+        return low;
+    }
+};
+
+#endif //DELAUNAY_PARALLEL_H
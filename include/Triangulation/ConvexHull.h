@@ -39,7 +39,7 @@ public:
      *
      * @return
      */
-    bool isEmpty() { return (hull.getNElements() == 0); }
+    bool isEmpty() const { return (hull.getNElements() == 0); }
 
      /**
      * @fn      getConvexHull
@@ -59,7 +59,7 @@ public:
      * @return  true if convex hull has exists
      *          false otherwise
      */
-    bool getConvexHullEdges(vector<int> &vEdges);
+    bool getConvexHullEdges(vector<int> &vEdges) const;
 
     /**
      * @fn      reset
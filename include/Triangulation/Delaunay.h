@@ -7,13 +7,49 @@
 ***********************************************************************************************************************/
 #include "ConvexHull.h"
 #include "Dcel.h"
+#include "DcelQueries.h"
 #include "defines.h"
 #include "Graph.h"
 #include "Polygon.h"
+#include "SpatialSort.h"
 #include "Triangulation.h"
+#include "TriangulationArena.h"
 #include "Voronoi.h"
 
 
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+// Initial capacity of the stack of edges to legalize.
+#define EDGE_STACK_SIZE         (64)
+
+// Expected edge flips per inserted point in random order: last point has at most 6 expected neighbours and it is
+// linked to 3 of them before flipping edges.
+#define EXPECTED_FLIPS_PER_POINT    (3)
+
+
+/***********************************************************************************************************************
+* Types definition
+***********************************************************************************************************************/
+// Point location used to insert every new point.
+enum PointLocation_E {GRAPH_LOCATION,       // Input order and history graph.
+                      WALK_LOCATION};       // Biased randomized insertion order and walk from last inserted face.
+
+/**
+ * Caller owned data used by const queries. Every thread uses its own context so a built triangulation can be queried
+ * from many threads at the same time.
+ */
+struct DelaunayQueryContext : public ExpansionContext
+{
+    int         startFace;          // Face where walk starts (walk location only). Updated to last located face.
+    vector<int> vFaces;             // Path extreme faces.
+    vector<int> vEdges;             // Convex hull edges that intersect path.
+    vector<int> vConvexEdges;       // Convex hull edges.
+
+    DelaunayQueryContext() : startFace(1) {};
+};
+
+
 /***********************************************************************************************************************
 * Class declaration
 ***********************************************************************************************************************/
@@ -24,46 +60,111 @@ class Delaunay: public Triangulation
     *******************************************************************************************************************/
 	Graph 	graph;				// Graph used in incremental algorithm.
     bool    isBuilt;
+    PointLocation_E location;   // Point location used in build.
+    int     lastFace;           // Face where walk starts (walk location only).
+    vector<pair<int,int>> vEdgeStack;   // Edges pending to legalize and their flip cascade depth.
+    vector<int> vOrder;         // Insertion order of the points after the highest one.
+    vector<BrioKey> vBrioKeys;  // Insertion order sort keys (walk location only).
+    TriangulationArena *arena;  // Caller supplied memory (nullptr if build reserves its own memory).
+
+    // Legalization statistics.
+    size_t  nFlips;             // # flips in build.
+    size_t  nMaxFlipDepth;      // Maximum flip cascade depth in build.
+    size_t  nLastFlips;         // # flips in last point insertion.
+    size_t  nLastFlipDepth;     // Flip cascade depth in last point insertion.
 
     /*******************************************************************************************************************
     * Private methods declarations
     *******************************************************************************************************************/
     void initGraph();
-	void checkEdge(int edge_ID);
-	void flipEdges(int edge_ID);
+    void reserveInsertion();
+	bool checkEdge(int edge_ID);
+	void flipEdges(int edge_ID, int depth);
+	void legalizeEdges();
+	void resetFlipCounters();
 	bool addPointToDelaunay(int index);
-	bool locateNode(const Point<TYPE> &point, int &nodeIndex);
-	bool isInteriorToNode(const Point<TYPE> &point, int nodeIndex);
+	bool locateNode(const Point<TYPE> &point, int &nodeIndex, int *nodesChecked=nullptr) const;
+	bool isInteriorToNode(const Point<TYPE> &point, int nodeIndex) const;
 	bool isStrictlyInteriorToNode(Point<TYPE> &point, int nodeIndex);
-	void splitNode(int pointIndex, int nodeIndex, int nTriangles);
+	bool locateFace(const Point<TYPE> &point, int startFace, int &faceId) const;
+	bool isInteriorToFace(const Point<TYPE> &point, int faceId) const;
+	bool isStrictlyInteriorToFace(const Point<TYPE> &point, int faceId) const;
+	void splitNode(int pointIndex, int nodeIndex, int faceId, int nTriangles);
+	void getInsertionOrder(vector<int> &vOrder);
 	double signedArea(Node *node);
-    void getConvexFacesIntersections(Line &line, vector<int> &vFaces, vector<int> &vEdges);
+    void getConvexFacesIntersections(Line &line, vector<int> &vFaces, vector<int> &vEdges,
+                                     vector<int> &vConvexEdges) const;
+    bool walkToFace(const Point<TYPE> &point, int &walkFace, int &faceId) const override;
+    bool expandClosest(const Point<TYPE> &in, size_t szMaxPoints, TYPE radius, vector<int> &vPointsIndex,
+                       DelaunayQueryContext &context) const;
 
 	friend class DelaunayIO;
 public:
     /*******************************************************************************************************************
     * Public methods declarations
     *******************************************************************************************************************/
-	Delaunay() : isBuilt(false) {};
-    explicit Delaunay(vector<Point<TYPE>> &vPoints) : Triangulation(vPoints), isBuilt(false)  {};
-	~Delaunay() = default;
-    Delaunay(const Delaunay &d) : Triangulation(d)
+	Delaunay() : isBuilt(false), location(GRAPH_LOCATION), lastFace(1), arena(nullptr) { resetFlipCounters(); };
+    explicit Delaunay(vector<Point<TYPE>> &vPoints, PointLocation_E locationIn=GRAPH_LOCATION) :
+                        Triangulation(vPoints), isBuilt(false), location(locationIn), lastFace(1), arena(nullptr)
+                        { resetFlipCounters(); };
+    explicit Delaunay(vector<Point<TYPE>> &&vPoints, PointLocation_E locationIn=GRAPH_LOCATION) :
+                        Triangulation(std::move(vPoints)), isBuilt(false), location(locationIn), lastFace(1),
+                        arena(nullptr)
+                        { resetFlipCounters(); };
+	~Delaunay() { detach(); };
+    Delaunay(const Delaunay &d) : Triangulation(d), arena(nullptr)
     {
         if(this != &d)
         {
             this->graph = d.graph;
             this->isBuilt = d.isBuilt;
+            this->location = d.location;
+            this->lastFace = d.lastFace;
+            this->nFlips = d.nFlips;
+            this->nMaxFlipDepth = d.nMaxFlipDepth;
+            this->nLastFlips = d.nLastFlips;
+            this->nLastFlipDepth = d.nLastFlipDepth;
         }
     }
+    // Arena memory cannot be shared by two triangulations.
+    Delaunay & operator=(const Delaunay &d) = delete;
 
     /*******************************************************************************************************************
     * Convex hull functions
     *******************************************************************************************************************/
-	bool isConvexHullComputed() { return !hull.isEmpty(); }
+	bool isConvexHullComputed() const { return !hull.isEmpty(); }
 	bool getConvexHull(Polygon &polygon) { return hull.getConvexHull(polygon); }
 	bool getConvexHullEdges(vector<int> &vEdges) { return hull.getConvexHullEdges(vEdges);  }
 	size_t getConvexHullLen() { return hull.size(); }
 
+    /*******************************************************************************************************************
+    * Caller supplied memory
+    *******************************************************************************************************************/
+    /**
+     * @fn      reserve
+     * @brief   Reserves dcel, graph and insertion order memory for the triangulation of the points. Dcel bound is
+     *          exact and graph bound uses the expected number of flips, so build without reallocations is only the
+     *          expected case: graph grows if points need more flips (see TriangulationArena::reserve to reserve the
+     *          flips of a previous build). Called by build unless an arena is attached
+     */
+    void reserve();
+
+    /**
+     * @fn              attach
+     * @brief           Builds the dcel edges and faces and the graph in the arena memory. Build does not reserve
+     *                  memory, so arena must be reserved for the number of points before build is called
+     *
+     * @param arenaIn   (IN/OUT) Arena whose memory is lent to the triangulation until it is detached
+     */
+    void attach(TriangulationArena &arenaIn);
+
+    /**
+     * @fn      detach
+     * @brief   Gives the memory back to the arena. Triangulation is not valid and it must be built again. Called by
+     *          destructor so memory is not lost
+     */
+    void detach();
+
     /*******************************************************************************************************************
     * Getter/Setters
     *******************************************************************************************************************/
@@ -71,6 +172,13 @@ public:
 	Dcel *getRefDcel() { return &this->dcel; }
     bool isValid() const { return isBuilt; }
     void setValid(bool isValid) { isBuilt = isValid; }
+    PointLocation_E getPointLocation() const { return location; }
+    void setPointLocation(PointLocation_E locationIn) { location = locationIn; }
+    bool isGraphUsed() const { return location == GRAPH_LOCATION; }
+    size_t getFlips() const { return nFlips; }
+    size_t getMaxFlipDepth() const { return nMaxFlipDepth; }
+    size_t getLastInsertionFlips() const { return nLastFlips; }
+    size_t getLastInsertionFlipDepth() const { return nLastFlipDepth; }
 
     /*******************************************************************************************************************
     * Triangulation interface functions implementation
@@ -81,9 +189,125 @@ public:
     bool findFace(Point<TYPE> &origin, int &faceId) override ;
     bool findClosestPoint(Point<TYPE> &in, Voronoi *voronoi, Point<TYPE> &out, int &pointIndex) override ;
     bool findPath(Point<TYPE> &origin, Point<TYPE> &dest, vector<int> &vFacesId) override ;
+
+    /**
+     * @fn                  findClosestPoint
+     * @brief               Finds the closest point walking greedily from the face that contains the input point
+     *
+     * @param in            (IN) Point whose closest point is returned
+     * @param out           (OUT) Closest point
+     * @param pointIndex    (OUT) Dcel point index
+     * @return  true if point located
+     *          false otherwise
+     */
+    bool findClosestPoint(Point<TYPE> &in, Point<TYPE> &out, int &pointIndex);
+
+    /*******************************************************************************************************************
+    * Const queries. Triangulation is not modified so they can be called from many threads using one context per thread.
+    *******************************************************************************************************************/
+    /**
+     * @fn                  findFace
+     * @brief               Finds the face that contains the input point (EXTERNAL_FACE if out of convex hull)
+     *
+     * @param origin        (IN) Point to locate
+     * @param faceId        (OUT) Face that contains the point
+     * @param context       (IN/OUT) Thread query context
+     * @return  true if point located
+     *          false otherwise
+     */
+    bool findFace(const Point<TYPE> &origin, int &faceId, DelaunayQueryContext &context) const;
+
+    /**
+     * @fn                  findClosestPoint
+     * @brief               Finds the closest point walking greedily from the face that contains the input point
+     *
+     * @param in            (IN) Point whose closest point is returned
+     * @param out           (OUT) Closest point
+     * @param pointIndex    (OUT) Dcel point index
+     * @param context       (IN/OUT) Thread query context
+     * @return  true if point located
+     *          false otherwise
+     */
+    bool findClosestPoint(const Point<TYPE> &in, Point<TYPE> &out, int &pointIndex,
+                          DelaunayQueryContext &context) const;
+
+    /**
+     * @fn                  findPath
+     * @brief               Finds the faces crossed by the segment between two points. Convex hull is computed by build
+     *
+     * @param origin        (IN) Segment origin
+     * @param dest          (IN) Segment destination
+     * @param vFacesId      (OUT) Faces crossed by the segment
+     * @param context       (IN/OUT) Thread query context
+     * @return  true if path computed
+     *          false otherwise
+     */
+    bool findPath(const Point<TYPE> &origin, const Point<TYPE> &dest, vector<int> &vFacesId,
+                  DelaunayQueryContext &context) const;
+
+    /**
+     * @fn                  findKClosest
+     * @brief               Finds the k closest points expanding Delaunay neighbours from the closest point in distance
+     *                      order. The (i+1)th closest point is a neighbour of one of the i closest points so the
+     *                      expansion only visits neighbours of the output points
+     *
+     * @param in            (IN) Point whose closest points are returned
+     * @param szNumPoints   (IN) Number of closest points (k)
+     * @param vPointsIndex  (OUT) Dcel index of the closest points sorted by distance. All points if less than k
+     * @param context       (IN/OUT) Thread query context
+     * @return  true if points found
+     *          false otherwise
+     */
+    bool findKClosest(const Point<TYPE> &in, size_t szNumPoints, vector<int> &vPointsIndex,
+                      DelaunayQueryContext &context) const;
+
+    /**
+     * @fn                  findInRadius
+     * @brief               Finds all points whose distance to the input point is not higher than radius expanding
+     *                      Delaunay neighbours from the closest point in distance order
+     *
+     * @param in            (IN) Circle center
+     * @param radius        (IN) Circle radius
+     * @param vPointsIndex  (OUT) Dcel index of the points in circle sorted by distance
+     * @param context       (IN/OUT) Thread query context
+     * @return  true if query computed
+     *          false otherwise
+     */
+    bool findInRadius(const Point<TYPE> &in, TYPE radius, vector<int> &vPointsIndex,
+                      DelaunayQueryContext &context) const;
+
+    /**
+     * @fn                  findKClosest
+     * @brief               Finds the k closest points of every point in a set. Points are sorted along a Hilbert curve
+     *                      and split in chunks located by different threads
+     *
+     * @param vPoints       (IN) Points whose closest points are returned
+     * @param szNumPoints   (IN) Number of closest points (k)
+     * @param vPointsIndex  (OUT) k Dcel indexes per input point in input order. Padded with INVALID if less than k
+     * @param szNumThreads  (IN) Number of threads. All available cores if zero
+     * @return  true if points found
+     *          false otherwise
+     */
+    bool findKClosest(const vector<Point<TYPE>> &vPoints, size_t szNumPoints, vector<int> &vPointsIndex,
+                      size_t szNumThreads=0) const;
+
+    /**
+     * @fn                  findInRadius
+     * @brief               Finds the points in the circle centered at every point in a set. Points are sorted along a
+     *                      Hilbert curve and split in chunks located by different threads
+     *
+     * @param vPoints       (IN) Circles centers
+     * @param radius        (IN) Circles radius
+     * @param vPointsIndex  (OUT) Dcel indexes of the points in every circle in input order
+     * @param szNumThreads  (IN) Number of threads. All available cores if zero
+     * @return  true if queries computed
+     *          false otherwise
+     */
+    bool findInRadius(const vector<Point<TYPE>> &vPoints, TYPE radius, vector<vector<int>> &vPointsIndex,
+                      size_t szNumThreads=0) const;
+
 #ifdef INCREMENTAL_DELAUNAY_STATISTICS
 	int getCollinear() const {return nCollinear;}
-	int getFlips() const {return nFlips;}
 	void freeStatistics();
 	int* getNodesChecked() const {return nNodesChecked;}
 #endif
@@ -0,0 +1,133 @@
+#ifndef DELAUNAY_DIVIDECONQUERDELAUNAY_H
+#define DELAUNAY_DIVIDECONQUERDELAUNAY_H
+
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "ConvexHull.h"
+#include "Dcel.h"
+#include "defines.h"
+#include "Polygon.h"
+#include "Triangulation.h"
+
+#include <utility>
+#include <vector>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+// Minimum number of points of a sub-problem to split it between two threads.
+#define DIVIDE_CONQUER_MIN_POINTS_THREAD        (4096)
+
+
+/***********************************************************************************************************************
+* Types definition
+***********************************************************************************************************************/
+// Wall time in seconds of every phase of the last build.
+struct DivideConquerTimes
+{
+    double sort=0.0;            // Sort points and check duplicated points.
+    double triangulate=0.0;     // Triangulate and merge halves (includes top level merge).
+    double merge=0.0;           // Top level merge. Sequential.
+    double dcel=0.0;            // Copy half-edges into Dcel.
+};
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+class DivideConquerDelaunay : public Triangulation
+{
+    /*******************************************************************************************************************
+    * Private types
+    *******************************************************************************************************************/
+    // Set of free half-edge pairs owned by a sub-problem. Pair "p" stores half-edges 2p and 2p+1.
+    struct EdgePool
+    {
+        vector<pair<int,int>> vRanges;      // Never used pairs as [first, last) ranges.
+        vector<int> vFreed;                 // Pairs released by deleted edges.
+    };
+
+    /*******************************************************************************************************************
+    * Private class members
+    *******************************************************************************************************************/
+    vector<Point<TYPE>> vSorted;            // Points sorted lexicographically.
+    vector<int> vSortedIndex;               // Dcel index of every sorted point.
+    vector<int> vOrigin;                    // Half-edge origin (sorted index). INVALID if half-edge is not used.
+    vector<int> vOnext;                     // Next half-edge counterclockwise around origin.
+    vector<int> vOprev;                     // Next half-edge clockwise around origin.
+    vector<int> vVertexEdge;                // Half-edge out of every sorted point.
+    size_t  szNumThreads;                   // Number of threads used to build triangulation.
+    bool    isBuilt;
+    DivideConquerTimes times;               // Build phases times.
+
+    /*******************************************************************************************************************
+    * Private methods declarations
+    *******************************************************************************************************************/
+    bool sortPoints();
+    void triangulate(int first, int last, int depth, EdgePool &pool, int &ldo, int &rdo);
+    void merge(int &ldo, int ldi, int rdi, int &rdo, EdgePool &pool);
+    int  makeEdge(int origin, int dest, EdgePool &pool);
+    void splice(int a, int b);
+    int  connect(int a, int b, EdgePool &pool);
+    void deleteEdge(int edge, EdgePool &pool);
+    void buildDcel();
+    void getConvexFacesIntersections(Line &line, vector<int> &vFaces, vector<int> &vEdges);
+    int  getParallelDepth() const;
+
+    inline int sym(int edge) const { return edge ^ 1; }
+    inline int dest(int edge) const { return vOrigin[edge ^ 1]; }
+    inline int lnext(int edge) const { return vOprev[edge ^ 1]; }
+    inline int rprev(int edge) const { return vOnext[edge ^ 1]; }
+    bool isCounterClockwise(int a, int b, int c) const;
+    bool isInCircle(int a, int b, int c, int d) const;
+    bool isRightOf(int point, int edge) const { return isCounterClockwise(point, dest(edge), vOrigin[edge]); }
+    bool isLeftOf(int point, int edge) const { return isCounterClockwise(point, vOrigin[edge], dest(edge)); }
+
+public:
+    /*******************************************************************************************************************
+    * Public methods declarations
+    *******************************************************************************************************************/
+    DivideConquerDelaunay() : szNumThreads(1), isBuilt(false) {};
+    explicit DivideConquerDelaunay(vector<Point<TYPE>> &vPoints, size_t szNumThreadsIn=0);
+    ~DivideConquerDelaunay() = default;
+
+    /*******************************************************************************************************************
+    * Convex hull functions
+    *******************************************************************************************************************/
+    bool isConvexHullComputed() { return !hull.isEmpty(); }
+    bool getConvexHull(Polygon &polygon) { return hull.getConvexHull(polygon); }
+    bool getConvexHullEdges(vector<int> &vEdges) { return hull.getConvexHullEdges(vEdges);  }
+    size_t getConvexHullLen() { return hull.size(); }
+
+    /*******************************************************************************************************************
+    * Getter/Setters
+    *******************************************************************************************************************/
+    Dcel *getRefDcel() { return &this->dcel; }
+    bool isValid() const { return isBuilt; }
+    size_t getNumThreads() const { return szNumThreads; }
+    const DivideConquerTimes &getTimes() const { return times; }
+
+    /*******************************************************************************************************************
+    * Triangulation interface functions implementation
+    *******************************************************************************************************************/
+    /**
+     * @fn      build
+     * @brief   Builds Delaunay triangulation splitting the set of points in two halves, computing both halves in
+     *          parallel and merging them. Output Dcel has no imaginary points and face 0 is the external face.
+     *
+     * @return  true if success
+     *          false otherwise (duplicated points)
+     */
+    bool build() override ;
+    bool convexHull() override ;
+    bool findTwoClosest(Point<TYPE> &p, Point<TYPE> &q) override ;
+    bool findFace(Point<TYPE> &origin, int &faceId) override ;
+    bool findClosestPoint(Point<TYPE> &in, Voronoi *voronoi, Point<TYPE> &out, int &pointIndex) override ;
+    bool findPath(Point<TYPE> &origin, Point<TYPE> &dest, vector<int> &vFacesId) override ;
+};
+
+#endif //DELAUNAY_DIVIDECONQUERDELAUNAY_H
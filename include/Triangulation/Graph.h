@@ -4,6 +4,7 @@
 /***********************************************************************************************************************
 * Includes
 ***********************************************************************************************************************/
+#include "HugePages.h"
 #include "Node.h"
 
 #include <cstring>
@@ -18,9 +19,14 @@ class Graph
     /*******************************************************************************************************************
     * Private class members
     *******************************************************************************************************************/
-    vector<int> vFaceNode;
-    vector<Node> vNodes;
+    vector<int> vFaceNode;              // Node assigned to every face
+    vector<int> vPoints;                // NODE_POINTS points ids per node
+    vector<int> vChildren;              // MAX_CHILDREN children ids per node (INVALID if not used)
+    vector<unsigned char> vNChildren;   // # children per node
+    vector<int> vFaces;                 // Face id per node
 
+    friend class ContainerReader;
+    friend class ContainerWriter;
     friend class GraphWriter;
 
 public:
@@ -35,27 +41,55 @@ public:
         if (this != &g)
         {
             this->vFaceNode = g.vFaceNode;
-            this->vNodes = g.vNodes;
+            this->vPoints = g.vPoints;
+            this->vChildren = g.vChildren;
+            this->vNChildren = g.vNChildren;
+            this->vFaces = g.vFaces;
         }
 
         return *this;
     }
 
-	int getSize() const {return this->vNodes.size(); };
-    Node* getRefNode(int nodeId) { return &this->vNodes.at(nodeId); };
+	int getSize() const {return this->vFaces.size(); };
+    Node getNode(int nodeId) const;
+    int getFace(int nodeId) const { return this->vFaces[nodeId]; };
     int getNodeAssigned(int face);
-    void setNodeAssigned(int iIdx, int iValue) { this->vFaceNode[iIdx] = iValue; };
-    int getNChildren(int nodeId) { return this->vNodes.at(nodeId).getNChildren(); };
-    int getiChild(int nodeId, int iChild) { return this->vNodes.at(nodeId).getiChild(iChild); };
-    void getVertices(int nodeIndex, int &index1, int &index2, int &index3);
+    void setNodeAssigned(int iIdx, int iValue);
+    int getNChildren(int nodeId) const { return this->vNChildren[nodeId]; };
+    int getiChild(int nodeId, int iChild) const { return this->vChildren[nodeId*MAX_CHILDREN + iChild]; };
+    void getVertices(int nodeIndex, int &index1, int &index2, int &index3) const;
 
 	// Graph manipulation
-	void insert(Node &node);
-	void update(int index, Node *node);
-    int isLeaf(int nodeIndex) { return this->vNodes.at(nodeIndex).isLeaf(); };
+	void insert(const Node &node);
+    void insert(int id1, int id2, int id3, int face);
+    void setChildren(int nodeId, int id1, int id2);
+    void setChildren(int nodeId, int id1, int id2, int id3);
+    int isLeaf(int nodeIndex) const { return this->vNChildren[nodeIndex] == 0; };
 
 	// Graph size functions.
+    /**
+     * @fn      reserve
+     * @brief   Reserves memory for the nodes and faces created when a triangulation of szNumPoints points is built
+     *          using szNumFlips edge flips
+     *
+     * @param   szNumPoints     (IN)    Number of points in triangulation
+     * @param   szNumFlips      (IN)    Number of edge flips done by the build
+     * @param   isHugePages     (IN)    Flag to advise the kernel to back nodes arrays with huge pages
+     */
+    void reserve(size_t szNumPoints, size_t szNumFlips, bool isHugePages=false);
 	void reset();
+
+    /**
+     * @fn      swap
+     * @brief   Swaps graph data with other graph. Lets a triangulation build its graph in memory supplied by the
+     *          caller (see TriangulationArena)
+     *
+     * @param   other   (IN/OUT)    Graph to swap data with
+     */
+    void swap(Graph &other);
+
+    size_t getNodesCapacity() const { return this->vFaces.capacity(); };
+    size_t getFacesCapacity() const { return this->vFaceNode.capacity(); };
 };
 
 #endif /* INCLUDE_GRAPH_H_ */
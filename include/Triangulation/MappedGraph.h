@@ -0,0 +1,98 @@
+#ifndef DELAUNAY_MAPPEDGRAPH_H
+#define DELAUNAY_MAPPEDGRAPH_H
+
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "MappedFile.h"
+#include "Node.h"
+
+#include <string>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+#define MAPPED_GRAPH_MAGIC              "GRAPHMAP"
+
+
+/***********************************************************************************************************************
+* Types declaration
+***********************************************************************************************************************/
+// Arrays stored in a mapped graph file. Same arrays as Graph.
+enum MappedGraphSection_T
+{
+    MAPPED_GRAPH_FACE_NODE,
+    MAPPED_GRAPH_POINTS,
+    MAPPED_GRAPH_CHILDREN,
+    MAPPED_GRAPH_NCHILDREN,
+    MAPPED_GRAPH_FACES,
+    MAPPED_GRAPH_NUM_SECTIONS
+};
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+/**
+ * Read only history graph whose arrays point into a memory mapped file written by GraphWriter::writeMapped. Getters
+ * have the same names and indexes than Graph ones.
+ */
+class MappedGraph
+{
+    /*******************************************************************************************************************
+    * Class members
+    *******************************************************************************************************************/
+    MappedFile          file;
+    const int           *faceNode;
+    const int           *points;
+    const int           *children;
+    const unsigned char *nChildren;
+    const int           *faces;
+    size_t              szNumNodes;
+    size_t              szNumFaces;
+
+public:
+    /*******************************************************************************************************************
+    * Public methods declarations
+    *******************************************************************************************************************/
+    MappedGraph() { this->close(); };
+
+    /**
+     * @fn                  open
+     * @brief               Maps a graph file and checks its layout
+     *
+     * @param strFileName   (IN) File name
+     * @return              true if file mapped and valid
+     *                      false otherwise
+     */
+    bool open(const string &strFileName);
+
+    /**
+     * @fn      close
+     * @brief   Releases the mapping
+     */
+    void close();
+
+    /*******************************************************************************************************************
+    * Getters/Setters
+    *******************************************************************************************************************/
+    bool isOpen() const { return this->file.isOpen(); };
+    int getSize() const { return (int) this->szNumNodes; };
+    size_t getNumFaces() const { return this->szNumFaces; };
+    int getFace(int nodeId) const { return this->faces[nodeId]; };
+    int getNodeAssigned(int face) const { return this->faceNode[face]; };
+    int getNChildren(int nodeId) const { return this->nChildren[nodeId]; };
+    int getiChild(int nodeId, int iChild) const { return this->children[nodeId*MAX_CHILDREN + iChild]; };
+    int isLeaf(int nodeIndex) const { return this->nChildren[nodeIndex] == 0; };
+    void getVertices(int nodeIndex, int &index1, int &index2, int &index3) const
+    {
+        index1 = this->points[nodeIndex*NODE_POINTS];
+        index2 = this->points[nodeIndex*NODE_POINTS + 1];
+        index3 = this->points[nodeIndex*NODE_POINTS + 2];
+    };
+};
+
+#endif //DELAUNAY_MAPPEDGRAPH_H
@@ -26,8 +26,10 @@ class Node
     /*******************************************************************************************************************
     * Class members
     *******************************************************************************************************************/
-    vector<int> vChildren;          // Children nodes IDs
-    vector<int> vPointsId;          // Node points IDs
+    int arrChildren[MAX_CHILDREN];  // Children nodes IDs
+    int arrPointsId[NODE_POINTS];   // Node points IDs
+    int nChildren;                  // # children
+    int nPoints;                    // # points (0 if not initialized)
 	int	face;						// Face id.
 
 	friend class NodeIO;
@@ -36,19 +38,22 @@ public:
     /*******************************************************************************************************************
     * Public class methods
     *******************************************************************************************************************/
-	Node() : face(INVALID) {};
-	Node(vector<int> &vPointsIn, int faceIn) : vPointsId(vPointsIn), face(faceIn) {};
-    Node(vector<int> &vChildrenIn, vector<int> &vPointsIn, int faceIn) : vChildren(vChildrenIn), vPointsId(vPointsIn), face(faceIn) {};
+	Node() : arrChildren{INVALID, INVALID, INVALID}, arrPointsId{INVALID, INVALID, INVALID}, nChildren(0), nPoints(0),
+             face(INVALID) {};
+    Node(int id1, int id2, int id3, int faceIn) : arrChildren{INVALID, INVALID, INVALID}, arrPointsId{id1, id2, id3},
+                                                  nChildren(0), nPoints(NODE_POINTS), face(faceIn) {};
+	Node(vector<int> &vPointsIn, int faceIn);
+    Node(vector<int> &vChildrenIn, vector<int> &vPointsIn, int faceIn);
 
     /*******************************************************************************************************************
     * Getters/Setters
     *******************************************************************************************************************/
-	inline int getNChildren() { return vChildren.size(); };
-	inline int getFace() { return(this->face); };
-	inline bool isLeaf() { return vChildren.empty(); };
-	inline bool isSplitted() { return (getNChildren() == TWO); };
-    int getiChild(int index);
-    int getiPoint(int index);
+	inline int getNChildren() const { return nChildren; };
+	inline int getFace() const { return(this->face); };
+	inline bool isLeaf() const { return nChildren == 0; };
+	inline bool isSplitted() const { return (getNChildren() == TWO); };
+    int getiChild(int index) const;
+    int getiPoint(int index) const;
     void setChildren(int id1, int id2);
     void setChildren(int id1, int id2, int id3);
 };
@@ -10,6 +10,13 @@
 #include "Triangulation.h"
 
 
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+// Minimum number of edges checked or flipped by a thread in parallel Delaunay conversion.
+#define STAR_MIN_EDGES_THREAD       (4096)
+
+
 /***********************************************************************************************************************
 * Class declaration
 ***********************************************************************************************************************/
@@ -29,6 +36,10 @@ class StarTriangulation : public Triangulation
     * Private methods
     *******************************************************************************************************************/
     bool setNotChecked(int index, bool *isEdgeChecked);
+    bool isIllegalEdge(int edgeIndex);
+    void flipEdge(int edgeIndex);
+    bool sequentialDelaunay();
+    bool parallelDelaunay(size_t szNumThreads);
     void getConvexFacesIntersections(Line &line, vector<int> &vFaces, vector<int> &vEdges);
 
 public:
@@ -37,6 +48,8 @@ public:
     *******************************************************************************************************************/
     StarTriangulation() : nPending(0), isBuilt(false) {};
     explicit StarTriangulation(vector<Point<TYPE>> &vPoints) : Triangulation(vPoints), nPending(0), isBuilt(false) {};
+    explicit StarTriangulation(vector<Point<TYPE>> &&vPoints) :
+                        Triangulation(std::move(vPoints)), nPending(0), isBuilt(false) {};
 	~StarTriangulation() = default;
     StarTriangulation(const StarTriangulation &t) : Triangulation(t)
     {
@@ -56,7 +69,17 @@ public:
      */
     bool build() override ;
 
-	bool delaunay();
+    /**
+     * @fn          delaunay
+     * @brief       Transforms the star triangulation into a Delaunay triangulation flipping illegal edges
+     *
+     * @param       szNumThreads    (IN)    Number of threads. If one edges are swept sequentially. Otherwise in circle
+     *                                      tests are computed in parallel and flips that do not share triangles are
+     *                                      applied in parallel batches. All available cores if zero
+     * @return      true if Delaunay triangulation computed
+     *              false otherwise
+     */
+	bool delaunay(size_t szNumThreads=1);
 
     /*******************************************************************************************************************
     * Getters/Setters
@@ -0,0 +1,119 @@
+#ifndef DELAUNAY_SWEEPHULLDELAUNAY_H
+#define DELAUNAY_SWEEPHULLDELAUNAY_H
+
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "ConvexHull.h"
+#include "Dcel.h"
+#include "defines.h"
+#include "Polygon.h"
+#include "Predicates.h"
+#include "Triangulation.h"
+
+#include <vector>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+// Minimum number of points sorted by a thread.
+#define SWEEP_HULL_MIN_POINTS_THREAD            (4096)
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+class SweepHullDelaunay : public Triangulation
+{
+    /*******************************************************************************************************************
+    * Private class members
+    *******************************************************************************************************************/
+    vector<Point<TYPE>> vPoints;            // Copy of the triangulation points.
+    vector<double> vDistance;               // Squared distance from every point to seed circle center.
+    vector<int> vSortedIndex;               // Points indexes sorted by distance to seed circle center.
+    vector<int> vCorners;                   // Origin point of every half-edge. Three half-edges per triangle.
+    vector<int> vTwins;                     // Twin half-edge of every half-edge. INVALID in convex hull edges.
+    vector<int> vHullNext;                  // Next point in convex hull (counterclockwise). Itself if removed.
+    vector<int> vHullPrevious;              // Previous point in convex hull.
+    vector<int> vHullEdge;                  // Convex hull half-edge whose origin is every hull point.
+    vector<int> vHullHash;                  // Hull points indexed by their pseudo-angle around seed circle center.
+    vector<int> vEdgeStack;                 // Half-edges pending to be legalized.
+    Point<TYPE> center;                     // Seed circle center.
+    size_t  szNumThreads;                   // Number of threads used to sort points.
+    size_t  szNumInside;                    // Number of points inserted inside the convex hull.
+    bool    isBuilt;
+
+    /*******************************************************************************************************************
+    * Private methods declarations
+    *******************************************************************************************************************/
+    bool findSeed(int &first, int &second, int &third);
+    bool sortPoints();
+    void sortRange(int first, int last, int depth);
+    bool insertPoint(int pointIndex);
+    bool insertInside(int pointIndex, int edge);
+    bool locateTriangle(int pointIndex, int edge, int &triangle, int &onEdge) const;
+    void splitTriangle(int pointIndex, int triangle);
+    void splitEdge(int pointIndex, int edge);
+    int  addTriangle(int a, int b, int c, int ab, int bc, int ca);
+    void link(int edge, int twin);
+    void legalize(int edge);
+    int  getHashKey(const Point<TYPE> &point) const;
+    int  getParallelDepth() const;
+    void getConvexFacesIntersections(Line &line, vector<int> &vFaces, vector<int> &vEdges);
+
+    inline bool isVisible(int pointIndex, int from, int to) const
+    {
+        return Predicates::orient(vPoints[from], vPoints[to], vPoints[pointIndex]) < 0.0;
+    }
+
+public:
+    /*******************************************************************************************************************
+    * Public methods declarations
+    *******************************************************************************************************************/
+    SweepHullDelaunay() : szNumThreads(1), szNumInside(0), isBuilt(false) {};
+    explicit SweepHullDelaunay(vector<Point<TYPE>> &vPoints, size_t szNumThreadsIn=0);
+    ~SweepHullDelaunay() = default;
+
+    /*******************************************************************************************************************
+    * Convex hull functions
+    *******************************************************************************************************************/
+    bool isConvexHullComputed() { return !hull.isEmpty(); }
+    bool getConvexHull(Polygon &polygon) { return hull.getConvexHull(polygon); }
+    bool getConvexHullEdges(vector<int> &vEdges) { return hull.getConvexHullEdges(vEdges);  }
+    size_t getConvexHullLen() { return hull.size(); }
+
+    /*******************************************************************************************************************
+    * Getter/Setters
+    *******************************************************************************************************************/
+    Dcel *getRefDcel() { return &this->dcel; }
+    bool isValid() const { return isBuilt; }
+    size_t getNumThreads() const { return szNumThreads; }
+    size_t getNumInsidePoints() const { return szNumInside; }
+
+    /*******************************************************************************************************************
+    * Triangulation interface functions implementation
+    *******************************************************************************************************************/
+    /**
+     * @fn      build
+     * @brief   Builds Delaunay triangulation sweeping points sorted by distance to the circle of a seed triangle.
+     *          Every point is joined to the visible convex hull edges and new triangles are legalized as they are
+     *          created. Output Dcel has no imaginary points and face 0 is the external face. Distances are
+     *          rounded, so a nearly collinear point can be sorted after points whose convex hull contains it. Such a
+     *          point splits the triangle that contains it and it is counted in getNumInsidePoints.
+     *
+     * @return  true if success
+     *          false otherwise (duplicated points, all points collinear or a point inside the convex hull that is
+     *          not in any triangle)
+     */
+    bool build() override ;
+    bool convexHull() override ;
+    bool findTwoClosest(Point<TYPE> &p, Point<TYPE> &q) override ;
+    bool findFace(Point<TYPE> &origin, int &faceId) override ;
+    bool findClosestPoint(Point<TYPE> &in, Voronoi *voronoi, Point<TYPE> &out, int &pointIndex) override ;
+    bool findPath(Point<TYPE> &origin, Point<TYPE> &dest, vector<int> &vFacesId) override ;
+};
+
+#endif //DELAUNAY_SWEEPHULLDELAUNAY_H
@@ -5,10 +5,30 @@
 /***********************************************************************************************************************
 * Includes
 ***********************************************************************************************************************/
+#include "ConvexHull.h"
+#include "Dcel.h"
+#include "Parallel.h"
 #include "Point.h"
 #include "Polygon.h"
+#include "SpatialSort.h"
 #include "Voronoi.h"
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+// Minimum number of queries located by a thread in batch point location.
+#define TRIANGULATION_MIN_QUERIES_THREAD        (4096)
+
+// Minimum number of vertices scanned by a thread in all nearest neighbours.
+#define TRIANGULATION_MIN_VERTEX_THREAD         (16384)
+
 
 /***********************************************************************************************************************
 * Class declaration
@@ -22,13 +42,67 @@ protected:
     Dcel dcel;
     ConvexHull hull;
 
+    /*******************************************************************************************************************
+    * Protected methods
+    *******************************************************************************************************************/
+    /**
+     * @fn      walkToFace
+     * @brief   Locates the face that contains a point walking from the face where the previous walk finished (see
+     *          Dcel::walkToFace).
+     *
+     * @param   point       (IN)        Point to locate
+     * @param   walkFace    (IN/OUT)    Face where walk starts. Updated to the last interior face visited
+     * @param   faceId      (OUT)       Face that contains the point. External face if point is out of convex hull
+     * @return  true if face found
+     *          false otherwise
+     */
+    virtual bool walkToFace(const Point<TYPE> &point, int &walkFace, int &faceId) const;
+
+    /**
+     * @fn      runHilbertChunks
+     * @brief   Sorts points along a Hilbert curve and splits sorted points in consecutive chunks processed by
+     *          different threads. Chunks have at least TRIANGULATION_MIN_QUERIES_THREAD points so small sets are
+     *          processed by the calling thread
+     *
+     * @param   vPoints         (IN)    Points to process
+     * @param   szNumThreads    (IN)    Number of threads. All available cores if zero
+     * @param   function        (IN)    Function called with sorted points indexes and [first, last) chunk range
+     * @return  true if function succeeds in all chunks
+     *          false otherwise
+     */
+    template <class Function>
+    static bool runHilbertChunks(const vector<Point<TYPE>> &vPoints, size_t szNumThreads, Function function)
+    {
+        // Sort points along Hilbert curve so consecutive points are close
+        vector<int> vOrder(vPoints.size());
+        std::iota(vOrder.begin(), vOrder.end(), 0);
+        SpatialSort::hilbertSort(vPoints, vOrder);
+
+        return Parallel::runChunks(vOrder.size(), TRIANGULATION_MIN_QUERIES_THREAD, szNumThreads,
+                                   [&](size_t first, size_t last) { return function(vOrder, first, last); });
+    }
+
+    /**
+     * @fn      reduceTwoClosest
+     * @brief   Finds the two closest points as the vertex whose nearest neighbour is closest. Triangulation must be
+     *          Delaunay
+     *
+     * @param   p               (OUT)   Lowest index of the two closest points
+     * @param   q               (OUT)   Highest index of the two closest points
+     * @param   szNumThreads    (IN)    Number of threads. All available cores if zero
+     * @return  true if found
+     *          false otherwise
+     */
+    bool reduceTwoClosest(Point<TYPE> &p, Point<TYPE> &q, size_t szNumThreads=0) const;
+
 public:
     /*******************************************************************************************************************
     * Public methods
     *******************************************************************************************************************/
     Triangulation() = default;
     explicit Triangulation(vector<Point<TYPE>> &vPoints) : dcel(vPoints) {};
-    ~Triangulation() = default;
+    explicit Triangulation(vector<Point<TYPE>> &&vPoints) : dcel(std::move(vPoints)) {};
+    virtual ~Triangulation() = default;
     Triangulation(const Triangulation &t)
     {
         if (this != &t)
@@ -101,6 +175,35 @@ public:
      */
     virtual bool findFace(Point<TYPE> &origin, int &faceId) = 0;
 
+    /**
+     * @fn      findFaces
+     * @brief   Finds the faces where a set of points fall into. Points are sorted along a Hilbert curve and every
+     *          point is located walking from the face of the previous one. Sorted points are split in consecutive
+     *          chunks located by different threads.
+     *
+     * @param   vPoints         (IN)    Points whose faces are returned
+     * @param   vFacesId        (OUT)   Face of every point in input order. External face if out of convex hull
+     * @param   szNumThreads    (IN)    Number of threads. All available cores if zero
+     * @return  true if all points located
+     *          false otherwise
+     */
+    bool findFaces(const vector<Point<TYPE>> &vPoints, vector<int> &vFacesId, size_t szNumThreads=0) const;
+
+    /**
+     * @fn      findAllNearest
+     * @brief   Finds the nearest neighbour of every vertex. In a Delaunay triangulation the nearest neighbour of a
+     *          vertex is joined to it by an edge so only half-edges are checked. Vertices are split in consecutive
+     *          ranges and every thread walks the half-edges that depart from its vertices, so every half-edge is read
+     *          once and no result is shared. Only squared distances are computed
+     *
+     * @param   vNeighbour          (OUT)   Dcel index of the nearest neighbour of every vertex. INVALID if none
+     * @param   vSquaredDistance    (OUT)   Squared distance from every vertex to its nearest neighbour
+     * @param   szNumThreads        (IN)    Number of threads. All available cores if zero
+     * @return  true if computed
+     *          false otherwise
+     */
+    bool findAllNearest(vector<int> &vNeighbour, vector<TYPE> &vSquaredDistance, size_t szNumThreads=0) const;
+
     /**
      * @fn      findPath
      * @build   Find the set of faces between two points
@@ -0,0 +1,58 @@
+#ifndef DELAUNAY_TRIANGULATIONARENA_H
+#define DELAUNAY_TRIANGULATIONARENA_H
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "Dcel.h"
+#include "Graph.h"
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+/**
+ * Caller supplied memory for the dcel edges and faces and the history graph of an incremental Delaunay triangulation.
+ * Arrays are reserved once and lent to every triangulation attached to the arena (see Delaunay::attach), so builds do
+ * not allocate or reallocate them and consecutive triangulations reuse the same memory.
+ */
+class TriangulationArena
+{
+    /*******************************************************************************************************************
+    * Class members
+    *******************************************************************************************************************/
+    Dcel    dcel;       // Edges and faces arrays. Points are not used.
+    Graph   graph;      // History graph arrays.
+
+    friend class Delaunay;
+
+public:
+    /*******************************************************************************************************************
+    * Public methods
+    *******************************************************************************************************************/
+    TriangulationArena() = default;
+    ~TriangulationArena() = default;
+
+    /**
+     * @fn                  reserve
+     * @brief               Reserves memory for a triangulation of szNumPoints points built using szNumFlips edge flips.
+     *                      Dcel bound is exact. Graph bound is exact if szNumFlips is the number of flips of a previous
+     *                      build of the same points (see Delaunay::getFlips)
+     *
+     * @param szNumPoints   (IN) Number of points
+     * @param szNumFlips    (IN) Number of edge flips done by the build (graph location only)
+     * @param isHugePages   (IN) Flag to advise the kernel to back arrays with huge pages
+     */
+    void reserve(size_t szNumPoints, size_t szNumFlips, bool isHugePages=false)
+    {
+        // Imaginary points are vertices of the triangulation too.
+        this->dcel.reserveTriangulation(szNumPoints + 2, isHugePages);
+        this->graph.reserve(szNumPoints, szNumFlips, isHugePages);
+    };
+
+    size_t getEdgesCapacity() const { return this->dcel.getEdgesCapacity(); };
+    size_t getFacesCapacity() const { return this->dcel.getFacesCapacity(); };
+    size_t getNodesCapacity() const { return this->graph.getNodesCapacity(); };
+};
+
+#endif //DELAUNAY_TRIANGULATIONARENA_H
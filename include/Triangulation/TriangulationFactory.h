@@ -6,8 +6,10 @@
 * Includes
 ***********************************************************************************************************************/
 #include "Delaunay.h"
+#include "DivideConquerDelaunay.h"
 #include "Point.h"
 #include "StarTriangulation.h"
+#include "SweepHullDelaunay.h"
 
 #include <vector>
 using namespace std;
@@ -39,10 +41,50 @@ public:
      *
      * @param   vPoints     (IN)    Triangulation set of points
      * @param   isSuccess   (OUT)   Flag that stands for successful execution
+     * @param   location    (IN)    Point location used to insert points
      * @return  Delaunay triangulation if successfully created
      *          nullptr otherwise
      */
-    static Delaunay *createDelaunay(vector<Point<TYPE>> &vPoints, bool &isSuccess);
+    static Delaunay *createDelaunay(vector<Point<TYPE>> &vPoints, bool &isSuccess,
+                                    PointLocation_E location=GRAPH_LOCATION);
+
+    /**
+     * @fn      createDelaunay
+     * @brief   Creates Delaunay triangulation moving the set of points into the triangulation (no copy)
+     *
+     * @param   vPoints     (IN)    Triangulation set of points. Empty after call
+     * @param   isSuccess   (OUT)   Flag that stands for successful execution
+     * @param   location    (IN)    Point location used to insert points
+     * @return  Delaunay triangulation if successfully created
+     *          nullptr otherwise
+     */
+    static Delaunay *createDelaunay(vector<Point<TYPE>> &&vPoints, bool &isSuccess,
+                                    PointLocation_E location=GRAPH_LOCATION);
+
+    /**
+     * @fn      createDivideConquer
+     * @brief   Creates Delaunay triangulation using divide and conquer algorithm
+     *
+     * @param   vPoints         (IN)    Triangulation set of points
+     * @param   isSuccess       (OUT)   Flag that stands for successful execution
+     * @param   szNumThreads    (IN)    Number of threads. All available cores if zero
+     * @return  Delaunay triangulation if successfully created
+     *          nullptr otherwise
+     */
+    static DivideConquerDelaunay *createDivideConquer(vector<Point<TYPE>> &vPoints, bool &isSuccess,
+                                                      size_t szNumThreads=0);
+
+    /**
+     * @fn      createSweepHull
+     * @brief   Creates Delaunay triangulation using sweep hull algorithm
+     *
+     * @param   vPoints         (IN)    Triangulation set of points
+     * @param   isSuccess       (OUT)   Flag that stands for successful execution
+     * @param   szNumThreads    (IN)    Number of threads used to sort points. All available cores if zero
+     * @return  Delaunay triangulation if successfully created
+     *          nullptr otherwise
+     */
+    static SweepHullDelaunay *createSweepHull(vector<Point<TYPE>> &vPoints, bool &isSuccess, size_t szNumThreads=0);
 };
 
 
@@ -6,6 +6,14 @@
 ***********************************************************************************************************************/
 #include "Dcel.h"
 #include "Line.h"
+#include "VoronoiView.h"
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+// Minimum number of Voronoi areas built by a thread.
+#define VORONOI_MIN_AREAS_THREAD        (4096)
 
 
 /***********************************************************************************************************************
@@ -16,18 +24,20 @@ class Voronoi
     /*******************************************************************************************************************
     * Class members
     *******************************************************************************************************************/
-	Dcel 	*triangulation;		// Reference to triangulation DCEL data.
+	const Dcel *triangulation;	// Reference to triangulation DCEL data.
 	Dcel 	dcel;				// Reference to Voronoi DCEL data.
 	bool    isBuilt;
 
     /*******************************************************************************************************************
     * Private methods declarations
     *******************************************************************************************************************/
-    void computeCircumcentres();
 	void buildArea(int pointIndex);
-	Point<TYPE> computeExtremeVoronoi(int edgeIndex, Point<TYPE> &centre);
-	bool edgeExists(Edge &edge);
-	bool isBottomMostFace(int faceId);
+    template <class M> void buildAreas(const BasicVoronoiView<M> &view, size_t szNumThreads);
+    template <class M> static bool edgeExists(const M &triangulation, int edgeIndex);
+
+    // Dcel whose areas can be built one by one (only Dcel views).
+    static const Dcel *getAreaDcel(const VoronoiView &view) { return view.getDcel(); };
+    template <class M> static const Dcel *getAreaDcel(const BasicVoronoiView<M> &) { return nullptr; };
 
 	friend class VoronoiIO;
 
@@ -36,7 +46,7 @@ public:
     * Public methods declarations
     *******************************************************************************************************************/
 	Voronoi() : triangulation(nullptr), isBuilt(false) {};
-	explicit Voronoi(Dcel *t) : triangulation(t), isBuilt(false) {};
+	explicit Voronoi(const Dcel *t) : triangulation(t), isBuilt(false) {};
 	~Voronoi() = default;
 
     Voronoi(const Voronoi &d)
@@ -55,11 +65,25 @@ public:
 	/**
 	 * @fn                      build
 	 * @brief                   Builds Voronoi diagram associated to triangulation
-	 * @param isIncremental     Flags if triangulation was built using Incremental algorithm
+	 * @param szNumThreads      (IN) Number of threads. All available cores if zero
 	 * @return                  true if build successfully
 	 *                          false otherwise
 	 */
-    bool build();
+    bool build(size_t szNumThreads=0);
+
+    /**
+     * @fn                      build
+     * @brief                   Builds Voronoi diagram DCEL from the circumcentres of a Voronoi view. Only needed to
+     *                          write or display the diagram. One thread builds the areas of a Dcel one by one.
+     *                          Several threads (or views of other triangulations, see MeshVoronoiView) build the areas
+     *                          in parallel after assigning the edge ids the sequential build would assign, so the DCEL
+     *                          is always the same
+     * @param view              (IN) Built Voronoi view
+     * @param szNumThreads      (IN) Number of threads. All available cores if zero
+     * @return                  true if build successfully
+     *                          false otherwise
+     */
+    template <class M> bool build(const BasicVoronoiView<M> &view, size_t szNumThreads=0);
 
 	/**
 	 * @fn              isInnerToArea
@@ -78,6 +102,7 @@ public:
     bool isValid() const { return isBuilt; }
     void setValid(bool isValue) { isBuilt = isValue; }
     inline Dcel* getRefDcel() { return(&this->dcel); }
+    inline const Dcel* getRefDcel() const { return(&this->dcel); }
 
     /**
      * @fn              getCentre
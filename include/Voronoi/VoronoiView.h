@@ -0,0 +1,164 @@
+#ifndef DELAUNAY_VORONOIVIEW_H
+#define DELAUNAY_VORONOIVIEW_H
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "Dcel.h"
+#include "Line.h"
+#include "MappedDcel.h"
+#include "TriangleMeshView.h"
+
+#include <vector>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+// Minimum number of circumcentres computed by a thread.
+#define VORONOI_MIN_FACES_THREAD        (16384)
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+/**
+ * Voronoi diagram read from the dual of an incremental Delaunay triangulation. Only the circumcentre of every
+ * Delaunay face is stored: the area of a point is walked through the half-edges that depart from it, and centre i is
+ * the circumcentre of Delaunay face i+1 (same ids as the Voronoi DCEL vertices). The triangulation must outlive the
+ * view. A Voronoi DCEL is only needed to write or display the diagram (see Voronoi::build(const VoronoiView &)).
+ * The triangulation is read through any Dcel accessor (see DcelQueries): VoronoiView reads a Dcel, MappedVoronoiView
+ * reads a mapped Dcel file and MeshVoronoiView reads a triangle mesh that keeps the imaginary faces.
+ */
+template <class M> class BasicVoronoiView
+{
+    /*******************************************************************************************************************
+    * Class members
+    *******************************************************************************************************************/
+    vector<Point<TYPE>> vCentres;       // Circumcentre of every Delaunay face except the external face.
+    const M     *triangulation;         // Delaunay triangulation.
+    bool        isBuilt;
+
+    /*******************************************************************************************************************
+    * Private methods
+    *******************************************************************************************************************/
+    bool computeExtremeCentre(int faceId);
+    bool computeExtremeVoronoi(int edgeIndex, const Point<TYPE> &centre, Point<TYPE> &extreme) const;
+    bool isBottomMostFace(int faceId) const;
+    bool isAreaEdge(int edgeIndex) const;
+
+public:
+
+    /*******************************************************************************************************************
+     * Public methods declaration
+     *******************************************************************************************************************/
+    explicit BasicVoronoiView(const M &dcelIn) : triangulation(&dcelIn), isBuilt(false) {};
+
+    /**
+     * @fn                  build
+     * @brief               Computes the circumcentre of every real face in parallel. Then it computes the centre of
+     *                      every imaginary face extending the Voronoi edge of its adjacent real face to the boundary.
+     *                      Fails if the triangulation has no imaginary faces (it is not incremental)
+     *
+     * @param szNumThreads  (IN) Number of threads. All available cores if zero
+     * @return              true if view built
+     *                      false otherwise
+     */
+    bool build(size_t szNumThreads=0);
+
+    /**
+     * @fn      reset
+     * @brief   Resets centres (but keeps triangulation)
+     */
+    void reset();
+
+    /**
+     * @fn              getFirstEdge
+     * @brief           Gets the first edge of the Voronoi area of a point: first edge departing from the point
+     *                  whose face is real. The Voronoi DCEL starts the area at the same edge
+     *
+     * @param areaId    (IN) Voronoi area id (point index + 1)
+     * @return          edge index
+     */
+    int getFirstEdge(int areaId) const;
+
+    /**
+     * @fn              getNextEdge
+     * @brief           Gets the next edge of the Voronoi area. Edges with imaginary vertices are skipped
+     *
+     * @param edgeIndex (IN) Current area edge index
+     * @return          next area edge index
+     */
+    int getNextEdge(int edgeIndex) const;
+
+    /**
+     * @fn              getEdgeCentres
+     * @brief           Gets the extremes of the Voronoi edge dual of a Delaunay edge. The Voronoi edge belongs to
+     *                  the area of the Delaunay edge origin
+     *
+     * @param edgeIndex (IN) Delaunay edge index
+     * @param origin    (OUT) Voronoi edge origin
+     * @param dest      (OUT) Voronoi edge destination
+     */
+    void getEdgeCentres(int edgeIndex, Point<TYPE> &origin, Point<TYPE> &dest) const;
+
+    /**
+     * @fn              getArea
+     * @brief           Gets the vertices of a Voronoi area in the same order than the Voronoi DCEL face
+     *
+     * @param areaId    (IN) Voronoi area id (point index + 1)
+     * @param vPoints   (OUT) Area vertices
+     */
+    void getArea(int areaId, vector<Point<TYPE>> &vPoints) const;
+
+    /**
+     * @fn              isInnerToArea
+     * @brief           checks if the input point is inner to areaId Voronoi area.
+     *
+     * @param p         (IN) Point to check
+     * @param areaId    (IN) Voronoi area id (point index + 1)
+     * @return          true if point is interior to area
+     *                  false otherwise
+     */
+    bool isInnerToArea(const Point<TYPE> &p, int areaId) const;
+
+    /**
+     * @fn                  findPath
+     * @brief               Finds the Voronoi areas crossed by a line from the origin area to the destination area.
+     *                      Returns the same areas than Dcel::findPath over the Voronoi DCEL
+     *
+     * @param vExtremeAreas (IN) Origin and destination areas ids
+     * @param line          (IN) Line between both points
+     * @param vAreasId      (OUT) Areas ids
+     * @return              true if path found
+     *                      false otherwise
+     */
+    bool findPath(const vector<int> &vExtremeAreas, Line &line, vector<int> &vAreasId) const;
+
+    /*******************************************************************************************************************
+    * Getters/Setters
+    *******************************************************************************************************************/
+    bool isValid() const { return isBuilt; };
+    const M *getDcel() const { return this->triangulation; };
+    size_t getNumCentres() const { return this->vCentres.size(); };
+    size_t getNumAreas() const { return this->triangulation->getNumVertex(); };
+
+    /**
+     * @fn                  getCentre
+     * @brief               Returns the circumcentre of a Delaunay face
+     * @param centreIndex   (IN) Centre index (Delaunay face id - 1)
+     * @param centre        (OUT) Face circumcentre
+     */
+    void getCentre(int centreIndex, Point<TYPE> &centre) const { centre = this->vCentres.at(centreIndex); };
+};
+
+
+/***********************************************************************************************************************
+* Types definition
+***********************************************************************************************************************/
+typedef BasicVoronoiView<Dcel>              VoronoiView;
+typedef BasicVoronoiView<TriangleMeshView>  MeshVoronoiView;
+typedef BasicVoronoiView<MappedDcel>        MappedVoronoiView;
+
+#endif //DELAUNAY_VORONOIVIEW_H
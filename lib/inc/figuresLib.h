@@ -49,4 +49,33 @@ bool getConvexHull(vector<Point<TYPE>> &vPointsIn, vector<Point<TYPE>> &vPointsO
  */
 bool getGabriel(vector<Point<TYPE>> &vPointsIn, vector<Point<TYPE>> &vPointsOut);
 
+
+/**
+ * @fn                  getMinimumSpanningTree
+ * @brief               Returns the Euclidean minimum spanning tree of a given set of points
+ * @details             The output is an even set of points where every two points is a segment of the tree
+ *
+ * @param vPointsIn     (IN) Input set of points
+ * @param vPointsOut    (OUT) Tree set of points
+ * @param szNumThreads  (IN) Number of threads. All available cores if zero
+ * @return              true if tree built
+ *                      false otherwise
+ */
+bool getMinimumSpanningTree(vector<Point<TYPE>> &vPointsIn, vector<Point<TYPE>> &vPointsOut, size_t szNumThreads=0);
+
+
+/**
+ * @fn                  getRelativeNeighbourhood
+ * @brief               Returns the relative neighbourhood graph of a given set of points
+ * @details             The output is an even set of points where every two points is a segment of the graph
+ *
+ * @param vPointsIn     (IN) Input set of points
+ * @param vPointsOut    (OUT) Relative neighbourhood graph set of points
+ * @param szNumThreads  (IN) Number of threads. All available cores if zero
+ * @return              true if graph built
+ *                      false otherwise
+ */
+bool getRelativeNeighbourhood(vector<Point<TYPE>> &vPointsIn, vector<Point<TYPE>> &vPointsOut,
+                              size_t szNumThreads=0);
+
 #endif //DELAUNAY_FIGURESLIB_H
@@ -55,4 +55,83 @@ bool get2ClosestPoints(vector<Point<TYPE>> &vPoints, Point<TYPE> &p, Point<TYPE>
 bool getPointFace(Point<TYPE> &p, vector<Point<TYPE>> &vPoints, vector<Point<TYPE>> &facePoints);
 
 
+/**
+ * @fn      getPointsFaces
+ * @brief   Given a set of points and a set of queries, returns the three points that surround every query. Queries
+ *          are located in a batch walking the triangulation along a Hilbert curve using all available cores
+ * @details Output vector of every query out of the points set is empty
+ *
+ * @param   vQueries        (IN) Points whose faces are returned
+ * @param   vPoints         (IN) Set of points
+ * @param   vFacesPoints    (OUT) Points that surround every query in input order
+ * @return  true if all faces found
+ *          false otherwise
+ */
+bool getPointsFaces(const vector<Point<TYPE>> &vQueries, vector<Point<TYPE>> &vPoints,
+                    vector<vector<Point<TYPE>>> &vFacesPoints);
+
+
+/**
+ * @fn      getKClosestPoints
+ * @brief   Given a set of points, it returns the k closest points to an input point sorted by distance
+ *
+ * @param   p           (IN) Point whose closest points in the set are returned
+ * @param   vPoints     (IN) Set of points where closest points belong
+ * @param   szNumPoints (IN) Number of closest points (k). All points returned if set is smaller
+ * @param   vClosest    (OUT) Closest points
+ * @return  true if points found
+ *          false otherwise
+ */
+bool getKClosestPoints(const Point<TYPE> &p, vector<Point<TYPE>> &vPoints, size_t szNumPoints,
+                       vector<Point<TYPE>> &vClosest);
+
+
+/**
+ * @fn      getKClosestPoints
+ * @brief   Given a set of points, it returns the k closest points to every query sorted by distance. Queries are
+ *          computed in a batch using all available cores
+ *
+ * @param   vQueries    (IN) Points whose closest points in the set are returned
+ * @param   vPoints     (IN) Set of points where closest points belong
+ * @param   szNumPoints (IN) Number of closest points (k). All points returned if set is smaller
+ * @param   vClosest    (OUT) Closest points of every query in input order
+ * @return  true if points found
+ *          false otherwise
+ */
+bool getKClosestPoints(const vector<Point<TYPE>> &vQueries, vector<Point<TYPE>> &vPoints, size_t szNumPoints,
+                       vector<vector<Point<TYPE>>> &vClosest);
+
+
+/**
+ * @fn      getPointsInRadius
+ * @brief   Given a set of points, it returns the points whose distance to an input point is not higher than radius
+ *          sorted by distance
+ *
+ * @param   p           (IN) Circle center
+ * @param   vPoints     (IN) Set of points
+ * @param   radius      (IN) Circle radius
+ * @param   vInRadius   (OUT) Points in circle
+ * @return  true if query computed
+ *          false otherwise
+ */
+bool getPointsInRadius(const Point<TYPE> &p, vector<Point<TYPE>> &vPoints, TYPE radius,
+                       vector<Point<TYPE>> &vInRadius);
+
+
+/**
+ * @fn      getPointsInRadius
+ * @brief   Given a set of points, it returns the points in the circle centered at every query sorted by distance.
+ *          Queries are computed in a batch using all available cores
+ *
+ * @param   vQueries    (IN) Circles centers
+ * @param   vPoints     (IN) Set of points
+ * @param   radius      (IN) Circles radius
+ * @param   vInRadius   (OUT) Points in the circle of every query in input order
+ * @return  true if queries computed
+ *          false otherwise
+ */
+bool getPointsInRadius(const vector<Point<TYPE>> &vQueries, vector<Point<TYPE>> &vPoints, TYPE radius,
+                       vector<vector<Point<TYPE>>> &vInRadius);
+
+
 #endif //DELAUNAY_LOCATELIB_H
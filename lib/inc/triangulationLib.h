@@ -36,4 +36,16 @@ bool getStarTriangulation(vector<Point<TYPE>> &vPoints, Dcel &dcel);
 bool getDelaunay(vector<Point<TYPE>> &vPoints, Dcel &dcel);
 
 
+/**
+ * @fn              getSweepHullDelaunay
+ * @brief           Returns the dcel associated to a Delaunay triangulation computed using sweep hull algorithm
+ *
+ * @param vPoints   (IN) Triangulation points
+ * @param dcel      (OUT) Delunay triangulation in DCEL format
+ * @return          true if triangulation built successfully
+ *                  false otherwise
+ */
+bool getSweepHullDelaunay(vector<Point<TYPE>> &vPoints, Dcel &dcel);
+
+
 #endif //DELAUNAY_TRIANGULATIONLIB_H
@@ -4,9 +4,73 @@
 #include "figuresLib.h"
 #include "Delaunay.h"
 #include "Gabriel.h"
+#include "MinimumSpanningTree.h"
+#include "RelativeNeighbourhood.h"
 #include "VoronoiFactory.h"
 
 
+/***********************************************************************************************************************
+* Private function definitions
+***********************************************************************************************************************/
+namespace
+{
+    /**
+     * @fn                  getGraph
+     * @brief               Builds a graph whose edges are a subset of the Delaunay triangulation of a set of points and
+     *                      returns its edges
+     *
+     * @param vPointsIn     (IN) Input set of points
+     * @param vPointsOut    (OUT) Every two points is a segment of the graph
+     * @param szNumThreads  (IN) Number of threads used to build the graph
+     * @return              true if graph built
+     *                      false otherwise
+     */
+    template <class Graph>
+    bool getGraph(vector<Point<TYPE>> &vPointsIn, vector<Point<TYPE>> &vPointsOut, size_t szNumThreads)
+    {
+        bool isSuccess=false;       // Return value
+
+        try
+        {
+            // Build Delaunay using incremental algorithm
+            Delaunay delaunay(vPointsIn);
+            if (delaunay.build())
+            {
+                Dcel *dcelRef = delaunay.getRefDcel();
+                Graph graph(*dcelRef);
+                if (graph.build(szNumThreads))
+                {
+                    // Initialize output
+                    isSuccess = true;
+                    vPointsOut.clear();
+
+                    // Add every edge once (lowest index half-edge)
+                    for (int edgeIndex=0; edgeIndex<graph.getSize() ;edgeIndex++)
+                    {
+                        if (graph.isSet(edgeIndex) && (edgeIndex < dcelRef->getTwin(edgeIndex)-1))
+                        {
+                            vPointsOut.push_back(*dcelRef->getRefPoint(dcelRef->getOrigin(edgeIndex)-1));
+                            vPointsOut.push_back(*dcelRef->getRefPoint(
+                                                    dcelRef->getOrigin(dcelRef->getTwin(edgeIndex)-1)-1));
+                        }
+                    }
+                }
+            }
+        }
+        catch (std::bad_alloc& ba)
+        {
+            std::cerr << "bad_alloc caught: " << ba.what() << '\n';
+        }
+        catch (exception &ex)
+        {
+            ex.what();
+        }
+
+        return isSuccess;
+    }
+}
+
+
 /***********************************************************************************************************************
 * API function definitions
 ***********************************************************************************************************************/
@@ -96,47 +160,37 @@ bool getGabriel(vector<Point<TYPE>> &vPointsIn, vector<Point<TYPE>> &vPointsOut)
         // Build Delaunay using incremental algorithm
         if (delaunay->build())
         {
-            // Create Voronoi
-            auto *voronoi = new Voronoi(delaunay->getRefDcel());
-
-            // Compute Voronoi diagram.
-            if (voronoi->build())
+            // Compute gabriel graph in place (no Voronoi diagram needed)
+            auto gabriel = new Gabriel(*delaunay->getRefDcel());
+            if (gabriel->build())
             {
-                // Compute gabriel graph
-                auto gabriel = new Gabriel(*delaunay->getRefDcel(), *voronoi);
-                if (gabriel->build())
-                {
-                    // Initialize output
-                    isSuccess = true;
-                    vPointsOut.clear();
+                // Initialize output
+                isSuccess = true;
+                vPointsOut.clear();
 
-                    // Get reference to gabriel dcel.
-                    Dcel *dcelRef = gabriel->getDcel();
+                // Get reference to gabriel dcel.
+                const Dcel *dcelRef = gabriel->getDcel();
 
-                    // Draw Gabriel edges.
-                    Point<TYPE> *p;	    // Temporary point
-                    for (size_t edgeIndex=0; edgeIndex<gabriel->getSize() ;edgeIndex++)
+                // Draw Gabriel edges.
+                const Point<TYPE> *p;	    // Temporary point
+                for (int edgeIndex=0; edgeIndex<gabriel->getSize() ;edgeIndex++)
+                {
+                    // Check if current edge matches Gabriel restriction.
+                    if (gabriel->isSet(edgeIndex))
                     {
-                        // Check if current edge mamtches Gabriel restriction.s
-                        if (gabriel->isSet(edgeIndex))
-                        {
-                            // Get origin vertex of edge.
-                            p = dcelRef->getRefPoint(dcelRef->getOrigin(edgeIndex)-1);
-                            vPointsOut.push_back((*p));
+                        // Get origin vertex of edge.
+                        p = dcelRef->getRefPoint(dcelRef->getOrigin(edgeIndex)-1);
+                        vPointsOut.push_back((*p));
 
-                            // Get destination vertex of edge.
-                            p = dcelRef->getRefPoint(dcelRef->getOrigin(dcelRef->getTwin(edgeIndex)-1)-1);
-                            vPointsOut.push_back((*p));
-                        }
+                        // Get destination vertex of edge.
+                        p = dcelRef->getRefPoint(dcelRef->getOrigin(dcelRef->getTwin(edgeIndex)-1)-1);
+                        vPointsOut.push_back((*p));
                     }
                 }
-
-                // Free resources
-                delete gabriel;
             }
 
             // Free resources
-            delete voronoi;
+            delete gabriel;
         }
 
         // Free resources
@@ -153,3 +207,15 @@ bool getGabriel(vector<Point<TYPE>> &vPointsIn, vector<Point<TYPE>> &vPointsOut)
 
     return isSuccess;
 }
+
+
+bool getMinimumSpanningTree(vector<Point<TYPE>> &vPointsIn, vector<Point<TYPE>> &vPointsOut, size_t szNumThreads)
+{
+    return getGraph<MinimumSpanningTree>(vPointsIn, vPointsOut, szNumThreads);
+}
+
+
+bool getRelativeNeighbourhood(vector<Point<TYPE>> &vPointsIn, vector<Point<TYPE>> &vPointsOut, size_t szNumThreads)
+{
+    return getGraph<RelativeNeighbourhood>(vPointsIn, vPointsOut, szNumThreads);
+}
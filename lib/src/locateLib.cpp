@@ -7,6 +7,34 @@
 #include "Delaunay.h"
 
 
+/***********************************************************************************************************************
+* Private function definitions
+***********************************************************************************************************************/
+namespace
+{
+    /**
+     * @fn      getPoints
+     * @brief   Copies the points of a set of Dcel indexes. INVALID indexes are skipped
+     *
+     * @param   dcel            (IN) Dcel that stores the points
+     * @param   vPointsIndex    (IN) Dcel indexes
+     * @param   vPoints         (OUT) Points
+     */
+    void getPoints(Dcel &dcel, const vector<int> &vPointsIndex, vector<Point<TYPE>> &vPoints)
+    {
+        vPoints.clear();
+        vPoints.reserve(vPointsIndex.size());
+        for (auto index : vPointsIndex)
+        {
+            if (index != INVALID)
+            {
+                vPoints.push_back(*dcel.getRefPoint(index));
+            }
+        }
+    }
+}
+
+
 /***********************************************************************************************************************
 * API function definitions
 ***********************************************************************************************************************/
@@ -22,17 +50,9 @@ bool getClosestPoint(Point<TYPE> &p, vector<Point<TYPE>> &vPoints, Point<TYPE> &
         // Build Delaunay using incremental algorithm
         if (delaunay->build())
         {
-            auto *voronoi = new Voronoi(delaunay->getRefDcel());
-
-            // Compute Voronoi diagram.
-            if ( voronoi->build())
-            {
-                int	pointIndex=0;
-                isSuccess = delaunay->findClosestPoint(p, voronoi, closest, pointIndex);
-            }
-
-            // Free resources
-            delete voronoi;
+            // Walk triangulation (no Voronoi diagram needed)
+            int	pointIndex=0;
+            isSuccess = delaunay->findClosestPoint(p, closest, pointIndex);
         }
 
         // Free resources
@@ -121,3 +141,149 @@ bool getPointFace(Point<TYPE> &p, vector<Point<TYPE>> &vPoints, vector<Point<TYP
 
     return isSuccess;
 }
+
+bool getPointsFaces(const vector<Point<TYPE>> &vQueries, vector<Point<TYPE>> &vPoints,
+                    vector<vector<Point<TYPE>>> &vFacesPoints)
+{
+    bool isSuccess=false;         // Return value
+
+    try
+    {
+        // Initialize output
+        vFacesPoints.clear();
+
+        // Insert points into delaunay
+        auto *delaunay = new Delaunay(vPoints);
+
+        // Build Delaunay using incremental algorithm
+        vector<int> vFacesId;
+        if (delaunay->build() && delaunay->findFaces(vQueries, vFacesId))
+        {
+            // Get faces points
+            vFacesPoints.resize(vFacesId.size());
+            for (size_t i=0; i<vFacesId.size() ; i++)
+            {
+                if (vFacesId[i] != EXTERNAL_FACE)
+                {
+                    DcelFigureBuilder::getFacePoints(vFacesId[i], *delaunay->getRefDcel(), vFacesPoints[i]);
+                }
+            }
+            isSuccess = true;
+        }
+
+        // Free resources
+        delete delaunay;
+    }
+    catch (std::bad_alloc& ba)
+    {
+        std::cerr << "bad_alloc caught: " << ba.what() << '\n';
+    }
+    catch (exception &ex)
+    {
+        ex.what();
+    }
+
+    return isSuccess;
+}
+
+bool getKClosestPoints(const Point<TYPE> &p, vector<Point<TYPE>> &vPoints, size_t szNumPoints,
+                       vector<Point<TYPE>> &vClosest)
+{
+    vector<vector<Point<TYPE>>> vBatch;
+    bool isSuccess = getKClosestPoints(vector<Point<TYPE>>(1, p), vPoints, szNumPoints, vBatch);
+    vClosest = isSuccess ? vBatch.front() : vector<Point<TYPE>>();
+    return isSuccess;
+}
+
+bool getKClosestPoints(const vector<Point<TYPE>> &vQueries, vector<Point<TYPE>> &vPoints, size_t szNumPoints,
+                       vector<vector<Point<TYPE>>> &vClosest)
+{
+    bool isSuccess=false;         // Return value
+
+    try
+    {
+        // Initialize output
+        vClosest.clear();
+
+        // Insert points into delaunay
+        auto *delaunay = new Delaunay(vPoints);
+
+        // Build Delaunay using incremental algorithm
+        vector<int> vPointsIndex;
+        if (delaunay->build() && delaunay->findKClosest(vQueries, szNumPoints, vPointsIndex))
+        {
+            // Get points of every query
+            vClosest.resize(vQueries.size());
+            for (size_t i=0; i<vQueries.size() ; i++)
+            {
+                vector<int> vQueryIndex(vPointsIndex.begin() + i*szNumPoints,
+                                        vPointsIndex.begin() + (i+1)*szNumPoints);
+                getPoints(*delaunay->getRefDcel(), vQueryIndex, vClosest[i]);
+            }
+            isSuccess = true;
+        }
+
+        // Free resources
+        delete delaunay;
+    }
+    catch (std::bad_alloc& ba)
+    {
+        std::cerr << "bad_alloc caught: " << ba.what() << '\n';
+    }
+    catch (exception &ex)
+    {
+        ex.what();
+    }
+
+    return isSuccess;
+}
+
+bool getPointsInRadius(const Point<TYPE> &p, vector<Point<TYPE>> &vPoints, TYPE radius,
+                       vector<Point<TYPE>> &vInRadius)
+{
+    vector<vector<Point<TYPE>>> vBatch;
+    bool isSuccess = getPointsInRadius(vector<Point<TYPE>>(1, p), vPoints, radius, vBatch);
+    vInRadius = isSuccess ? vBatch.front() : vector<Point<TYPE>>();
+    return isSuccess;
+}
+
+bool getPointsInRadius(const vector<Point<TYPE>> &vQueries, vector<Point<TYPE>> &vPoints, TYPE radius,
+                       vector<vector<Point<TYPE>>> &vInRadius)
+{
+    bool isSuccess=false;         // Return value
+
+    try
+    {
+        // Initialize output
+        vInRadius.clear();
+
+        // Insert points into delaunay
+        auto *delaunay = new Delaunay(vPoints);
+
+        // Build Delaunay using incremental algorithm
+        vector<vector<int>> vPointsIndex;
+        if (delaunay->build() && delaunay->findInRadius(vQueries, radius, vPointsIndex))
+        {
+            // Get points of every query
+            vInRadius.resize(vQueries.size());
+            for (size_t i=0; i<vQueries.size() ; i++)
+            {
+                getPoints(*delaunay->getRefDcel(), vPointsIndex[i], vInRadius[i]);
+            }
+            isSuccess = true;
+        }
+
+        // Free resources
+        delete delaunay;
+    }
+    catch (std::bad_alloc& ba)
+    {
+        std::cerr << "bad_alloc caught: " << ba.what() << '\n';
+    }
+    catch (exception &ex)
+    {
+        ex.what();
+    }
+
+    return isSuccess;
+}
@@ -5,6 +5,7 @@
 
 #include "DcelFigureBuilder.h"
 #include "Delaunay.h"
+#include "VoronoiView.h"
 
 
 /***********************************************************************************************************************
@@ -75,21 +76,19 @@ bool getVoronoiPath(Point<TYPE> &o, Point<TYPE> &d, vector<Point<TYPE>> &vPoints
         // Build Delaunay using incremental algorithm
         if (delaunay->build())
         {
-            // Create Voronoi
-            auto *voronoi = new Voronoi(delaunay->getRefDcel());
-
-            // Compute Voronoi diagram.
-            if (voronoi->build())
+            // Compute Voronoi view (no Voronoi DCEL needed)
+            VoronoiView view(*delaunay->getRefDcel());
+            if (view.build())
             {
                 int pointFace1;
                 int pointFace2;
                 Point<TYPE> closest;
 
-                // Get faces where origin and destination points fall into
-                if (delaunay->findClosestPoint(o, voronoi, closest, pointFace1) &&
-                    delaunay->findClosestPoint(d, voronoi, closest, pointFace2))
+                // Get areas where origin and destination points fall into
+                if (delaunay->findClosestPoint(o, closest, pointFace1) &&
+                    delaunay->findClosestPoint(d, closest, pointFace2))
                 {
-                    // Add faces to set whose path must be computed
+                    // Add areas to set whose path must be computed
                     vector<int> vPathFaces;
                     vPathFaces.push_back(pointFace1 + 1);
                     vPathFaces.push_back(pointFace2 + 1);
@@ -97,18 +96,18 @@ bool getVoronoiPath(Point<TYPE> &o, Point<TYPE> &d, vector<Point<TYPE>> &vPoints
                     // Find path
                     Line line(o, d);
                     vector<int> vFacesId;
-                    if (voronoi->getRefDcel()->findPath(vPathFaces, line, vFacesId))
+                    if (view.findPath(vPathFaces, line, vFacesId))
                     {
                         // Initialize output
                         isSuccess = true;
                         vFaces.clear();
 
-                        // Iterate path faces
+                        // Iterate path areas
                         for (auto faceId : vFacesId)
                         {
-                            // Get current face points
+                            // Get current area points
                             vector<Point<TYPE>> vFacesPoints;
-                            DcelFigureBuilder::getFacePoints(faceId, *voronoi->getRefDcel(), vFacesPoints);
+                            view.getArea(faceId, vFacesPoints);
 
                             // Add points to face
                             FaceT face = {};
@@ -123,9 +122,6 @@ bool getVoronoiPath(Point<TYPE> &o, Point<TYPE> &d, vector<Point<TYPE>> &vPoints
                     }
                 }
             }
-
-            // Free resources
-            delete voronoi;
         }
 
         // Free resources
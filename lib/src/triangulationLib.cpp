@@ -56,3 +56,30 @@ bool getDelaunay(vector<Point<TYPE>> &vPoints, Dcel &dcelOut)
 
     return isSuccess;
 }
+
+
+bool getSweepHullDelaunay(vector<Point<TYPE>> &vPoints, Dcel &dcelOut)
+{
+    bool isSuccess;       // Return value
+
+    try
+    {
+        // Build Delaunay using sweep hull algorithm
+        auto *delaunay = TriangulationFactory::createSweepHull(vPoints, isSuccess);
+        if (isSuccess)
+        {
+            // Update output
+            dcelOut = *delaunay->getRefDcel();
+
+            // Free resources
+            delete delaunay;
+        }
+    }
+    catch (std::bad_alloc& ba)
+    {
+        std::cerr << "bad_alloc caught: " << ba.what() << '\n';
+        isSuccess = false;
+    }
+
+    return isSuccess;
+}
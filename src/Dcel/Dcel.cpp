@@ -2,7 +2,9 @@
 * Includes
 ***********************************************************************************************************************/
 #include "Dcel.h"
+#include "DcelQueries.h"
 #include "Logging.h"
+#include "Predicates.h"
 
 #include <cstring>
 #include <vector>
@@ -52,7 +54,7 @@ using namespace std;
 /***********************************************************************************************************************
 * Public methods definitions
 ***********************************************************************************************************************/
-bool Dcel::imaginaryFace(int faceId)
+bool Dcel::imaginaryFace(int faceId) const
 {
     bool	imaginary=false;		// Return value.
     int		edgeIndex=0;			// Edge index.
@@ -86,10 +88,7 @@ bool Dcel::imaginaryFace(int faceId)
 
 void Dcel::getPoints(vector<Point<TYPE>> &vOut)
 {
-    for (auto v : vVertex)
-    {
-        vOut.push_back(v.getPoint());
-    }
+    vOut.insert(vOut.end(), vPoints.begin(), vPoints.end());
 }
 
 
@@ -102,16 +101,16 @@ void Dcel::getPoints(vector<Point<TYPE>> &vOut)
 * 				FALSE i.o.c.
 * Description: 	Checks if edge at "index" position is in external face.
 ***************************************************************************/
-bool Dcel::isExternalEdge(int edgeIndex)
+bool Dcel::isExternalEdge(int edgeIndex) const
 {
 	bool isExternal=false;			// Return value.
 
 	// Check index is not out of bounds.
-	if (edgeIndex < this->getNumEdges())
+	if ((size_t) edgeIndex < this->getNumEdges())
 	{
 		// Check if this edge or its twin belong face #0.
-		if ((this->vEdges.at(edgeIndex).getFace() == EXTERNAL_FACE) ||
-			(this->vEdges.at(this->vEdges.at(edgeIndex).getTwin() - 1).getFace() == EXTERNAL_FACE))
+		if ((this->getFace(edgeIndex) == EXTERNAL_FACE) ||
+			(this->getFace(this->getTwin(edgeIndex) - 1) == EXTERNAL_FACE))
 		{
 			// Edge is external.
 			isExternal = true;
@@ -140,16 +139,16 @@ bool Dcel::isExternalEdge(int edgeIndex)
 * Description: 	Checks if "edgeID" edge has an imaginary point as one of
 * 				its extreme vertex.
 ***************************************************************************/
-bool Dcel::hasNegativeVertex(int edgeID)
+bool Dcel::hasNegativeVertex(int edgeID) const
 {
     bool hasNegative=false;      // Return value.
 
 	// Check face is not out of bounds.
-	if (edgeID <= this->getNumEdges())
+	if ((size_t) edgeID <= this->getNumEdges())
 	{
 		// Check if any of the vertex of the triangle is negative.
-		if ((this->vEdges.at(edgeID - 1).getOrigin() < 0) ||
-			(this->vEdges.at(this->vEdges.at(edgeID - 1).getNext()-1).getOrigin() < 0))
+		if ((this->getOrigin(edgeID - 1) < 0) ||
+			(this->getOrigin(this->getNext(edgeID - 1)-1) < 0))
 		{
 #ifdef DEBUG_HAS_NEGATIVE_VERTEX
 	    	Logging::buildText(__FUNCTION__, __FILE__, "Edge vertex are \n");
@@ -286,7 +285,7 @@ int	Dcel::getCollinear(int pointIndex, int edgeID)
 void Dcel::sort()
 {
 	// Call quicksort with DCEL set of points.
-	quicksort(&this->vVertex.at(0), &this->vVertex.at(1), 0, this->getNumVertex() - 2);
+	quicksort(1, this->getNumVertex() - 1);
 }
 
 
@@ -300,9 +299,9 @@ int Dcel::getIndexLowest(bool (*f)(Point<TYPE> *, Point<TYPE> *))
     index = 0;
 
     // Find index of highest point.
-    for (i=1; i< this->getNumVertex() ; i++)
+    for (i=1; i< (int) this->getNumVertex() ; i++)
     {
-    	if ((*f) (this->vVertex.at(i).getRefPoint(), this->vVertex.at(index).getRefPoint()))
+    	if ((*f) (this->getRefPoint(i), this->getRefPoint(index)))
         {
     		index = i;
         }
@@ -334,7 +333,7 @@ int Dcel::getIndexHighest(bool (*f)(const Point<TYPE> *, const Point<TYPE> *))
     // Find index of highest point.
     for (size_t i=1; i< this->getNumVertex() ; i++)
     {
-    	if ((*f) (this->vVertex.at(i).getRefPoint(), this->vVertex.at(index).getRefPoint()))
+    	if ((*f) (this->getRefPoint(i), this->getRefPoint(index)))
         {
             index = i;
         }
@@ -362,91 +361,10 @@ int Dcel::getIndexHighest(bool (*f)(const Point<TYPE> *, const Point<TYPE> *))
 * Description: 	searches highest point in the DCEL vertex set and places
 * 				it in the first position of the array.
 ***************************************************************************/
-enum Turn_T Dcel::returnTurn(const Point<TYPE> *p, int sourcePoint, int destPoint)
+enum Turn_T Dcel::returnTurn(const Point<TYPE> *p, int sourcePoint, int destPoint) const
 {
-    enum Turn_T turn;         // Return value.
-
-    // Normal source point.
-    if (sourcePoint > 0)
-    {
-        // Normal destination point.
-        if (destPoint > 0)
-        {
-            // If turn right then point is not in triangle.
-			turn = this->vVertex.at(sourcePoint-1).getRefPoint()->check_Turn(*this->vVertex.at(destPoint-1).getRefPoint(), *p);
-        }
-        // Destination point is P-2.
-        else if (destPoint == P_MINUS_2)
-        {
-            if (sourcePoint == 1)
-        	{
-        		turn = LEFT_TURN;
-        	}
-            // Check if point is over line from source_Index point to P-2.
-            else if (Point<TYPE>::higher_Point(p, this->vVertex.at(sourcePoint-1).getRefPoint(), &Point<TYPE>::lexicographicHigher))
-            {
-                turn = RIGHT_TURN;
-            }
-            else
-			{
-				turn = LEFT_TURN;
-			}
-        }
-        // Destination point is P-1.
-        else
-        {
-            // Check if point is over line from source_Index point to P-1.
-            if (Point<TYPE>::higher_Point(p, this->vVertex.at(sourcePoint-1).getRefPoint(), &Point<TYPE>::lexicographicHigher))
-            {
-				turn = LEFT_TURN;
-            }
-            else
-			{
-				turn = RIGHT_TURN;
-			}
-        }
-    }
-    else
-    {
-        // Source point is P-1 and destination cannot be p-2.
-        if (sourcePoint == P_MINUS_1)
-        {
-            if (destPoint == 1)
-        	{
-        		turn = LEFT_TURN;
-        	}
-            // Check if point is over line from P-1 point to dest_Index point.
-            else if (Point<TYPE>::higher_Point(p, this->vVertex.at(destPoint-1).getRefPoint(), &Point<TYPE>::lexicographicHigher))
-            {
-				turn = RIGHT_TURN;
-            }
-            else
-			{
-				turn = LEFT_TURN;
-			}
-        }
-        // Source point is P-2.
-        else
-        {
-            // Check destination point.
-            if (destPoint != P_MINUS_1)
-            {
-				if (Point<TYPE>::higher_Point(p, this->vVertex.at(destPoint-1).getRefPoint(), &Point<TYPE>::lexicographicHigher))
-				{
-					turn = LEFT_TURN;
-				}
-				else
-				{
-					turn = RIGHT_TURN;
-				}
-            }
-            else
-			{
-				// Points can only do a left turn.
-				turn = LEFT_TURN;
-			}
-        }
-    }
+    // Same turn for any Dcel accessor.
+    enum Turn_T turn = DcelQueries::returnTurn(*this, p, sourcePoint, destPoint);
 
 #ifdef DEBUG_RETURN_TURN
 	Logging::buildText(__FUNCTION__, __FILE__, "Turn between segment points ");
@@ -523,7 +441,7 @@ double Dcel::signedArea(int id1, int id2, int id3)
 * 				"line". If so then returns true and edgeId has the id of the
 * 				intersected edge.
 ***************************************************************************/
-bool Dcel::getEdgeIntersection(Line &line, int face, queue<int> &qEdges)
+bool Dcel::getEdgeIntersection(Line &line, int face, queue<int> &qEdges) const
 {
 	int  iCurrentEdgeIdx=0;			// Edge index.
 
@@ -575,7 +493,7 @@ bool Dcel::getEdgeIntersection(Line &line, int face, queue<int> &qEdges)
 * GLOBAL:	NONE
 * Description: 	finds the list of faces where input line lays.
 ***************************************************************************/
-bool Dcel::findPath(vector<int> &vExtremeFaces, Line &line, vector<int> &vFacesId)
+bool Dcel::findPath(vector<int> &vExtremeFaces, Line &line, vector<int> &vFacesId) const
 {
 	bool found=true;		// Return value.
 
@@ -630,6 +548,12 @@ bool Dcel::findPath(vector<int> &vExtremeFaces, Line &line, vector<int> &vFacesI
 }
 
 
+bool Dcel::walkToFace(const Point<TYPE> &point, int &walkFace, int &faceId) const
+{
+    return DcelQueries::walkToFace(*this, point, walkFace, faceId);
+}
+
+
 bool Dcel::isInsideFace(const Point<TYPE> &p, int faceId)
 {
 	bool inner=true;		// Return value
@@ -664,13 +588,15 @@ bool Dcel::isInsideFace(const Point<TYPE> &p, int faceId)
 ***********************************************************************************************************************/
 /***************************************************************************
 * Name: 	quicksort
-* IN:		N/A
+* IN:		first		first vertex index to sort
+* 			last		last vertex index to sort
 * OUT:		N/A
 * IN/OUT:	N/A
 * RETURN:	N/A
-* Description: clutters the set of point of the DCEL.
+* Description: sorts vertex in [first, last] range by angle with respect
+* 				to the vertex at first position of the DCEL.
 ***************************************************************************/
-void Dcel::quicksort(Vertex *origin, Vertex *list, int first, int last)
+void Dcel::quicksort(int first, int last)
 {
 	int pivotIndex=0;			// Index of the element used as pivot.
 
@@ -678,35 +604,37 @@ void Dcel::quicksort(Vertex *origin, Vertex *list, int first, int last)
     if(first < last)
 	{
 		// Move first element to its position.
-    	pivotIndex = movePivot(origin, list, first, last);
+    	pivotIndex = movePivot(first, last);
 
 		// Order from initial element to previous element to pivot.
-		quicksort(origin, list, first, pivotIndex-1);
+		quicksort(first, pivotIndex-1);
 
 		// Order from next element to pivot until end of set.
-		quicksort(origin, list, pivotIndex+1, last);
+		quicksort(pivotIndex+1, last);
 	}
 }
 
 
 /***************************************************************************
 * Name: 	movePivot
-* IN:		N/A
+* IN:		first		first vertex index to sort
+* 			last		last vertex index to sort
 * OUT:		N/A
 * IN/OUT:	N/A
-* RETURN:	N/A
-* Description: clutters the set of point of the DCEL.
+* RETURN:	final position of the pivot vertex
+* Description: places the vertex at first position in its sorted position.
 ***************************************************************************/
-int	 Dcel::movePivot(Vertex *origin, Vertex *list, int first, int last)
+int	 Dcel::movePivot(int first, int last)
 {
     int pivotIndex=0;				// Return value.
 	int i=0, firstIndex=0;			// Loop variables.
-	Vertex pivotPoint;				// Pivot point.
-	Vertex temp;					// Register to exchange elements in list.
+	Point<TYPE> origin;				// Origin point.
+	Point<TYPE> pivotPoint;			// Pivot point.
 
 	// Get position and value of pivot point.
     pivotIndex = first;
-    pivotPoint = list[pivotIndex];
+    origin = *this->getRefPoint(0);
+    pivotPoint = *this->getRefPoint(pivotIndex);
 
 	// Set first index.
 	firstIndex = first + 1;
@@ -715,24 +643,21 @@ int	 Dcel::movePivot(Vertex *origin, Vertex *list, int first, int last)
     for (i=firstIndex; i<=last; i++)
 	{
 		// If turn is right then angle is lower in list[i] than in pivot element.
-		if ((origin->getRefPoint()->check_Turn(*pivotPoint.getRefPoint(), *list[i].getRefPoint()) == RIGHT_TURN) ||
-		   ((origin->getRefPoint()->check_Turn(*pivotPoint.getRefPoint(), *list[i].getRefPoint()) == COLLINEAR) &&
-			(pivotPoint.getPoint().getX() > list[i].getPoint().getX())))
+		Point<TYPE> *point = this->getRefPoint(i);
+		Turn_T turn = origin.check_Turn(pivotPoint, *point);
+		if ((turn == RIGHT_TURN) ||
+		   ((turn == COLLINEAR) && (pivotPoint.getX() > point->getX())))
 		{
 			// Increase pivot index.
 			pivotIndex++;
 
 			// Move current element to lower position in set.
-            temp = list[i];
-            list[i] = list[pivotIndex];
-            list[pivotIndex] = temp;
+            this->swapVertex(i, pivotIndex);
 		}
 	}
 
 	// Move pivot point.
-    temp = list[first];
-    list[first] = list[pivotIndex];
-    list[pivotIndex] = temp;
+    this->swapVertex(first, pivotIndex);
 
 	return(pivotIndex);
 }
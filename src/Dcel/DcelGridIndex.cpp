@@ -0,0 +1,273 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "DcelGridIndex.h"
+#include "DcelQueries.h"
+#include "Parallel.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+/***********************************************************************************************************************
+* Public methods definitions
+***********************************************************************************************************************/
+template <class M> bool BasicDcelGridIndex<M>::build(const M &dcelIn, size_t szNumThreads)
+{
+    this->reset();
+
+    // Check there is at least one triangle
+    size_t szNumVertex = dcelIn.getNumVertex();
+    if ((szNumVertex == 0) || (dcelIn.getNumFaces() <= 1))
+    {
+        return false;
+    }
+    this->dcel = &dcelIn;
+
+    // Compute bounding box
+    this->minPoint = *this->dcel->getRefPoint(0);
+    Point<TYPE> maxPoint = this->minPoint;
+    for (size_t i=1; i<szNumVertex ;i++)
+    {
+        const Point<TYPE> *point = this->dcel->getRefPoint((int) i);
+        this->minPoint.setX(std::min(this->minPoint.getX(), point->getX()));
+        this->minPoint.setY(std::min(this->minPoint.getY(), point->getY()));
+        maxPoint.setX(std::max(maxPoint.getX(), point->getX()));
+        maxPoint.setY(std::max(maxPoint.getY(), point->getY()));
+    }
+
+    // Cells size so there is roughly one vertex per cell. Neither side has more cells than vertices so thin bounding
+    // boxes do not allocate a huge grid: there are at most 3n+1 cells
+    TYPE width = maxPoint.getX() - this->minPoint.getX();
+    TYPE height = maxPoint.getY() - this->minPoint.getY();
+    this->cellSize = std::max(std::sqrt(width*height / (TYPE) szNumVertex),
+                              std::max(width, height) / (TYPE) szNumVertex);
+    if (this->cellSize <= 0.0)
+    {
+        this->cellSize = 1.0;
+    }
+    this->szNumColumns = (size_t) (width / this->cellSize) + 1;
+    this->szNumRows = (size_t) (height / this->cellSize) + 1;
+    this->vSeeds.assign(this->szNumColumns*this->szNumRows, INVALID);
+
+    // Compute cell and a real face of every vertex
+    vector<size_t> vCells(szNumVertex);
+    vector<int> vFaces(szNumVertex);
+    Parallel::runChunks(szNumVertex, GRID_INDEX_MIN_ELEMENTS_THREAD, szNumThreads, [&](size_t first, size_t last)
+    {
+        for (size_t i=first; i<last ;i++)
+        {
+            vCells[i] = this->getCell(*this->dcel->getRefPoint((int) i));
+            vFaces[i] = this->getRealFace((int) i);
+        }
+        return true;
+    });
+
+    // Set faces as cells seeds
+    for (size_t i=0; i<szNumVertex ;i++)
+    {
+        if (vFaces[i] != INVALID)
+        {
+            this->vSeeds[vCells[i]] = vFaces[i];
+        }
+    }
+    this->fillEmptyCells(szNumThreads);
+
+    // No real face found
+    if (this->vSeeds.front() == INVALID)
+    {
+        this->reset();
+        return false;
+    }
+
+    return true;
+}
+
+
+template <class M> bool BasicDcelGridIndex<M>::attach(const M &dcelIn)
+{
+    for (auto seed : this->vSeeds)
+    {
+        if ((seed <= EXTERNAL_FACE) || (seed >= (int) dcelIn.getNumFaces()))
+        {
+            return false;
+        }
+    }
+
+    this->dcel = &dcelIn;
+    return this->isBuilt();
+}
+
+
+template <class M> void BasicDcelGridIndex<M>::reset()
+{
+    this->dcel = nullptr;
+    this->minPoint.setOrigin();
+    this->cellSize = 0.0;
+    this->szNumColumns = 0;
+    this->szNumRows = 0;
+    this->vSeeds.clear();
+}
+
+
+template <class M> bool BasicDcelGridIndex<M>::findFace(const Point<TYPE> &point, int &faceId) const
+{
+    if ((this->dcel == nullptr) || !this->isBuilt())
+    {
+        return false;
+    }
+
+    int walkFace = this->vSeeds[this->getCell(point)];
+    if (!DcelQueries::walkToFace(*this->dcel, point, walkFace, faceId))
+    {
+        return false;
+    }
+
+    // Imaginary faces are out of the convex hull
+    if ((faceId != EXTERNAL_FACE) && DcelQueries::imaginaryFace(*this->dcel, faceId))
+    {
+        faceId = EXTERNAL_FACE;
+    }
+
+    return true;
+}
+
+
+template <class M> void BasicDcelGridIndex<M>::update(int faceId)
+{
+    if ((this->dcel == nullptr) || !this->isBuilt() || (faceId <= EXTERNAL_FACE) ||
+        (faceId >= (int) this->dcel->getNumFaces()) || DcelQueries::imaginaryFace(*this->dcel, faceId))
+    {
+        return;
+    }
+
+    int ids[NPOINTS_TRIANGLE];
+    DcelQueries::getFaceVertices(*this->dcel, faceId, ids);
+    for (auto id : ids)
+    {
+        this->vSeeds[this->getCell(*this->dcel->getRefPoint(id-1))] = faceId;
+    }
+}
+
+
+template <class M> size_t BasicDcelGridIndex<M>::getCell(const Point<TYPE> &point) const
+{
+    // Points out of the grid are moved to the closest border cell
+    TYPE column = std::floor((point.getX() - this->minPoint.getX()) / this->cellSize);
+    TYPE row = std::floor((point.getY() - this->minPoint.getY()) / this->cellSize);
+    column = std::min(std::max(column, (TYPE) 0.0), (TYPE) (this->szNumColumns - 1));
+    row = std::min(std::max(row, (TYPE) 0.0), (TYPE) (this->szNumRows - 1));
+
+    return ((size_t) row)*this->szNumColumns + (size_t) column;
+}
+
+
+/***********************************************************************************************************************
+* Private methods definitions
+***********************************************************************************************************************/
+/**
+ * @fn      getRealFace
+ * @brief   Gets a face of the vertex that is not external nor imaginary
+ *
+ * @param   pointIndex  (IN)    Vertex index
+ * @return  face id
+ *          INVALID if all faces of the vertex are external or imaginary
+ */
+template <class M> int BasicDcelGridIndex<M>::getRealFace(int pointIndex) const
+{
+    int iFirstEdgeIdx = this->dcel->getPointEdge(pointIndex) - 1;
+    if (iFirstEdgeIdx < 0)
+    {
+        return INVALID;
+    }
+
+    int iEdgeIdx = iFirstEdgeIdx;
+    do
+    {
+        int faceId = this->dcel->getFace(iEdgeIdx);
+        if ((faceId != EXTERNAL_FACE) && !DcelQueries::imaginaryFace(*this->dcel, faceId))
+        {
+            return faceId;
+        }
+        iEdgeIdx = this->dcel->getTwin(this->dcel->getPrevious(iEdgeIdx)-1) - 1;
+    } while (iEdgeIdx != iFirstEdgeIdx);
+
+    return INVALID;
+}
+
+
+/**
+ * @fn      fillEmptyCells
+ * @brief   Sets seed of cells without vertices. Every row copies the seed of the closest previous cell (or the first
+ *          seed of the row for leading cells) and rows without vertices copy the closest previous non empty row (or
+ *          the first non empty row for leading rows)
+ *
+ * @param   szNumThreads    (IN)    Number of threads
+ */
+template <class M> void BasicDcelGridIndex<M>::fillEmptyCells(size_t szNumThreads)
+{
+    // Rows are independent
+    size_t szMinRows = (GRID_INDEX_MIN_ELEMENTS_THREAD + this->szNumColumns - 1) / this->szNumColumns;
+    Parallel::runChunks(this->szNumRows, szMinRows, szNumThreads, [&](size_t first, size_t last)
+    {
+        for (size_t row=first; row<last ;row++)
+        {
+            auto itFirst = this->vSeeds.begin() + row*this->szNumColumns;
+            auto itLast = itFirst + this->szNumColumns;
+            auto itSeed = std::find_if(itFirst, itLast, [](int seed) { return seed != INVALID; });
+            if (itSeed == itLast)
+            {
+                continue;
+            }
+
+            int seed = *itSeed;
+            for (auto it=itFirst; it != itLast ; it++)
+            {
+                if (*it == INVALID)
+                {
+                    *it = seed;
+                }
+                seed = *it;
+            }
+        }
+        return true;
+    });
+
+    // Copy rows without vertices
+    int firstRow = INVALID;
+    int previousRow = INVALID;
+    for (size_t row=0; row<this->szNumRows ;row++)
+    {
+        auto itRow = this->vSeeds.begin() + row*this->szNumColumns;
+        if (*itRow != INVALID)
+        {
+            previousRow = (int) row;
+            if (firstRow == INVALID)
+            {
+                firstRow = (int) row;
+            }
+        }
+        else if (previousRow != INVALID)
+        {
+            auto itPrevious = this->vSeeds.begin() + previousRow*this->szNumColumns;
+            std::copy(itPrevious, itPrevious + this->szNumColumns, itRow);
+        }
+    }
+
+    // Leading rows without vertices
+    if (firstRow != INVALID)
+    {
+        auto itFirst = this->vSeeds.begin() + firstRow*this->szNumColumns;
+        for (int row=0; row<firstRow ;row++)
+        {
+            std::copy(itFirst, itFirst + this->szNumColumns, this->vSeeds.begin() + row*this->szNumColumns);
+        }
+    }
+}
+
+
+/***********************************************************************************************************************
+* Explicit instantiations
+***********************************************************************************************************************/
+template class BasicDcelGridIndex<Dcel>;
+template class BasicDcelGridIndex<MappedDcel>;
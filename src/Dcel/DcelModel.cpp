@@ -2,8 +2,10 @@
 * Includes
 ***********************************************************************************************************************/
 #include "DcelModel.h"
+#include "HugePages.h"
 #include "Logging.h"
 
+#include <utility>
 
 
 /***********************************************************************************************************************
@@ -20,14 +22,28 @@
 ***************************************************************************/
 void DcelModel::addVertex(const Point<TYPE> *p, const int edge)
 {
-    Vertex v(edge, *p);
-    vVertex.push_back(v);
+    vPoints.push_back(*p);
+    vPointEdge.push_back(edge);
 }
 
 
 void DcelModel::addVertex(const Vertex &v)
 {
-    vVertex.push_back(v);
+    vPoints.push_back(v.getPoint());
+    vPointEdge.push_back(v.getOrigin());
+}
+
+
+/**
+ * @fn          getVertex
+ * @brief       Builds a vertex from the point data at index position
+ *
+ * @param pointIndex    (IN) Point index
+ * @return      vertex data
+ */
+Vertex DcelModel::getVertex(int pointIndex) const
+{
+    return Vertex(DcelAccess::get(vPointEdge, pointIndex), DcelAccess::get(vPoints, pointIndex));
 }
 
 
@@ -44,10 +60,10 @@ void DcelModel::addVertex(const Vertex &v)
 void DcelModel::updateVertex(int edge_ID, int index)
 {
     // Check if index is out of bounds.
-    if (index < this->vVertex.size())
+    if ((size_t) index < this->vPoints.size())
     {
         // Update vertex edge.
-        this->vVertex.at(index).setOrigin(edge_ID);
+        this->vPointEdge[index] = edge_ID;
 #ifdef DEBUG_UPDATE_VERTEX_EDGE_AT
         Logging::buildText(__FUNCTION__, __FILE__, "Update vertex ");
 		Logging::buildText(__FUNCTION__, __FILE__, index+1);
@@ -62,7 +78,7 @@ void DcelModel::updateVertex(int edge_ID, int index)
         Logging::buildText(__FUNCTION__, __FILE__, "Index ");
         Logging::buildText(__FUNCTION__, __FILE__, index);
         Logging::buildText(__FUNCTION__, __FILE__, " out of bounds: ");
-        Logging::buildRange(__FUNCTION__, __FILE__, 0, this->vVertex.size());
+        Logging::buildRange(__FUNCTION__, __FILE__, 0, this->vPoints.size());
         Logging::write(true, Error);
     }
 }
@@ -80,10 +96,10 @@ void DcelModel::updateVertex(int edge_ID, int index)
 void DcelModel::updateVertex(Point<TYPE> *p, int index)
 {
     // Check if index is out of bounds.
-    if (index < this->vVertex.size())
+    if ((size_t) index < this->vPoints.size())
     {
         // Update vertex edge.
-        this->vVertex.at(index).setPoint(p);
+        this->vPoints[index] = *p;
 #ifdef DEBUG_UPDATE_VERTEX_EDGE_AT
         Logging::buildText(__FUNCTION__, __FILE__, "Vertex ");
 		Logging::buildText(__FUNCTION__, __FILE__, index+1);
@@ -98,7 +114,7 @@ void DcelModel::updateVertex(Point<TYPE> *p, int index)
         Logging::buildText(__FUNCTION__, __FILE__, "Index ");
         Logging::buildText(__FUNCTION__, __FILE__, index);
         Logging::buildText(__FUNCTION__, __FILE__, " out of bounds: ");
-        Logging::buildRange(__FUNCTION__, __FILE__, 0, this->vVertex.size());
+        Logging::buildRange(__FUNCTION__, __FILE__, 0, this->vPoints.size());
         Logging::write(true, Error);
     }
 }
@@ -118,14 +134,32 @@ void DcelModel::updateVertex(Point<TYPE> *p, int index)
 ***************************************************************************/
 void DcelModel::addEdge(int origin, int twin, int previous, int next, int face)
 {
-    Edge e(origin, twin, previous, next, face);
-    this->vEdges.push_back(e);
+    this->vOrigin.push_back(origin);
+    this->vTwin.push_back(twin);
+    this->vPrevious.push_back(previous);
+    this->vNext.push_back(next);
+    this->vEdgeFace.push_back(face);
 }
 
 
 void DcelModel::addEdge(Edge &edge)
 {
-    this->vEdges.push_back(edge);
+    this->addEdge(edge.getOrigin(), edge.getTwin(), edge.getPrevious(), edge.getNext(), edge.getFace());
+}
+
+
+/**
+ * @fn          getEdge
+ * @brief       Builds an edge from the edge fields at index position
+ *
+ * @param edgeIndex     (IN) Edge index
+ * @return      edge data
+ */
+Edge DcelModel::getEdge(int edgeIndex) const
+{
+    return Edge(DcelAccess::get(vOrigin, edgeIndex), DcelAccess::get(vTwin, edgeIndex),
+                DcelAccess::get(vPrevious, edgeIndex), DcelAccess::get(vNext, edgeIndex),
+                DcelAccess::get(vEdgeFace, edgeIndex));
 }
 
 
@@ -146,7 +180,7 @@ void DcelModel::addEdge(Edge &edge)
 void DcelModel::updateEdge(int origin, int twin, int previous, int next, int face, int index)
 {
     // Check if faces vector is full.
-    if (index < this->vEdges.size())
+    if ((size_t) index < this->getNumEdges())
     {
 #ifdef DEBUG_UPDATE_EDGE
         Logging::buildText(__FUNCTION__, __FILE__, "Updating edge ");
@@ -170,31 +204,31 @@ void DcelModel::updateEdge(int origin, int twin, int previous, int next, int fac
         // Check if origin point field must be updated.
         if (origin != NO_UPDATE)
         {
-            this->vEdges.at(index).setOrigin(origin);
+            this->setOrigin(index, origin);
         }
 
         // Check if twin edge field must be updated.
         if (twin != NO_UPDATE)
         {
-            this->vEdges.at(index).setTwin(twin);
+            this->setTwin(index, twin);
         }
 
         // Check if previous edge field must be updated.
         if (previous != NO_UPDATE)
         {
-            this->vEdges.at(index).setPrevious(previous);
+            this->setPrevious(index, previous);
         }
 
         // Check if next edge field must be updated.
         if (next != NO_UPDATE)
         {
-            this->vEdges.at(index).setNext(next);
+            this->setNext(index, next);
         }
 
         // Check if face field must be updated.
         if (face != NO_UPDATE)
         {
-            this->vEdges.at(index).setFace(face);
+            this->setFace(index, face);
         }
     }
     else
@@ -203,7 +237,7 @@ void DcelModel::updateEdge(int origin, int twin, int previous, int next, int fac
         Logging::buildText(__FUNCTION__, __FILE__, "Updating edge with index ");
         Logging::buildText(__FUNCTION__, __FILE__, index);
         Logging::buildText(__FUNCTION__, __FILE__, " out of bounds.");
-        Logging::buildRange(__FUNCTION__, __FILE__, 0, this->vEdges.size());
+        Logging::buildRange(__FUNCTION__, __FILE__, 0, this->getNumEdges());
         Logging::write(true, Error);
     }
 }
@@ -263,14 +297,11 @@ void DcelModel::updateFace(int edge_ID, int index)
 ***************************************************************************/
 void DcelModel::swapVertex(int index1, int index2)
 {
-    Vertex vertex;	// Temporary variable.
-
-    if ((index1 < this->getNumVertex()) || (index2 < this->getNumVertex()))
+    if (((size_t) index1 < this->getNumVertex()) || ((size_t) index2 < this->getNumVertex()))
     {
         // Swap vertices.
-        vertex = this->vVertex.at(index1);
-        this->vVertex.at(index1) = this->vVertex.at(index2);
-        this->vVertex.at(index2) = vertex;
+        std::swap(this->vPoints.at(index1), this->vPoints.at(index2));
+        std::swap(this->vPointEdge.at(index1), this->vPointEdge.at(index2));
     }
     else
     {
@@ -283,10 +314,10 @@ void DcelModel::swapVertex(int index1, int index2)
 }
 
 
-void DcelModel::getEdgePoints(int edgeIndex, Point<TYPE> &origin, Point<TYPE> &dest)
+void DcelModel::getEdgePoints(int edgeIndex, Point<TYPE> &origin, Point<TYPE> &dest) const
 {
 #ifdef DEBUG_OUTOFBOUNDS_EXCEPTION
-    if (edgeIndex >= this->getNumEdges())
+    if ((size_t) edgeIndex >= this->getNumEdges())
 	{
 		Logging::buildText(__FUNCTION__, __FILE__, "Edge index out of bounds");
 		Logging::buildText(__FUNCTION__, __FILE__, edgeIndex);
@@ -307,7 +338,7 @@ void DcelModel::getEdgePoints(int edgeIndex, Point<TYPE> &origin, Point<TYPE> &d
 }
 
 
-void DcelModel::getFaceVertices(int faceIndex, int *ids)
+void DcelModel::getFaceVertices(int faceIndex, int *ids) const
 {
     int		edgeIndex=0;			// Edge index.
 
@@ -339,15 +370,20 @@ void DcelModel::getFacePoints(int faceIndex, vector<Point<TYPE>> &vPoints)
 void DcelModel::reset(bool isResetPoints)
 {
     // Check if points must be reset
-    if (isResetPoints && !this->vVertex.empty())
+    if (isResetPoints && !this->vPoints.empty())
     {
-        this->vVertex.clear();
+        this->vPoints.clear();
+        this->vPointEdge.clear();
     }
 
     // Reset edges
-    if (!this->vEdges.empty())
+    if (!this->vOrigin.empty())
     {
-        this->vEdges.clear();
+        this->vOrigin.clear();
+        this->vTwin.clear();
+        this->vPrevious.clear();
+        this->vNext.clear();
+        this->vEdgeFace.clear();
     }
 
     // Reset faces
@@ -358,12 +394,69 @@ void DcelModel::reset(bool isResetPoints)
 }
 
 
+void DcelModel::reserve(size_t szNumPoints, size_t szNumEdges, size_t szNumFaces, bool isHugePages)
+{
+    this->vPoints.reserve(szNumPoints);
+    this->vPointEdge.reserve(szNumPoints);
+    this->vOrigin.reserve(szNumEdges);
+    this->vTwin.reserve(szNumEdges);
+    this->vPrevious.reserve(szNumEdges);
+    this->vNext.reserve(szNumEdges);
+    this->vEdgeFace.reserve(szNumEdges);
+    this->vFaces.reserve(szNumFaces);
+
+    if (isHugePages)
+    {
+        HugePages::advise(this->vOrigin);
+        HugePages::advise(this->vTwin);
+        HugePages::advise(this->vPrevious);
+        HugePages::advise(this->vNext);
+        HugePages::advise(this->vEdgeFace);
+    }
+}
+
+
+void DcelModel::reserveTriangulation(size_t szNumVertex, bool isHugePages)
+{
+    size_t szNumEdges = (szNumVertex < NPOINTS_TRIANGLE) ? 0 : 6*szNumVertex - 12;
+    size_t szNumFaces = (szNumVertex < NPOINTS_TRIANGLE) ? 0 : 2*szNumVertex - 4;
+    this->reserve(this->vPoints.size(), szNumEdges, szNumFaces, isHugePages);
+}
+
+
+void DcelModel::swapEdges(DcelModel &other)
+{
+    this->vOrigin.swap(other.vOrigin);
+    this->vTwin.swap(other.vTwin);
+    this->vPrevious.swap(other.vPrevious);
+    this->vNext.swap(other.vNext);
+    this->vEdgeFace.swap(other.vEdgeFace);
+    this->vFaces.swap(other.vFaces);
+}
+
+
+void DcelModel::resize(size_t szNumEdges, size_t szNumFaces)
+{
+    this->vOrigin.resize(szNumEdges, INVALID);
+    this->vTwin.resize(szNumEdges, INVALID);
+    this->vPrevious.resize(szNumEdges, INVALID);
+    this->vNext.resize(szNumEdges, INVALID);
+    this->vEdgeFace.resize(szNumEdges, INVALID);
+    this->vFaces.resize(szNumFaces, Face(INVALID));
+}
+
+
 bool DcelModel::operator==(const DcelModel& other) const
 {
     bool isEqual;	    // Return value.
 
-    isEqual =  ((this->vVertex == other.vVertex) &&
-                (this->vEdges == other.vEdges) &&
+    isEqual =  ((this->vPoints == other.vPoints) &&
+                (this->vPointEdge == other.vPointEdge) &&
+                (this->vOrigin == other.vOrigin) &&
+                (this->vTwin == other.vTwin) &&
+                (this->vPrevious == other.vPrevious) &&
+                (this->vNext == other.vNext) &&
+                (this->vEdgeFace == other.vEdgeFace) &&
                 (this->vFaces == other.vFaces));
 
     return(isEqual);
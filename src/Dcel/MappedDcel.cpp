@@ -0,0 +1,118 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "Logging.h"
+#include "MappedDcel.h"
+#include "MappedLayout.h"
+
+
+/***********************************************************************************************************************
+* Public methods definitions
+***********************************************************************************************************************/
+bool MappedDcel::open(const string &strFileName)
+{
+    this->close();
+    if (!this->file.open(strFileName))
+    {
+        return false;
+    }
+
+    static_assert(sizeof(Face) == sizeof(int), "Face must be stored as its edge id");
+    vector<size_t> vElementSizes(MAPPED_DCEL_NUM_SECTIONS, sizeof(int));
+    vElementSizes[MAPPED_DCEL_POINTS] = sizeof(Point<TYPE>);
+    const MappedHeader *header = MappedLayout::check(this->file.getData(), this->file.getSize(), MAPPED_DCEL_MAGIC,
+                                                     vElementSizes);
+
+    // Every edge array must have the same length
+    const MappedSection *sections = (header != nullptr) ? header->arrSections : nullptr;
+    bool isSuccess = (sections != nullptr) &&
+                     (sections[MAPPED_DCEL_POINTS].count == sections[MAPPED_DCEL_POINT_EDGE].count);
+    for (int i=MAPPED_DCEL_TWIN; isSuccess && (i<=MAPPED_DCEL_EDGE_FACE) ;i++)
+    {
+        isSuccess = sections[i].count == sections[MAPPED_DCEL_ORIGIN].count;
+    }
+
+    if (!isSuccess)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Invalid mapped Dcel file: ");
+        Logging::buildText(__FUNCTION__, __FILE__, strFileName);
+        Logging::write(true, Error);
+        this->close();
+        return false;
+    }
+
+    const char *data = this->file.getData();
+    this->points = (const Point<TYPE> *) &data[sections[MAPPED_DCEL_POINTS].offset];
+    this->pointEdge = (const int *) &data[sections[MAPPED_DCEL_POINT_EDGE].offset];
+    this->origin = (const int *) &data[sections[MAPPED_DCEL_ORIGIN].offset];
+    this->twin = (const int *) &data[sections[MAPPED_DCEL_TWIN].offset];
+    this->previous = (const int *) &data[sections[MAPPED_DCEL_PREVIOUS].offset];
+    this->next = (const int *) &data[sections[MAPPED_DCEL_NEXT].offset];
+    this->edgeFace = (const int *) &data[sections[MAPPED_DCEL_EDGE_FACE].offset];
+    this->faces = (const int *) &data[sections[MAPPED_DCEL_FACES].offset];
+    this->szNumVertex = sections[MAPPED_DCEL_POINTS].count;
+    this->szNumEdges = sections[MAPPED_DCEL_ORIGIN].count;
+    this->szNumFaces = sections[MAPPED_DCEL_FACES].count;
+    return true;
+}
+
+
+void MappedDcel::close()
+{
+    this->file.close();
+    this->points = nullptr;
+    this->pointEdge = nullptr;
+    this->origin = nullptr;
+    this->twin = nullptr;
+    this->previous = nullptr;
+    this->next = nullptr;
+    this->edgeFace = nullptr;
+    this->faces = nullptr;
+    this->szNumVertex = 0;
+    this->szNumEdges = 0;
+    this->szNumFaces = 0;
+}
+
+
+bool MappedDcel::toDcel(Dcel &dcel) const
+{
+    if (!this->isOpen())
+    {
+        return false;
+    }
+
+    dcel.reset();
+    dcel.reserve(this->szNumVertex, this->szNumEdges, this->szNumFaces);
+    for (size_t i=0; i<this->szNumVertex ;i++)
+    {
+        dcel.addVertex(&this->points[i], this->pointEdge[i]);
+    }
+
+    for (size_t i=0; i<this->szNumEdges ;i++)
+    {
+        dcel.addEdge(this->origin[i], this->twin[i], this->previous[i], this->next[i], this->edgeFace[i]);
+    }
+
+    for (size_t i=0; i<this->szNumFaces ;i++)
+    {
+        dcel.addFace(this->faces[i]);
+    }
+
+    return true;
+}
+
+
+void MappedDcel::getFaceVertices(int faceIndex, int *ids) const
+{
+    int edgeIndex = this->getFaceEdge(faceIndex) - 1;
+    ids[0] = this->getOrigin(edgeIndex);
+    ids[1] = this->getOrigin(this->getNext(edgeIndex)-1);
+    ids[2] = this->getOrigin(this->getPrevious(edgeIndex)-1);
+}
+
+
+void MappedDcel::getEdgePoints(int edgeIndex, Point<TYPE> &originPoint, Point<TYPE> &destPoint) const
+{
+    originPoint = *this->getRefPoint(this->getOrigin(edgeIndex)-1);
+    destPoint = *this->getRefPoint(this->getOrigin(this->getTwin(edgeIndex)-1)-1);
+}
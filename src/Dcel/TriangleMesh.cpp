@@ -0,0 +1,126 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "TriangleMesh.h"
+#include "TriangleMeshView.h"
+
+#include <algorithm>
+
+
+/***********************************************************************************************************************
+* Public methods definitions
+***********************************************************************************************************************/
+void TriangleMesh::fromDcel(Dcel &dcel, bool isImaginaryKept)
+{
+    this->reset();
+    dcel.getPoints(this->vPoints);
+
+    // Copy real triangles edges and map every dcel edge to its mesh edge id
+    vector<int> vMeshEdge(dcel.getNumEdges(), NO_TWIN);
+    vector<int> vDcelEdge;
+    this->vCorners.reserve(dcel.getNumEdges());
+    vDcelEdge.reserve(dcel.getNumEdges());
+    for (int faceId=1; faceId<(int) dcel.getNumFaces() ;faceId++)
+    {
+        if ((dcel.getFaceEdge(faceId) <= 0) || (!isImaginaryKept && dcel.imaginaryFace(faceId)))
+        {
+            continue;
+        }
+
+        int edgeIndex = dcel.getFaceEdge(faceId) - 1;
+        for (int i=0; i<NPOINTS_TRIANGLE ;i++)
+        {
+            vMeshEdge[edgeIndex] = (int) this->vCorners.size() + 1;
+            this->vCorners.push_back(dcel.getOrigin(edgeIndex));
+            vDcelEdge.push_back(edgeIndex);
+            edgeIndex = dcel.getNext(edgeIndex) - 1;
+        }
+    }
+
+    // Twins that are not in a mesh triangle are convex hull edges
+    this->vTwins.resize(this->vCorners.size());
+    for (size_t i=0; i<vDcelEdge.size() ;i++)
+    {
+        this->vTwins[i] = vMeshEdge[dcel.getTwin(vDcelEdge[i]) - 1];
+    }
+}
+
+
+bool TriangleMesh::toDcel(Dcel &dcel) const
+{
+    dcel.reset();
+
+    // View computes the external face edges
+    TriangleMeshView view(*this);
+    if (!view.build())
+    {
+        return false;
+    }
+
+    dcel.reserve(view.getNumVertex(), view.getNumEdges(), view.getNumFaces());
+    for (int pointIndex=0; pointIndex<(int) view.getNumVertex() ;pointIndex++)
+    {
+        dcel.addVertex(view.getRefPoint(pointIndex), view.getPointEdge(pointIndex));
+    }
+
+    for (int edgeIndex=0; edgeIndex<(int) view.getNumEdges() ;edgeIndex++)
+    {
+        dcel.addEdge(view.getOrigin(edgeIndex), view.getTwin(edgeIndex), view.getPrevious(edgeIndex),
+                     view.getNext(edgeIndex), view.getFace(edgeIndex));
+    }
+
+    for (int faceId=0; faceId<(int) view.getNumFaces() ;faceId++)
+    {
+        dcel.addFace(view.getFaceEdge(faceId));
+    }
+
+    return true;
+}
+
+
+void TriangleMesh::set(vector<Point<TYPE>> &vPointsIn, vector<int> &vCornersIn, vector<int> &vTwinsIn)
+{
+    this->vPoints.swap(vPointsIn);
+    this->vCorners.swap(vCornersIn);
+    this->vTwins.swap(vTwinsIn);
+    vPointsIn.clear();
+    vCornersIn.clear();
+    vTwinsIn.clear();
+}
+
+
+void TriangleMesh::reset()
+{
+    this->vPoints.clear();
+    this->vCorners.clear();
+    this->vTwins.clear();
+}
+
+
+bool TriangleMesh::hasImaginaryFaces() const
+{
+    return std::any_of(this->vCorners.begin(), this->vCorners.end(), [](int corner) { return corner < 0; });
+}
+
+
+void TriangleMesh::getFaceVertices(int faceId, int *ids) const
+{
+    int edgeIndex = getFaceEdge(faceId) - 1;
+    for (int i=0; i<NPOINTS_TRIANGLE ;i++)
+    {
+        ids[i] = this->vCorners.at(edgeIndex + i);
+    }
+}
+
+
+void TriangleMesh::getFacePoints(int faceId, vector<Point<TYPE>> &vFacePoints) const
+{
+    int ids[NPOINTS_TRIANGLE];
+    this->getFaceVertices(faceId, ids);
+
+    vFacePoints.clear();
+    for (int id : ids)
+    {
+        vFacePoints.push_back(this->vPoints.at(id-1));
+    }
+}
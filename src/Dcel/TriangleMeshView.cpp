@@ -0,0 +1,78 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "Logging.h"
+#include "TriangleMeshView.h"
+
+
+/***********************************************************************************************************************
+* Public methods definitions
+***********************************************************************************************************************/
+bool TriangleMeshView::build()
+{
+    size_t szNumPoints = this->mesh->getNumVertex();
+    this->numMeshEdges = (int) this->mesh->getNumEdges();
+    this->firstHullEdge = INVALID;
+    this->vPointEdge.assign(szNumPoints, INVALID);
+    this->vHullEdge.assign(szNumPoints - P_MINUS_2, INVALID);
+    this->vHullTwin.clear();
+
+    // First edge of every point and external face edge that departs from every convex hull edge destination
+    for (int edgeIndex=0; edgeIndex<this->numMeshEdges ;edgeIndex++)
+    {
+        int origin = this->mesh->getOrigin(edgeIndex);
+        if ((origin < P_MINUS_2) || (origin == 0) || (origin > (int) szNumPoints))
+        {
+            Logging::buildText(__FUNCTION__, __FILE__, "Invalid point id ");
+            Logging::buildText(__FUNCTION__, __FILE__, origin);
+            Logging::write(true, Error);
+            return false;
+        }
+
+        if ((origin > 0) && (this->vPointEdge[origin-1] == INVALID))
+        {
+            this->vPointEdge[origin-1] = edgeIndex+1;
+        }
+
+        if (!this->mesh->isExternalEdge(edgeIndex))
+        {
+            continue;
+        }
+
+        int hullOrigin = this->mesh->getOrigin(TriangleMesh::getNext(edgeIndex)-1);
+        int &hullEdge = this->vHullEdge[this->getSlot(hullOrigin)];
+        if (hullEdge != INVALID)
+        {
+            Logging::buildText(__FUNCTION__, __FILE__, "Convex hull is not a simple polygon at point ");
+            Logging::buildText(__FUNCTION__, __FILE__, hullOrigin);
+            Logging::write(true, Error);
+            return false;
+        }
+        hullEdge = this->numMeshEdges + (int) this->vHullTwin.size() + 1;
+        this->vHullTwin.push_back(edgeIndex+1);
+    }
+
+    // Link external face edges: next edge starts at the origin of the twin edge
+    this->vHullPrevious.assign(this->vHullTwin.size(), INVALID);
+    this->vHullNext.assign(this->vHullTwin.size(), INVALID);
+    for (size_t i=0; i<this->vHullTwin.size() ;i++)
+    {
+        int next = this->vHullEdge[this->getSlot(this->mesh->getOrigin(this->vHullTwin[i]-1))];
+        if (next == INVALID)
+        {
+            Logging::buildText(__FUNCTION__, __FILE__, "Convex hull is not closed at edge ");
+            Logging::buildText(__FUNCTION__, __FILE__, this->numMeshEdges + (int) i + 1);
+            Logging::write(true, Error);
+            return false;
+        }
+        this->vHullNext[i] = next;
+        this->vHullPrevious[next - this->numMeshEdges - 1] = this->numMeshEdges + (int) i + 1;
+    }
+
+    if (!this->vHullTwin.empty())
+    {
+        this->firstHullEdge = this->numMeshEdges + 1;
+    }
+
+    return true;
+}
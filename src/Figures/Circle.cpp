@@ -10,6 +10,7 @@
 ***********************************************************************************************************************/
 #include "Figures/Circle.h"
 #include "Logging.h"
+#include "Predicates.h"
 
 
 /***********************************************************************************************************************
@@ -37,45 +38,14 @@ Circle::Circle(Point<TYPE> *centre, TYPE radius)
 
 bool Circle::inCircle(Point<TYPE> &p)
 {
-	bool	isInCircle=false;
-	double 	temp[9];		// Intermediate values.
-
 	// If circle is empty -> has not been initialized.
 	if (vPoints.empty())
     {
-	    return isInCircle;
+	    return false;
     }
 
-	// Compute Ax - Dx, Ay - Dy and (Ax-Dx)² + (Ay-Dy)²
-	temp[0] = (vPoints.at(0).getX() - p.getX());
-	temp[1] = (vPoints.at(0).getY() - p.getY());
-	temp[2] = (pow((vPoints.at(0).getX() - p.getX()), 2) + pow((vPoints.at(0).getY() - p.getY()), 2));
-
-	// Compute Bx - Dx, By - Dy and (Bx-Dx)² + (By-Dy)²
-	temp[3] = (vPoints.at(1).getX() - p.getX());
-	temp[4] = (vPoints.at(1).getY() - p.getY());
-	temp[5] = (pow((vPoints.at(1).getX() - p.getX()), 2) + pow((vPoints.at(1).getY() - p.getY()), 2));
-
-	// Compute Cx - Dx, Cy - Dy and (Cx-Dx)² + (Cy-Dy)²
-	temp[6] = (vPoints.at(2).getX() - p.getX());
-	temp[7] = (vPoints.at(2).getY() - p.getY());
-	temp[8] = (pow((vPoints.at(2).getX() - p.getX()), 2) + pow((vPoints.at(2).getY() - p.getY()), 2));
-
-	// Compute determinant.
-    double value = (temp[0]*temp[4]*temp[8]) +
-			(temp[1]*temp[5]*temp[6]) +
-			(temp[2]*temp[3]*temp[7]) -
-			(temp[2]*temp[4]*temp[6]) -
-			(temp[5]*temp[7]*temp[0]) -
-			(temp[8]*temp[1]*temp[3]);
-
-	// If positive then point "s" belongs to p-q-r circumference.
-	if (value > 0.0)
-	{
-		isInCircle = true;
-	}
-
-	return(isInCircle);
+	// If positive then point "p" belongs to circumference.
+	return Predicates::inCircle(vPoints.at(0), vPoints.at(1), vPoints.at(2), p);
 }
 
 
@@ -86,20 +56,26 @@ bool Circle::inCircle(Point<TYPE> &p)
  * 				attribute.
  */
 void Circle::computeCentre()
+{
+    Circle::computeCentre(vPoints.at(0), vPoints.at(1), vPoints.at(2), this->centre);
+}
+
+
+void Circle::computeCentre(const Point<TYPE> &p, const Point<TYPE> &q, const Point<TYPE> &r, Point<TYPE> &centre)
 {
 	TYPE 	slope1, slope2;
 	TYPE  	n1=0.0, n2=0.0;
 	int		valid1=0, valid2=0;
 
 	// Get point between two triangle vertex.
-    TYPE x1 = (vPoints.at(0).getX() + vPoints.at(1).getX()) / (float) 2.0;
-    TYPE y1 = (vPoints.at(0).getY() + vPoints.at(1).getY()) / (float) 2.0;
+    TYPE x1 = (p.getX() + q.getX()) / (float) 2.0;
+    TYPE y1 = (p.getY() + q.getY()) / (float) 2.0;
 
 	// Compute slope.
-	if ((vPoints.at(0).getX() - vPoints.at(1).getX()) != 0)
+	if ((p.getX() - q.getX()) != 0)
 	{
-        slope1 = (vPoints.at(0).getY() - vPoints.at(1).getY()) /
-				(vPoints.at(0).getX() - vPoints.at(1).getX());
+        slope1 = (p.getY() - q.getY()) /
+				(p.getX() - q.getX());
 #ifdef DEBUG_COMPUTE_CENTRE
 		Logging::buildText(__FUNCTION__, __FILE__, "Slope between 1st and 2nd points is ");
 		Logging::buildText(__FUNCTION__, __FILE__, slope1);
@@ -130,14 +106,14 @@ void Circle::computeCentre()
 	}
 
 	// Get point between two triangle vertex.
-    TYPE x2 = (vPoints.at(1).getX() + vPoints.at(2).getX()) / (float) 2.0;
-    TYPE y2 = (vPoints.at(1).getY() + vPoints.at(2).getY()) / (float) 2.0;
+    TYPE x2 = (q.getX() + r.getX()) / (float) 2.0;
+    TYPE y2 = (q.getY() + r.getY()) / (float) 2.0;
 
 	// Compute slope.
-	if ((vPoints.at(1).getX() - vPoints.at(2).getX()) != 0)
+	if ((q.getX() - r.getX()) != 0)
 	{
-        slope2 = (vPoints.at(1).getY() - vPoints.at(2).getY()) /
-				(vPoints.at(1).getX() - vPoints.at(2).getX());
+        slope2 = (q.getY() - r.getY()) /
+				(q.getX() - r.getX());
 #ifdef DEBUG_COMPUTE_CENTRE
 		Logging::buildText(__FUNCTION__, __FILE__, "Slope between 2nd and 3rd points is ");
 		Logging::buildText(__FUNCTION__, __FILE__, slope2);
@@ -172,26 +148,26 @@ void Circle::computeCentre()
 		if (valid2)
 		{
 			// Compute x.
-			this->centre.setX( (n2 - n1) / (slope1 - slope2));
+			centre.setX( (n2 - n1) / (slope1 - slope2));
 
 			// Compute y.
-			this->centre.setY( this->centre.getX()*slope1 + n1);
+			centre.setY( centre.getX()*slope1 + n1);
 		}
 		else
 		{
-			this->centre.setX( x2);
-			this->centre.setY( this->centre.getX()*slope1 + n1);
+			centre.setX( x2);
+			centre.setY( centre.getX()*slope1 + n1);
 		}
 	}
 	else
 	{
-		this->centre.setX( x1);
-		this->centre.setY( this->centre.getX()*slope2 + n2);
+		centre.setX( x1);
+		centre.setY( centre.getX()*slope2 + n2);
 	}
 
 #ifdef DEBUG_COMPUTE_CENTRE
 	Logging::buildText(__FUNCTION__, __FILE__, "Circle centre is ");
-	Logging::buildText(__FUNCTION__, __FILE__, this->centre.toStr());
+	Logging::buildText(__FUNCTION__, __FILE__, centre.toStr());
 	Logging::write( true);
 #endif
 }
@@ -2,6 +2,7 @@
 * Includes
 ***********************************************************************************************************************/
 #include "Line.h"
+#include "Predicates.h"
 
 
 /***********************************************************************************************************************
@@ -46,8 +47,8 @@ bool Line::intersect(Line &other)
     }
 
     // Compute turns between 1st segment and origin and destination point of segment 2.
-    turn1 = this->origin.check_Turn(this->destination, other.origin);
-    turn2 = this->origin.check_Turn(this->destination, other.destination);
+    turn1 = Predicates::turn(this->origin, this->destination, other.origin);
+    turn2 = Predicates::turn(this->origin, this->destination, other.destination);
 
     // If it is collinear then return false (return value already set).
     if ((turn1 != COLLINEAR) && (turn2 != COLLINEAR))
@@ -56,8 +57,8 @@ bool Line::intersect(Line &other)
             ((turn1 == RIGHT_TURN) && (turn2 == LEFT_TURN)))
         {
             // Compute turns between 2nd segment and origin and destination point of segment 1.
-            turn1 = other.origin.check_Turn(other.destination, this->origin);
-            turn2 = other.origin.check_Turn(other.destination, this->destination);
+            turn1 = Predicates::turn(other.origin, other.destination, this->origin);
+            turn2 = Predicates::turn(other.origin, other.destination, this->destination);
 
             // If it is collinear then return false (return value already set).
             if ((turn1 != COLLINEAR) && (turn2 != COLLINEAR))
@@ -0,0 +1,344 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "Predicates.h"
+
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+
+
+/***********************************************************************************************************************
+* Expansion arithmetic
+***********************************************************************************************************************/
+namespace
+{
+    // Exact values are represented as expansions: sums of nonoverlapping doubles sorted by increasing magnitude.
+    // Capacity is the maximum number of components of the operation result, so expansions live in the stack and
+    // exact predicates do not allocate memory.
+    template <size_t N> struct Expansion
+    {
+        double  components[N];
+        size_t  size;
+
+        Expansion() : size(0) {};
+
+        // Zero components are not stored.
+        void append(double component)
+        {
+            if (component != 0.0)
+            {
+                this->components[this->size++] = component;
+            }
+        };
+    };
+
+    // Half of the machine epsilon and error bounds of the floating point filters.
+    const double EPSILON = DBL_EPSILON / 2.0;
+    const double ORIENT_ERROR_BOUND = (3.0 + 16.0*EPSILON)*EPSILON;
+    const double INCIRCLE_ERROR_BOUND = (10.0 + 96.0*EPSILON)*EPSILON;
+
+    // Splits a double in two halves of 26 bits.
+    const double SPLITTER = 134217729.0;
+
+    inline void twoSum(double a, double b, double &x, double &y)
+    {
+        x = a + b;
+        double bVirtual = x - a;
+        double aVirtual = x - bVirtual;
+        y = (a - aVirtual) + (b - bVirtual);
+    }
+
+    inline void fastTwoSum(double a, double b, double &x, double &y)
+    {
+        x = a + b;
+        y = b - (x - a);
+    }
+
+    inline void twoDiff(double a, double b, double &x, double &y)
+    {
+        x = a - b;
+        double bVirtual = a - x;
+        double aVirtual = x + bVirtual;
+        y = (a - aVirtual) + (bVirtual - b);
+    }
+
+    inline void split(double a, double &high, double &low)
+    {
+        double c = SPLITTER*a;
+        high = c - (c - a);
+        low = a - high;
+    }
+
+    inline void twoProduct(double a, double b, double &x, double &y)
+    {
+        double aHigh, aLow, bHigh, bLow;
+        x = a*b;
+        split(a, aHigh, aLow);
+        split(b, bHigh, bLow);
+        double error = x - (aHigh*bHigh);
+        error -= aLow*bHigh;
+        error -= aHigh*bLow;
+        y = (aLow*bLow) - error;
+    }
+
+    // Exact difference a - b as an expansion.
+    void difference(double a, double b, Expansion<2> &h)
+    {
+        double x, y;
+        twoDiff(a, b, x, y);
+
+        h.size = 0;
+        h.append(y);
+        h.append(x);
+    }
+
+    // Adds a double to an expansion in place. Every output component is written before the input one is overwritten.
+    template <size_t N> void grow(Expansion<N> &h, double b)
+    {
+        size_t szSize=0;
+        double q = b;
+        for (size_t i=0; i<h.size ;i++)
+        {
+            double sum, error;
+            twoSum(q, h.components[i], sum, error);
+            if (error != 0.0)
+            {
+                h.components[szSize++] = error;
+            }
+            q = sum;
+        }
+        h.size = szSize;
+        h.append(q);
+    }
+
+    template <size_t N, size_t M> void sum(const Expansion<N> &e, const Expansion<M> &f, Expansion<N + M> &h)
+    {
+        h.size = 0;
+        for (size_t i=0; i<e.size ;i++)
+        {
+            h.components[h.size++] = e.components[i];
+        }
+        for (size_t i=0; i<f.size ;i++)
+        {
+            grow(h, f.components[i]);
+        }
+    }
+
+    // Multiplies an expansion by a double.
+    template <size_t N> void scale(const Expansion<N> &e, double b, Expansion<2*N> &h)
+    {
+        h.size = 0;
+        if ((e.size == 0) || (b == 0.0))
+        {
+            return;
+        }
+
+        double q, error;
+        twoProduct(e.components[0], b, q, error);
+        h.append(error);
+        for (size_t i=1; i<e.size ;i++)
+        {
+            double product1, product0, partial;
+            twoProduct(e.components[i], b, product1, product0);
+            twoSum(q, product0, partial, error);
+            h.append(error);
+            fastTwoSum(product1, partial, q, error);
+            h.append(error);
+        }
+        h.append(q);
+    }
+
+    template <size_t N, size_t M> void product(const Expansion<N> &e, const Expansion<M> &f, Expansion<2*N*M> &h)
+    {
+        h.size = 0;
+        Expansion<2*N> scaled;
+        for (size_t i=0; i<f.size ;i++)
+        {
+            scale(e, f.components[i], scaled);
+            for (size_t j=0; j<scaled.size ;j++)
+            {
+                grow(h, scaled.components[j]);
+            }
+        }
+    }
+
+    template <size_t N> void negative(Expansion<N> &e)
+    {
+        for (size_t i=0; i<e.size ;i++)
+        {
+            e.components[i] = -e.components[i];
+        }
+    }
+
+    // The most significant component has the sign of the expansion.
+    template <size_t N> inline double estimate(const Expansion<N> &e)
+    {
+        return (e.size == 0) ? 0.0 : e.components[e.size - 1];
+    }
+}
+
+
+/***********************************************************************************************************************
+* Public methods definitions
+***********************************************************************************************************************/
+double Predicates::orient(const Point<TYPE> &a, const Point<TYPE> &b, const Point<TYPE> &c)
+{
+    double detLeft = ((double) a.getX() - c.getX())*((double) b.getY() - c.getY());
+    double detRight = ((double) a.getY() - c.getY())*((double) b.getX() - c.getX());
+    double det = detLeft - detRight;
+
+    // If products have different signs there is no cancellation
+    double detSum;
+    if (detLeft > 0.0)
+    {
+        if (detRight <= 0.0)
+        {
+            return det;
+        }
+        detSum = detLeft + detRight;
+    }
+    else if (detLeft < 0.0)
+    {
+        if (detRight >= 0.0)
+        {
+            return det;
+        }
+        detSum = -detLeft - detRight;
+    }
+    else
+    {
+        return det;
+    }
+
+    if (std::fabs(det) >= ORIENT_ERROR_BOUND*detSum)
+    {
+        return det;
+    }
+
+    return orientExact(a, b, c);
+}
+
+
+Turn_T Predicates::turn(const Point<TYPE> &a, const Point<TYPE> &b, const Point<TYPE> &c)
+{
+    double det = orient(a, b, c);
+    if (det > 0.0)
+    {
+        return LEFT_TURN;
+    }
+    else if (det < 0.0)
+    {
+        return RIGHT_TURN;
+    }
+
+    return COLLINEAR;
+}
+
+
+double Predicates::inCircleDet(const Point<TYPE> &a, const Point<TYPE> &b, const Point<TYPE> &c,
+                               const Point<TYPE> &d)
+{
+    double adx = (double) a.getX() - d.getX();
+    double ady = (double) a.getY() - d.getY();
+    double bdx = (double) b.getX() - d.getX();
+    double bdy = (double) b.getY() - d.getY();
+    double cdx = (double) c.getX() - d.getX();
+    double cdy = (double) c.getY() - d.getY();
+
+    double bdxcdy = bdx*cdy;
+    double cdxbdy = cdx*bdy;
+    double aLift = adx*adx + ady*ady;
+
+    double cdxady = cdx*ady;
+    double adxcdy = adx*cdy;
+    double bLift = bdx*bdx + bdy*bdy;
+
+    double adxbdy = adx*bdy;
+    double bdxady = bdx*ady;
+    double cLift = cdx*cdx + cdy*cdy;
+
+    double det = aLift*(bdxcdy - cdxbdy) + bLift*(cdxady - adxcdy) + cLift*(adxbdy - bdxady);
+
+    double permanent = (std::fabs(bdxcdy) + std::fabs(cdxbdy))*aLift +
+                       (std::fabs(cdxady) + std::fabs(adxcdy))*bLift +
+                       (std::fabs(adxbdy) + std::fabs(bdxady))*cLift;
+    if (std::fabs(det) > INCIRCLE_ERROR_BOUND*permanent)
+    {
+        return det;
+    }
+
+    return inCircleExact(a, b, c, d);
+}
+
+
+/***********************************************************************************************************************
+* Private methods definitions
+***********************************************************************************************************************/
+double Predicates::orientExact(const Point<TYPE> &a, const Point<TYPE> &b, const Point<TYPE> &c)
+{
+    Expansion<2> acx, acy, bcx, bcy;
+    difference(a.getX(), c.getX(), acx);
+    difference(a.getY(), c.getY(), acy);
+    difference(b.getX(), c.getX(), bcx);
+    difference(b.getY(), c.getY(), bcy);
+
+    Expansion<8> left, right;
+    product(acx, bcy, left);
+    product(acy, bcx, right);
+    negative(right);
+
+    Expansion<16> det;
+    sum(left, right, det);
+    return estimate(det);
+}
+
+
+double Predicates::inCircleExact(const Point<TYPE> &a, const Point<TYPE> &b, const Point<TYPE> &c,
+                                 const Point<TYPE> &d)
+{
+    Expansion<2> adx, ady, bdx, bdy, cdx, cdy;
+    difference(a.getX(), d.getX(), adx);
+    difference(a.getY(), d.getY(), ady);
+    difference(b.getX(), d.getX(), bdx);
+    difference(b.getY(), d.getY(), bdy);
+    difference(c.getX(), d.getX(), cdx);
+    difference(c.getY(), d.getY(), cdy);
+
+    // Lifted coordinates and 2x2 minors
+    Expansion<16> aLift, bLift, cLift, bc, ca, ab;
+    Expansion<8> left, right;
+    product(adx, adx, left);
+    product(ady, ady, right);
+    sum(left, right, aLift);
+    product(bdx, bdx, left);
+    product(bdy, bdy, right);
+    sum(left, right, bLift);
+    product(cdx, cdx, left);
+    product(cdy, cdy, right);
+    sum(left, right, cLift);
+
+    product(bdx, cdy, left);
+    product(cdx, bdy, right);
+    negative(right);
+    sum(left, right, bc);
+    product(cdx, ady, left);
+    product(adx, cdy, right);
+    negative(right);
+    sum(left, right, ca);
+    product(adx, bdy, left);
+    product(bdx, ady, right);
+    negative(right);
+    sum(left, right, ab);
+
+    Expansion<512> aTerm, bTerm, cTerm;
+    product(aLift, bc, aTerm);
+    product(bLift, ca, bTerm);
+    product(cLift, ab, cTerm);
+
+    Expansion<1024> abTerm;
+    sum(aTerm, bTerm, abTerm);
+    Expansion<1536> det;
+    sum(abTerm, cTerm, det);
+    return estimate(det);
+}
@@ -0,0 +1,128 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "SpatialSort.h"
+
+#include <algorithm>
+#include <random>
+#include <utility>
+
+
+/***********************************************************************************************************************
+* Public methods definitions
+***********************************************************************************************************************/
+uint64_t SpatialSort::getHilbertIndex(const Point<TYPE> &p, const Point<TYPE> &minPoint, const Point<TYPE> &maxPoint)
+{
+    const uint32_t side = uint32_t(1) << HILBERT_ORDER;
+
+    // Scale point to [0, side) grid
+    TYPE width = maxPoint.getX() - minPoint.getX();
+    TYPE height = maxPoint.getY() - minPoint.getY();
+    TYPE scale = std::max(width, height);
+    if (scale <= 0.0)
+    {
+        return 0;
+    }
+    auto x = (uint32_t) std::min<TYPE>(side - 1, (p.getX() - minPoint.getX()) / scale * side);
+    auto y = (uint32_t) std::min<TYPE>(side - 1, (p.getY() - minPoint.getY()) / scale * side);
+
+    // Compute position in curve rotating quadrants at every level
+    uint64_t index = 0;
+    for (uint32_t s = side/2; s > 0 ; s /= 2)
+    {
+        uint32_t rx = (x & s) > 0;
+        uint32_t ry = (y & s) > 0;
+        index += uint64_t(s) * uint64_t(s) * ((3 * rx) ^ ry);
+        if (ry == 0)
+        {
+            if (rx == 1)
+            {
+                x = side - 1 - x;
+                y = side - 1 - y;
+            }
+            std::swap(x, y);
+        }
+    }
+
+    return index;
+}
+
+
+void SpatialSort::hilbertSort(const vector<Point<TYPE>> &vPoints, vector<int> &vIndex)
+{
+    Point<TYPE> minPoint, maxPoint;
+    getBoundingBox(vPoints, vIndex, minPoint, maxPoint);
+
+    // Compute points keys
+    vector<pair<uint64_t, int>> vKeys(vIndex.size());
+    for (size_t i=0; i<vIndex.size() ;i++)
+    {
+        vKeys[i] = make_pair(getHilbertIndex(vPoints[vIndex[i]], minPoint, maxPoint), vIndex[i]);
+    }
+
+    // Sort by key
+    std::sort(vKeys.begin(), vKeys.end());
+    for (size_t i=0; i<vIndex.size() ;i++)
+    {
+        vIndex[i] = vKeys[i].second;
+    }
+}
+
+
+void SpatialSort::brio(const vector<Point<TYPE>> &vPoints, vector<int> &vIndex, unsigned int seed)
+{
+    vector<BrioKey> vKeys;
+    brio(vPoints, vIndex, vKeys, seed);
+}
+
+
+void SpatialSort::brio(const vector<Point<TYPE>> &vPoints, vector<int> &vIndex, vector<BrioKey> &vKeys,
+                       unsigned int seed)
+{
+    Point<TYPE> minPoint, maxPoint;
+    getBoundingBox(vPoints, vIndex, minPoint, maxPoint);
+
+    // Assign every point to a round. Round 0 is the last one and contains half the points
+    std::mt19937 generator(seed);
+    vKeys.resize(vIndex.size());
+    for (size_t i=0; i<vIndex.size() ;i++)
+    {
+        int round = 0;
+        while ((round < BRIO_MAX_ROUNDS) && (generator() & 1))
+        {
+            round++;
+        }
+
+        vKeys[i] = make_pair(make_pair(-round, getHilbertIndex(vPoints[vIndex[i]], minPoint, maxPoint)), vIndex[i]);
+    }
+
+    // Sort by round and then by Hilbert index
+    std::sort(vKeys.begin(), vKeys.end());
+    for (size_t i=0; i<vIndex.size() ;i++)
+    {
+        vIndex[i] = vKeys[i].second;
+    }
+}
+
+
+void SpatialSort::getBoundingBox(const vector<Point<TYPE>> &vPoints, const vector<int> &vIndex,
+                                 Point<TYPE> &minPoint, Point<TYPE> &maxPoint)
+{
+    if (vIndex.empty())
+    {
+        minPoint.setOrigin();
+        maxPoint.setOrigin();
+        return;
+    }
+
+    minPoint = vPoints[vIndex[0]];
+    maxPoint = vPoints[vIndex[0]];
+    for (auto index : vIndex)
+    {
+        const Point<TYPE> &p = vPoints[index];
+        minPoint.setX(std::min(minPoint.getX(), p.getX()));
+        minPoint.setY(std::min(minPoint.getY(), p.getY()));
+        maxPoint.setX(std::max(maxPoint.getX(), p.getX()));
+        maxPoint.setY(std::max(maxPoint.getY(), p.getY()));
+    }
+}
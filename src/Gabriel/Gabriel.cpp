@@ -3,8 +3,11 @@
 ***********************************************************************************************************************/
 #include "Gabriel.h"
 //#include "Line.h"
+#include "Parallel.h"
 //#include "Point.h"
 
+#include <algorithm>
+
 
 /***********************************************************************************************************************
 * Defines
@@ -22,8 +25,43 @@
 /***********************************************************************************************************************
 * Public methods definitions
 ***********************************************************************************************************************/
+bool Gabriel::build(size_t szNumThreads)
+{
+    // Reset previous graph (if any)
+    std::fill(this->vValidEdges.begin(), this->vValidEdges.end(), 0);
+    this->isBuilt = false;
+
+    if (this->isVoronoiUsed())
+    {
+        return this->buildVoronoi();
+    }
+
+    if (this->meshView != nullptr)
+    {
+        return this->buildInPlace(*this->meshView, szNumThreads);
+    }
+    return this->buildInPlace(*this->triangulation, szNumThreads);
+}
+
+
+void Gabriel::reset()
+{
+    dcel.reset();
+    voronoi.reset();
+    triangulation = nullptr;
+    meshView = nullptr;
+    view = nullptr;
+    vValidEdges.clear();
+    szNumEdges = 0;
+    isBuilt = false;
+}
+
+
+/***********************************************************************************************************************
+* Private methods definitions
+***********************************************************************************************************************/
 /***************************************************************************
-* Name: 	build
+* Name: 	buildVoronoi
 * IN:		NONE
 * OUT:		NONE
 * RETURN:	NONE
@@ -33,14 +71,15 @@
 * 				it checks if the circle whose diameter is that edge
 * 				surrounds any other point of the triangulation.
 ***************************************************************************/
-bool Gabriel::build()
+bool Gabriel::buildVoronoi()
 {
     int     edgeIndex=0;		// Loop counter.
     int		nEdges=0;			// Upper bound limit.
-    Point<TYPE> *p1, *p2;		// Edge origin and destination points.
+    const Point<TYPE> *p1, *p2;	// Edge origin and destination points.
     Point<TYPE> q1, q2;		// Edge origin and destination points.
     int     face1=0, face2=0; 	// Faces that share edge.
     Line 	line1, line2;
+    const Dcel *checkedDcel = this->getDcel();	// DCEL copy or triangulation checked in place.
 
     // Check all edges.
     nEdges = this->getSize();
@@ -59,10 +98,10 @@ bool Gabriel::build()
 			Logging::write(true, Info);
 #endif
         // Skip edges higher than its twin -> already checked.
-        if (edgeIndex < this->dcel.getTwin(edgeIndex))
+        if (edgeIndex < checkedDcel->getTwin(edgeIndex))
         {
             // Skip imaginary edges.
-            if (!this->dcel.hasNegativeVertex(edgeIndex+1))
+            if (!checkedDcel->hasNegativeVertex(edgeIndex+1))
             {
 #ifdef DEBUG_GABRIEL_BUILD
                 Logging::buildText(__FUNCTION__, __FILE__, "Checking intersection for edge ");
@@ -70,16 +109,24 @@ bool Gabriel::build()
 					Logging::write(true, Info);
 #endif
                 // Get faces that share edge.
-                face1 = this->dcel.getFace(edgeIndex);
-                face2 = this->dcel.getFace(this->dcel.getTwin(edgeIndex)-1);
+                face1 = checkedDcel->getFace(edgeIndex);
+                face2 = checkedDcel->getFace(checkedDcel->getTwin(edgeIndex)-1);
 
                 // Get origin and destination point of triangulation segment.
-                p1 = this->dcel.getRefPoint(this->dcel.getOrigin(edgeIndex)-1);
-                p2 = this->dcel.getRefPoint(this->dcel.getOrigin(this->dcel.getTwin(edgeIndex)-1)-1);
+                p1 = checkedDcel->getRefPoint(checkedDcel->getOrigin(edgeIndex)-1);
+                p2 = checkedDcel->getRefPoint(checkedDcel->getOrigin(checkedDcel->getTwin(edgeIndex)-1)-1);
 
                 // Get origin and destination point of triangulation segment.
-                this->voronoi.getCentre(face1-1, q1);
-                this->voronoi.getCentre(face2-1, q2);
+                if (this->view != nullptr)
+                {
+                    this->view->getCentre(face1-1, q1);
+                    this->view->getCentre(face2-1, q2);
+                }
+                else
+                {
+                    this->voronoi.getCentre(face1-1, q1);
+                    this->voronoi.getCentre(face2-1, q2);
+                }
 
                 // Create lines to check intersection.
                 line1 = Line(*p1, *p2);
@@ -120,7 +167,7 @@ bool Gabriel::build()
 				Logging::buildText(__FUNCTION__, __FILE__, "Skipping edge ");
 				Logging::buildText(__FUNCTION__, __FILE__, edgeIndex+1);
 				Logging::buildText(__FUNCTION__, __FILE__, " because twin edge already checked ");
-				Logging::buildText(__FUNCTION__, __FILE__, this->dcel.getTwin(edgeIndex));
+				Logging::buildText(__FUNCTION__, __FILE__, checkedDcel->getTwin(edgeIndex));
 				Logging::write(true, Info);
 			}
 #endif
@@ -142,14 +189,86 @@ bool Gabriel::build()
 void Gabriel::validateEdges(int edgeIndex)
 {
 	this->set(edgeIndex);
-	this->set(this->dcel.getTwin(edgeIndex)-1);
+	this->set(this->getDcel()->getTwin(edgeIndex)-1);
 }
 
 
-void Gabriel::reset()
+/**
+ * @fn                  buildInPlace
+ * @brief               Checks every edge of the triangulation without Voronoi diagram. Every thread computes whole
+ *                      words of the bitset so threads never write the same word
+ *
+ * @param dcelIn        (IN) Triangulation read through a Dcel accessor
+ * @param szNumThreads  (IN) Number of threads. All available cores if zero
+ * @return              true if graph built
+ *                      false otherwise
+ */
+template <class M> bool Gabriel::buildInPlace(const M &dcelIn, size_t szNumThreads)
 {
-    dcel.reset();
-    voronoi.reset();
-    vValidEdges.clear();
-    isBuilt = false;
+    Parallel::runChunks(this->vValidEdges.size(), GABRIEL_MIN_WORDS_THREAD, szNumThreads, [&](size_t first, size_t last)
+    {
+        for (size_t wordIndex=first; wordIndex<last ;wordIndex++)
+        {
+            uint64_t word=0;
+            size_t szFirstEdge = wordIndex*64;
+            size_t szLastEdge = std::min(szFirstEdge + 64, this->szNumEdges);
+            for (size_t edgeIndex=szFirstEdge; edgeIndex<szLastEdge ;edgeIndex++)
+            {
+                if (Gabriel::isGabrielEdge(dcelIn, (int) edgeIndex))
+                {
+                    word |= uint64_t(1) << (edgeIndex - szFirstEdge);
+                }
+            }
+            this->vValidEdges[wordIndex] = word;
+        }
+        return true;
+    });
+
+    this->isBuilt = true;
+    return this->isBuilt;
+}
+
+
+/**
+ * @fn                  isGabrielEdge
+ * @brief               Checks if a real edge has no point strictly inside its diametral circle. In a Delaunay
+ *                      triangulation it is enough to check the opposite vertex of both edge triangles: a point r is
+ *                      inside the circle if the angle at r is obtuse, so (p - r)·(q - r) < 0
+ *
+ * @param dcelIn        (IN) Triangulation read through a Dcel accessor
+ * @param edgeIndex     (IN) Edge index
+ * @return              true if edge is a Gabriel edge
+ *                      false otherwise
+ */
+template <class M> bool Gabriel::isGabrielEdge(const M &dcelIn, int edgeIndex)
+{
+    // Skip imaginary edges.
+    int twinIndex = dcelIn.getTwin(edgeIndex)-1;
+    int originId = dcelIn.getOrigin(edgeIndex);
+    int destId = dcelIn.getOrigin(twinIndex);
+    if ((originId <= 0) || (destId <= 0))
+    {
+        return false;
+    }
+
+    const Point<TYPE> *p = dcelIn.getRefPoint(originId-1);
+    const Point<TYPE> *q = dcelIn.getRefPoint(destId-1);
+    for (int sideEdge : {edgeIndex, twinIndex})
+    {
+        // Skip external face and imaginary vertices
+        int apexId = dcelIn.getOrigin(dcelIn.getPrevious(sideEdge)-1);
+        if ((dcelIn.getFace(sideEdge) == EXTERNAL_FACE) || (apexId <= 0))
+        {
+            continue;
+        }
+
+        const Point<TYPE> *r = dcelIn.getRefPoint(apexId-1);
+        TYPE dot = (p->getX() - r->getX())*(q->getX() - r->getX()) + (p->getY() - r->getY())*(q->getY() - r->getY());
+        if (dot < 0.0)
+        {
+            return false;
+        }
+    }
+
+    return true;
 }
@@ -0,0 +1,142 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "MinimumSpanningTree.h"
+#include "Parallel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+
+/***********************************************************************************************************************
+* Public methods definitions
+***********************************************************************************************************************/
+bool MinimumSpanningTree::build(size_t szNumThreads)
+{
+    // Check there is at least one edge
+    size_t szNumEdges = this->dcel->getNumEdges();
+    size_t szNumVertex = this->dcel->getNumVertex();
+    this->vValidEdges.assign(szNumEdges, false);
+    this->szNumTreeEdges = 0;
+    this->length = 0.0;
+    this->isBuilt = false;
+    if (szNumEdges == 0)
+    {
+        return false;
+    }
+
+    // Compute squared length of every real edge. Lowest index half-edge represents the edge
+    const TYPE invalidLength = std::numeric_limits<TYPE>::max();
+    vector<pair<TYPE,int>> vEdges(szNumEdges);
+    Parallel::runChunks(szNumEdges, MST_MIN_EDGES_THREAD, szNumThreads, [&](size_t first, size_t last)
+    {
+        for (size_t i=first; i<last ;i++)
+        {
+            int twinIndex = this->dcel->getTwin((int) i)-1;
+            int originId = this->dcel->getOrigin((int) i);
+            int destId = this->dcel->getOrigin(twinIndex);
+            if (((int) i > twinIndex) || (originId <= 0) || (destId <= 0))
+            {
+                vEdges[i] = make_pair(invalidLength, (int) i);
+                continue;
+            }
+
+            const Point<TYPE> *origin = this->dcel->getRefPoint(originId-1);
+            const Point<TYPE> *dest = this->dcel->getRefPoint(destId-1);
+            TYPE dx = dest->getX() - origin->getX();
+            TYPE dy = dest->getY() - origin->getY();
+            vEdges[i] = make_pair(dx*dx + dy*dy, (int) i);
+        }
+        return true;
+    });
+    vEdges.erase(std::remove_if(vEdges.begin(), vEdges.end(),
+                                [&](const pair<TYPE,int> &edge) { return edge.first == invalidLength; }),
+                 vEdges.end());
+
+    // Sort edges by length. Ties are sorted by edge index so the tree does not depend on the number of threads
+    Parallel::sort(vEdges, MST_MIN_EDGES_THREAD, szNumThreads, [](const pair<TYPE,int> &a, const pair<TYPE,int> &b)
+    {
+        return a < b;
+    });
+
+    // Kruskal. Add edges that join two components until all vertices are connected
+    vector<int> vParents(szNumVertex);
+    std::iota(vParents.begin(), vParents.end(), 0);
+    vector<char> vRanks(szNumVertex, 0);
+    for (auto it=vEdges.begin(); (it != vEdges.end()) && (this->szNumTreeEdges+1 < szNumVertex) ; it++)
+    {
+        int edgeIndex = it->second;
+        int originRoot = findRoot(vParents, this->dcel->getOrigin(edgeIndex)-1);
+        int destRoot = findRoot(vParents, this->dcel->getOrigin(this->dcel->getTwin(edgeIndex)-1)-1);
+        if (originRoot == destRoot)
+        {
+            continue;
+        }
+
+        // Union by rank
+        if (vRanks[originRoot] < vRanks[destRoot])
+        {
+            std::swap(originRoot, destRoot);
+        }
+        vParents[destRoot] = originRoot;
+        if (vRanks[originRoot] == vRanks[destRoot])
+        {
+            vRanks[originRoot]++;
+        }
+
+        this->validateEdges(edgeIndex);
+        this->szNumTreeEdges++;
+        this->length += std::sqrt(it->first);
+    }
+
+    // Triangulation is connected so all vertices must be in the tree
+    this->isBuilt = (this->szNumTreeEdges+1 == szNumVertex);
+    return this->isBuilt;
+}
+
+
+void MinimumSpanningTree::reset()
+{
+    vValidEdges.clear();
+    szNumTreeEdges = 0;
+    length = 0.0;
+    isBuilt = false;
+}
+
+
+/***********************************************************************************************************************
+* Private methods definitions
+***********************************************************************************************************************/
+/**
+ * @fn      validateEdges
+ * @brief   Sets to true the input edge and its twin
+ *
+ * @param   edgeIndex   (IN) Edge index to set to true
+ */
+void MinimumSpanningTree::validateEdges(int edgeIndex)
+{
+    this->vValidEdges.at(edgeIndex) = true;
+    this->vValidEdges.at(this->dcel->getTwin(edgeIndex)-1) = true;
+}
+
+
+/**
+ * @fn      findRoot
+ * @brief   Finds the root of the component of a vertex. Visited vertices point to their grandparent (path halving)
+ *
+ * @param   vParents    (IN/OUT) Parent of every vertex
+ * @param   index       (IN) Vertex index
+ * @return  root vertex index
+ */
+int MinimumSpanningTree::findRoot(vector<int> &vParents, int index)
+{
+    while (vParents[index] != index)
+    {
+        vParents[index] = vParents[vParents[index]];
+        index = vParents[index];
+    }
+
+    return index;
+}
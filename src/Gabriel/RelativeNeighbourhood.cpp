@@ -0,0 +1,154 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "RelativeNeighbourhood.h"
+#include "Parallel.h"
+
+
+/***********************************************************************************************************************
+* Public methods definitions
+***********************************************************************************************************************/
+bool RelativeNeighbourhood::build(size_t szNumThreads)
+{
+    // Check there is at least one edge
+    size_t szNumEdges = this->dcel->getNumEdges();
+    this->vValidEdges.assign(szNumEdges, false);
+    this->isBuilt = false;
+    if (szNumEdges == 0)
+    {
+        return false;
+    }
+
+    // Every edge is checked by the thread of its lowest index half-edge. Bytes can be written from different threads
+    vector<char> vIsValid(szNumEdges, false);
+    Parallel::runChunks(szNumEdges, RNG_MIN_EDGES_THREAD, szNumThreads, [&](size_t first, size_t last)
+    {
+        vector<int> vStack;
+        vector<unsigned int> vVisited(this->dcel->getNumVertex(), 0);
+        unsigned int stamp=0;
+        for (size_t i=first; i<last ;i++)
+        {
+            int twinIndex = this->dcel->getTwin((int) i)-1;
+            if (((int) i < twinIndex) && !this->dcel->hasNegativeVertex((int) i+1) &&
+                this->isEmptyLune((int) i, vStack, vVisited, ++stamp))
+            {
+                vIsValid[i] = true;
+                vIsValid[twinIndex] = true;
+            }
+        }
+        return true;
+    });
+
+    for (size_t i=0; i<szNumEdges ;i++)
+    {
+        this->vValidEdges[i] = vIsValid[i];
+    }
+
+    this->isBuilt = true;
+    return this->isBuilt;
+}
+
+
+void RelativeNeighbourhood::reset()
+{
+    vValidEdges.clear();
+    isBuilt = false;
+}
+
+
+/***********************************************************************************************************************
+* Private methods definitions
+***********************************************************************************************************************/
+/**
+ * @fn      isEmptyLune
+ * @brief   Checks if there is no point closer to both edge vertices than the edge length. Points closer to the edge
+ *          origin than the edge length are visited from the origin through Delaunay neighbours: every vertex has a
+ *          neighbour closer to the origin, so all of them are reached without leaving the origin circle
+ *
+ * @param   edgeIndex   (IN)        Edge index
+ * @param   vStack      (IN/OUT)    Vertices to visit. Buffer reused between calls
+ * @param   vVisited    (IN/OUT)    Stamp of the last call that visited every vertex
+ * @param   stamp       (IN)        Stamp of this call
+ * @return  true if the lune is empty
+ *          false otherwise
+ */
+bool RelativeNeighbourhood::isEmptyLune(int edgeIndex, vector<int> &vStack, vector<unsigned int> &vVisited,
+                                        unsigned int stamp) const
+{
+    int originIndex = this->dcel->getOrigin(edgeIndex)-1;
+    int destIndex = this->dcel->getOrigin(this->dcel->getTwin(edgeIndex)-1)-1;
+    const Point<TYPE> *origin = this->dcel->getRefPoint(originIndex);
+    const Point<TYPE> *dest = this->dcel->getRefPoint(destIndex);
+    TYPE dx = dest->getX() - origin->getX();
+    TYPE dy = dest->getY() - origin->getY();
+    TYPE squaredLength = dx*dx + dy*dy;
+
+    // Most non empty lunes contain the opposite vertex of one of the edge triangles
+    int vApexes[] = {this->dcel->getOrigin(this->dcel->getPrevious(edgeIndex)-1)-1,
+                     this->dcel->getOrigin(this->dcel->getPrevious(this->dcel->getTwin(edgeIndex)-1)-1)-1};
+    for (int apexIndex : vApexes)
+    {
+        if ((apexIndex >= 0) && isInLune(*this->dcel->getRefPoint(apexIndex), *origin, *dest, squaredLength))
+        {
+            return false;
+        }
+    }
+
+    vStack.clear();
+    vStack.push_back(originIndex);
+    vVisited[originIndex] = stamp;
+    vVisited[destIndex] = stamp;
+    while (!vStack.empty())
+    {
+        int pointIndex = vStack.back();
+        vStack.pop_back();
+
+        // Visit neighbours in the origin circle
+        int iFirstEdgeIdx = this->dcel->getPointEdge(pointIndex) - 1;
+        int iEdgeIdx = iFirstEdgeIdx;
+        do
+        {
+            int neighbourIndex = this->dcel->getOrigin(this->dcel->getTwin(iEdgeIdx)-1)-1;
+            if ((neighbourIndex >= 0) && (vVisited[neighbourIndex] != stamp))
+            {
+                vVisited[neighbourIndex] = stamp;
+                const Point<TYPE> *point = this->dcel->getRefPoint(neighbourIndex);
+                TYPE originX = point->getX() - origin->getX();
+                TYPE originY = point->getY() - origin->getY();
+                if (originX*originX + originY*originY < squaredLength)
+                {
+                    if (isInLune(*point, *origin, *dest, squaredLength))
+                    {
+                        return false;
+                    }
+                    vStack.push_back(neighbourIndex);
+                }
+            }
+            iEdgeIdx = this->dcel->getTwin(this->dcel->getPrevious(iEdgeIdx)-1) - 1;
+        } while (iEdgeIdx != iFirstEdgeIdx);
+    }
+
+    return true;
+}
+
+
+/**
+ * @fn      isInLune
+ * @brief   Checks if a point is closer to both edge vertices than the edge length
+ *
+ * @param   point           (IN) Point to check
+ * @param   origin          (IN) Edge origin
+ * @param   dest            (IN) Edge destination
+ * @param   squaredLength   (IN) Edge squared length
+ * @return  true if the point is in the lune
+ *          false otherwise
+ */
+bool RelativeNeighbourhood::isInLune(const Point<TYPE> &point, const Point<TYPE> &origin, const Point<TYPE> &dest,
+                                     TYPE squaredLength)
+{
+    TYPE originX = point.getX() - origin.getX();
+    TYPE originY = point.getY() - origin.getY();
+    TYPE destX = point.getX() - dest.getX();
+    TYPE destY = point.getY() - dest.getY();
+    return (originX*originX + originY*originY < squaredLength) && (destX*destX + destY*destY < squaredLength);
+}
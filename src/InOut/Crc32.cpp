@@ -0,0 +1,61 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "Crc32.h"
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+#define CRC32_POLYNOMIAL            (0xEDB88320u)
+#define CRC32_TABLE_SIZE            (256)
+
+
+/***********************************************************************************************************************
+* Local functions
+***********************************************************************************************************************/
+/**
+ * @fn      getTable
+ * @brief   Gets the CRC of every byte value. Table is built the first time it is used
+ *
+ * @return  CRC32_TABLE_SIZE CRC values
+ */
+static const uint32_t *getTable()
+{
+    struct Table
+    {
+        uint32_t arrValues[CRC32_TABLE_SIZE];
+        Table()
+        {
+            for (uint32_t i=0; i<CRC32_TABLE_SIZE ;i++)
+            {
+                uint32_t value = i;
+                for (int bit=0; bit<8 ;bit++)
+                {
+                    value = (value & 1) ? (value >> 1) ^ CRC32_POLYNOMIAL : (value >> 1);
+                }
+                arrValues[i] = value;
+            }
+        }
+    };
+    static const Table table;
+
+    return table.arrValues;
+}
+
+
+/***********************************************************************************************************************
+* Public methods definitions
+***********************************************************************************************************************/
+uint32_t Crc32::compute(const void *data, size_t szSize, uint32_t crc)
+{
+    const uint32_t *table = getTable();
+    auto bytes = (const unsigned char *) data;
+    crc = ~crc;
+    for (size_t i=0; i<szSize ;i++)
+    {
+        crc = table[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+    }
+
+    return ~crc;
+}
@@ -0,0 +1,60 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "Logging.h"
+#include "MappedFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+/***********************************************************************************************************************
+* Public methods definitions
+***********************************************************************************************************************/
+bool MappedFile::open(const string &strFileName)
+{
+    this->close();
+
+    int fd = ::open(strFileName.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error opening file: ");
+        Logging::buildText(__FUNCTION__, __FILE__, strFileName);
+        Logging::write(true, Error);
+        return false;
+    }
+
+    // Empty files cannot be mapped
+    struct stat results = {};
+    void *ptr = MAP_FAILED;
+    if ((fstat(fd, &results) == 0) && (results.st_size > 0))
+    {
+        ptr = mmap(nullptr, (size_t) results.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd);
+
+    if (ptr == MAP_FAILED)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error mapping file: ");
+        Logging::buildText(__FUNCTION__, __FILE__, strFileName);
+        Logging::write(true, Error);
+        return false;
+    }
+
+    this->data = (const char *) ptr;
+    this->szSize = (size_t) results.st_size;
+    return true;
+}
+
+
+void MappedFile::close()
+{
+    if (this->data != nullptr)
+    {
+        munmap((void *) this->data, this->szSize);
+        this->data = nullptr;
+        this->szSize = 0;
+    }
+}
@@ -0,0 +1,103 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "MappedLayout.h"
+
+#include "defines.h"
+#include "Logging.h"
+
+#include <cstring>
+#include <fstream>
+
+
+/***********************************************************************************************************************
+* Public methods definitions
+***********************************************************************************************************************/
+bool MappedLayout::write(const string &strFileName, const string &strMagic, const vector<MappedArray> &vArrays)
+{
+    if ((strMagic.size() > MAPPED_MAGIC_LENGTH) || (vArrays.size() > MAPPED_MAX_SECTIONS))
+    {
+        return false;
+    }
+
+    // Build header. Every array starts at the first aligned offset after the previous one
+    MappedHeader header = {};
+    memcpy(header.arrMagic, strMagic.c_str(), strMagic.size());
+    header.version = MAPPED_VERSION;
+    header.endianTag = MAPPED_ENDIAN_TAG;
+    header.typeSize = sizeof(TYPE);
+    header.numSections = (uint32_t) vArrays.size();
+    uint64_t offset = sizeof(MappedHeader);
+    for (size_t i=0; i<vArrays.size() ;i++)
+    {
+        offset = (offset + MAPPED_ALIGNMENT - 1) & ~((uint64_t) MAPPED_ALIGNMENT - 1);
+        header.arrSections[i].offset = offset;
+        header.arrSections[i].count = vArrays[i].szCount;
+        offset += vArrays[i].szCount*vArrays[i].szElementSize;
+    }
+
+    ofstream ofs(strFileName.c_str(), ios::out | ios::binary);
+    if (!ofs.is_open())
+    {
+        return false;
+    }
+
+    // Write header, padding and arrays
+    const char arrPadding[MAPPED_ALIGNMENT] = {};
+    ofs.write((const char *) &header, sizeof(header));
+    uint64_t written = sizeof(header);
+    for (size_t i=0; i<vArrays.size() ;i++)
+    {
+        ofs.write(arrPadding, (streamsize) (header.arrSections[i].offset - written));
+        ofs.write((const char *) vArrays[i].data, (streamsize) (vArrays[i].szCount*vArrays[i].szElementSize));
+        written = header.arrSections[i].offset + vArrays[i].szCount*vArrays[i].szElementSize;
+    }
+
+    ofs.close();
+    return !ofs.fail();
+}
+
+
+const MappedHeader *MappedLayout::check(const char *data, size_t szSize, const string &strMagic,
+                                        const vector<size_t> &vElementSizes)
+{
+    if ((data == nullptr) || (szSize < sizeof(MappedHeader)))
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "File too short to be a mapped file: ");
+        Logging::buildText(__FUNCTION__, __FILE__, szSize);
+        Logging::write(true, Error);
+        return nullptr;
+    }
+
+    // Check header fields
+    auto header = (const MappedHeader *) data;
+    char arrMagic[MAPPED_MAGIC_LENGTH] = {};
+    memcpy(arrMagic, strMagic.c_str(), min(strMagic.size(), (size_t) MAPPED_MAGIC_LENGTH));
+    if ((memcmp(header->arrMagic, arrMagic, MAPPED_MAGIC_LENGTH) != 0) || (header->version != MAPPED_VERSION) ||
+        (header->endianTag != MAPPED_ENDIAN_TAG) || (header->typeSize != sizeof(TYPE)) ||
+        (header->numSections != vElementSizes.size()))
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Mapped file header does not match. Version: ");
+        Logging::buildText(__FUNCTION__, __FILE__, (size_t) header->version);
+        Logging::buildText(__FUNCTION__, __FILE__, ". Coordinates size: ");
+        Logging::buildText(__FUNCTION__, __FILE__, (size_t) header->typeSize);
+        Logging::write(true, Error);
+        return nullptr;
+    }
+
+    // Check arrays are aligned and inside the file
+    for (size_t i=0; i<vElementSizes.size() ;i++)
+    {
+        const MappedSection &section = header->arrSections[i];
+        if (((section.offset % MAPPED_ALIGNMENT) != 0) || (section.offset > szSize) ||
+            (section.count > (szSize - section.offset) / vElementSizes[i]))
+        {
+            Logging::buildText(__FUNCTION__, __FILE__, "Mapped file section out of file bounds: ");
+            Logging::buildText(__FUNCTION__, __FILE__, i);
+            Logging::write(true, Error);
+            return nullptr;
+        }
+    }
+
+    return header;
+}
@@ -0,0 +1,602 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "CompressedReader.h"
+
+#include "Logging.h"
+#include "MappedFile.h"
+#include "Parallel.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <fstream>
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+// Minimum number of triangles whose twins are computed by a thread.
+#define MIN_TRIANGLES_CHUNK     (65536)
+
+// Initial number of slots of open edges tables (power of two).
+#define OPEN_EDGES_MIN_SLOTS    (4096)
+
+// Minimum number of edges processed by a thread when building Dcel.
+#define MIN_EDGES_CHUNK         (65536)
+
+
+/***********************************************************************************************************************
+* Public methods definitions
+***********************************************************************************************************************/
+bool CompressedReader::isCompressed(const string &strFileName)
+{
+    char arrMagic[COMPRESSED_MAGIC_LENGTH] = {};
+    ifstream ifsMagic(strFileName.c_str(), ios::in | ios::binary);
+    return ifsMagic.read(arrMagic, COMPRESSED_MAGIC_LENGTH) &&
+           (memcmp(arrMagic, COMPRESSED_MAGIC, COMPRESSED_MAGIC_LENGTH) == 0);
+}
+
+
+bool CompressedReader::read(const string &strFileName, TriangleMesh &mesh, size_t szNumThreads)
+{
+    bool isSuccess=false;		// Return value.
+
+    try
+    {
+        vector<Point<TYPE>> vPoints;
+        vector<int> vCorners, vTwins, vPointEdge;
+        mesh.reset();
+        isSuccess = CompressedReader::decodeFile(strFileName, vPoints, vCorners, vTwins, vPointEdge, szNumThreads);
+        if (isSuccess)
+        {
+            mesh.set(vPoints, vCorners, vTwins);
+        }
+    }
+    catch (bad_alloc &ex)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error allocating memory");
+        Logging::write( true, Error);
+    }
+    catch (exception &ex)
+    {
+        std::cout << ex.what();
+    }
+
+    return isSuccess;
+}
+
+
+bool CompressedReader::read(const string &strFileName, Dcel &dcel, size_t szNumThreads)
+{
+    bool isSuccess=false;		// Return value.
+
+    try
+    {
+        // Dcel arrays are decoded in place
+        dcel.reset();
+        isSuccess = CompressedReader::decodeFile(strFileName, dcel.vPoints, dcel.vOrigin, dcel.vTwin, dcel.vPointEdge,
+                                                 szNumThreads) &&
+                    CompressedReader::buildDcel(dcel, szNumThreads);
+        if (!isSuccess)
+        {
+            dcel.reset();
+        }
+    }
+    catch (bad_alloc &ex)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error allocating memory");
+        Logging::write( true, Error);
+    }
+    catch (exception &ex)
+    {
+        std::cout << ex.what();
+    }
+
+    return isSuccess;
+}
+
+
+/***********************************************************************************************************************
+* Private methods definitions
+***********************************************************************************************************************/
+/**
+ * @fn                  decodePoints
+ * @brief               Decodes points blocks in parallel
+ *
+ * @param header        (IN) File header
+ * @param vBlocks       (IN) Start of every points block and end of the last one
+ * @param vPoints       (OUT) Points
+ * @param szNumThreads  (IN) Number of threads. All available cores if zero
+ * @return              true if all blocks decoded
+ *                      false otherwise
+ */
+bool CompressedReader::decodePoints(const CompressedHeader &header, const vector<const unsigned char *> &vBlocks,
+                                    vector<Point<TYPE>> &vPoints, size_t szNumThreads)
+{
+    vPoints.resize(header.numPoints);
+    bool isQuantized = (header.flags & COMPRESSED_FLAG_QUANTIZED) != 0;
+    bool isSuccess = Parallel::runChunks(vBlocks.size() - 1, 1, szNumThreads, [&](size_t firstBlock, size_t lastBlock)
+    {
+        for (size_t block=firstBlock; block<lastBlock ;block++)
+        {
+            size_t first = block*header.blockSize;
+            size_t last = min(first + header.blockSize, vPoints.size());
+            const unsigned char *ptr = vBlocks[block];
+            const unsigned char *end = vBlocks[block+1];
+
+            // Full precision coordinates. Converted if written by a build with a different type
+            if (!isQuantized)
+            {
+                if ((size_t) (end - ptr) != 2*header.typeSize*(last - first))
+                {
+                    return false;
+                }
+
+                for (size_t i=first; i<last ;i++, ptr+=2*header.typeSize)
+                {
+                    if (header.typeSize == sizeof(float))
+                    {
+                        float coordinates[2];
+                        memcpy(coordinates, ptr, sizeof(coordinates));
+                        vPoints[i] = Point<TYPE>((TYPE) coordinates[0], (TYPE) coordinates[1]);
+                    }
+                    else
+                    {
+                        double coordinates[2];
+                        memcpy(coordinates, ptr, sizeof(coordinates));
+                        vPoints[i] = Point<TYPE>((TYPE) coordinates[0], (TYPE) coordinates[1]);
+                    }
+                }
+                continue;
+            }
+
+            // Grid cells deltas
+            int64_t cellX=0, cellY=0;
+            for (size_t i=first; i<last ;i++)
+            {
+                uint64_t deltaX, deltaY;
+                if (!readVarint(ptr, end, deltaX) || !readVarint(ptr, end, deltaY))
+                {
+                    return false;
+                }
+
+                cellX += zigzagDecode(deltaX);
+                cellY += zigzagDecode(deltaY);
+                vPoints[i] = Point<TYPE>((TYPE) (header.minX + (double) cellX*header.cellSize),
+                                         (TYPE) (header.minY + (double) cellY*header.cellSize));
+            }
+
+            if (ptr != end)
+            {
+                return false;
+            }
+        }
+        return true;
+    });
+
+    if (!isSuccess)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Invalid points block");
+        Logging::write(true, Error);
+    }
+
+    return isSuccess;
+}
+
+
+/**
+ * @fn                  decodeTriangles
+ * @brief               Decodes triangles blocks in parallel. All corners must be valid point ids
+ *
+ * @param header        (IN) File header
+ * @param vBlocks       (IN) Start of every triangles block and end of the last one
+ * @param vCorners      (OUT) Origin point id of every edge
+ * @param szNumThreads  (IN) Number of threads. All available cores if zero
+ * @return              true if all blocks decoded
+ *                      false otherwise
+ */
+bool CompressedReader::decodeTriangles(const CompressedHeader &header, const vector<const unsigned char *> &vBlocks,
+                                       vector<int> &vCorners, size_t szNumThreads)
+{
+    vCorners.resize(header.numTriangles*NPOINTS_TRIANGLE);
+    auto numPoints = (int64_t) header.numPoints;
+    bool isSuccess = Parallel::runChunks(vBlocks.size() - 1, 1, szNumThreads, [&](size_t firstBlock, size_t lastBlock)
+    {
+        for (size_t block=firstBlock; block<lastBlock ;block++)
+        {
+            size_t first = block*header.blockSize;
+            size_t last = min(first + header.blockSize, (size_t) header.numTriangles);
+            const unsigned char *ptr = vBlocks[block];
+            const unsigned char *end = vBlocks[block+1];
+
+            int previous[NPOINTS_TRIANGLE] = {0, 0, 0};
+            for (size_t triangle=first; triangle<last ;triangle++)
+            {
+                if (ptr >= end)
+                {
+                    return false;
+                }
+
+                int *corners = &vCorners[triangle*NPOINTS_TRIANGLE];
+                unsigned char tags = *ptr++;
+                for (int i=0; i<NPOINTS_TRIANGLE ;i++)
+                {
+                    int tag = (tags >> (COMPRESSED_TAG_BITS*i)) & COMPRESSED_TAG_MASK;
+                    if (tag != COMPRESSED_TAG_LITERAL)
+                    {
+                        corners[i] = previous[tag];
+                        continue;
+                    }
+
+                    uint64_t delta;
+                    if (!readVarint(ptr, end, delta))
+                    {
+                        return false;
+                    }
+
+                    int64_t corner = previous[i] + zigzagDecode(delta);
+                    if ((corner <= 0) || (corner > numPoints))
+                    {
+                        return false;
+                    }
+                    corners[i] = (int) corner;
+                }
+
+                // Tags of first triangle can only be literals
+                if ((corners[0] <= 0) || (corners[1] <= 0) || (corners[2] <= 0))
+                {
+                    return false;
+                }
+                memcpy(previous, corners, sizeof(previous));
+            }
+
+            if (ptr != end)
+            {
+                return false;
+            }
+        }
+        return true;
+    });
+
+    if (!isSuccess)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Invalid triangles block");
+        Logging::write(true, Error);
+    }
+
+    return isSuccess;
+}
+
+
+/**
+ * @fn                  computeTwins
+ * @brief               Computes the twin of every edge. Triangles are split in consecutive chunks processed in
+ *                      parallel: every edge is matched with the open edges of its chunk (edges whose twin has not been
+ *                      found yet) and opened if its twin is not open. Writers store triangles along a space filling
+ *                      curve so open edges are the boundary of the triangles already visited and fit in cache. Open
+ *                      edges of all chunks are matched at the end and edges without twin are convex hull edges
+ *
+ * @param szNumPoints   (IN) Number of points
+ * @param vCorners      (IN) Origin point id of every edge
+ * @param vTwins        (OUT) Twin edge id of every edge (NO_TWIN in convex hull edges)
+ * @param vPointEdge    (OUT) First edge id that starts at every point (INVALID if none)
+ * @param szNumThreads  (IN) Number of threads. All available cores if zero
+ */
+void CompressedReader::computeTwins(size_t szNumPoints, const vector<int> &vCorners, vector<int> &vTwins,
+                                    vector<int> &vPointEdge, size_t szNumThreads)
+{
+    // Triangles of chunk c are [c*szChunkSize, (c+1)*szChunkSize)
+    size_t szNumTriangles = vCorners.size() / NPOINTS_TRIANGLE;
+    size_t szNumChunks = min(Parallel::getNumThreads(szNumThreads),
+                             (szNumTriangles + MIN_TRIANGLES_CHUNK - 1) / MIN_TRIANGLES_CHUNK);
+    szNumChunks = max(szNumChunks, (size_t) 1);
+    size_t szChunkSize = (szNumTriangles + szNumChunks - 1) / szNumChunks;
+
+    vTwins.resize(vCorners.size());
+    vector<vector<int>> vChunkOpen(szNumChunks);
+    Parallel::runChunks(szNumChunks, 1, szNumChunks, [&](size_t firstChunk, size_t lastChunk)
+    {
+        vector<OpenEdge> vTable;
+        for (size_t chunk=firstChunk; chunk<lastChunk ;chunk++)
+        {
+            size_t szNumOpen=0;
+            vTable.assign(OPEN_EDGES_MIN_SLOTS, OpenEdge());
+            size_t first = min(chunk*szChunkSize, szNumTriangles)*NPOINTS_TRIANGLE;
+            size_t last = min((chunk + 1)*szChunkSize, szNumTriangles)*NPOINTS_TRIANGLE;
+            for (size_t edgeIndex=first; edgeIndex<last ;edgeIndex++)
+            {
+                CompressedReader::matchEdge(vCorners, (int) edgeIndex, vTable, szNumOpen, vTwins);
+            }
+            CompressedReader::getOpenEdges(vTable, vChunkOpen[chunk]);
+        }
+        return true;
+    });
+
+    // Open edges of different chunks
+    size_t szNumOpen=0;
+    vector<OpenEdge> vTable(OPEN_EDGES_MIN_SLOTS);
+    for (auto &vOpen : vChunkOpen)
+    {
+        for (int edgeIndex : vOpen)
+        {
+            CompressedReader::matchEdge(vCorners, edgeIndex, vTable, szNumOpen, vTwins);
+        }
+    }
+
+    // Lowest edge that departs from every point
+    vPointEdge.assign(szNumPoints, INVALID);
+    for (int edgeIndex=(int) vCorners.size()-1; edgeIndex>=0 ;edgeIndex--)
+    {
+        vPointEdge[vCorners[edgeIndex]-1] = edgeIndex+1;
+    }
+}
+
+
+/**
+ * @fn                  matchEdge
+ * @brief               Looks for the twin of an edge in the open edges table. If found both edges are twins and the
+ *                      twin is removed from the table. Otherwise the edge is inserted without twin. Table uses linear
+ *                      probing and doubles its size when it is half full
+ *
+ * @param vCorners      (IN) Origin point id of every edge
+ * @param edgeIndex     (IN) Edge index
+ * @param vTable        (IN/OUT) Open edges table. Size is a power of two
+ * @param szNumOpen     (IN/OUT) Number of edges in the table
+ * @param vTwins        (OUT) Twin edge id of every edge
+ */
+void CompressedReader::matchEdge(const vector<int> &vCorners, int edgeIndex, vector<OpenEdge> &vTable,
+                                 size_t &szNumOpen, vector<int> &vTwins)
+{
+    auto origin = (uint64_t) vCorners[edgeIndex];
+    auto destination = (uint64_t) vCorners[TriangleMesh::getNext(edgeIndex) - 1];
+
+    // Look for the twin edge
+    size_t szMask = vTable.size() - 1;
+    uint64_t twinKey = (destination << 32) | origin;
+    size_t slot = CompressedReader::getSlot(twinKey, szMask);
+    while ((vTable[slot].key != NO_OPEN_EDGE) && (vTable[slot].key != twinKey))
+    {
+        slot = (slot + 1) & szMask;
+    }
+
+    if (vTable[slot].key == twinKey)
+    {
+        int twin = vTable[slot].edgeIndex;
+        vTwins[edgeIndex] = twin + 1;
+        vTwins[twin] = edgeIndex + 1;
+        szNumOpen--;
+
+        // Move back the next edges that cannot be found after the empty slot
+        size_t hole = slot;
+        for (size_t next=(hole + 1) & szMask; vTable[next].key != NO_OPEN_EDGE ; next=(next + 1) & szMask)
+        {
+            size_t home = CompressedReader::getSlot(vTable[next].key, szMask);
+            if (((next - home) & szMask) >= ((next - hole) & szMask))
+            {
+                vTable[hole] = vTable[next];
+                hole = next;
+            }
+        }
+        vTable[hole].key = NO_OPEN_EDGE;
+        return;
+    }
+
+    // Double table size when half full
+    if (2*(szNumOpen + 1) > vTable.size())
+    {
+        vector<OpenEdge> vOld(2*vTable.size());
+        vOld.swap(vTable);
+        szMask = vTable.size() - 1;
+        for (auto &openEdge : vOld)
+        {
+            if (openEdge.key != NO_OPEN_EDGE)
+            {
+                size_t newSlot = CompressedReader::getSlot(openEdge.key, szMask);
+                while (vTable[newSlot].key != NO_OPEN_EDGE)
+                {
+                    newSlot = (newSlot + 1) & szMask;
+                }
+                vTable[newSlot] = openEdge;
+            }
+        }
+    }
+
+    uint64_t key = (origin << 32) | destination;
+    slot = CompressedReader::getSlot(key, szMask);
+    while (vTable[slot].key != NO_OPEN_EDGE)
+    {
+        slot = (slot + 1) & szMask;
+    }
+    vTable[slot].key = key;
+    vTable[slot].edgeIndex = edgeIndex;
+    vTwins[edgeIndex] = NO_TWIN;
+    szNumOpen++;
+}
+
+
+/**
+ * @fn                  getOpenEdges
+ * @brief               Gets the edges of an open edges table sorted by edge index
+ *
+ * @param vTable        (IN) Open edges table
+ * @param vEdges        (OUT) Open edges indexes
+ */
+void CompressedReader::getOpenEdges(const vector<OpenEdge> &vTable, vector<int> &vEdges)
+{
+    vEdges.clear();
+    for (auto &openEdge : vTable)
+    {
+        if (openEdge.key != NO_OPEN_EDGE)
+        {
+            vEdges.push_back(openEdge.edgeIndex);
+        }
+    }
+    std::sort(vEdges.begin(), vEdges.end());
+}
+
+
+/**
+ * @fn                  decodeFile
+ * @brief               Maps the file, checks the header and blocks table, decodes all blocks and computes twins
+ *
+ * @param strFileName   (IN) File name
+ * @param vPoints       (OUT) Points
+ * @param vCorners      (OUT) Origin point id of every edge
+ * @param vTwins        (OUT) Twin edge id of every edge (NO_TWIN in convex hull edges)
+ * @param vPointEdge    (OUT) First edge id that starts at every point (INVALID if none)
+ * @param szNumThreads  (IN) Number of threads. All available cores if zero
+ * @return              true if read successfully
+ *                      false otherwise
+ */
+bool CompressedReader::decodeFile(const string &strFileName, vector<Point<TYPE>> &vPoints, vector<int> &vCorners,
+                                  vector<int> &vTwins, vector<int> &vPointEdge, size_t szNumThreads)
+{
+    MappedFile file;
+    if (!file.open(strFileName))
+    {
+        return false;
+    }
+
+    // Check header. Number of elements is checked against file size before allocating them
+    CompressedHeader header = {};
+    bool isValid = file.getSize() >= sizeof(header);
+    if (isValid)
+    {
+        memcpy(&header, file.getData(), sizeof(header));
+        bool isQuantized = (header.flags & COMPRESSED_FLAG_QUANTIZED) != 0;
+        isValid = (memcmp(header.arrMagic, COMPRESSED_MAGIC, COMPRESSED_MAGIC_LENGTH) == 0) &&
+                  (header.version == COMPRESSED_VERSION) && (header.endianTag == COMPRESSED_ENDIAN_TAG) &&
+                  (header.blockSize > 0) &&
+                  (isQuantized || (header.typeSize == sizeof(float)) || (header.typeSize == sizeof(double))) &&
+                  (header.numPoints <= file.getSize()) && (header.numPoints < INT_MAX) &&
+                  (header.numTriangles <= file.getSize()) && (header.numTriangles < INT_MAX / NPOINTS_TRIANGLE);
+    }
+
+    // Blocks table and blocks must use the rest of the file
+    size_t szNumPointBlocks = (header.numPoints + header.blockSize - 1) / max(header.blockSize, 1u);
+    size_t szNumTriangleBlocks = (header.numTriangles + header.blockSize - 1) / max(header.blockSize, 1u);
+    size_t szOffset = sizeof(header) + sizeof(uint64_t)*(szNumPointBlocks + szNumTriangleBlocks);
+    isValid = isValid && (szOffset <= file.getSize());
+
+    // Start of every block and end of the last one
+    auto data = (const unsigned char *) file.getData();
+    vector<const unsigned char *> vStarts(1, data + szOffset);
+    for (size_t i=0; isValid && (i<szNumPointBlocks + szNumTriangleBlocks) ;i++)
+    {
+        uint64_t szBlockSize;
+        memcpy(&szBlockSize, data + sizeof(header) + i*sizeof(uint64_t), sizeof(szBlockSize));
+        isValid = szBlockSize <= file.getSize() - szOffset;
+        szOffset += szBlockSize;
+        vStarts.push_back(data + szOffset);
+    }
+
+    if (!isValid || (szOffset != file.getSize()))
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Invalid compressed file: ");
+        Logging::buildText(__FUNCTION__, __FILE__, strFileName);
+        Logging::write(true, Error);
+        return false;
+    }
+
+    // Edges arrays have room for the external face edges added when a Dcel is built
+    vector<const unsigned char *> vPointBlocks(vStarts.begin(), vStarts.begin() + szNumPointBlocks + 1);
+    vector<const unsigned char *> vTriangleBlocks(vStarts.begin() + szNumPointBlocks, vStarts.end());
+    vCorners.reserve(header.numTriangles*NPOINTS_TRIANGLE + header.numPoints);
+    vTwins.reserve(header.numTriangles*NPOINTS_TRIANGLE + header.numPoints);
+    if (!CompressedReader::decodePoints(header, vPointBlocks, vPoints, szNumThreads) ||
+        !CompressedReader::decodeTriangles(header, vTriangleBlocks, vCorners, szNumThreads))
+    {
+        return false;
+    }
+
+    CompressedReader::computeTwins(vPoints.size(), vCorners, vTwins, vPointEdge, szNumThreads);
+    return true;
+}
+
+
+/**
+ * @fn                  buildDcel
+ * @brief               Completes a Dcel whose points, triangles edges origins and twins are set. Next, previous and
+ *                      face are computed from the edge index and external face edges are added as twins of convex
+ *                      hull edges as TriangleMesh::toDcel does
+ *
+ * @param dcel          (IN/OUT) Triangulation dcel
+ * @param szNumThreads  (IN) Number of threads. All available cores if zero
+ * @return              true if dcel built
+ *                      false if convex hull is not a simple polygon
+ */
+bool CompressedReader::buildDcel(Dcel &dcel, size_t szNumThreads)
+{
+    // Every edge without twin adds an external face edge
+    int numTriangleEdges = (int) dcel.vOrigin.size();
+    auto szNumHullEdges = (size_t) std::count(dcel.vTwin.begin(), dcel.vTwin.end(), NO_TWIN);
+    dcel.reserve(dcel.getNumVertex(), numTriangleEdges + szNumHullEdges, numTriangleEdges / NPOINTS_TRIANGLE + 1,
+                 true);
+    dcel.vPrevious.resize(numTriangleEdges);
+    dcel.vNext.resize(numTriangleEdges);
+    dcel.vEdgeFace.resize(numTriangleEdges);
+    Parallel::runChunks(numTriangleEdges, MIN_EDGES_CHUNK, szNumThreads, [&](size_t first, size_t last)
+    {
+        for (int edgeIndex=(int) first; edgeIndex<(int) last ;edgeIndex++)
+        {
+            dcel.vPrevious[edgeIndex] = TriangleMesh::getPrevious(edgeIndex);
+            dcel.vNext[edgeIndex] = TriangleMesh::getNext(edgeIndex);
+            dcel.vEdgeFace[edgeIndex] = TriangleMesh::getFace(edgeIndex);
+        }
+        return true;
+    });
+
+    // Add external face edges as twins of convex hull edges
+    vector<int> vHullEdge(dcel.getNumVertex(), INVALID);
+    int firstHullEdge=INVALID;
+    for (int edgeIndex=0; edgeIndex<numTriangleEdges ;edgeIndex++)
+    {
+        if (dcel.vTwin[edgeIndex] != NO_TWIN)
+        {
+            continue;
+        }
+
+        int origin = dcel.vOrigin[TriangleMesh::getNext(edgeIndex)-1];
+        if (vHullEdge[origin-1] != INVALID)
+        {
+            Logging::buildText(__FUNCTION__, __FILE__, "Convex hull is not a simple polygon at point ");
+            Logging::buildText(__FUNCTION__, __FILE__, origin);
+            Logging::write(true, Error);
+            return false;
+        }
+
+        int hullEdge = (int) dcel.getNumEdges() + 1;
+        dcel.addEdge(origin, edgeIndex+1, INVALID, INVALID, EXTERNAL_FACE);
+        dcel.vTwin[edgeIndex] = hullEdge;
+        vHullEdge[origin-1] = hullEdge;
+        if (firstHullEdge == INVALID)
+        {
+            firstHullEdge = hullEdge;
+        }
+    }
+
+    // Link external face edges: next edge starts at the origin of the twin edge
+    for (int edgeIndex=numTriangleEdges; edgeIndex<(int) dcel.getNumEdges() ;edgeIndex++)
+    {
+        int next = vHullEdge[dcel.vOrigin[dcel.vTwin[edgeIndex]-1]-1];
+        if (next == INVALID)
+        {
+            Logging::buildText(__FUNCTION__, __FILE__, "Convex hull is not closed at edge ");
+            Logging::buildText(__FUNCTION__, __FILE__, edgeIndex+1);
+            Logging::write(true, Error);
+            return false;
+        }
+        dcel.vNext[edgeIndex] = next;
+        dcel.vPrevious[next-1] = edgeIndex+1;
+    }
+
+    // Add faces
+    dcel.addFace(firstHullEdge);
+    for (int faceId=1; faceId<=numTriangleEdges / NPOINTS_TRIANGLE ;faceId++)
+    {
+        dcel.addFace(TriangleMesh::getFaceEdge(faceId));
+    }
+
+    return true;
+}
@@ -0,0 +1,347 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "ContainerReader.h"
+
+#include "Crc32.h"
+#include "Logging.h"
+#include "MappedDcel.h"
+#include "MappedGraph.h"
+
+#include <cstring>
+
+
+/***********************************************************************************************************************
+* Public methods definitions
+***********************************************************************************************************************/
+bool ContainerReader::isContainer(const string &strFileName)
+{
+    char arrMagic[CONTAINER_MAGIC_LENGTH] = {};
+    ifstream ifsMagic(strFileName.c_str(), ios::in | ios::binary);
+    return ifsMagic.read(arrMagic, CONTAINER_MAGIC_LENGTH) &&
+           (memcmp(arrMagic, CONTAINER_MAGIC, CONTAINER_MAGIC_LENGTH) == 0);
+}
+
+
+bool ContainerReader::open(const string &strFileNameIn)
+{
+    this->close();
+    this->strFileName = strFileNameIn;
+    this->ifs.open(strFileNameIn.c_str(), ios::in | ios::binary);
+    if (!this->ifs.is_open())
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error opening file: ");
+        Logging::buildText(__FUNCTION__, __FILE__, strFileNameIn);
+        Logging::write(true, Error);
+        return false;
+    }
+
+    // Check header. Its CRC is computed with the CRC field set to zero
+    this->ifs.seekg(0, ios::end);
+    auto fileSize = (uint64_t) this->ifs.tellg();
+    this->ifs.seekg(0, ios::beg);
+    ContainerHeader fileHeader = {};
+    bool isValid = (bool) this->ifs.read((char *) &fileHeader, sizeof(fileHeader));
+    uint32_t headerCrc = fileHeader.headerCrc;
+    fileHeader.headerCrc = 0;
+    if (!isValid || (memcmp(fileHeader.arrMagic, CONTAINER_MAGIC, CONTAINER_MAGIC_LENGTH) != 0) ||
+        (Crc32::compute(&fileHeader, sizeof(fileHeader)) != headerCrc))
+    {
+        this->close();
+        return this->logError("Invalid container header. Version: ", (int) fileHeader.version);
+    }
+    if ((fileHeader.version != CONTAINER_VERSION) || (fileHeader.endianTag != CONTAINER_ENDIAN_TAG))
+    {
+        this->close();
+        return this->logError("Unsupported container version or byte order. Version: ", (int) fileHeader.version);
+    }
+    if (((fileHeader.typeSize != sizeof(float)) && (fileHeader.typeSize != sizeof(double))) ||
+        (fileHeader.numSections > CONTAINER_MAX_SECTIONS))
+    {
+        this->close();
+        return this->logError("Invalid coordinates size or number of sections. Coordinates size: ",
+                              (int) fileHeader.typeSize);
+    }
+
+    // Check sections table and that sections are inside the file (truncated files are rejected)
+    this->vSections.resize(fileHeader.numSections);
+    isValid = (bool) this->ifs.read((char *) this->vSections.data(),
+                                    (streamsize) (sizeof(ContainerSection)*this->vSections.size())) &&
+              (Crc32::compute(this->vSections.data(), sizeof(ContainerSection)*this->vSections.size()) ==
+               fileHeader.tableCrc);
+    for (size_t i=0; isValid && (i<this->vSections.size()) ;i++)
+    {
+        const ContainerSection &section = this->vSections[i];
+        isValid = (section.elementSize > 0) && (section.offset <= fileSize) &&
+                  (section.count <= (fileSize - section.offset) / section.elementSize);
+    }
+    if (!isValid)
+    {
+        this->close();
+        return this->logError("Container sections table is corrupted or file is truncated. Sections: ",
+                              (int) fileHeader.numSections);
+    }
+
+    this->header = fileHeader;
+    return true;
+}
+
+
+void ContainerReader::close()
+{
+    if (this->ifs.is_open())
+    {
+        this->ifs.close();
+    }
+    this->ifs.clear();
+    this->header = ContainerHeader();
+    this->vSections.clear();
+}
+
+
+bool ContainerReader::hasGroup(ContainerGroup_T group) const
+{
+    for (auto &section : this->vSections)
+    {
+        if (section.group == group)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+bool ContainerReader::readPoints(vector<Point<TYPE>> &vPoints)
+{
+    return this->readCoordinates(CONTAINER_POINTS, 0, vPoints);
+}
+
+
+bool ContainerReader::readDcel(Dcel &dcel)
+{
+    return this->readDcelSections(CONTAINER_DCEL, dcel);
+}
+
+
+bool ContainerReader::readGraph(Graph &graph)
+{
+    bool isSuccess = this->readArray(CONTAINER_GRAPH, MAPPED_GRAPH_FACE_NODE, graph.vFaceNode) &&
+                     this->readArray(CONTAINER_GRAPH, MAPPED_GRAPH_POINTS, graph.vPoints) &&
+                     this->readArray(CONTAINER_GRAPH, MAPPED_GRAPH_CHILDREN, graph.vChildren) &&
+                     this->readArray(CONTAINER_GRAPH, MAPPED_GRAPH_NCHILDREN, graph.vNChildren) &&
+                     this->readArray(CONTAINER_GRAPH, MAPPED_GRAPH_FACES, graph.vFaces);
+
+    // Every node has NODE_POINTS points and MAX_CHILDREN children slots
+    size_t szNumNodes = graph.vFaces.size();
+    if (isSuccess && ((graph.vPoints.size() != szNumNodes*NODE_POINTS) ||
+                      (graph.vChildren.size() != szNumNodes*MAX_CHILDREN) || (graph.vNChildren.size() != szNumNodes)))
+    {
+        isSuccess = this->logError("Graph arrays lengths do not match. Nodes: ", (int) szNumNodes);
+    }
+
+    if (!isSuccess)
+    {
+        graph.reset();
+    }
+    return isSuccess;
+}
+
+
+bool ContainerReader::readVoronoi(Voronoi &voronoi)
+{
+    bool isSuccess = this->readDcelSections(CONTAINER_VORONOI, *voronoi.getRefDcel());
+    voronoi.setValid(isSuccess);
+    return isSuccess;
+}
+
+
+bool ContainerReader::readGabriel(Gabriel &gabriel)
+{
+    vector<uint64_t> vNumEdges;
+    vector<uint64_t> vValidEdges;
+    bool isSuccess = this->readArray(CONTAINER_GABRIEL, CONTAINER_GABRIEL_NUM_EDGES, vNumEdges) &&
+                     this->readArray(CONTAINER_GABRIEL, CONTAINER_GABRIEL_BITSET, vValidEdges);
+    if (isSuccess && ((vNumEdges.size() != 1) || (vNumEdges[0] != gabriel.szNumEdges) ||
+                      (vValidEdges.size() != gabriel.vValidEdges.size())))
+    {
+        isSuccess = this->logError("Gabriel graph edges do not match triangulation. Edges: ", gabriel.getSize());
+    }
+
+    if (isSuccess)
+    {
+        gabriel.vValidEdges.swap(vValidEdges);
+        gabriel.isBuilt = true;
+    }
+    return isSuccess;
+}
+
+
+/***********************************************************************************************************************
+* Private methods definitions
+***********************************************************************************************************************/
+/**
+ * @fn          findSection
+ * @brief       Finds a section in the sections table
+ *
+ * @param group (IN) Data set
+ * @param array (IN) Array in data set
+ * @return      section if found
+ *              null otherwise
+ */
+const ContainerSection *ContainerReader::findSection(ContainerGroup_T group, int array) const
+{
+    for (auto &section : this->vSections)
+    {
+        if ((section.group == group) && (section.array == array))
+        {
+            return &section;
+        }
+    }
+
+    return nullptr;
+}
+
+
+/**
+ * @fn              readSection
+ * @brief           Reads section data and checks its CRC
+ *
+ * @param section   (IN) Section to read
+ * @param data      (OUT) Buffer of section count*elementSize bytes
+ * @return          true if read and CRC matches
+ *                  false otherwise
+ */
+bool ContainerReader::readSection(const ContainerSection &section, void *data)
+{
+    if (!this->isOpen())
+    {
+        return false;
+    }
+
+    uint64_t numBytes = section.count*section.elementSize;
+    this->ifs.clear();
+    this->ifs.seekg((streamoff) section.offset, ios::beg);
+    if (!this->ifs.read((char *) data, (streamsize) numBytes) || (Crc32::compute(data, numBytes) != section.crc))
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Section CRC does not match in file ");
+        Logging::buildText(__FUNCTION__, __FILE__, this->strFileName);
+        Logging::buildText(__FUNCTION__, __FILE__, ". Group: ");
+        Logging::buildText(__FUNCTION__, __FILE__, (int) section.group);
+        Logging::buildText(__FUNCTION__, __FILE__, ". Array: ");
+        Logging::buildText(__FUNCTION__, __FILE__, (int) section.array);
+        Logging::write(true, Error);
+        return false;
+    }
+
+    return true;
+}
+
+
+/**
+ * @fn              readCoordinates
+ * @brief           Reads a points section. Points are converted if the file coordinates type is not TYPE
+ *
+ * @param group     (IN) Data set
+ * @param array     (IN) Array in data set
+ * @param vPoints   (OUT) Points
+ * @return          true if read successfully
+ *                  false otherwise
+ */
+bool ContainerReader::readCoordinates(ContainerGroup_T group, int array, vector<Point<TYPE>> &vPoints)
+{
+    if (this->header.typeSize == sizeof(TYPE))
+    {
+        return this->readArray(group, array, vPoints);
+    }
+
+    const ContainerSection *section = this->findSection(group, array);
+    if ((section == nullptr) || !(section->flags & CONTAINER_FLAG_COORDINATES) ||
+        (section->elementSize != 2*this->header.typeSize))
+    {
+        return this->logError("Missing or invalid points section in group ", group);
+    }
+
+    // Read points written with the other coordinates type
+    vector<char> vBuffer(section->count*section->elementSize);
+    if (!this->readSection(*section, vBuffer.data()))
+    {
+        return false;
+    }
+
+    vPoints.resize(section->count);
+    for (size_t i=0; i<vPoints.size() ;i++)
+    {
+        if (this->header.typeSize == sizeof(float))
+        {
+            float arrCoordinates[2];
+            memcpy(arrCoordinates, &vBuffer[i*sizeof(arrCoordinates)], sizeof(arrCoordinates));
+            vPoints[i] = Point<TYPE>((TYPE) arrCoordinates[0], (TYPE) arrCoordinates[1]);
+        }
+        else
+        {
+            double arrCoordinates[2];
+            memcpy(arrCoordinates, &vBuffer[i*sizeof(arrCoordinates)], sizeof(arrCoordinates));
+            vPoints[i] = Point<TYPE>((TYPE) arrCoordinates[0], (TYPE) arrCoordinates[1]);
+        }
+    }
+
+    return true;
+}
+
+
+/**
+ * @fn          readDcelSections
+ * @brief       Reads the arrays of a Dcel. Dcel is reset if any array cannot be read
+ *
+ * @param group (IN) Data set (Dcel or Voronoi)
+ * @param dcel  (OUT) Dcel
+ * @return      true if read successfully
+ *              false otherwise
+ */
+bool ContainerReader::readDcelSections(ContainerGroup_T group, DcelModel &dcel)
+{
+    static_assert(sizeof(Face) == sizeof(int), "Face must be stored as its edge id");
+    bool isSuccess = this->readCoordinates(group, MAPPED_DCEL_POINTS, dcel.vPoints) &&
+                     this->readArray(group, MAPPED_DCEL_POINT_EDGE, dcel.vPointEdge) &&
+                     this->readArray(group, MAPPED_DCEL_ORIGIN, dcel.vOrigin) &&
+                     this->readArray(group, MAPPED_DCEL_TWIN, dcel.vTwin) &&
+                     this->readArray(group, MAPPED_DCEL_PREVIOUS, dcel.vPrevious) &&
+                     this->readArray(group, MAPPED_DCEL_NEXT, dcel.vNext) &&
+                     this->readArray(group, MAPPED_DCEL_EDGE_FACE, dcel.vEdgeFace) &&
+                     this->readArray(group, MAPPED_DCEL_FACES, dcel.vFaces);
+
+    size_t szNumEdges = dcel.vOrigin.size();
+    if (isSuccess && ((dcel.vPoints.size() != dcel.vPointEdge.size()) || (dcel.vTwin.size() != szNumEdges) ||
+                      (dcel.vPrevious.size() != szNumEdges) || (dcel.vNext.size() != szNumEdges) ||
+                      (dcel.vEdgeFace.size() != szNumEdges)))
+    {
+        isSuccess = this->logError("Dcel arrays lengths do not match in group ", group);
+    }
+
+    if (!isSuccess)
+    {
+        dcel.reset();
+    }
+    return isSuccess;
+}
+
+
+/**
+ * @fn              logError
+ * @brief           Logs an error of the open container
+ *
+ * @param strText   (IN) Error text
+ * @param value     (IN) Value logged after the text
+ * @return          false
+ */
+bool ContainerReader::logError(const string &strText, int value) const
+{
+    Logging::buildText(__FUNCTION__, __FILE__, strText);
+    Logging::buildText(__FUNCTION__, __FILE__, value);
+    Logging::buildText(__FUNCTION__, __FILE__, ". File: ");
+    Logging::buildText(__FUNCTION__, __FILE__, this->strFileName);
+    Logging::write(true, Error);
+    return false;
+}
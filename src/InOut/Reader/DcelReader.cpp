@@ -3,6 +3,8 @@
 ***********************************************************************************************************************/
 #include "DcelReader.h"
 
+#include "CompressedReader.h"
+#include "ContainerReader.h"
 #include "Dcel.h"
 #include "defines.h"
 #include "FileExtensionChecker.h"
@@ -23,8 +25,17 @@ bool DcelReader::read(const string &fileName, Dcel &dcel)
 
     try
     {
-        // Check if read binary data.
-        if (FileExtensionChecker::isBinary(fileName))
+        // Check if read container, compressed or binary data.
+        if (ContainerReader::isContainer(fileName))
+        {
+            ContainerReader reader;
+            isSuccess = reader.open(fileName) && reader.readDcel(dcel);
+        }
+        else if (CompressedReader::isCompressed(fileName))
+        {
+            isSuccess = CompressedReader::read(fileName, dcel);
+        }
+        else if (FileExtensionChecker::isBinary(fileName))
         {
             isSuccess = DcelReader::readBinary(fileName, dcel);
         }
@@ -3,6 +3,7 @@
 ***********************************************************************************************************************/
 #include "GraphReader.h"
 
+#include "ContainerReader.h"
 #include "FileExtensionChecker.h"
 #include "Logging.h"
 #include "NodeIO.h"
@@ -24,8 +25,13 @@ bool GraphReader::read(const string &fileName, Graph &graph)
         // Initialize output
         graph.reset();
 
-        // Check if read binary data.
-        if (FileExtensionChecker::isBinary(fileName))
+        // Check if read container or binary data.
+        if (ContainerReader::isContainer(fileName))
+        {
+            ContainerReader reader;
+            isSuccess = reader.open(fileName) && reader.readGraph(graph);
+        }
+        else if (FileExtensionChecker::isBinary(fileName))
         {
             isSuccess = GraphReader::readBinary(fileName, graph);
         }
@@ -158,25 +164,15 @@ bool GraphReader::readBinary(const string &strFileName, Graph &graph)
                 szPtr += sizeof(iFaceId);
 
                 // Add node
-                if (iNumChildren == 0)
-                {
-                    vector<int> vPoints = {iP1, iP2, iP3};
-                    Node node(vPoints, iFaceId);
-                    graph.insert(node);
-                }
-                else if (iNumChildren == 2)
+                int nodeId = graph.getSize();
+                graph.insert(iP1, iP2, iP3, iFaceId);
+                if (iNumChildren == 2)
                 {
-                    vector<int> vPoints = {iP1, iP2, iP3};
-                    vector<int> vChildren = {iChild1, iChild2};
-                    Node node(vPoints, vChildren, iFaceId);
-                    graph.insert(node);
+                    graph.setChildren(nodeId, iChild1, iChild2);
                 }
-                else
+                else if (iNumChildren == 3)
                 {
-                    vector<int> vPoints = {iP1, iP2, iP3};
-                    vector<int> vChildren = {iChild1, iChild2, iChild3};
-                    Node node(vPoints, vChildren, iFaceId);
-                    graph.insert(node);
+                    graph.setChildren(nodeId, iChild1, iChild2, iChild3);
                 }
             }
 
@@ -0,0 +1,199 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "GridIndexReader.h"
+
+#include "FileExtensionChecker.h"
+#include "Logging.h"
+
+#include <cstring>
+#include <fstream>
+#include <sys/stat.h>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Public methods definitions
+***********************************************************************************************************************/
+template <class M> bool GridIndexReader::read(const string &fileName, const M &dcel, BasicDcelGridIndex<M> &index)
+{
+    bool isSuccess=false;		// Return value.
+
+    try
+    {
+        // Initialize output
+        index.reset();
+
+        // Check if read binary data.
+        if (FileExtensionChecker::isBinary(fileName))
+        {
+            isSuccess = GridIndexReader::readBinary(fileName, index);
+        }
+        else
+        {
+            isSuccess = GridIndexReader::readFlat(fileName, index);
+        }
+
+        // Seeds must be faces of the dcel
+        isSuccess = isSuccess && index.attach(dcel);
+        if (!isSuccess)
+        {
+            index.reset();
+        }
+    }
+    catch (const ofstream::failure& e)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error opening file: ");
+        Logging::buildText(__FUNCTION__, __FILE__, fileName);
+        Logging::write(true, Error);
+    }
+    catch (bad_alloc &ex)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error allocating memory");
+        Logging::write( true, Error);
+    }
+    catch (exception &ex)
+    {
+        std::cout << ex.what();
+    }
+
+    return isSuccess;
+}
+
+
+/***********************************************************************************************************************
+* Private methods definitions
+***********************************************************************************************************************/
+/**
+ * @fn                  isValidSize
+ * @brief               Checks grid dimensions are not zero and the number of cells does not exceed a maximum
+ *
+ * @param szNumColumns  (IN) # cells per row
+ * @param szNumRows     (IN) # rows
+ * @param szMaxCells    (IN) Maximum number of cells the file can store
+ * @return              true if dimensions are valid
+ *                      false otherwise
+ */
+bool GridIndexReader::isValidSize(size_t szNumColumns, size_t szNumRows, size_t szMaxCells)
+{
+    return (szNumColumns > 0) && (szNumRows > 0) && (szNumRows <= szMaxCells / szNumColumns);
+}
+
+
+template <class M> bool GridIndexReader::readFlat(const string &strFileName, BasicDcelGridIndex<M> &index)
+{
+    bool 	isSuccess=false;	        // Return value.
+
+    // Open file.
+    ifstream ifs(strFileName.c_str(), ios::in);
+    if (ifs.is_open())
+    {
+        // Read grid geometry.
+        TYPE x=0.0, y=0.0;
+        ifs >> index.szNumColumns >> index.szNumRows;
+        ifs >> x >> y >> index.cellSize;
+        index.minPoint = Point<TYPE>(x, y);
+
+        // Every seed takes at least one digit and one separator so counts are checked before allocating seeds.
+        struct stat results = {};
+        stat(strFileName.c_str(), &results);
+        if (ifs.fail() || !GridIndexReader::isValidSize(index.szNumColumns, index.szNumRows,
+                                                         (size_t) results.st_size / 2))
+        {
+            Logging::buildText(__FUNCTION__, __FILE__, "Invalid grid dimensions in file: ");
+            Logging::buildText(__FUNCTION__, __FILE__, strFileName);
+            Logging::write(true, Error);
+            return false;
+        }
+
+        // Read cells seeds.
+        index.vSeeds.resize(index.szNumColumns*index.szNumRows);
+        for (auto &seed : index.vSeeds)
+        {
+            ifs >> seed;
+        }
+
+        isSuccess = !ifs.fail() && (index.cellSize > 0.0);
+
+        // Close file.
+        ifs.close();
+    }
+    else
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error opening file: ");
+        Logging::buildText(__FUNCTION__, __FILE__, strFileName);
+        Logging::write(true, Error);
+    }
+
+    return isSuccess;
+}
+
+
+template <class M> bool GridIndexReader::readBinary(const string &strFileName, BasicDcelGridIndex<M> &index)
+{
+    bool 	isSuccess=false;	        // Return value.
+
+    // Open file.
+    ifstream ifs(strFileName.c_str(), ios::in | ios::binary);
+    if (ifs.is_open())
+    {
+        // Get file size
+        struct stat results = {};
+        stat(strFileName.c_str(), &results);
+        size_t szHeaderSize = sizeof(size_t)*2 + sizeof(TYPE)*3;
+
+        // Read data from file
+        vector<char> vBuffer(results.st_size);
+        if ((vBuffer.size() < szHeaderSize) || !ifs.read(vBuffer.data(), results.st_size))
+        {
+            Logging::buildText(__FUNCTION__, __FILE__, "Not enough data read from file: ");
+            Logging::buildText(__FUNCTION__, __FILE__, strFileName);
+            Logging::write(true, Error);
+        }
+        else
+        {
+            // Get grid dimensions
+            size_t szPtr=0;
+            memcpy(&index.szNumColumns, &vBuffer[szPtr], sizeof(size_t));
+            szPtr += sizeof(size_t);
+            memcpy(&index.szNumRows, &vBuffer[szPtr], sizeof(size_t));
+            szPtr += sizeof(size_t);
+
+            // Get grid origin and cell size
+            TYPE values[3];
+            memcpy(values, &vBuffer[szPtr], sizeof(values));
+            szPtr += sizeof(values);
+            index.minPoint = Point<TYPE>(values[0], values[1]);
+            index.cellSize = values[2];
+
+            // Get seeds. Counts are checked before they are multiplied so they cannot overflow
+            size_t szMaxCells = (vBuffer.size() - szPtr) / sizeof(int);
+            size_t szNumCells = index.szNumColumns*index.szNumRows;
+            if (GridIndexReader::isValidSize(index.szNumColumns, index.szNumRows, szMaxCells) &&
+                (vBuffer.size() == szPtr + sizeof(int)*szNumCells))
+            {
+                index.vSeeds.resize(szNumCells);
+                memcpy(index.vSeeds.data(), &vBuffer[szPtr], sizeof(int)*szNumCells);
+                isSuccess = (index.cellSize > 0.0);
+            }
+        }
+
+        // Close file.
+        ifs.close();
+    }
+    else
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error opening file: ");
+        Logging::buildText(__FUNCTION__, __FILE__, strFileName);
+        Logging::write(true, Error);
+    }
+
+    return isSuccess;
+}
+
+
+/***********************************************************************************************************************
+* Explicit instantiations
+***********************************************************************************************************************/
+template bool GridIndexReader::read(const string &fileName, const Dcel &dcel, DcelGridIndex &index);
+template bool GridIndexReader::read(const string &fileName, const MappedDcel &dcel, MappedDcelGridIndex &index);
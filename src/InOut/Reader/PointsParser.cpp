@@ -0,0 +1,317 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "PointsParser.h"
+
+#include "Logging.h"
+#include "Parallel.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+// Largest mantissa and power of ten that are exact in a double so a single multiplication or division is rounded
+// correctly.
+#define PARSER_MAX_EXACT_MANTISSA       ((uint64_t) 1 << 53)
+#define PARSER_MAX_EXACT_POWER          (22)
+#define PARSER_MAX_MANTISSA_DIGITS      (19)
+
+
+/***********************************************************************************************************************
+* Local functions
+***********************************************************************************************************************/
+static inline bool isDigit(char c) { return (c >= '0') && (c <= '9'); };
+static inline bool isSpace(char c) { return (c == ' ') || (c == '\t') || (c == '\r') || (c == '\n'); };
+static inline bool isSeparator(char c) { return isSpace(c) || (c == ','); };
+
+
+/***********************************************************************************************************************
+* Public methods definitions
+***********************************************************************************************************************/
+bool PointsParser::parse(const char *data, size_t szSize, vector<Point<TYPE>> &vPoints, size_t szNumThreads)
+{
+    size_t szNumChunks = min(Parallel::getNumThreads(szNumThreads), szSize / POINTS_PARSER_MIN_BYTES_THREAD);
+    szNumChunks = max(szNumChunks, (size_t) 1);
+    vector<size_t> vBounds;
+    PointsParser::split(data, szSize, szNumChunks, vBounds);
+
+    // Parse every chunk in a different thread
+    vector<vector<TYPE>> vChunksCoordinates(szNumChunks);
+    vector<size_t> vNumLines(szNumChunks, 0);
+    vector<char> vIsValid(szNumChunks, true);
+    Parallel::runChunks(szNumChunks, 1, szNumChunks, [&](size_t first, size_t last)
+    {
+        for (size_t i=first; i<last ;i++)
+        {
+            vIsValid[i] = PointsParser::parseChunk(&data[vBounds[i]], vBounds[i+1] - vBounds[i],
+                                                   vChunksCoordinates[i], vNumLines[i]);
+        }
+        return true;
+    });
+
+    // Report first error. Previous chunks were fully parsed so their lines are counted
+    size_t szLine = 1;
+    vector<size_t> vOffsets(szNumChunks + 1, 0);
+    for (size_t i=0; i<szNumChunks ;i++)
+    {
+        if (!vIsValid[i])
+        {
+            Logging::buildText(__FUNCTION__, __FILE__, "Invalid number in line ");
+            Logging::buildText(__FUNCTION__, __FILE__, szLine + vNumLines[i]);
+            Logging::write(true, Error);
+            return false;
+        }
+        szLine += vNumLines[i];
+        vOffsets[i+1] = vOffsets[i] + vChunksCoordinates[i].size();
+    }
+
+    if ((vOffsets.back() % 2) != 0)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Last point does not have Y coordinate");
+        Logging::write(true, Error);
+        return false;
+    }
+
+    // Coordinates are paired in text order so a point can start in a chunk and end in the next one
+    size_t szFirstPoint = vPoints.size();
+    size_t szNumPoints = vOffsets.back() / 2;
+    vPoints.resize(szFirstPoint + szNumPoints);
+    Parallel::runChunks(szNumChunks, 1, szNumChunks, [&](size_t first, size_t last)
+    {
+        for (size_t i=first; i<last ;i++)
+        {
+            for (size_t j=0; j<vChunksCoordinates[i].size() ;j++)
+            {
+                size_t szCoordinate = vOffsets[i] + j;
+                Point<TYPE> &point = vPoints[szFirstPoint + szCoordinate / 2];
+                if ((szCoordinate % 2) == 0)
+                {
+                    point.setX(vChunksCoordinates[i][j]);
+                }
+                else
+                {
+                    point.setY(vChunksCoordinates[i][j]);
+                }
+            }
+            vector<TYPE>().swap(vChunksCoordinates[i]);
+        }
+        return true;
+    });
+
+    return true;
+}
+
+
+/***********************************************************************************************************************
+* Private methods definitions
+***********************************************************************************************************************/
+/**
+ * @fn                  split
+ * @brief               Splits text in chunks of similar length. Chunks end after a line end found before the next
+ *                      chunk nominal start or, if there is none, before a white space (and an optional comma)
+ *
+ * @param data          (IN) Text
+ * @param szSize        (IN) Text length
+ * @param szNumChunks   (IN) Number of chunks
+ * @param vBounds       (OUT) Chunks start offsets followed by text length
+ */
+void PointsParser::split(const char *data, size_t szSize, size_t szNumChunks, vector<size_t> &vBounds)
+{
+    vBounds.assign(szNumChunks + 1, szSize);
+    vBounds[0] = 0;
+    for (size_t i=1; i<szNumChunks ;i++)
+    {
+        size_t szStart = max(i*szSize / szNumChunks, vBounds[i-1]);
+        size_t szEnd = max((i+1)*szSize / szNumChunks, szStart);
+        auto lineEnd = (const char *) memchr(&data[szStart], '\n', szEnd - szStart);
+        if (lineEnd != nullptr)
+        {
+            szStart = (size_t) (lineEnd - data) + 1;
+        }
+        else
+        {
+            // Skip number and the separator after it so the chunk starts in the next number
+            while ((szStart < szSize) && !isSeparator(data[szStart]))
+            {
+                szStart++;
+            }
+            while ((szStart < szSize) && isSpace(data[szStart]) && (data[szStart] != '\n'))
+            {
+                szStart++;
+            }
+            if ((szStart < szSize) && (data[szStart] == ','))
+            {
+                szStart++;
+            }
+        }
+        vBounds[i] = szStart;
+    }
+}
+
+
+/**
+ * @fn                  parseChunk
+ * @brief               Parses the coordinates of a chunk
+ *
+ * @param data          (IN) Chunk text
+ * @param szSize        (IN) Chunk length
+ * @param vCoordinates  (OUT) Coordinates in text order
+ * @param szNumLines    (OUT) Number of line ends in the chunk or before the invalid number
+ * @return              true if chunk parsed
+ *                      false if an invalid number is found
+ */
+bool PointsParser::parseChunk(const char *data, size_t szSize, vector<TYPE> &vCoordinates, size_t &szNumLines)
+{
+    // Coordinates written with 6 decimals and a separator take at least 9 characters
+    vCoordinates.reserve(szSize / 9 + 1);
+    szNumLines = 0;
+
+    const char *ptr = data;
+    const char *end = data + szSize;
+    bool isCommaAllowed = false;
+    while (ptr < end)
+    {
+        if (*ptr == '\n')
+        {
+            szNumLines++;
+            isCommaAllowed = false;
+            ptr++;
+        }
+        else if (isSpace(*ptr))
+        {
+            ptr++;
+        }
+        else if ((*ptr == ',') && isCommaAllowed)
+        {
+            isCommaAllowed = false;
+            ptr++;
+        }
+        else
+        {
+            TYPE value;
+            if (!PointsParser::parseNumber(ptr, end, value))
+            {
+                return false;
+            }
+            vCoordinates.push_back(value);
+            isCommaAllowed = true;
+        }
+    }
+
+    return true;
+}
+
+
+/**
+ * @fn              parseNumber
+ * @brief           Parses a decimal number with optional sign, fraction and exponent. Numbers with a short mantissa
+ *                  and exponent are computed with a single exact operation and other numbers use the C library
+ *
+ * @param ptr       (IN/OUT) Number first character. Updated to the character after the number
+ * @param end       (IN) Text end
+ * @param value     (OUT) Number value
+ * @return          true if number is valid
+ *                  false otherwise
+ */
+bool PointsParser::parseNumber(const char *&ptr, const char *end, TYPE &value)
+{
+    static const double arrPowers[PARSER_MAX_EXACT_POWER+1] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+                                                               1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19,
+                                                               1e20, 1e21, 1e22};
+
+    const char *numberEnd = ptr;
+    while ((numberEnd < end) && !isSeparator(*numberEnd))
+    {
+        numberEnd++;
+    }
+
+    // Sign and mantissa digits
+    const char *p = ptr;
+    bool isNegative = false;
+    if ((p < numberEnd) && ((*p == '+') || (*p == '-')))
+    {
+        isNegative = (*p == '-');
+        p++;
+    }
+
+    uint64_t mantissa = 0;
+    int nDigits = 0;
+    int exponent = 0;
+    bool hasDigits = false;
+    bool isFraction = false;
+    while ((p < numberEnd) && (isDigit(*p) || ((*p == '.') && !isFraction)))
+    {
+        if (*p == '.')
+        {
+            isFraction = true;
+        }
+        else
+        {
+            // Leading zeros are not significant digits
+            if ((mantissa != 0) || (*p != '0'))
+            {
+                nDigits++;
+                mantissa = (nDigits <= PARSER_MAX_MANTISSA_DIGITS) ? mantissa*10 + (uint64_t) (*p - '0') : mantissa;
+            }
+            exponent -= isFraction ? 1 : 0;
+            hasDigits = true;
+        }
+        p++;
+    }
+
+    // Exponent
+    if (hasDigits && (p < numberEnd) && ((*p == 'e') || (*p == 'E')))
+    {
+        p++;
+        int sign = 1;
+        if ((p < numberEnd) && ((*p == '+') || (*p == '-')))
+        {
+            sign = (*p == '-') ? -1 : 1;
+            p++;
+        }
+        if ((p >= numberEnd) || !isDigit(*p))
+        {
+            return false;
+        }
+        int exponentValue = 0;
+        while ((p < numberEnd) && isDigit(*p))
+        {
+            exponentValue = min(exponentValue*10 + (*p - '0'), 100000);
+            p++;
+        }
+        exponent += sign*exponentValue;
+    }
+
+    if (!hasDigits || (p != numberEnd) || (numberEnd - ptr >= POINTS_PARSER_MAX_NUMBER_LENGTH))
+    {
+        return false;
+    }
+
+#ifndef FLOAT_TYPE
+    if ((nDigits <= PARSER_MAX_MANTISSA_DIGITS) && (mantissa <= PARSER_MAX_EXACT_MANTISSA) &&
+        (abs(exponent) <= PARSER_MAX_EXACT_POWER))
+    {
+        double result = (double) mantissa;
+        result = (exponent < 0) ? result / arrPowers[-exponent] : result * arrPowers[exponent];
+        value = isNegative ? -result : result;
+        ptr = numberEnd;
+        return true;
+    }
+#endif
+
+    // C library needs a null terminated string
+    char arrNumber[POINTS_PARSER_MAX_NUMBER_LENGTH];
+    memcpy(arrNumber, ptr, numberEnd - ptr);
+    arrNumber[numberEnd - ptr] = '\0';
+#ifdef FLOAT_TYPE
+    value = strtof(arrNumber, nullptr);
+#else
+    value = strtod(arrNumber, nullptr);
+#endif
+    ptr = numberEnd;
+    return true;
+}
@@ -3,8 +3,11 @@
 ***********************************************************************************************************************/
 #include "PointsReader.h"
 
+#include "ContainerReader.h"
 #include "FileExtensionChecker.h"
 #include "Logging.h"
+#include "MappedFile.h"
+#include "PointsParser.h"
 
 #include <sys/stat.h>
 #include <cstring>
@@ -19,15 +22,21 @@ bool PointsReader::read(const string &strFileName, vector<Point<TYPE>> &vPoints)
 
     try
     {
+        // Read points from container
+        if (ContainerReader::isContainer(strFileName))
+        {
+            ContainerReader reader;
+            isSuccess = reader.open(strFileName) && reader.readPoints(vPoints);
+        }
         // Read points from flat points file
-        if (FileExtensionChecker::isBinary(strFileName))
+        else if (FileExtensionChecker::isBinary(strFileName))
         {
             isSuccess = PointsReader::readBinary(strFileName, vPoints);
         }
             // Read points from binary file
         else
         {
-            isSuccess = PointsReader::readFlat(strFileName, vPoints);
+            isSuccess = PointsReader::readText(strFileName, vPoints);
         }
     }
     catch (const ifstream::failure& e)
@@ -50,18 +59,20 @@ bool PointsReader::read(const string &strFileName, vector<Point<TYPE>> &vPoints)
 }
 
 
-/***********************************************************************************************************************
-* Public methods definitions
-***********************************************************************************************************************/
-/**
- * @fn      readFlat
- * @brief   read the set of points from a flat file
- *
- * @param   strFileName     (IN) File name
- * @param   vPoints         (OUT) Points set
- * @return  true if file read successfully
- *          false otherwise
- */
+bool PointsReader::readText(const string &strFileName, vector<Point<TYPE>> &vPoints, size_t szNumThreads)
+{
+    // Empty files cannot be mapped and have no points
+    struct stat results = {};
+    if ((stat(strFileName.c_str(), &results) == 0) && (results.st_size == 0))
+    {
+        return true;
+    }
+
+    MappedFile file;
+    return file.open(strFileName) && PointsParser::parse(file.getData(), file.getSize(), vPoints, szNumThreads);
+}
+
+
 bool PointsReader::readFlat(const string &strFileName, vector<Point<TYPE>> &vPoints)
 {
     bool isSuccess=false;	// Return value.
@@ -100,6 +111,9 @@ bool PointsReader::readFlat(const string &strFileName, vector<Point<TYPE>> &vPoi
 }
 
 
+/***********************************************************************************************************************
+* Private methods definitions
+***********************************************************************************************************************/
 /**
  * @fn      readBinary
  * @brief   read the set of points from a binary file
@@ -26,9 +26,9 @@ bool VoronoiIO::read(const string &strFileName, Voronoi &voronoi)
 }
 
 
-bool VoronoiIO::write(const string &strFileName, const Voronoi &voronoi)
+bool VoronoiIO::write(const string &strFileName, const Voronoi &voronoi, bool isBackground)
 {
-    bool isSuccess = DcelWriter::write(strFileName, voronoi.dcel);
+    bool isSuccess = DcelWriter::write(strFileName, voronoi.dcel, isBackground);
 
     return isSuccess;
 }
@@ -0,0 +1,312 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "BufferedWriter.h"
+#include "Logging.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+// Significant digits written by ostream by default.
+#define REAL_DIGITS             (6)
+
+// Decimal exponents printed without exponent by "%g" format.
+#define REAL_MIN_EXPONENT       (-4)
+#define REAL_MAX_EXPONENT       (REAL_DIGITS - 1)
+
+// Distance to a half unit under which rounding is left to snprintf because the scaled value could be a tie.
+#define REAL_TIE_MARGIN         (1e-6)
+
+
+/***********************************************************************************************************************
+* Public methods definitions
+***********************************************************************************************************************/
+bool BufferedWriter::open(const string &strFileName, bool isBackground, size_t szBufferSize)
+{
+    this->close();
+
+    this->fd = ::open(strFileName.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (this->fd < 0)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error opening file: ");
+        Logging::buildText(__FUNCTION__, __FILE__, strFileName);
+        Logging::write(true, Error);
+        return false;
+    }
+
+    // Buffers must fit any formatted number
+    szBufferSize = max(szBufferSize, (size_t) BUFFERED_MAX_NUMBER_LENGTH);
+    this->vBuffers[0].resize(szBufferSize);
+    if (isBackground)
+    {
+        this->vBuffers[1].resize(szBufferSize);
+    }
+    this->szIndex = 0;
+    this->ptrCurrent = this->vBuffers[0].data();
+    this->ptrEnd = this->ptrCurrent + szBufferSize;
+    this->isError = false;
+
+    this->isBackground = isBackground;
+    this->isPending = false;
+    this->isStopped = false;
+    if (isBackground)
+    {
+        this->thread = std::thread(&BufferedWriter::run, this);
+    }
+
+    return true;
+}
+
+
+bool BufferedWriter::close()
+{
+    if (!this->isOpen())
+    {
+        return !this->isError;
+    }
+
+    this->flush();
+    if (this->isBackground)
+    {
+        {
+            unique_lock<std::mutex> lock(this->mutex);
+            this->isStopped = true;
+        }
+        this->condition.notify_all();
+        this->thread.join();
+        this->isBackground = false;
+    }
+
+    if (::close(this->fd) != 0)
+    {
+        this->isError = true;
+    }
+    this->fd = -1;
+
+    // Release buffers
+    for (auto &vBuffer : this->vBuffers)
+    {
+        vector<char>().swap(vBuffer);
+    }
+    this->ptrCurrent = this->ptrEnd = nullptr;
+
+    return !this->isError;
+}
+
+
+/***********************************************************************************************************************
+* Private methods definitions
+***********************************************************************************************************************/
+/**
+ * @fn      flush
+ * @brief   Writes the buffer being filled. In background mode the buffer is passed to the I/O thread once the previous
+ *          one is written and the other buffer is filled next
+ */
+void BufferedWriter::flush()
+{
+    char *ptrBuffer = this->vBuffers[this->szIndex].data();
+    auto szNumBytes = (size_t) (this->ptrCurrent - ptrBuffer);
+    if (szNumBytes > 0)
+    {
+        if (this->isBackground)
+        {
+            {
+                unique_lock<std::mutex> lock(this->mutex);
+                this->condition.wait(lock, [this] { return !this->isPending; });
+                this->isPending = true;
+                this->szPendingIndex = this->szIndex;
+                this->szPendingBytes = szNumBytes;
+            }
+            this->condition.notify_all();
+            this->szIndex = 1 - this->szIndex;
+            ptrBuffer = this->vBuffers[this->szIndex].data();
+        }
+        else if (!this->isError && !writeAll(this->fd, ptrBuffer, szNumBytes))
+        {
+            this->isError = true;
+        }
+    }
+
+    this->ptrCurrent = ptrBuffer;
+    this->ptrEnd = ptrBuffer + this->vBuffers[this->szIndex].size();
+}
+
+
+/**
+ * @fn      run
+ * @brief   I/O thread loop. Writes pending buffers until the writer is closed
+ */
+void BufferedWriter::run()
+{
+    unique_lock<std::mutex> lock(this->mutex);
+    while (true)
+    {
+        this->condition.wait(lock, [this] { return this->isPending || this->isStopped; });
+        if (!this->isPending)
+        {
+            break;
+        }
+
+        // Pending buffer is not the one being filled so it is written unlocked
+        const char *data = this->vBuffers[this->szPendingIndex].data();
+        size_t szNumBytes = this->szPendingBytes;
+        bool isSuccess = !this->isError;
+        lock.unlock();
+        isSuccess = isSuccess && writeAll(this->fd, data, szNumBytes);
+        lock.lock();
+
+        this->isError = this->isError || !isSuccess;
+        this->isPending = false;
+        this->condition.notify_all();
+    }
+}
+
+
+/**
+ * @fn              writeAll
+ * @brief           Writes all bytes to a file retrying partial writes
+ *
+ * @param fd        (IN) File descriptor
+ * @param data      (IN) Data to write
+ * @param szSize    (IN) Number of bytes
+ * @return          true if all bytes written
+ *                  false otherwise
+ */
+bool BufferedWriter::writeAll(int fd, const char *data, size_t szSize)
+{
+    while (szSize > 0)
+    {
+        ssize_t written = ::write(fd, data, szSize);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        szSize -= (size_t) written;
+    }
+
+    return true;
+}
+
+
+/**
+ * @fn              formatReal
+ * @brief           Formats a real number as "%g" does. Values that are printed without exponent are rounded to
+ *                  REAL_DIGITS digits by scaling them to an integer. Other values (and values that could be a rounding
+ *                  tie) are formatted by snprintf
+ *
+ * @param value     (IN) Value to format
+ * @param ptr       (IN) Output buffer (at least BUFFERED_MAX_NUMBER_LENGTH bytes)
+ * @return          pointer to next byte after the formatted value
+ */
+char *BufferedWriter::formatReal(double value, char *ptr)
+{
+    static const double arrPowers[] = {1e-4, 1e-3, 1e-2, 1e-1, 1e0, 1e1, 1e2, 1e3, 1e4, 1e5};
+    static const double arrScales[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
+    static const unsigned long maxDigits = 1000000;
+
+    double absolute = std::fabs(value);
+    if (value == 0.0)
+    {
+        if (std::signbit(value))
+        {
+            *ptr++ = '-';
+        }
+        *ptr++ = '0';
+        return ptr;
+    }
+
+    if ((absolute >= arrPowers[0]) && (absolute < arrPowers[REAL_MAX_EXPONENT - REAL_MIN_EXPONENT] * 10.0))
+    {
+        // Decimal exponent and value scaled to REAL_DIGITS integer digits
+        int exponent = REAL_MAX_EXPONENT;
+        while ((exponent > REAL_MIN_EXPONENT) && (absolute < arrPowers[exponent - REAL_MIN_EXPONENT]))
+        {
+            exponent--;
+        }
+        double scaled = absolute*arrScales[REAL_MAX_EXPONENT - exponent];
+        auto digits = (unsigned long) scaled;
+        double fraction = scaled - (double) digits;
+
+        if ((digits >= maxDigits/10) && (digits < maxDigits) && (std::fabs(fraction - 0.5) >= REAL_TIE_MARGIN))
+        {
+            if (fraction > 0.5)
+            {
+                digits++;
+            }
+
+            // Rounding up adds a digit
+            if (digits == maxDigits)
+            {
+                digits /= 10;
+                exponent++;
+            }
+
+            if (exponent <= REAL_MAX_EXPONENT)
+            {
+                char arrDigits[REAL_DIGITS];
+                for (int i=REAL_DIGITS-1; i>=0 ; i--)
+                {
+                    arrDigits[i] = (char) ('0' + digits % 10);
+                    digits /= 10;
+                }
+
+                // Trailing zeros of the fractional part are not written
+                int nDigits = REAL_DIGITS;
+                while ((nDigits > exponent + 1) && (arrDigits[nDigits-1] == '0'))
+                {
+                    nDigits--;
+                }
+
+                if (value < 0.0)
+                {
+                    *ptr++ = '-';
+                }
+                if (exponent >= 0)
+                {
+                    for (int i=0; i<=exponent ; i++)
+                    {
+                        *ptr++ = arrDigits[i];
+                    }
+                    if (nDigits > exponent + 1)
+                    {
+                        *ptr++ = '.';
+                        for (int i=exponent+1; i<nDigits ; i++)
+                        {
+                            *ptr++ = arrDigits[i];
+                        }
+                    }
+                }
+                else
+                {
+                    *ptr++ = '0';
+                    *ptr++ = '.';
+                    for (int i=exponent+1; i<0 ; i++)
+                    {
+                        *ptr++ = '0';
+                    }
+                    for (int i=0; i<nDigits ; i++)
+                    {
+                        *ptr++ = arrDigits[i];
+                    }
+                }
+                return ptr;
+            }
+        }
+    }
+
+    int length = snprintf(ptr, BUFFERED_MAX_NUMBER_LENGTH, "%g", value);
+    return ptr + max(length, 0);
+}
@@ -0,0 +1,340 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "CompressedWriter.h"
+
+#include "Logging.h"
+#include "Parallel.h"
+#include "SpatialSort.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+// Maximum number of grid cells per axis so cells deltas fit in 64 bits.
+#define MAX_GRID_CELLS          (4.0e18)
+
+// Minimum number of triangles sorted by a thread.
+#define MIN_SORT_CHUNK          (65536)
+
+
+/***********************************************************************************************************************
+* Public methods definitions
+***********************************************************************************************************************/
+bool CompressedWriter::write(const string &strFileName, const TriangleMesh &mesh, double cellSize,
+                             size_t szNumThreads)
+{
+    bool isSuccess=false;		// Return value.
+
+    try
+    {
+        CompressedHeader header = {};
+        memcpy(header.arrMagic, COMPRESSED_MAGIC, COMPRESSED_MAGIC_LENGTH);
+        header.version = COMPRESSED_VERSION;
+        header.endianTag = COMPRESSED_ENDIAN_TAG;
+        header.typeSize = sizeof(TYPE);
+        header.numPoints = mesh.getNumVertex();
+        header.numTriangles = mesh.getNumFaces() - 1;
+        header.blockSize = COMPRESSED_BLOCK_SIZE;
+
+        // Points blocks first and then triangles blocks
+        vector<vector<unsigned char>> vBlocks;
+        if (CompressedWriter::encodePoints(mesh, cellSize, header, vBlocks, szNumThreads))
+        {
+            CompressedWriter::encodeTriangles(mesh.vCorners, vBlocks, szNumThreads);
+            isSuccess = CompressedWriter::writeFile(strFileName, header, vBlocks);
+        }
+    }
+    catch (bad_alloc &ex)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error allocating memory");
+        Logging::write( true, Error);
+    }
+    catch (exception &ex)
+    {
+        std::cout << ex.what();
+    }
+
+    return isSuccess;
+}
+
+
+bool CompressedWriter::write(const string &strFileName, Dcel &dcel, double cellSize, size_t szNumThreads)
+{
+    bool isSuccess=false;		// Return value.
+
+    try
+    {
+        // Twins are not written so only corners are sorted
+        TriangleMesh mesh(dcel);
+        vector<int> vCorners;
+        CompressedWriter::sortTriangles(mesh, vCorners, szNumThreads);
+        mesh.vCorners.swap(vCorners);
+        isSuccess = CompressedWriter::write(strFileName, mesh, cellSize, szNumThreads);
+    }
+    catch (bad_alloc &ex)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error allocating memory");
+        Logging::write( true, Error);
+    }
+
+    return isSuccess;
+}
+
+
+/***********************************************************************************************************************
+* Private methods definitions
+***********************************************************************************************************************/
+/**
+ * @fn                  sortTriangles
+ * @brief               Sorts the mesh triangles along the Hilbert curve of their centroids so consecutive triangles
+ *                      are adjacent. Corners order of every triangle does not change
+ *
+ * @param mesh          (IN) Triangle mesh
+ * @param vCorners      (OUT) Corners of the sorted triangles
+ * @param szNumThreads  (IN) Number of threads. All available cores if zero
+ */
+void CompressedWriter::sortTriangles(const TriangleMesh &mesh, vector<int> &vCorners, size_t szNumThreads)
+{
+    const vector<Point<TYPE>> &vPoints = mesh.vPoints;
+    Point<TYPE> minPoint, maxPoint;
+    vector<int> vIndex(vPoints.size());
+    for (size_t i=0; i<vIndex.size() ;i++)
+    {
+        vIndex[i] = (int) i;
+    }
+    SpatialSort::getBoundingBox(vPoints, vIndex, minPoint, maxPoint);
+
+    // Hilbert index of the centroid of every triangle in high 32 bits and triangle index in low 32 bits
+    size_t szNumTriangles = mesh.vCorners.size() / NPOINTS_TRIANGLE;
+    vector<uint64_t> vKeys(szNumTriangles);
+    Parallel::runChunks(szNumTriangles, MIN_SORT_CHUNK, szNumThreads, [&](size_t first, size_t last)
+    {
+        for (size_t triangle=first; triangle<last ;triangle++)
+        {
+            const int *corners = &mesh.vCorners[triangle*NPOINTS_TRIANGLE];
+            const Point<TYPE> &p1 = vPoints[corners[0]-1];
+            const Point<TYPE> &p2 = vPoints[corners[1]-1];
+            const Point<TYPE> &p3 = vPoints[corners[2]-1];
+            Point<TYPE> centroid((p1.getX() + p2.getX() + p3.getX()) / 3, (p1.getY() + p2.getY() + p3.getY()) / 3);
+            vKeys[triangle] = (SpatialSort::getHilbertIndex(centroid, minPoint, maxPoint) << 32) | triangle;
+        }
+        return true;
+    });
+    Parallel::sort(vKeys, MIN_SORT_CHUNK, szNumThreads, std::less<uint64_t>());
+
+    vCorners.resize(mesh.vCorners.size());
+    for (size_t i=0; i<szNumTriangles ;i++)
+    {
+        memcpy(&vCorners[i*NPOINTS_TRIANGLE], &mesh.vCorners[(vKeys[i] & UINT32_MAX)*NPOINTS_TRIANGLE],
+               NPOINTS_TRIANGLE*sizeof(int));
+    }
+}
+
+
+/**
+ * @fn                  encodePoints
+ * @brief               Encodes the mesh points in blocks. Quantized coordinates are the grid cell of every point
+ *                      relative to the lowest coordinates so decoded points are at most half a cell away
+ *
+ * @param mesh          (IN) Triangle mesh
+ * @param cellSize      (IN) Grid cell size. Zero stores full precision coordinates
+ * @param header        (IN/OUT) File header. Quantization fields are set
+ * @param vBlocks       (OUT) Encoded blocks (one per COMPRESSED_BLOCK_SIZE points)
+ * @param szNumThreads  (IN) Number of threads. All available cores if zero
+ * @return              true if points encoded
+ *                      false if cell size is negative or too small for the points range
+ */
+bool CompressedWriter::encodePoints(const TriangleMesh &mesh, double cellSize, CompressedHeader &header,
+                                    vector<vector<unsigned char>> &vBlocks, size_t szNumThreads)
+{
+    const vector<Point<TYPE>> &vPoints = mesh.vPoints;
+    size_t szNumBlocks = (vPoints.size() + COMPRESSED_BLOCK_SIZE - 1) / COMPRESSED_BLOCK_SIZE;
+    vBlocks.resize(szNumBlocks);
+
+    // Full precision coordinates
+    if (cellSize == 0.0)
+    {
+        for (size_t block=0; block<szNumBlocks ;block++)
+        {
+            size_t first = block*COMPRESSED_BLOCK_SIZE;
+            size_t szNumBytes = sizeof(Point<TYPE>)*(min(first + COMPRESSED_BLOCK_SIZE, vPoints.size()) - first);
+            vBlocks[block].resize(szNumBytes);
+            memcpy(vBlocks[block].data(), &vPoints[first], szNumBytes);
+        }
+        return true;
+    }
+
+    // Grid origin is the lowest coordinates
+    double minX=0.0, minY=0.0, maxX=0.0, maxY=0.0;
+    if (!vPoints.empty())
+    {
+        minX = maxX = vPoints[0].getX();
+        minY = maxY = vPoints[0].getY();
+    }
+    for (auto &point : vPoints)
+    {
+        minX = min(minX, (double) point.getX());
+        maxX = max(maxX, (double) point.getX());
+        minY = min(minY, (double) point.getY());
+        maxY = max(maxY, (double) point.getY());
+    }
+
+    if (!(cellSize > 0.0) || !((max(maxX - minX, maxY - minY) / cellSize) < MAX_GRID_CELLS))
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Invalid cell size for points range: ");
+        Logging::buildText(__FUNCTION__, __FILE__, cellSize);
+        Logging::write(true, Error);
+        return false;
+    }
+
+    header.flags |= COMPRESSED_FLAG_QUANTIZED;
+    header.cellSize = cellSize;
+    header.minX = minX;
+    header.minY = minY;
+
+    // Cells are deltas to previous point cell in the same block
+    Parallel::runChunks(szNumBlocks, 1, szNumThreads, [&](size_t firstBlock, size_t lastBlock)
+    {
+        for (size_t block=firstBlock; block<lastBlock ;block++)
+        {
+            size_t first = block*COMPRESSED_BLOCK_SIZE;
+            size_t last = min(first + COMPRESSED_BLOCK_SIZE, vPoints.size());
+            vector<unsigned char> &vBlock = vBlocks[block];
+            vBlock.resize(2*COMPRESSED_MAX_VARINT*(last - first));
+
+            unsigned char *ptr = vBlock.data();
+            int64_t previousX=0, previousY=0;
+            for (size_t i=first; i<last ;i++)
+            {
+                auto cellX = (int64_t) std::llround((vPoints[i].getX() - minX) / cellSize);
+                auto cellY = (int64_t) std::llround((vPoints[i].getY() - minY) / cellSize);
+                ptr = writeVarint(zigzagEncode(cellX - previousX), ptr);
+                ptr = writeVarint(zigzagEncode(cellY - previousY), ptr);
+                previousX = cellX;
+                previousY = cellY;
+            }
+            vBlock.resize(ptr - vBlock.data());
+        }
+        return true;
+    });
+
+    return true;
+}
+
+
+/**
+ * @fn                  encodeTriangles
+ * @brief               Encodes the mesh triangles corners in blocks. Consecutive triangles usually share vertices so
+ *                      every corner is tagged with the corner of the previous triangle it is equal to. Other corners
+ *                      are stored as the delta to the same corner of the previous triangle
+ *
+ * @param vCorners      (IN) Corners of every triangle
+ * @param vBlocks       (IN/OUT) Encoded blocks. Triangles blocks (one per COMPRESSED_BLOCK_SIZE triangles) are added
+ * @param szNumThreads  (IN) Number of threads. All available cores if zero
+ */
+void CompressedWriter::encodeTriangles(const vector<int> &vCorners, vector<vector<unsigned char>> &vBlocks,
+                                       size_t szNumThreads)
+{
+    size_t szNumTriangles = vCorners.size() / NPOINTS_TRIANGLE;
+    size_t szNumBlocks = (szNumTriangles + COMPRESSED_BLOCK_SIZE - 1) / COMPRESSED_BLOCK_SIZE;
+    size_t szFirstBlock = vBlocks.size();
+    vBlocks.resize(szFirstBlock + szNumBlocks);
+
+    Parallel::runChunks(szNumBlocks, 1, szNumThreads, [&](size_t firstBlock, size_t lastBlock)
+    {
+        for (size_t block=firstBlock; block<lastBlock ;block++)
+        {
+            size_t first = block*COMPRESSED_BLOCK_SIZE;
+            size_t last = min(first + COMPRESSED_BLOCK_SIZE, szNumTriangles);
+            vector<unsigned char> &vBlock = vBlocks[szFirstBlock + block];
+            vBlock.resize((1 + NPOINTS_TRIANGLE*COMPRESSED_MAX_VARINT)*(last - first));
+
+            unsigned char *ptr = vBlock.data();
+            int previous[NPOINTS_TRIANGLE] = {0, 0, 0};
+            for (size_t triangle=first; triangle<last ;triangle++)
+            {
+                const int *corners = &vCorners[triangle*NPOINTS_TRIANGLE];
+                unsigned char *tags = ptr++;
+                *tags = 0;
+                for (int i=0; i<NPOINTS_TRIANGLE ;i++)
+                {
+                    int tag = COMPRESSED_TAG_LITERAL;
+                    for (int j=0; j<NPOINTS_TRIANGLE ;j++)
+                    {
+                        if (corners[i] == previous[j])
+                        {
+                            tag = j;
+                            break;
+                        }
+                    }
+
+                    *tags |= (unsigned char) (tag << (COMPRESSED_TAG_BITS*i));
+                    if (tag == COMPRESSED_TAG_LITERAL)
+                    {
+                        ptr = writeVarint(zigzagEncode((int64_t) corners[i] - previous[i]), ptr);
+                    }
+                }
+
+                memcpy(previous, corners, sizeof(previous));
+            }
+            vBlock.resize(ptr - vBlock.data());
+        }
+        return true;
+    });
+}
+
+
+/**
+ * @fn                  writeFile
+ * @brief               Writes header, blocks sizes and blocks to a temporary file that is renamed to the final name
+ *
+ * @param strFileName   (IN) File name
+ * @param header        (IN) File header
+ * @param vBlocks       (IN) Points and triangles blocks
+ * @return              true if file written
+ *                      false otherwise
+ */
+bool CompressedWriter::writeFile(const string &strFileName, const CompressedHeader &header,
+                                 const vector<vector<unsigned char>> &vBlocks)
+{
+    string strTempFileName = strFileName + ".tmp";
+    ofstream ofs(strTempFileName.c_str(), ios::out | ios::binary);
+    if (!ofs.is_open())
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error opening file: ");
+        Logging::buildText(__FUNCTION__, __FILE__, strTempFileName);
+        Logging::write(true, Error);
+        return false;
+    }
+
+    vector<uint64_t> vSizes(vBlocks.size());
+    for (size_t i=0; i<vBlocks.size() ;i++)
+    {
+        vSizes[i] = vBlocks[i].size();
+    }
+
+    ofs.write((const char *) &header, sizeof(header));
+    ofs.write((const char *) vSizes.data(), (streamsize) (sizeof(uint64_t)*vSizes.size()));
+    for (auto &vBlock : vBlocks)
+    {
+        ofs.write((const char *) vBlock.data(), (streamsize) vBlock.size());
+    }
+    ofs.close();
+
+    if (ofs.fail() || (std::rename(strTempFileName.c_str(), strFileName.c_str()) != 0))
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error writing file: ");
+        Logging::buildText(__FUNCTION__, __FILE__, strFileName);
+        Logging::write(true, Error);
+        std::remove(strTempFileName.c_str());
+        return false;
+    }
+
+    return true;
+}
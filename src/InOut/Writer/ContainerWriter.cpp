@@ -0,0 +1,204 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "ContainerWriter.h"
+
+#include "Crc32.h"
+#include "Logging.h"
+#include "MappedDcel.h"
+#include "MappedGraph.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+
+/***********************************************************************************************************************
+* Public methods definitions
+***********************************************************************************************************************/
+void ContainerWriter::addPoints(const vector<Point<TYPE>> &vPoints)
+{
+    this->addSection(CONTAINER_POINTS, 0, vPoints.data(), vPoints.size(), sizeof(Point<TYPE>),
+                     CONTAINER_FLAG_COORDINATES);
+}
+
+
+void ContainerWriter::addGraph(const Graph &graph)
+{
+    this->addSection(CONTAINER_GRAPH, MAPPED_GRAPH_FACE_NODE, graph.vFaceNode.data(), graph.vFaceNode.size(),
+                     sizeof(int));
+    this->addSection(CONTAINER_GRAPH, MAPPED_GRAPH_POINTS, graph.vPoints.data(), graph.vPoints.size(), sizeof(int));
+    this->addSection(CONTAINER_GRAPH, MAPPED_GRAPH_CHILDREN, graph.vChildren.data(), graph.vChildren.size(),
+                     sizeof(int));
+    this->addSection(CONTAINER_GRAPH, MAPPED_GRAPH_NCHILDREN, graph.vNChildren.data(), graph.vNChildren.size(),
+                     sizeof(unsigned char));
+    this->addSection(CONTAINER_GRAPH, MAPPED_GRAPH_FACES, graph.vFaces.data(), graph.vFaces.size(), sizeof(int));
+}
+
+
+void ContainerWriter::addVoronoi(const Voronoi &voronoi)
+{
+    this->addDcelSections(CONTAINER_VORONOI, *voronoi.getRefDcel());
+}
+
+
+void ContainerWriter::addGabriel(const Gabriel &gabriel)
+{
+    this->numEdgesGabriel = gabriel.szNumEdges;
+    this->addSection(CONTAINER_GABRIEL, CONTAINER_GABRIEL_BITSET, gabriel.vValidEdges.data(),
+                     gabriel.vValidEdges.size(), sizeof(uint64_t));
+    this->addSection(CONTAINER_GABRIEL, CONTAINER_GABRIEL_NUM_EDGES, &this->numEdgesGabriel, 1, sizeof(uint64_t));
+}
+
+
+bool ContainerWriter::write(const string &strFileName)
+{
+    bool isSuccess=false;		// Return value.
+
+    try
+    {
+        isSuccess = this->writeFile(strFileName);
+    }
+    catch (bad_alloc &ex)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error allocating memory");
+        Logging::write( true, Error);
+    }
+    catch (exception &ex)
+    {
+        std::cout << ex.what();
+    }
+
+    return isSuccess;
+}
+
+
+void ContainerWriter::clear()
+{
+    this->vSections.clear();
+    this->vArrays.clear();
+    this->numEdgesGabriel = 0;
+}
+
+
+/***********************************************************************************************************************
+* Private methods definitions
+***********************************************************************************************************************/
+/**
+ * @fn                  addSection
+ * @brief               Adds an array to the sections table. Offset and CRC are set when the file is written
+ *
+ * @param group         (IN) Data set
+ * @param array         (IN) Array in data set
+ * @param data          (IN) Array data
+ * @param szCount       (IN) Number of elements
+ * @param szElementSize (IN) Bytes per element
+ * @param flags         (IN) CONTAINER_FLAG_* values
+ */
+void ContainerWriter::addSection(ContainerGroup_T group, int array, const void *data, size_t szCount,
+                                 size_t szElementSize, uint32_t flags)
+{
+    ContainerSection section = {};
+    section.group = (uint16_t) group;
+    section.array = (uint16_t) array;
+    section.elementSize = (uint32_t) szElementSize;
+    section.count = szCount;
+    section.flags = flags;
+    this->vSections.push_back(section);
+    this->vArrays.push_back({data, (uint64_t) (szCount*szElementSize)});
+}
+
+
+/**
+ * @fn          addDcelSections
+ * @brief       Adds the arrays of a Dcel to the sections table
+ *
+ * @param group (IN) Data set (Dcel or Voronoi)
+ * @param dcel  (IN) Dcel to add
+ */
+void ContainerWriter::addDcelSections(ContainerGroup_T group, const DcelModel &dcel)
+{
+    static_assert(sizeof(Face) == sizeof(int), "Face must be stored as its edge id");
+    this->addSection(group, MAPPED_DCEL_POINTS, dcel.vPoints.data(), dcel.vPoints.size(), sizeof(Point<TYPE>),
+                     CONTAINER_FLAG_COORDINATES);
+    this->addSection(group, MAPPED_DCEL_POINT_EDGE, dcel.vPointEdge.data(), dcel.vPointEdge.size(), sizeof(int));
+    this->addSection(group, MAPPED_DCEL_ORIGIN, dcel.vOrigin.data(), dcel.vOrigin.size(), sizeof(int));
+    this->addSection(group, MAPPED_DCEL_TWIN, dcel.vTwin.data(), dcel.vTwin.size(), sizeof(int));
+    this->addSection(group, MAPPED_DCEL_PREVIOUS, dcel.vPrevious.data(), dcel.vPrevious.size(), sizeof(int));
+    this->addSection(group, MAPPED_DCEL_NEXT, dcel.vNext.data(), dcel.vNext.size(), sizeof(int));
+    this->addSection(group, MAPPED_DCEL_EDGE_FACE, dcel.vEdgeFace.data(), dcel.vEdgeFace.size(), sizeof(int));
+    this->addSection(group, MAPPED_DCEL_FACES, dcel.vFaces.data(), dcel.vFaces.size(), sizeof(Face));
+}
+
+
+/**
+ * @fn                  writeFile
+ * @brief               Writes the container to a temporary file and renames it to the final name
+ *
+ * @param strFileName   (IN) File name
+ * @return              true if file written
+ *                      false otherwise
+ */
+bool ContainerWriter::writeFile(const string &strFileName)
+{
+    if (this->vSections.size() > CONTAINER_MAX_SECTIONS)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Too many sections: ");
+        Logging::buildText(__FUNCTION__, __FILE__, this->vSections.size());
+        Logging::write(true, Error);
+        return false;
+    }
+
+    // Sections offsets and CRCs
+    uint64_t offset = sizeof(ContainerHeader) + sizeof(ContainerSection)*this->vSections.size();
+    for (size_t i=0; i<this->vSections.size() ;i++)
+    {
+        offset = (offset + CONTAINER_ALIGNMENT - 1) & ~((uint64_t) CONTAINER_ALIGNMENT - 1);
+        this->vSections[i].offset = offset;
+        this->vSections[i].crc = Crc32::compute(this->vArrays[i].data, this->vArrays[i].numBytes);
+        offset += this->vArrays[i].numBytes;
+    }
+
+    ContainerHeader header = {};
+    memcpy(header.arrMagic, CONTAINER_MAGIC, CONTAINER_MAGIC_LENGTH);
+    header.version = CONTAINER_VERSION;
+    header.endianTag = CONTAINER_ENDIAN_TAG;
+    header.typeSize = sizeof(TYPE);
+    header.numSections = (uint32_t) this->vSections.size();
+    header.tableCrc = Crc32::compute(this->vSections.data(), sizeof(ContainerSection)*this->vSections.size());
+    header.headerCrc = Crc32::compute(&header, sizeof(header));
+
+    string strTempFileName = strFileName + ".tmp";
+    ofstream ofs(strTempFileName.c_str(), ios::out | ios::binary);
+    if (!ofs.is_open())
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error opening file: ");
+        Logging::buildText(__FUNCTION__, __FILE__, strTempFileName);
+        Logging::write(true, Error);
+        return false;
+    }
+
+    // Header, table and sections data
+    const char arrPadding[CONTAINER_ALIGNMENT] = {};
+    ofs.write((const char *) &header, sizeof(header));
+    ofs.write((const char *) this->vSections.data(), (streamsize) (sizeof(ContainerSection)*this->vSections.size()));
+    uint64_t written = sizeof(ContainerHeader) + sizeof(ContainerSection)*this->vSections.size();
+    for (size_t i=0; i<this->vSections.size() ;i++)
+    {
+        ofs.write(arrPadding, (streamsize) (this->vSections[i].offset - written));
+        ofs.write((const char *) this->vArrays[i].data, (streamsize) this->vArrays[i].numBytes);
+        written = this->vSections[i].offset + this->vArrays[i].numBytes;
+    }
+    ofs.close();
+
+    if (ofs.fail() || (std::rename(strTempFileName.c_str(), strFileName.c_str()) != 0))
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error writing file: ");
+        Logging::buildText(__FUNCTION__, __FILE__, strFileName);
+        Logging::write(true, Error);
+        std::remove(strTempFileName.c_str());
+        return false;
+    }
+
+    return true;
+}
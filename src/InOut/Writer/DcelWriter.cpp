@@ -1,9 +1,13 @@
 /***********************************************************************************************************************
 * Includes
 ***********************************************************************************************************************/
+#include "BufferedWriter.h"
 #include "DcelWriter.h"
 #include "FileExtensionChecker.h"
 #include "Logging.h"
+#include "MappedDcel.h"
+#include "MappedLayout.h"
+#include "TriangleMeshView.h"
 
 #include <cstring>
 
@@ -11,37 +15,41 @@
 /***********************************************************************************************************************
 * Public methods definitions
 ***********************************************************************************************************************/
-bool DcelWriter::write(const string &fileName, const DcelModel &dcel)
+bool DcelWriter::write(const string &fileName, const DcelModel &dcel, bool isBackground)
 {
-    bool isSuccess=false;		// Return value.
+    return DcelWriter::writeDcel(fileName, dcel, isBackground);
+}
 
-    try
-    {
-        // Check if write binary data.
-        if (FileExtensionChecker::isBinary(fileName))
-        {
-            isSuccess = DcelWriter::writeBinary(fileName, dcel);
-        }
-        else
-        {
-            isSuccess = DcelWriter::writeFlat(fileName, dcel);
-        }
-    }
-    catch (const ofstream::failure& e)
+
+bool DcelWriter::write(const string &fileName, const TriangleMesh &mesh, bool isBackground)
+{
+    // Mesh triangles are read in place through the view
+    TriangleMeshView view(mesh);
+    return view.build() && DcelWriter::writeDcel(fileName, view, isBackground);
+}
+
+
+bool DcelWriter::writeMapped(const string &fileName, const DcelModel &dcel)
+{
+    // Arrays are written in MappedDcelSection_T order
+    static_assert(sizeof(Face) == sizeof(int), "Face must be stored as its edge id");
+    vector<MappedArray> vArrays(MAPPED_DCEL_NUM_SECTIONS);
+    vArrays[MAPPED_DCEL_POINTS] = {dcel.vPoints.data(), dcel.vPoints.size(), sizeof(Point<TYPE>)};
+    vArrays[MAPPED_DCEL_POINT_EDGE] = {dcel.vPointEdge.data(), dcel.vPointEdge.size(), sizeof(int)};
+    vArrays[MAPPED_DCEL_ORIGIN] = {dcel.vOrigin.data(), dcel.vOrigin.size(), sizeof(int)};
+    vArrays[MAPPED_DCEL_TWIN] = {dcel.vTwin.data(), dcel.vTwin.size(), sizeof(int)};
+    vArrays[MAPPED_DCEL_PREVIOUS] = {dcel.vPrevious.data(), dcel.vPrevious.size(), sizeof(int)};
+    vArrays[MAPPED_DCEL_NEXT] = {dcel.vNext.data(), dcel.vNext.size(), sizeof(int)};
+    vArrays[MAPPED_DCEL_EDGE_FACE] = {dcel.vEdgeFace.data(), dcel.vEdgeFace.size(), sizeof(int)};
+    vArrays[MAPPED_DCEL_FACES] = {dcel.vFaces.data(), dcel.vFaces.size(), sizeof(Face)};
+
+    bool isSuccess = MappedLayout::write(fileName, MAPPED_DCEL_MAGIC, vArrays);
+    if (!isSuccess)
     {
-        Logging::buildText(__FUNCTION__, __FILE__, "Error opening file: ");
+        Logging::buildText(__FUNCTION__, __FILE__, "Error writing file: ");
         Logging::buildText(__FUNCTION__, __FILE__, fileName);
         Logging::write(true, Error);
     }
-    catch (bad_alloc &ex)
-    {
-        Logging::buildText(__FUNCTION__, __FILE__, "Error allocating memory");
-        Logging::write( true, Error);
-    }
-    catch (exception &ex)
-    {
-        std::cout << ex.what();
-    }
 
     return isSuccess;
 }
@@ -51,16 +59,18 @@ void DcelWriter::print(const DcelModel &dcel, std::ostream &out)
 {
     // Points loop.
     std::cout << dcel.getNumVertex() << std::endl;
-    for (auto vertex : dcel.vVertex)
+    for (size_t i=0; i<dcel.getNumVertex() ;i++)
     {
+        Vertex vertex = dcel.getVertex(i);
         cout << vertex;
     }
 
 
     // Edges loop.
     std::cout << dcel.getNumEdges() << std::endl;
-    for (auto edge : dcel.vEdges)
+    for (size_t i=0; i<dcel.getNumEdges() ;i++)
     {
+        Edge edge = dcel.getEdge(i);
         cout << edge;
     }
 
@@ -76,166 +86,180 @@ void DcelWriter::print(const DcelModel &dcel, std::ostream &out)
 * Private methods definitions
 ***********************************************************************************************************************/
 /**
- * @fn          writeFlat
- * @brief       Writes Dcel to file in flat format
+ * @fn                  writeDcel
+ * @brief               Writes any Dcel accessor (see DcelQueries) in the format of the file extension
  *
- * @param fileName  (IN) File name
- * @param dcel      (IN) Dcel data to write
- * @return          true if file written
- *                  false otherwise
+ * @param fileName      (IN) File name
+ * @param dcel          (IN) Dcel data to write
+ * @param isBackground  (IN) Write buffers in an I/O thread
+ * @return              true if file written
+ *                      false otherwise
  */
-bool DcelWriter::writeFlat(const string &fileName, const DcelModel &dcel)
+template <class M> bool DcelWriter::writeDcel(const string &fileName, const M &dcel, bool isBackground)
 {
-    bool isSuccess;     // Return value.
+    bool isSuccess=false;		// Return value.
 
-    // Open file.
-    ofstream ofs(fileName.c_str(), ios::out);
-    if (ofs.is_open())
+    try
     {
-        // Write # points and points
-        ofs << dcel.getNumVertex() << std::endl;
-        for (auto point : dcel.vVertex)
-        {
-            ofs << point;
-        }
-
-        // Write # edges and edges
-        ofs << dcel.getNumEdges() << std::endl;
-        for (auto edge : dcel.vEdges)
+        // Check if write binary data.
+        if (FileExtensionChecker::isBinary(fileName))
         {
-            ofs << edge;
+            isSuccess = DcelWriter::writeBinary(fileName, dcel, isBackground);
         }
-
-        // Write # faces and faces
-        ofs << dcel.getNumFaces() << std::endl;
-        for (auto face : dcel.vFaces)
+        else
         {
-            ofs << face << std::endl;
+            isSuccess = DcelWriter::writeFlat(fileName, dcel, isBackground);
         }
-
-        // Close file.
-        ofs.close();
-        isSuccess = true;
     }
-    // Error opening file.
-    else
+    catch (const ofstream::failure& e)
     {
         Logging::buildText(__FUNCTION__, __FILE__, "Error opening file: ");
         Logging::buildText(__FUNCTION__, __FILE__, fileName);
         Logging::write(true, Error);
     }
+    catch (bad_alloc &ex)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error allocating memory");
+        Logging::write( true, Error);
+    }
+    catch (exception &ex)
+    {
+        std::cout << ex.what();
+    }
 
     return isSuccess;
 }
 
 
 /**
- * @fn          writeBinary
- * @brief       Writes Dcel to file in binary format
+ * @fn                  writeFlat
+ * @brief               Writes Dcel to file in flat format. Records are formatted in the writer buffer so the file is
+ *                      equal to the one written using Vertex, Edge and Face operator<<
  *
- * @param fileName  (IN) File name
- * @param dcel      (IN) Dcel data to write
- * @return          true if file written
- *                  false otherwise
+ * @param fileName      (IN) File name
+ * @param dcel          (IN) Dcel data to write
+ * @param isBackground  (IN) Write buffers in an I/O thread
+ * @return              true if file written
+ *                      false otherwise
  */
-bool DcelWriter::writeBinary(const string &fileName, const DcelModel &dcel)
+template <class M> bool DcelWriter::writeFlat(const string &fileName, const M &dcel, bool isBackground)
 {
-    bool isSuccess=false;	    // Return value.
-
-    // Open file.
-    ofstream ofs(fileName.c_str(), ios::out | ios::binary);
-    if (ofs.is_open())
-    {
-        // Computing amount of data to write.
-        unsigned long size = sizeof(size_t)*3 + sizeof(Vertex)*dcel.getNumVertex() +
-                             sizeof(Edge)*dcel.getNumEdges() +
-                             sizeof(Face)*dcel.getNumFaces();
-
-        // Allocate buffer
-        char *buffer = new char[size];
-        char *ptr = buffer;
-
-        // Insert number of vertex
-        size_t szValue = dcel.getNumVertex();
-        memcpy(ptr, &szValue, sizeof(szValue));
-        ptr += sizeof(szValue);
-
-        // Insert vertex array data
-        size_t szNumBytes = sizeof(szValue);
-        TYPE value;
-        int iValue;
-        for (auto vertex : dcel.vVertex)
-        {
-            value = vertex.getRefPoint()->getX();
-            memcpy(ptr, &value, sizeof(TYPE));
-            ptr += sizeof(TYPE);
-            szNumBytes += sizeof(TYPE);
-            value = vertex.getRefPoint()->getY();
-            memcpy(ptr, &value, sizeof(TYPE));
-            ptr += sizeof(TYPE);
-            szNumBytes += sizeof(TYPE);
-            iValue = vertex.getOrigin();
-            memcpy(ptr, &iValue, sizeof(iValue));
-            ptr += sizeof(iValue);
-            szNumBytes += sizeof(iValue);
-        }
+    BufferedWriter writer;
+    if (!writer.open(fileName, isBackground))
+    {
+        return false;
+    }
 
-        // Copy edges data.
-        szValue = dcel.getNumEdges();
-        memcpy(ptr, &szValue, sizeof(szValue));
-        ptr += sizeof(szValue);
-        szNumBytes += sizeof(szValue);
-        for (auto edge : dcel.vEdges)
-        {
-            iValue = edge.getOrigin();
-            memcpy(ptr, &iValue, sizeof(iValue));
-            ptr += sizeof(iValue);
-            szNumBytes += sizeof(iValue);
-            iValue = edge.getTwin();
-            memcpy(ptr, &iValue, sizeof(iValue));
-            ptr += sizeof(iValue);
-            szNumBytes += sizeof(iValue);
-            iValue = edge.getPrevious();
-            memcpy(ptr, &iValue, sizeof(iValue));
-            ptr += sizeof(iValue);
-            szNumBytes += sizeof(iValue);
-            iValue = edge.getNext();
-            memcpy(ptr, &iValue, sizeof(iValue));
-            ptr += sizeof(iValue);
-            szNumBytes += sizeof(iValue);
-            iValue = edge.getFace();
-            memcpy(ptr, &iValue, sizeof(iValue));
-            ptr += sizeof(iValue);
-            szNumBytes += sizeof(iValue);
-        }
+    // Write # points and points
+    writer.writeInt((long long) dcel.getNumVertex());
+    writer.writeChar('\n');
+    for (size_t i=0; i<dcel.getNumVertex() ;i++)
+    {
+        writer.writeReal(dcel.getRefPoint((int) i)->getX());
+        writer.writeChar(' ');
+        writer.writeReal(dcel.getRefPoint((int) i)->getY());
+        writer.writeChar(' ');
+        writer.writeInt(dcel.getPointEdge((int) i));
+        writer.writeChar('\n');
+    }
 
-        // Copy faces data.
-        szValue = dcel.getNumFaces();
-        memcpy(ptr, &szValue, sizeof(szValue));
-        ptr += sizeof(szValue);
-        szNumBytes += sizeof(szValue);
-        for (auto face : dcel.vFaces)
-        {
-            iValue = face.getEdge();
-            memcpy(ptr, &iValue, sizeof(iValue));
-            ptr += sizeof(iValue);
-            szNumBytes += sizeof(iValue);
-        }
+    // Write # edges and edges
+    writer.writeInt((long long) dcel.getNumEdges());
+    writer.writeChar('\n');
+    for (size_t i=0; i<dcel.getNumEdges() ;i++)
+    {
+        writer.writeInt(dcel.getOrigin((int) i));
+        writer.writeChar(' ');
+        writer.writeInt(dcel.getTwin((int) i));
+        writer.writeChar(' ');
+        writer.writeInt(dcel.getPrevious((int) i));
+        writer.writeChar(' ');
+        writer.writeInt(dcel.getNext((int) i));
+        writer.writeChar(' ');
+        writer.writeInt(dcel.getFace((int) i));
+        writer.writeChar(' ');
+        writer.writeChar('\n');
+    }
+
+    // Write # faces and faces (a blank line follows every face)
+    writer.writeInt((long long) dcel.getNumFaces());
+    writer.writeChar('\n');
+    for (size_t i=0; i<dcel.getNumFaces() ;i++)
+    {
+        writer.writeInt(dcel.getFaceEdge((int) i));
+        writer.writeChar('\n');
+        writer.writeChar('\n');
+    }
+
+    return DcelWriter::close(writer, fileName);
+}
 
-        // Write data.
-        ofs.write(buffer, sizeof(char)*szNumBytes);
 
-        // Close file.
-        ofs.close();
+/**
+ * @fn                  writeBinary
+ * @brief               Writes Dcel to file in binary format. Data is written through the writer buffer so memory
+ *                      does not depend on the Dcel size
+ *
+ * @param fileName      (IN) File name
+ * @param dcel          (IN) Dcel data to write
+ * @param isBackground  (IN) Write buffers in an I/O thread
+ * @return              true if file written
+ *                      false otherwise
+ */
+template <class M> bool DcelWriter::writeBinary(const string &fileName, const M &dcel, bool isBackground)
+{
+    BufferedWriter writer;
+    if (!writer.open(fileName, isBackground))
+    {
+        return false;
+    }
 
-        // Deallocate data.
-        delete[] buffer;
-        isSuccess = true;
+    // Write # points and points
+    writer.writeValue<size_t>(dcel.getNumVertex());
+    for (size_t i=0; i<dcel.getNumVertex() ;i++)
+    {
+        writer.writeValue<TYPE>(dcel.getRefPoint((int) i)->getX());
+        writer.writeValue<TYPE>(dcel.getRefPoint((int) i)->getY());
+        writer.writeValue<int>(dcel.getPointEdge((int) i));
     }
-    // Error opening file.
-    else
+
+    // Write # edges and edges
+    writer.writeValue<size_t>(dcel.getNumEdges());
+    for (size_t i=0; i<dcel.getNumEdges() ;i++)
     {
-        Logging::buildText(__FUNCTION__, __FILE__, "Error opening file: ");
+        writer.writeValue<int>(dcel.getOrigin((int) i));
+        writer.writeValue<int>(dcel.getTwin((int) i));
+        writer.writeValue<int>(dcel.getPrevious((int) i));
+        writer.writeValue<int>(dcel.getNext((int) i));
+        writer.writeValue<int>(dcel.getFace((int) i));
+    }
+
+    // Write # faces and faces
+    writer.writeValue<size_t>(dcel.getNumFaces());
+    for (size_t i=0; i<dcel.getNumFaces() ;i++)
+    {
+        writer.writeValue<int>(dcel.getFaceEdge((int) i));
+    }
+
+    return DcelWriter::close(writer, fileName);
+}
+
+
+/**
+ * @fn                  close
+ * @brief               Closes a file written by the writer
+ *
+ * @param writer        (IN/OUT) Writer to close
+ * @param fileName      (IN) File name
+ * @return              true if all data written
+ *                      false otherwise
+ */
+bool DcelWriter::close(BufferedWriter &writer, const string &fileName)
+{
+    bool isSuccess = writer.close();
+    if (!isSuccess)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error writing file: ");
         Logging::buildText(__FUNCTION__, __FILE__, fileName);
         Logging::write(true, Error);
     }
@@ -5,6 +5,8 @@
 
 #include "FileExtensionChecker.h"
 #include "Logging.h"
+#include "MappedGraph.h"
+#include "MappedLayout.h"
 #include "NodeIO.h"
 
 #include <fstream>
@@ -14,7 +16,7 @@ using namespace std;
 /***********************************************************************************************************************
 * Public methods definitions
 ***********************************************************************************************************************/
-bool GraphWriter::write(const string &strFileName, const Graph &graph)
+bool GraphWriter::write(const string &strFileName, const Graph &graph, bool isBackground)
 {
     bool isSuccess=false;		// Return value.
 
@@ -23,11 +25,11 @@ bool GraphWriter::write(const string &strFileName, const Graph &graph)
         // Check if write binary data.
         if (FileExtensionChecker::isBinary(strFileName))
         {
-            isSuccess = GraphWriter::writeBinary(strFileName, graph);
+            isSuccess = GraphWriter::writeBinary(strFileName, graph, isBackground);
         }
         else
         {
-            isSuccess = GraphWriter::writeFlat(strFileName, graph);
+            isSuccess = GraphWriter::writeFlat(strFileName, graph, isBackground);
         }
     }
     catch (const ofstream::failure& e)
@@ -50,6 +52,28 @@ bool GraphWriter::write(const string &strFileName, const Graph &graph)
 }
 
 
+bool GraphWriter::writeMapped(const string &strFileName, const Graph &graph)
+{
+    // Arrays are written in MappedGraphSection_T order
+    vector<MappedArray> vArrays(MAPPED_GRAPH_NUM_SECTIONS);
+    vArrays[MAPPED_GRAPH_FACE_NODE] = {graph.vFaceNode.data(), graph.vFaceNode.size(), sizeof(int)};
+    vArrays[MAPPED_GRAPH_POINTS] = {graph.vPoints.data(), graph.vPoints.size(), sizeof(int)};
+    vArrays[MAPPED_GRAPH_CHILDREN] = {graph.vChildren.data(), graph.vChildren.size(), sizeof(int)};
+    vArrays[MAPPED_GRAPH_NCHILDREN] = {graph.vNChildren.data(), graph.vNChildren.size(), sizeof(unsigned char)};
+    vArrays[MAPPED_GRAPH_FACES] = {graph.vFaces.data(), graph.vFaces.size(), sizeof(int)};
+
+    bool isSuccess = MappedLayout::write(strFileName, MAPPED_GRAPH_MAGIC, vArrays);
+    if (!isSuccess)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error writing file: ");
+        Logging::buildText(__FUNCTION__, __FILE__, strFileName);
+        Logging::write(true, Error);
+    }
+
+    return isSuccess;
+}
+
+
 void GraphWriter::print(const Graph &graph, std::ostream &out)
 {
     // Print graph length and size.
@@ -58,7 +82,7 @@ void GraphWriter::print(const Graph &graph, std::ostream &out)
     // Print graph nodes.
     for (size_t i=0; i<graph.getSize() ;i++)
     {
-        Node node = graph.vNodes.at(i);
+        Node node = graph.getNode(i);
         NodeIO::print(node, out);
     }
 
@@ -74,128 +98,114 @@ void GraphWriter::print(const Graph &graph, std::ostream &out)
 ***********************************************************************************************************************/
 /**
  * @fn                  writeFlat
- * @brief               Writes graph to output file in flat format
+ * @brief               Writes graph to output file in flat format. Nodes are formatted in the writer buffer so the
+ *                      file is equal to the one written using NodeIO::write
  *
  * @param strFileName   (IN)    File name to write to
  * @param graph         (IN)    Graph to write to file
+ * @param isBackground  (IN)    Write buffers in an I/O thread
  * @return              true if written successfully
  *                      false otherwise
  */
-bool GraphWriter::writeFlat(const string &strFileName, const Graph &graph)
+bool GraphWriter::writeFlat(const string &strFileName, const Graph &graph, bool isBackground)
 {
-    bool isSuccess=false;	// Return value.
+    BufferedWriter writer;
+    if (!writer.open(strFileName, isBackground))
+    {
+        return false;
+    }
 
-    // Open file.
-    ofstream ofs(strFileName.c_str(), ios::out);
-    if (ofs.is_open())
+    // Nodes main loop.
+    writer.writeInt(graph.getSize());
+    writer.writeChar('\n');
+    for (int nodeId=0; nodeId<graph.getSize() ; nodeId++)
     {
-        // Nodes main loop.
-        ofs << graph.vNodes.size() << endl;
-        for (size_t i=0; i<graph.getSize() ;i++)
+        for (int i=0; i<NODE_POINTS ; i++)
         {
-            Node node = graph.vNodes.at(i);
-            NodeIO::write(node, ofs);
-            ofs << endl;
+            writer.writeInt(graph.vPoints[nodeId*NODE_POINTS + i]);
+            writer.writeChar(' ');
         }
 
-        // Read face-node relations.
-        for (int i : graph.vFaceNode)
+        writer.writeInt(graph.getNChildren(nodeId));
+        writer.writeChar(' ');
+        for (int i=0; i<graph.getNChildren(nodeId) ; i++)
         {
-            ofs << i << endl;
+            writer.writeInt(graph.getiChild(nodeId, i));
+            writer.writeChar(' ');
         }
 
-        // Close file.
-        ofs.close();
-        isSuccess = true;
+        writer.writeInt(graph.getFace(nodeId));
+        writer.writeChar('\n');
     }
 
-    return isSuccess;
+    // Write face-node relations.
+    for (int i : graph.vFaceNode)
+    {
+        writer.writeInt(i);
+        writer.writeChar('\n');
+    }
+
+    return GraphWriter::close(writer, strFileName);
 }
 
 
 /**
  * @fn                  writeBinary
- * @brief               Writes graph to output file in binary format
+ * @brief               Writes graph to output file in binary format. Data is written through the writer buffer so
+ *                      memory does not depend on the graph size
  *
  * @param strFileName   (IN)    File name to write to
  * @param graph         (IN)    Graph to write to file
+ * @param isBackground  (IN)    Write buffers in an I/O thread
  * @return              true if written successfully
  *                      false otherwise
  */
-bool GraphWriter::writeBinary(const string &strFileName, const Graph &graph)
+bool GraphWriter::writeBinary(const string &strFileName, const Graph &graph, bool isBackground)
 {
-    bool isSuccess=false;	// Return value.
+    BufferedWriter writer;
+    if (!writer.open(strFileName, isBackground))
+    {
+        return false;
+    }
 
-    // Open file.
-    ofstream ofs(strFileName.c_str(), ios::out | ios::binary);
-    if (ofs.is_open())
+    // Insert nodes array length
+    writer.writeValue<size_t>(graph.getSize());
+    for (int nodeId=0; nodeId<graph.getSize() ; nodeId++)
     {
-        // Computing amount of data to write.
-        unsigned long size = sizeof(size_t) + sizeof(Node)*graph.vNodes.size() +
-                             sizeof(size_t) + sizeof(int)*graph.vFaceNode.size();
-
-        // Allocate buffer.
-        size_t szCnt=0;
-        char *buffer = new char[size];
-
-        // Insert nodes array length
-        size_t szValue = graph.vNodes.size();
-        memcpy(&buffer[szCnt], &szValue, sizeof(szValue));
-        szCnt += sizeof(szValue);
-
-        // Insert nodes array data
-        int iValue;
-        for (auto node : graph.vNodes)
-        {
-            // Add number of children
-            iValue = node.getNChildren();
-            memcpy(&buffer[szCnt], &iValue, sizeof(iValue));
-            szCnt += sizeof(iValue);
-
-            // Add children
-            for (size_t szIdx=0; szIdx<node.getNChildren() ; szIdx++)
-            {
-                iValue = node.getiChild(szIdx);
-                memcpy(&buffer[szCnt], &iValue, sizeof(iValue));
-                szCnt += sizeof(iValue);
-            }
-
-            // Add points indexes
-            for (size_t szIdx=0; szIdx<NODE_POINTS ; szIdx++)
-            {
-                iValue = node.getiPoint(szIdx);
-                memcpy(&buffer[szCnt], &iValue, sizeof(iValue));
-                szCnt += sizeof(iValue);
-            }
-
-            // Add face
-            iValue = node.getFace();
-            memcpy(&buffer[szCnt], &iValue, sizeof(iValue));
-            szCnt += sizeof(iValue);
-        }
+        // Add number of children and children
+        writer.writeValue<int>(graph.getNChildren(nodeId));
+        writer.write(&graph.vChildren[nodeId*MAX_CHILDREN], sizeof(int)*graph.getNChildren(nodeId));
 
-        // Insert nodes array length
-        szValue = graph.vFaceNode.size();
-        memcpy(&buffer[szCnt], &szValue, sizeof(szValue));
-        szCnt += sizeof(szValue);
+        // Add points indexes and face
+        writer.write(&graph.vPoints[nodeId*NODE_POINTS], sizeof(int)*NODE_POINTS);
+        writer.writeValue<int>(graph.getFace(nodeId));
+    }
 
-        // Copy faces array data
-        for (auto faceNode : graph.vFaceNode)
-        {
-            // Add number of children
-            memcpy(&buffer[szCnt], &faceNode, sizeof(faceNode));
-            szCnt += sizeof(faceNode);
-        }
+    // Insert face-node array length and data
+    writer.writeValue<size_t>(graph.vFaceNode.size());
+    writer.write(graph.vFaceNode.data(), sizeof(int)*graph.vFaceNode.size());
 
-        // Write data.
-        ofs.write(buffer, sizeof(char)*szCnt);
+    return GraphWriter::close(writer, strFileName);
+}
 
-        // Close file.
-        ofs.close();
 
-        // Deallocate data.
-        delete[] buffer;
-        isSuccess = true;
+/**
+ * @fn                  close
+ * @brief               Closes a file written by the writer
+ *
+ * @param writer        (IN/OUT) Writer to close
+ * @param strFileName   (IN)     File name
+ * @return              true if all data written
+ *                      false otherwise
+ */
+bool GraphWriter::close(BufferedWriter &writer, const string &strFileName)
+{
+    bool isSuccess = writer.close();
+    if (!isSuccess)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error writing file: ");
+        Logging::buildText(__FUNCTION__, __FILE__, strFileName);
+        Logging::write(true, Error);
     }
 
     return isSuccess;
@@ -0,0 +1,166 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "GridIndexWriter.h"
+
+#include "FileExtensionChecker.h"
+#include "Logging.h"
+
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Public methods definitions
+***********************************************************************************************************************/
+template <class M> bool GridIndexWriter::write(const string &strFileName, const BasicDcelGridIndex<M> &index)
+{
+    bool isSuccess=false;		// Return value.
+
+    try
+    {
+        // Check if write binary data.
+        if (FileExtensionChecker::isBinary(strFileName))
+        {
+            isSuccess = GridIndexWriter::writeBinary(strFileName, index);
+        }
+        else
+        {
+            isSuccess = GridIndexWriter::writeFlat(strFileName, index);
+        }
+    }
+    catch (const ofstream::failure& e)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error opening file: ");
+        Logging::buildText(__FUNCTION__, __FILE__, strFileName);
+        Logging::write(true, Error);
+    }
+    catch (bad_alloc &ex)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error allocating memory");
+        Logging::write( true, Error);
+    }
+    catch (exception &ex)
+    {
+        std::cout << ex.what();
+    }
+
+    return isSuccess;
+}
+
+
+/***********************************************************************************************************************
+* Private methods definitions
+***********************************************************************************************************************/
+/**
+ * @fn                  writeFlat
+ * @brief               Writes grid index to output file in flat format: grid dimensions, grid origin and cell size
+ *                      and one seed face per line
+ *
+ * @param strFileName   (IN)    File name to write to
+ * @param index         (IN)    Grid index to write to file
+ * @return              true if written successfully
+ *                      false otherwise
+ */
+template <class M> bool GridIndexWriter::writeFlat(const string &strFileName, const BasicDcelGridIndex<M> &index)
+{
+    bool isSuccess=false;	// Return value.
+
+    // Open file.
+    ofstream ofs(strFileName.c_str(), ios::out);
+    if (ofs.is_open())
+    {
+        // Grid geometry.
+        ofs << setprecision(numeric_limits<TYPE>::max_digits10);
+        ofs << index.szNumColumns << " " << index.szNumRows << endl;
+        ofs << index.minPoint.getX() << " " << index.minPoint.getY() << " " << index.cellSize << endl;
+
+        // Cells seeds.
+        for (int seed : index.vSeeds)
+        {
+            ofs << seed << endl;
+        }
+
+        // Close file.
+        ofs.close();
+        isSuccess = true;
+    }
+    else
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error opening file: ");
+        Logging::buildText(__FUNCTION__, __FILE__, strFileName);
+        Logging::write(true, Error);
+    }
+
+    return isSuccess;
+}
+
+
+/**
+ * @fn                  writeBinary
+ * @brief               Writes grid index to output file in binary format
+ *
+ * @param strFileName   (IN)    File name to write to
+ * @param index         (IN)    Grid index to write to file
+ * @return              true if written successfully
+ *                      false otherwise
+ */
+template <class M> bool GridIndexWriter::writeBinary(const string &strFileName, const BasicDcelGridIndex<M> &index)
+{
+    bool isSuccess=false;	// Return value.
+
+    // Open file.
+    ofstream ofs(strFileName.c_str(), ios::out | ios::binary);
+    if (ofs.is_open())
+    {
+        // Computing amount of data to write.
+        size_t szSize = sizeof(size_t)*2 + sizeof(TYPE)*3 + sizeof(int)*index.vSeeds.size();
+
+        // Allocate buffer.
+        size_t szCnt=0;
+        char *buffer = new char[szSize];
+
+        // Insert grid dimensions
+        memcpy(&buffer[szCnt], &index.szNumColumns, sizeof(size_t));
+        szCnt += sizeof(size_t);
+        memcpy(&buffer[szCnt], &index.szNumRows, sizeof(size_t));
+        szCnt += sizeof(size_t);
+
+        // Insert grid origin and cell size
+        TYPE values[3] = {index.minPoint.getX(), index.minPoint.getY(), index.cellSize};
+        memcpy(&buffer[szCnt], values, sizeof(values));
+        szCnt += sizeof(values);
+
+        // Insert seeds
+        memcpy(&buffer[szCnt], index.vSeeds.data(), sizeof(int)*index.vSeeds.size());
+        szCnt += sizeof(int)*index.vSeeds.size();
+
+        // Write data.
+        ofs.write(buffer, sizeof(char)*szCnt);
+
+        // Close file.
+        ofs.close();
+
+        // Deallocate data.
+        delete[] buffer;
+        isSuccess = true;
+    }
+    else
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error opening file: ");
+        Logging::buildText(__FUNCTION__, __FILE__, strFileName);
+        Logging::write(true, Error);
+    }
+
+    return isSuccess;
+}
+
+
+/***********************************************************************************************************************
+* Explicit instantiations
+***********************************************************************************************************************/
+template bool GridIndexWriter::write(const string &strFileName, const DcelGridIndex &index);
+template bool GridIndexWriter::write(const string &strFileName, const MappedDcelGridIndex &index);
@@ -20,7 +20,7 @@ bool ConvexHull::getConvexHull(Polygon &polygon)
 };
 
 
-bool ConvexHull::getConvexHullEdges(vector<int> &vOut)
+bool ConvexHull::getConvexHullEdges(vector<int> &vOut) const
 {
     // Check hull has been computed
     if (isEmpty())
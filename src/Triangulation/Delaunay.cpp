@@ -3,13 +3,17 @@
 ***********************************************************************************************************************/
 #include "Delaunay.h"
 #include "Point.h"
+#include "Predicates.h"
 #include "Voronoi.h"
 #include "DcelReader.h"
 #include "DcelWriter.h"
 #include "DcelFigureBuilder.h"
+#include "SpatialSort.h"
 
-#include <queue>
+#include <algorithm>
 #include <cfloat>
+#include <functional>
+#include <limits>
 
 #ifdef DEBUG_GEOMETRICAL
 //#define DEBUG_DELAUNAY
@@ -41,15 +45,23 @@ bool Delaunay::build()
 {
     // If no graph allocated then create a new graph.
     this->initGraph();
+    this->resetFlipCounters();
+
+    // Reserve dcel and graph memory unless caller supplied it.
+    if (this->arena == nullptr)
+    {
+        this->reserve();
+    }
 
     // Set highest point at first position of the DCEL vertex array.
     int highestPointIndex = this->dcel.getIndexHighest(&Point<TYPE>::lexicographicHigher);
     this->dcel.swapVertex(0, highestPointIndex);
 
     // Insert root node.
-    vector<int> vPoints = {1, P_MINUS_2, P_MINUS_1};
-    Node node(vPoints, 1);
-    this->graph.insert(node);
+    if (this->isGraphUsed())
+    {
+        this->graph.insert(1, P_MINUS_2, P_MINUS_1, 1);
+    }
 
     // Update edge from new point.
     this->dcel.updateVertex(1, 0);
@@ -69,22 +81,86 @@ bool Delaunay::build()
     // Reset convex hull flag.
     this->hull.reset();
 
+    // Walk starts from the only real face.
+    this->lastFace = 1;
+
     // Loop all other points.
-    int pointIndex=1;
-    int nPoints = this->dcel.getNumVertex();
+    this->getInsertionOrder(this->vOrder);
+    size_t i=0;
     isBuilt = true;
-    while ((pointIndex < nPoints) && isBuilt)
+    while ((i < this->vOrder.size()) && isBuilt)
     {
         // Insert new point into triangle where it is located.
-        isBuilt = this->addPointToDelaunay(pointIndex);
-        pointIndex++;
+        isBuilt = this->addPointToDelaunay(this->vOrder[i]);
+        i++;
+    }
+
+    // Compute convex hull so queries do not modify the triangulation.
+    if (isBuilt)
+    {
+        this->convexHull();
     }
 
    	return isBuilt;
 }
 
 
-void Delaunay::checkEdge(int edge_ID)
+void Delaunay::reserve()
+{
+    // Imaginary points are vertices of the triangulation too.
+    size_t szNumPoints = this->dcel.getNumVertex();
+    this->dcel.reserveTriangulation(szNumPoints + 2);
+    if (this->isGraphUsed())
+    {
+        this->graph.reserve(szNumPoints, EXPECTED_FLIPS_PER_POINT*szNumPoints);
+    }
+    this->reserveInsertion();
+}
+
+
+void Delaunay::attach(TriangulationArena &arenaIn)
+{
+    this->detach();
+
+    // Edges, faces and graph built by a previous triangulation are discarded but their memory is kept.
+    arenaIn.dcel.reset(false);
+    arenaIn.graph.reset();
+    this->dcel.reset(false);
+    this->graph.reset();
+    this->dcel.swapEdges(arenaIn.dcel);
+    this->graph.swap(arenaIn.graph);
+    this->arena = &arenaIn;
+    this->isBuilt = false;
+    this->reserveInsertion();
+}
+
+
+void Delaunay::detach()
+{
+    if (this->arena == nullptr)
+    {
+        return;
+    }
+
+    this->dcel.swapEdges(this->arena->dcel);
+    this->graph.swap(this->arena->graph);
+    this->dcel.reset(false);
+    this->graph.reset();
+    this->hull.reset();
+    this->arena = nullptr;
+    this->isBuilt = false;
+}
+
+
+/**
+ * @fn      checkEdge
+ * @brief   Checks if an edge is illegal and so it must be flipped
+ *
+ * @param   edge_ID     (IN) Edge id to check
+ * @return  true if edge must be flipped
+ *          false otherwise
+ */
+bool Delaunay::checkEdge(int edge_ID)
 {
 	bool flipEdges;		// Flip needed flag.
 	int	 edgeIndex=0;	// Edge index.
@@ -126,7 +202,7 @@ void Delaunay::checkEdge(int edge_ID)
 					if (this->dcel.getOrigin(edgeIndex) == P_MINUS_2)
 					{
 						// If turn LEFT_TURN then flip edge.
-						if (p->check_Turn(*q, *common1) == LEFT_TURN)
+						if (Predicates::turn(*p, *q, *common1) == LEFT_TURN)
 						{
 							flipEdges = true;
 						}
@@ -134,7 +210,7 @@ void Delaunay::checkEdge(int edge_ID)
 					else
 					{
 						// If turn RIGHT then flip edge.
-						if (p->check_Turn(*q, *common1) == RIGHT_TURN)
+						if (Predicates::turn(*p, *q, *common1) == RIGHT_TURN)
 						{
 							flipEdges = true;
 						}
@@ -150,7 +226,7 @@ void Delaunay::checkEdge(int edge_ID)
 					if (this->dcel.getOrigin(this->dcel.getTwin(edgeIndex)-1) == P_MINUS_2)
 					{
 						// If turn LEFT_TURN then flip edge.
-						if (p->check_Turn(*q, *common1) == LEFT_TURN)
+						if (Predicates::turn(*p, *q, *common1) == LEFT_TURN)
 						{
 							flipEdges = true;
 						}
@@ -158,7 +234,7 @@ void Delaunay::checkEdge(int edge_ID)
 					else
 					{
 						// If turn RIGHT then flip edge.
-						if (p->check_Turn(*q, *common1) == RIGHT_TURN)
+						if (Predicates::turn(*p, *q, *common1) == RIGHT_TURN)
 						{
 							flipEdges = true;
 						}
@@ -183,7 +259,7 @@ void Delaunay::checkEdge(int edge_ID)
 				q = this->dcel.getRefPoint(this->dcel.getOrigin(this->dcel.getPrevious(this->dcel.getTwin(edgeIndex)-1)-1)-1);
 
 				// Check if q falls into circle defined by common1-common2-p.
-				if (Point<TYPE>::inCircle(common1, common2, p, q))
+				if (Predicates::inCircle(*common1, *common2, *p, *q))
 				{
 					flipEdges = true;
 				}
@@ -200,29 +276,16 @@ void Delaunay::checkEdge(int edge_ID)
 	}
 #endif
 
-	// Check if edges must be flipped.
+#ifdef DEBUG_CHECK_EDGES
 	if (flipEdges)
 	{
-#ifdef INCREMENTAL_DELAUNAY_STATISTICS
-		this->nFlips++;
-#endif
-#ifdef DEBUG_CHECK_EDGES
 		Logging::buildText(__FUNCTION__, __FILE__, "Edge: ");
 		Logging::buildText(__FUNCTION__, __FILE__, edge_ID);
 		Logging::buildText(__FUNCTION__, __FILE__, " must be flipped. Its data and its twin is:\n");
 		Logging::buildText(__FUNCTION__, __FILE__, this->dcel.getRefEdge(edge_ID-1)->toStr());
-		Logging::buildText(__FUNCTION__, __FILE__, this->dcel.getRefEdge(this->dcel.getNext(edge_ID-1)-1)->toStr());
-		Logging::buildText(__FUNCTION__, __FILE__, this->dcel.getRefEdge(this->dcel.getPrevious(edge_ID-1)-1)->toStr());
-
 		Logging::buildText(__FUNCTION__, __FILE__, this->dcel.getRefEdge(this->dcel.getTwin(edge_ID-1)-1)->toStr());
-		Logging::buildText(__FUNCTION__, __FILE__, this->dcel.getRefEdge(this->dcel.getNext(this->dcel.getTwin(edge_ID-1)-1)-1)->toStr());
-		Logging::buildText(__FUNCTION__, __FILE__, this->dcel.getRefEdge(this->dcel.getPrevious(this->dcel.getTwin(edge_ID-1)-1)-1)->toStr());
 		Logging::write(true, Info);
-#endif
-		// Flip edges.
-		this->flipEdges(edge_ID);
 	}
-#ifdef DEBUG_CHECK_EDGES
 	else
 	{
 		Logging::buildText(__FUNCTION__, __FILE__, "Edge: ");
@@ -231,16 +294,62 @@ void Delaunay::checkEdge(int edge_ID)
 		Logging::write(true, Info);
 	}
 #endif
+
+	return flipEdges;
 }
 
 
-void Delaunay::flipEdges(int edge_ID)
+/**
+ * @fn      legalizeEdges
+ * @brief   Checks the edges in the edge stack until it is empty. Every illegal edge is flipped and the two edges that
+ *          could become illegal are pushed to the stack, so the flip cascade is processed without recursion.
+ */
+void Delaunay::legalizeEdges()
+{
+	while (!this->vEdgeStack.empty())
+	{
+		int edge_ID = this->vEdgeStack.back().first;
+		int depth = this->vEdgeStack.back().second;
+		this->vEdgeStack.pop_back();
+
+		if (this->checkEdge(edge_ID))
+		{
+			this->nFlips++;
+			this->nLastFlips++;
+			this->nLastFlipDepth = std::max(this->nLastFlipDepth, (size_t) depth + 1);
+			this->nMaxFlipDepth = std::max(this->nMaxFlipDepth, this->nLastFlipDepth);
+			this->flipEdges(edge_ID, depth);
+		}
+	}
+}
+
+
+/**
+ * @fn      resetFlipCounters
+ * @brief   Resets legalization statistics
+ */
+void Delaunay::resetFlipCounters()
+{
+	this->nFlips = 0;
+	this->nMaxFlipDepth = 0;
+	this->nLastFlips = 0;
+	this->nLastFlipDepth = 0;
+}
+
+
+/**
+ * @fn      flipEdges
+ * @brief   Flips an edge and its twin and pushes the edges that could become illegal to the edge stack
+ *
+ * @param   edge_ID     (IN) Edge id to flip
+ * @param   depth       (IN) Flip cascade depth of the edge
+ */
+void Delaunay::flipEdges(int edge_ID, int depth)
 {
 	int	 temp=0;									// Temp variable.
 	int	 edge_Index=0;								// Edge index.
-	Node *node, newNode;
 	int	 old_Node_ID1=0, old_Node_ID2=0;			// Old nodes id.
-	Edge *twin, *edge;
+	EdgeRef twin, edge;
 
 	// Get edge index.
 	edge_Index = edge_ID-1;
@@ -269,8 +378,11 @@ void Delaunay::flipEdges(int edge_ID)
 #endif
 
 	// Store nodes ID that are going to be updated to internal nodes.
-	old_Node_ID1 = this->graph.getNodeAssigned(edge->getFace());
-	old_Node_ID2 = this->graph.getNodeAssigned(twin->getFace());
+	if (this->isGraphUsed())
+	{
+		old_Node_ID1 = this->graph.getNodeAssigned(edge->getFace());
+		old_Node_ID2 = this->graph.getNodeAssigned(twin->getFace());
+	}
 
 #ifdef DEBUG_FLIP_EDGES
 	Logging::buildText(__FUNCTION__, __FILE__, "Faces where edges are located: ");
@@ -340,32 +452,24 @@ void Delaunay::flipEdges(int edge_ID)
 	this->dcel.setFaceEdge(edge->getFace(), edge_ID);
 	this->dcel.setFaceEdge(twin->getFace(), edge->getTwin());
 
-	// Get node of current edge and update it.
-	node = this->graph.getRefNode(old_Node_ID1);
-	node->setChildren(this->graph.getSize(), this->graph.getSize() + 1);
-    this->graph.update(old_Node_ID1, node);
-
-	// Get node of twin edge and update it.
-	node = this->graph.getRefNode(old_Node_ID2);
-	node->setChildren(this->graph.getSize(), this->graph.getSize() + 1);
-    this->graph.update(old_Node_ID2, node);
-
-    // Insert two new nodes.
-    vector<int> vPoints1 = {this->dcel.getOrigin(edge->getPrevious()-1),
-                           this->dcel.getOrigin(edge_Index),
-                           this->dcel.getOrigin(edge->getNext()-1)};
-    newNode = Node(vPoints1, edge->getFace());
-    this->graph.insert(newNode);
-
-    vector<int> vPoints2 = {this->dcel.getOrigin(twin->getPrevious()-1),
-                            this->dcel.getOrigin(edge->getTwin()-1),
-                            this->dcel.getOrigin(twin->getNext()-1)};
-    newNode = Node(vPoints2, twin->getFace());
-    this->graph.insert(newNode);
-
-	// Check recursively edges that could be illegal.
-	this->checkEdge(edge->getPrevious());
-	this->checkEdge(twin->getNext());
+	if (this->isGraphUsed())
+	{
+		// Update nodes of current and twin edges.
+		this->graph.setChildren(old_Node_ID1, this->graph.getSize(), this->graph.getSize() + 1);
+		this->graph.setChildren(old_Node_ID2, this->graph.getSize(), this->graph.getSize() + 1);
+
+		// Insert two new nodes.
+		this->graph.insert(this->dcel.getOrigin(edge->getPrevious()-1),
+						   this->dcel.getOrigin(edge_Index),
+						   this->dcel.getOrigin(edge->getNext()-1), edge->getFace());
+		this->graph.insert(this->dcel.getOrigin(twin->getPrevious()-1),
+						   this->dcel.getOrigin(edge->getTwin()-1),
+						   this->dcel.getOrigin(twin->getNext()-1), twin->getFace());
+	}
+
+	// Edges that could be illegal (stack is LIFO so previous edge is checked first).
+	this->vEdgeStack.push_back(make_pair(twin->getNext(), depth + 1));
+	this->vEdgeStack.push_back(make_pair(edge->getPrevious(), depth + 1));
 }
 
 
@@ -478,166 +582,90 @@ bool Delaunay::convexHull()
 * RETURN:	true		if two closest points found.
 * 			false		i.o.c.
 * GLOBAL:	NONE
-* Description: 	Finds the two closest point in the DCEL. It is only necessary
-* 				to check the neighbors of every point because there are no
-* 				closer points to a given point than its neighbors.
+* Description: 	the two closest points are a vertex and its nearest
+* 				neighbour so the result is the lowest distance of all
+* 				nearest neighbours computed in parallel.
 ***************************************************************************/
 bool Delaunay::findTwoClosest(Point<TYPE> &p, Point<TYPE> &q)
 {
-	bool found=false;				// Return value.
-	int	 pointIndex=0;				// Loop counter.
-	int  firstEdgeId=0;				// First edge for current point.
-	int	 currentEdgeId=0;			// Current edge id.
-	int	 currentEdgeIndex=0;		// Current edge index.
-	double	distance;   			// Current distance.
-	auto	lowestDistance=DBL_MAX;	// Current distance.
-	Point<TYPE>	*origin;			// First point.
-	Point<TYPE>	*dest;				// Second point.
-	int	destination=0;				// Destination point id.
-	int lastPointIndex=0;			// Last point must no be checked.
-
-	// Check all vertex.
-	lastPointIndex = this->dcel.getNumVertex() - 1;
-	for (pointIndex=0; pointIndex<lastPointIndex; pointIndex++)
-	{
-		// Get edge departing from current point.
-		currentEdgeId = this->dcel.getPointEdge(pointIndex);
-		firstEdgeId = currentEdgeId;
-		currentEdgeIndex = currentEdgeId - 1;
-
-		// Get reference to origin point.
-		origin = this->dcel.getRefPoint(pointIndex);
-
-		do
-		{
-			// Skip no-real edges.
-			if (!this->dcel.hasNegativeVertex(currentEdgeId))
-			{
-				// Get reference to destination point.
-				destination = this->dcel.getOrigin(this->dcel.getTwin(currentEdgeIndex)-1);
-				dest = this->dcel.getRefPoint(destination-1);
-				if ((pointIndex+1) < destination)
-				{
-					// Compute distance.
-					distance = origin->distance(*dest);
-
-					// Compare to current.
-					if (distance < lowestDistance)
-					{
-						// Update lowest distance and output indexes.
-						lowestDistance = distance;
-						p = *dcel.getRefPoint(pointIndex);
-                        q = *dcel.getRefPoint(destination-1);
-						found = true;
-					}
-				}
-			}
-
-			// Get next edge departing from edge.
-			currentEdgeId = this->dcel.getTwin(this->dcel.getPrevious(currentEdgeIndex)-1);
-			currentEdgeIndex = currentEdgeId - 1;
-		} while (currentEdgeId != firstEdgeId);
-	}
-
-	return(found);
+    return this->isBuilt && this->reduceTwoClosest(p, q);
 }
 
 
-/***************************************************************************
-* Name: 	findClosestPoint
-* IN:		p			input point whose closest is going to be located.
-* 			voronoi		Voronoi areas data.
-* OUT:		q			closest point to p
-* 			pointIndex 	index of the point in the DCEL.
-* 			distance 	p-q distance.
-* RETURN:	true		if closes point found.
-* 			false		i.o.c.
-* GLOBAL:	NONE
-* Description: 	finds the closest point q to input point p. To do so it first
-* 				locates the face that surrounds p and then
-***************************************************************************/
+/**
+ * @fn      findClosestPoint
+ * @brief   Finds the closest point to the input point. Voronoi diagram is not needed because the closest point is
+ *          found walking the triangulation (see findClosestPoint without Voronoi).
+ *
+ * @param   in          (IN)    Point whose closest point is located
+ * @param   voronoi     (IN)    Not used
+ * @param   out         (OUT)   Closest point
+ * @param   pointIndex  (OUT)   Index of the closest point in the dcel
+ * @return  true if closest point found
+ *          false otherwise
+ */
 bool Delaunay::findClosestPoint(Point<TYPE> &in, Voronoi *voronoi, Point<TYPE> &out, int &pointIndex)
 {
-	int	 nodeIndex=0;			// Node index.
-    bool *insertedPoints = new bool[this->dcel.getNumVertex()];
-	memset(insertedPoints, 0, sizeof(bool)* this->dcel.getNumVertex());
-
-	// Get node index of the face that surrounds point.
-    bool found = this->locateNode(in, nodeIndex);
-	if (found)
-	{
-        pointIndex = 0;
-        queue<int> queue;
-
-		// Insert points from node.
-		for (size_t i=0; i<NPOINTS_TRIANGLE ;i++)
-		{
-			pointIndex = this->graph.getRefNode(nodeIndex)->getiPoint(i)-1;
-			if (pointIndex >= 0)
-			{
-				// Insert current point and set as inserted.
-				insertedPoints[pointIndex] = true;
-				queue.push(pointIndex);
-			}
-		}
-
-		// Set loop condition.
-		found = false;
+    return this->findClosestPoint(in, out, pointIndex);
+}
 
-		// Check point in queue until closest is found.
-		do
-		{
-			// Get next point.
-			pointIndex = queue.front();
-            queue.pop();
 
-			// Check if point inner to current Voronoi area.
-			if (voronoi->isInnerToArea(in, pointIndex+1))
-			{
-				found = true;
-			}
-			else
-			{
-				// Get edge departing from current point.
-                int currentEdgeIndex = this->dcel.getPointEdge(pointIndex)-1;
-				currentEdgeIndex = this->dcel.getPrevious(currentEdgeIndex)-1;
-                int currentPointIndex = this->dcel.getOrigin(currentEdgeIndex)-1;
-
-				// Set end of loop condition.
-                int firstPointIndex = currentPointIndex;
+bool Delaunay::findClosestPoint(Point<TYPE> &in, Point<TYPE> &out, int &pointIndex)
+{
+    DelaunayQueryContext context;
+    context.startFace = this->lastFace;
+    return this->findClosestPoint(in, out, pointIndex, context);
+}
 
-				do
-				{
-					// Insert only if not already checked.
-					if (currentPointIndex >= 0)
-					{
-						if (!insertedPoints[currentPointIndex])
-						{
-							// Insert current point and set as inserted.
-							insertedPoints[currentPointIndex] = true;
-							queue.push(currentPointIndex);
-						}
-					}
 
-					// Get next edge.
-					currentEdgeIndex = this->dcel.getTwin(currentEdgeIndex)-1;
-					currentEdgeIndex = this->dcel.getPrevious(currentEdgeIndex)-1;
-					currentPointIndex = this->dcel.getOrigin(currentEdgeIndex)-1;
-				} while (currentPointIndex != firstPointIndex);
-			}
-		} while (!found && !queue.empty());
+/**
+ * @fn      findClosestPoint
+ * @brief   Finds the closest point to the input point. First locates the face that contains the point and starts at
+ *          its closest real vertex. Then walks greedily to any neighbour closer to the input point: in a Delaunay
+ *          triangulation every vertex that is not the closest point has a neighbour that is closer, so the walk ends
+ *          at the closest point. No memory is allocated.
+ *
+ * @param   in          (IN)        Point whose closest point is located
+ * @param   out         (OUT)       Closest point
+ * @param   pointIndex  (OUT)       Index of the closest point in the dcel
+ * @param   context     (IN/OUT)    Caller query data
+ * @return  true if closest point found
+ *          false otherwise
+ */
+bool Delaunay::findClosestPoint(const Point<TYPE> &in, Point<TYPE> &out, int &pointIndex,
+                                DelaunayQueryContext &context) const
+{
+    int	 nodeIndex=0;			// Node index.
+    int	 faceId=0;				// Face id.
+    int	 ids[NPOINTS_TRIANGLE];	// Points of the face that surrounds point.
 
-		if (found)
-		{
-			// Update output data.
-			out = *this->dcel.getRefPoint(pointIndex);
-		}
-	}
+    // Get points of the face that surrounds point.
+    bool found;
+    if (this->isGraphUsed())
+    {
+        found = this->locateNode(in, nodeIndex);
+        if (found)
+        {
+            this->graph.getVertices(nodeIndex, ids[0], ids[1], ids[2]);
+        }
+    }
+    else
+    {
+        found = this->locateFace(in, context.startFace, faceId);
+        if (found)
+        {
+            this->dcel.getFaceVertices(faceId, ids);
+            context.startFace = faceId;
+        }
+    }
 
-	// Deallocate memory.
-	delete[] insertedPoints;
+    if (!found || !DcelQueries::findClosestPoint(this->dcel, in, ids, pointIndex))
+    {
+        return false;
+    }
 
-	return found;
+    out = *this->dcel.getRefPoint(pointIndex);
+    return true;
 }
 
 
@@ -645,14 +673,15 @@ bool Delaunay::findClosestPoint(Point<TYPE> &in, Voronoi *voronoi, Point<TYPE> &
  * @fn    getConvexFacesIntersections
  * @brief Get faces and edge in convex hull that intersects input line
  *
- * @param line      (IN) Line to check
- * @param vFaces    (OUT) Faces in convex hull that intersect line
- * @param vEdges    (OUT) Edges in convex hull that intersect line
+ * @param line          (IN) Line to check
+ * @param vFaces        (OUT) Faces in convex hull that intersect line
+ * @param vEdges        (OUT) Edges in convex hull that intersect line
+ * @param vConvexEdges  (OUT) Convex hull edges
  */
-void Delaunay::getConvexFacesIntersections(Line &line, vector<int> &vFaces, vector<int> &vEdges)
+void Delaunay::getConvexFacesIntersections(Line &line, vector<int> &vFaces, vector<int> &vEdges,
+                                           vector<int> &vConvexEdges) const
 {
     // Get convex hull edges
-    vector<int> vConvexEdges;
     hull.getConvexHullEdges(vConvexEdges);
 
     Point<TYPE> o;
@@ -676,16 +705,34 @@ void Delaunay::getConvexFacesIntersections(Line &line, vector<int> &vFaces, vect
 }
 
 
+bool Delaunay::findPath(Point<TYPE> &origin, Point<TYPE> &dest, vector<int> &vFacesId)
+{
+    // Check if convex hull has not been computed.
+    if (!this->isConvexHullComputed())
+    {
+        this->convexHull();
+    }
+
+    DelaunayQueryContext context;
+    context.startFace = this->lastFace;
+    return this->findPath(origin, dest, vFacesId, context);
+}
+
+
 /***************************************************************************
 * Name: 	findPath
-* IN:		line		line that determines the path.
-* OUT:		facesPath	list of faces in the path.
+* IN:		origin		path origin point.
+* 			dest		path destination point.
+* 			context		caller query data.
+* OUT:		vFacesId	list of faces in the path.
 * RETURN:	true		if path found.
 * 			false		i.o.c.
 * GLOBAL:	NONE
 * Description: 	determines the set of faces where the input line lays on.
+* 				Convex hull must be computed (see build).
 ***************************************************************************/
-bool Delaunay::findPath(Point<TYPE> &origin, Point<TYPE> &dest, vector<int> &vFacesId)
+bool Delaunay::findPath(const Point<TYPE> &origin, const Point<TYPE> &dest, vector<int> &vFacesId,
+                        DelaunayQueryContext &context) const
 {
 	bool found=false;				// Return value.
 
@@ -698,11 +745,12 @@ bool Delaunay::findPath(Point<TYPE> &origin, Point<TYPE> &dest, vector<int> &vFa
     // Get extreme point faces.
     int	 originFace=0;				// Initial face in the path.
     int	 destinationFace=0;		    // Final face in the path.
-    if (this->findFace(origin, originFace) && this->findFace(dest, destinationFace))
+    if (this->findFace(origin, originFace, context) && this->findFace(dest, destinationFace, context))
 	{
         bool computePath=false;			// Both points in external face.
 
-        vector<int> vFaces;
+        vector<int> &vFaces = context.vFaces;
+        vFaces.clear();
 
 		// Add non external faces to set.
 		if (originFace != EXTERNAL_FACE)
@@ -720,14 +768,14 @@ bool Delaunay::findPath(Point<TYPE> &origin, Point<TYPE> &dest, vector<int> &vFa
 		// Check if any of the faces is external to convex hull.
 		if (vFaces.size() != 2)
 		{
-			// Check if convex hull has not been computed.
+			// Convex hull is needed to get the faces where the path enters the triangulation.
 			if (!this->isConvexHullComputed())
 			{
-				this->convexHull();
+				return false;
 			}
 
-            vector<int> vEdges;
-            getConvexFacesIntersections(line, vFaces, vEdges);
+            context.vEdges.clear();
+            getConvexFacesIntersections(line, vFaces, context.vEdges, context.vConvexEdges);
 
             // If vFaces is empty -> both points are external and there is no intersection with convex hull
             if (vFaces.empty())
@@ -738,39 +786,13 @@ bool Delaunay::findPath(Point<TYPE> &origin, Point<TYPE> &dest, vector<int> &vFa
             {
                 computePath = true;
             }
-
-//			// Line intersects convex hull.
-//            Polygon polygon;
-//            getConvexHull(polygon);
-//            vector<int> intersectEdges;		// Set of edges that intersect convex hull.
-//			if (polygon.getIntersections(line, intersectEdges))
-//			{
-//                int nFacesToAdd = intersectEdges.size();
-//				vector<int> vEdges;
-//                this->getConvexHullEdges(vEdges);
-//                if (!vEdges.empty())
-//                {
-//                    computePath = true;
-//                    int	 edgeIdx;
-//                    for (size_t i=0; i<nFacesToAdd ;i++)
-//                    {
-//                        edgeIdx = vEdges.at(intersectEdges.at(i))-1;
-//                        originFace = this->dcel.getFace(this->dcel.getTwin(edgeIdx) - 1);
-//                        vFaces.push_back(originFace);
-//                    }
-//                }
-//			}
-//			else
-//            {
-//                found = true;
-//            }
 		}
 
 		// If both points are external -> no path to compute.
 		if (computePath)
 		{
 			// Find path.
-			found = this->getRefDcel()->findPath(vFaces, line, vFacesId);
+			found = this->dcel.findPath(vFaces, line, vFacesId);
 		}
 	}
 
@@ -778,25 +800,125 @@ bool Delaunay::findPath(Point<TYPE> &origin, Point<TYPE> &dest, vector<int> &vFa
 }
 
 
+bool Delaunay::findKClosest(const Point<TYPE> &in, size_t szNumPoints, vector<int> &vPointsIndex,
+                            DelaunayQueryContext &context) const
+{
+    return this->expandClosest(in, szNumPoints, std::numeric_limits<TYPE>::max(), vPointsIndex, context);
+}
+
+
+bool Delaunay::findInRadius(const Point<TYPE> &in, TYPE radius, vector<int> &vPointsIndex,
+                            DelaunayQueryContext &context) const
+{
+    if (radius < 0.0)
+    {
+        vPointsIndex.clear();
+        return false;
+    }
+
+    return this->expandClosest(in, this->dcel.getNumVertex(), radius, vPointsIndex, context);
+}
+
+
+bool Delaunay::findKClosest(const vector<Point<TYPE>> &vPoints, size_t szNumPoints, vector<int> &vPointsIndex,
+                            size_t szNumThreads) const
+{
+    vPointsIndex.assign(vPoints.size()*szNumPoints, INVALID);
+    if (!this->isBuilt)
+    {
+        return false;
+    }
+
+    // Every chunk expands from the points sorted along Hilbert curve using its own context and scratch
+    return runHilbertChunks(vPoints, szNumThreads, [&](const vector<int> &vOrder, size_t first, size_t last)
+    {
+        DelaunayQueryContext context;
+        vector<int> vClosest;
+        for (size_t i=first; i<last ;i++)
+        {
+            int index = vOrder[i];
+            if (!this->findKClosest(vPoints[index], szNumPoints, vClosest, context))
+            {
+                return false;
+            }
+            std::copy(vClosest.begin(), vClosest.end(), vPointsIndex.begin() + index*szNumPoints);
+        }
+        return true;
+    });
+}
+
+
+bool Delaunay::findInRadius(const vector<Point<TYPE>> &vPoints, TYPE radius, vector<vector<int>> &vPointsIndex,
+                            size_t szNumThreads) const
+{
+    vPointsIndex.clear();
+    vPointsIndex.resize(vPoints.size());
+    if (!this->isBuilt)
+    {
+        return false;
+    }
+
+    return runHilbertChunks(vPoints, szNumThreads, [&](const vector<int> &vOrder, size_t first, size_t last)
+    {
+        DelaunayQueryContext context;
+        for (size_t i=first; i<last ;i++)
+        {
+            int index = vOrder[i];
+            if (!this->findInRadius(vPoints[index], radius, vPointsIndex[index], context))
+            {
+                return false;
+            }
+        }
+        return true;
+    });
+}
+
+
+bool Delaunay::findFace(Point<TYPE> &origin, int &faceId)
+{
+    DelaunayQueryContext context;
+    context.startFace = this->lastFace;
+    return this->findFace(origin, faceId, context);
+}
+
+
 /***************************************************************************
 * Name: 	findFace
-* IN:		index		index of the point whose face must be located.
+* IN:		origin		point whose face must be located.
+* 			context		caller query data.
 * OUT:		faceId		face id of the face that surrounds the point.
 * RETURN:	true		if face found.
 * 			false		i.o.c.
 * GLOBAL:	NONE
-* Description: 	allocates the graph to be used in incremental Delaunay.
+* Description: 	locates the face that contains the point. Imaginary faces
+* 				are returned as the external face.
 ***************************************************************************/
-bool Delaunay::findFace(Point<TYPE> &origin, int &faceId)
+bool Delaunay::findFace(const Point<TYPE> &origin, int &faceId, DelaunayQueryContext &context) const
 {
 	int		nodeIndex=0;		// Index of the node assigned to face.
+	bool	found;
 
 	// Locate node.
-	bool found = this->locateNode(origin, nodeIndex);
+	if (this->isGraphUsed())
+	{
+		found = this->locateNode(origin, nodeIndex);
+		if (found)
+		{
+			// Get face in node.
+			faceId = this->graph.getFace(nodeIndex);
+		}
+	}
+	else
+	{
+		found = this->locateFace(origin, context.startFace, faceId);
+		if (found)
+		{
+			context.startFace = faceId;
+		}
+	}
+
 	if (found)
 	{
-		// Get face in node.
-        faceId = this->graph.getRefNode(nodeIndex)->getFace();
 		if (this->dcel.imaginaryFace(faceId))
 		{
             faceId = EXTERNAL_FACE;
@@ -835,16 +957,35 @@ bool Delaunay::addPointToDelaunay(int index)
 	bool	inserted=false;		// Return value.
 	int		nodeIndex=0;		// Current node index.
 	Point<TYPE> *point=nullptr;   	// Pointer to points in DCEL.
+	int		*nodesChecked=nullptr;	// Nodes checked counter.
 #ifdef INCREMENTAL_DELAUNAY_STATISTICS
 	this->nNodesCheckedIndex = index;
 	this->nNodesChecked[nNodesCheckedIndex] = 1;
+	nodesChecked = &this->nNodesChecked[nNodesCheckedIndex];
 #endif
 
 	// Get new point to insert.
 	point = this->dcel.getRefPoint(index);
+	this->nLastFlips = 0;
+	this->nLastFlipDepth = 0;
+
+	// Gets face where point is located walking from last inserted point.
+	if (!this->isGraphUsed())
+	{
+		int faceId=0;
+		if (this->locateFace(*point, this->lastFace, faceId))
+		{
+			// Split face creating 3 or 4 triangles.
+			int nTriangles = this->isStrictlyInteriorToFace(*point, faceId) ? 3 : 4;
+			this->splitNode(index, INVALID, faceId, nTriangles);
 
+			// Next walk starts from a face of the new point.
+			this->lastFace = this->dcel.getFace(this->dcel.getPointEdge(index)-1);
+			inserted = true;
+		}
+	}
 	// Gets node where index point is located.
-    if (this->locateNode(*point, nodeIndex))
+	else if (this->locateNode(*point, nodeIndex, nodesChecked))
     {
 #ifdef DEBUG_DELAUNAY_INSERTPOINT
 		Logging::buildText(__FUNCTION__, __FILE__, "Node is a leaf. Point is interior to node ");
@@ -860,7 +1001,7 @@ bool Delaunay::addPointToDelaunay(int index)
 			Logging::write(true, Info);
 #endif
             // Split current node creating 3 triangles.
-            this->splitNode(index, nodeIndex, 3);
+            this->splitNode(index, nodeIndex, this->graph.getFace(nodeIndex), 3);
         }
         // Point over an edge.
         else
@@ -870,7 +1011,7 @@ bool Delaunay::addPointToDelaunay(int index)
 			Logging::write(true, Info);
 #endif
             // Split current node creating 4 triangles.
-            this->splitNode(index, nodeIndex, 4);
+            this->splitNode(index, nodeIndex, this->graph.getFace(nodeIndex), 4);
         }
 #ifdef DEBUG_DELAUNAY_INSERTPOINT
 		Logging::buildText(__FUNCTION__, __FILE__, "Point inserted");
@@ -886,6 +1027,7 @@ bool Delaunay::addPointToDelaunay(int index)
 /***************************************************************************
 * Name: 	locateNode
 * IN:		index		index of the point to locate.
+* 			nodesChecked	nodes checked counter (statistics). Not used if null.
 * OUT:		nodeIndex	node where point should be inserted.
 * RETURN:	true		if node found
 * 			false 		i.o.c.
@@ -893,12 +1035,15 @@ bool Delaunay::addPointToDelaunay(int index)
 * Description: 	Locates the node where the point whose index is the first
 * 				input parameter is located.
 ***************************************************************************/
-bool Delaunay::locateNode(const Point<TYPE> &point, int &nodeIndex)
+bool Delaunay::locateNode(const Point<TYPE> &point, int &nodeIndex, int *nodesChecked) const
 {
 	bool	locatedNode;	    // Return value.
 	int     i=0;                // Loop counter.
 	int		nChildren=0;		// # children in current node.
 	bool	error=false; 		// Fatal error flag.
+#ifndef INCREMENTAL_DELAUNAY_STATISTICS
+	(void) nodesChecked;		// Only used by statistics.
+#endif
 
 #ifdef DEBUG_DELAUNAY_LOCATENODE
 	Logging::buildText(__FUNCTION__, __FILE__, "Searching point " );
@@ -911,7 +1056,10 @@ bool Delaunay::locateNode(const Point<TYPE> &point, int &nodeIndex)
     while ((!this->graph.isLeaf(nodeIndex)) && (!error))
     {
 #ifdef INCREMENTAL_DELAUNAY_STATISTICS
-    	this->nNodesChecked[this->nNodesCheckedIndex]++;
+    	if (nodesChecked != nullptr)
+    	{
+    		(*nodesChecked)++;
+    	}
 #endif
        	// PENDING REMOVE ASSIGNED FACE WHEN NODE IS INTERIOR.
         // Search triangle in children nodes.
@@ -986,7 +1134,7 @@ bool Delaunay::locateNode(const Point<TYPE> &point, int &nodeIndex)
 * 				conditions checks that there is no RIGHT turn between the
 * 				input point and the points of every edge of the triangle.
 ***************************************************************************/
-bool Delaunay::isInteriorToNode(const Point<TYPE> &point, int nodeIndex)
+bool Delaunay::isInteriorToNode(const Point<TYPE> &point, int nodeIndex) const
 {
 	bool	isInterior=false;		// Return value.
 	int		id1=0, id2=0, id3=0;	// IDs of vertex points.
@@ -1075,10 +1223,218 @@ bool Delaunay::isStrictlyInteriorToNode(Point<TYPE> &point, int nodeIndex)
 	return(isInterior);
 }
 
+/**
+ * @fn      locateFace
+ * @brief   Locates the face that contains the input point walking from the
+ *          start face. The walk moves to the neighbour face through any edge
+ *          that leaves the point at its right. If the walk does not finish in
+ *          as many steps as faces then all faces are checked.
+ *
+ * @param   point       (IN)    Point to locate
+ * @param   startFace   (IN)    Face where walk starts
+ * @param   faceId      (OUT)   Face that contains the point
+ * @return  true if face found
+ *          false otherwise
+ */
+bool Delaunay::locateFace(const Point<TYPE> &point, int startFace, int &faceId) const
+{
+    size_t  szMaxSteps = this->dcel.getNumFaces();
+    size_t  szStep=0;
+    bool    isFound=false;
+
+    faceId = ((startFace > EXTERNAL_FACE) && (startFace < (int) szMaxSteps)) ? startFace : 1;
+    while (!isFound && (faceId != EXTERNAL_FACE) && (szStep < szMaxSteps))
+    {
+        // Check every edge of the face.
+        int edgeIndex = this->dcel.getFaceEdge(faceId) - 1;
+        int nextFace = faceId;
+        for (size_t i=0; (i<NPOINTS_TRIANGLE) && (nextFace == faceId) ;i++)
+        {
+            int origin = this->dcel.getOrigin(edgeIndex);
+            int dest = this->dcel.getOrigin(this->dcel.getNext(edgeIndex) - 1);
+            if (this->dcel.returnTurn(&point, origin, dest) == RIGHT_TURN)
+            {
+                // Move to face at the other side of the edge.
+                nextFace = this->dcel.getFace(this->dcel.getTwin(edgeIndex) - 1);
+            }
+            edgeIndex = this->dcel.getNext(edgeIndex) - 1;
+        }
+
+        isFound = (nextFace == faceId);
+        faceId = nextFace;
+        szStep++;
+    }
+
+    // Walk failed -> check all faces.
+    if (!isFound)
+    {
+        faceId = 1;
+        while (!isFound && (faceId < (int) this->dcel.getNumFaces()))
+        {
+            isFound = this->isInteriorToFace(point, faceId);
+            if (!isFound)
+            {
+                faceId++;
+            }
+        }
+    }
+
+    return isFound;
+}
+
+
+/**
+ * @fn      walkToFace
+ * @brief   Locates the face that contains the input point walking from the
+ *          face where the previous walk finished. Imaginary faces are kept as
+ *          next walk start and returned as the external face.
+ *
+ * @param   point       (IN)        Point to locate
+ * @param   walkFace    (IN/OUT)    Face where walk starts. Updated to located face
+ * @param   faceId      (OUT)       Face that contains the point
+ * @return  true if face found
+ *          false otherwise
+ */
+bool Delaunay::walkToFace(const Point<TYPE> &point, int &walkFace, int &faceId) const
+{
+    if (!this->isBuilt || !this->locateFace(point, walkFace, faceId))
+    {
+        return false;
+    }
+
+    walkFace = faceId;
+    if (this->dcel.imaginaryFace(faceId))
+    {
+        faceId = EXTERNAL_FACE;
+    }
+
+    return true;
+}
+
+
+/**
+ * @fn      expandClosest
+ * @brief   Locates the closest point and expands its Delaunay neighbours in
+ *          distance order (see DcelQueries::expandClosest).
+ *
+ * @param   in              (IN)        Query point
+ * @param   szMaxPoints     (IN)        Maximum number of output points
+ * @param   radius          (IN)        Maximum distance of output points
+ * @param   vPointsIndex    (OUT)       Dcel index of points sorted by distance
+ * @param   context         (IN/OUT)    Thread query context
+ * @return  true if closest point found
+ *          false otherwise
+ */
+bool Delaunay::expandClosest(const Point<TYPE> &in, size_t szMaxPoints, TYPE radius, vector<int> &vPointsIndex,
+                             DelaunayQueryContext &context) const
+{
+    vPointsIndex.clear();
+    if (!this->isBuilt)
+    {
+        return false;
+    }
+    if (szMaxPoints == 0)
+    {
+        return true;
+    }
+
+    Point<TYPE> closest;
+    int pointIndex=0;
+    if (!this->findClosestPoint(in, closest, pointIndex, context))
+    {
+        return false;
+    }
+
+    DcelQueries::expandClosest(this->dcel, in, pointIndex, szMaxPoints, radius, vPointsIndex, context);
+    return true;
+}
+
+
+/**
+ * @fn      isInteriorToFace
+ * @brief   Checks if point is interior or over an edge of the face
+ *
+ * @param   point   (IN)    Point to check
+ * @param   faceId  (IN)    Face to check
+ * @return  true if there is no right turn between the point and any edge of the face
+ *          false otherwise
+ */
+bool Delaunay::isInteriorToFace(const Point<TYPE> &point, int faceId) const
+{
+    int ids[NPOINTS_TRIANGLE];
+    this->dcel.getFaceVertices(faceId, ids);
+
+    return (this->dcel.returnTurn(&point, ids[0], ids[1]) != RIGHT_TURN) &&
+           (this->dcel.returnTurn(&point, ids[1], ids[2]) != RIGHT_TURN) &&
+           (this->dcel.returnTurn(&point, ids[2], ids[0]) != RIGHT_TURN);
+}
+
+
+/**
+ * @fn      isStrictlyInteriorToFace
+ * @brief   Checks if point is interior to the face and not over any of its edges
+ *
+ * @param   point   (IN)    Point to check
+ * @param   faceId  (IN)    Face to check
+ * @return  true if there are only left turns between the point and the edges of the face
+ *          false otherwise
+ */
+bool Delaunay::isStrictlyInteriorToFace(const Point<TYPE> &point, int faceId) const
+{
+    int ids[NPOINTS_TRIANGLE];
+    this->dcel.getFaceVertices(faceId, ids);
+
+    return (this->dcel.returnTurn(&point, ids[0], ids[1]) == LEFT_TURN) &&
+           (this->dcel.returnTurn(&point, ids[1], ids[2]) == LEFT_TURN) &&
+           (this->dcel.returnTurn(&point, ids[2], ids[0]) == LEFT_TURN);
+}
+
+
+/**
+ * @fn      getInsertionOrder
+ * @brief   Computes the order used to insert the points after the highest one. The graph location uses the input
+ *          order and the walk location uses a biased randomized insertion order so consecutive points are close.
+ *
+ * @param   vOrder  (OUT)   Indexes of the points to insert
+ */
+void Delaunay::getInsertionOrder(vector<int> &vOrder)
+{
+    int nPoints = this->dcel.getNumVertex();
+    vOrder.resize(nPoints > 0 ? nPoints - 1 : 0);
+    for (size_t i=0; i<vOrder.size() ;i++)
+    {
+        vOrder[i] = (int) i + 1;
+    }
+
+    if (!this->isGraphUsed())
+    {
+        SpatialSort::brio(this->dcel.getRefPoints(), vOrder, this->vBrioKeys);
+    }
+}
+
+
+/**
+ * @fn      reserveInsertion
+ * @brief   Reserves the insertion order, its sort keys and the edge stack, so build only allocates the convex hull
+ *          and the stack of very deep flip cascades
+ */
+void Delaunay::reserveInsertion()
+{
+    size_t szNumInserted = (this->dcel.getNumVertex() > 0) ? this->dcel.getNumVertex() - 1 : 0;
+    this->vOrder.reserve(szNumInserted);
+    this->vEdgeStack.reserve(EDGE_STACK_SIZE);
+    if (!this->isGraphUsed())
+    {
+        this->vBrioKeys.reserve(szNumInserted);
+    }
+}
+
+
 /***************************************************************************
 * Name: 	splitNode
 * IN:		pointIndex		point index that splits node
-* 			nodeIndex		node to split
+* 			nodeIndex		node to split (unused if graph is not used)
+* 			faceId			face that contains the point
 * 			nTriangles		# triangles after node is splitted
 * OUT:		NONE
 * RETURN:	NONE
@@ -1087,7 +1443,7 @@ bool Delaunay::isStrictlyInteriorToNode(Point<TYPE> &point, int nodeIndex)
 * 				in the node. If the point is over an edge then 4 triangles
 * 				must be created. Otherwise 3 triangles are created.
 ***************************************************************************/
-void Delaunay::splitNode(int pointIndex, int nodeIndex, int nTriangles)
+void Delaunay::splitNode(int pointIndex, int nodeIndex, int faceId, int nTriangles)
 {
 	int 	index=0;
 	int		newNodeID=0;
@@ -1100,7 +1456,6 @@ void Delaunay::splitNode(int pointIndex, int nodeIndex, int nTriangles)
 	int		flipCandidates[2];		// Edges that must be cheked due to split operation.
 	int		oldNode1=0;				// Old nodes id.
 	int		oldNode2=0;				// Old nodes id.
-	Node 	*ptrNode;				// Pointer to current node.
 	Node 	newNode[3];
 	double	area[3];
 
@@ -1111,11 +1466,8 @@ void Delaunay::splitNode(int pointIndex, int nodeIndex, int nTriangles)
     // Update edge departing from new point.
 	this->dcel.updateVertex(new_Edge_ID, pointIndex);
 
-    // Get information of node where the new triangles are created.
-	ptrNode = this->graph.getRefNode(nodeIndex);
-
     // Get data of the face of the triangle to be splitted.
-	int faceEdge = this->dcel.getRefFace(ptrNode->getFace())->getEdge();
+	int faceEdge = this->dcel.getRefFace(faceId)->getEdge();
 
     // Check number of new triangles to create.
     if (nTriangles == 3)
@@ -1125,8 +1477,8 @@ void Delaunay::splitNode(int pointIndex, int nodeIndex, int nTriangles)
     	next_Edge_ID = this->dcel.getNext(faceEdge-1);
 
         // Insert two new edges: new_Edge_ID and new_Edge_ID+1.
-        this->dcel.addEdge(pointIndex+1, new_Edge_ID+5, new_Edge_ID+1, faceEdge, ptrNode->getFace());
-        this->dcel.addEdge(this->dcel.getOrigin(next_Edge_ID-1), new_Edge_ID+2, faceEdge, new_Edge_ID, ptrNode->getFace());
+        this->dcel.addEdge(pointIndex+1, new_Edge_ID+5, new_Edge_ID+1, faceEdge, faceId);
+        this->dcel.addEdge(this->dcel.getOrigin(next_Edge_ID-1), new_Edge_ID+2, faceEdge, new_Edge_ID, faceId);
 
         // Insert two new edges: new_Edge_ID+2 and new_Edge_ID+3.
         this->dcel.addEdge(pointIndex+1, new_Edge_ID+1, new_Edge_ID+3, next_Edge_ID, new_Face_ID);
@@ -1145,84 +1497,83 @@ void Delaunay::splitNode(int pointIndex, int nodeIndex, int nTriangles)
         this->dcel.addFace(new_Edge_ID + 2);
         this->dcel.addFace(new_Edge_ID + 4);
 
-        // Update leaf node.
-        newNodeID = this->graph.getSize();
-        this->graph.getRefNode(nodeIndex)->setChildren(newNodeID, newNodeID+1, newNodeID+2);
-        this->graph.update(nodeIndex, ptrNode);
-
-		// Insert three new nodes.
-		vector<int> vPoints = {this->dcel.getOrigin(new_Edge_ID),
-                                this->dcel.getOrigin(new_Edge_ID - 1),
-                                this->dcel.getOrigin(faceEdge - 1)};
-        newNode[0] = Node(vPoints, ptrNode->getFace());
-        area[0] = this->signedArea(&newNode[0]);
-        vPoints.clear();
-        vPoints = {this->dcel.getOrigin(new_Edge_ID + 2),
-                   this->dcel.getOrigin(new_Edge_ID + 1),
-                   this->dcel.getOrigin(next_Edge_ID - 1)};
-        newNode[1] = Node(vPoints, new_Face_ID);
-        area[1] = this->signedArea(&newNode[1]);
-        vPoints.clear();
-        vPoints = {this->dcel.getOrigin(new_Edge_ID + 4),
-                   this->dcel.getOrigin(new_Edge_ID + 3),
-                   this->dcel.getOrigin(prev_Edge_ID - 1)};
-        newNode[2] = Node(vPoints,new_Face_ID + 1);
-        area[2] = this->signedArea(&newNode[2]);
-        if (area[0] > area[1])
+        if (this->isGraphUsed())
         {
-            // 2nd, 0th, 1st.
-            if (area[2] > area[0])
+            // Update leaf node.
+            newNodeID = this->graph.getSize();
+            this->graph.setChildren(nodeIndex, newNodeID, newNodeID+1, newNodeID+2);
+
+			// Insert three new nodes.
+            newNode[0] = Node(this->dcel.getOrigin(new_Edge_ID),
+                              this->dcel.getOrigin(new_Edge_ID - 1),
+                              this->dcel.getOrigin(faceEdge - 1), faceId);
+            area[0] = this->signedArea(&newNode[0]);
+            newNode[1] = Node(this->dcel.getOrigin(new_Edge_ID + 2),
+                              this->dcel.getOrigin(new_Edge_ID + 1),
+                              this->dcel.getOrigin(next_Edge_ID - 1), new_Face_ID);
+            area[1] = this->signedArea(&newNode[1]);
+            newNode[2] = Node(this->dcel.getOrigin(new_Edge_ID + 4),
+                              this->dcel.getOrigin(new_Edge_ID + 3),
+                              this->dcel.getOrigin(prev_Edge_ID - 1), new_Face_ID + 1);
+            area[2] = this->signedArea(&newNode[2]);
+            if (area[0] > area[1])
             {
-                this->graph.insert(newNode[2]);
-                this->graph.insert(newNode[0]);
-                this->graph.insert(newNode[1]);
-            }
-            // 0th, 2nd, 1st.
-            else
-            {
-            	this->graph.insert(newNode[0]);
-                //insert_Node(graph, &new_Node[0]);
-                if (area[2] > area[1])
+                // 2nd, 0th, 1st.
+                if (area[2] > area[0])
                 {
-                	this->graph.insert(newNode[2]);
-                	this->graph.insert(newNode[1]);
+                    this->graph.insert(newNode[2]);
+                    this->graph.insert(newNode[0]);
+                    this->graph.insert(newNode[1]);
                 }
-                // 0th, 1st, 2nd.
+                // 0th, 2nd, 1st.
                 else
                 {
-                	this->graph.insert(newNode[1]);
-                	this->graph.insert(newNode[2]);
+                	this->graph.insert(newNode[0]);
+                    //insert_Node(graph, &new_Node[0]);
+                    if (area[2] > area[1])
+                    {
+                    	this->graph.insert(newNode[2]);
+                    	this->graph.insert(newNode[1]);
+                    }
+                    // 0th, 1st, 2nd.
+                    else
+                    {
+                    	this->graph.insert(newNode[1]);
+                    	this->graph.insert(newNode[2]);
+                    }
                 }
             }
-        }
-        else
-        {
-            // 2nd, 1st, 0th.
-            if (area[2] > area[1])
-            {
-            	this->graph.insert(newNode[2]);
-            	this->graph.insert(newNode[1]);
-            	this->graph.insert(newNode[0]);
-            }
             else
             {
-            	this->graph.insert(newNode[1]);
-                if (area[2] > area[0])
+                // 2nd, 1st, 0th.
+                if (area[2] > area[1])
                 {
                 	this->graph.insert(newNode[2]);
+                	this->graph.insert(newNode[1]);
                 	this->graph.insert(newNode[0]);
                 }
                 else
                 {
-                	this->graph.insert(newNode[0]);
-                	this->graph.insert(newNode[2]);
+                	this->graph.insert(newNode[1]);
+                    if (area[2] > area[0])
+                    {
+                    	this->graph.insert(newNode[2]);
+                    	this->graph.insert(newNode[0]);
+                    }
+                    else
+                    {
+                    	this->graph.insert(newNode[0]);
+                    	this->graph.insert(newNode[2]);
+                    }
                 }
             }
         }
+
 		// Check if edges must be flipped.
-        this->checkEdge(faceEdge);
-		this->checkEdge(prev_Edge_ID);
-		this->checkEdge(next_Edge_ID);
+		this->vEdgeStack.push_back(make_pair(next_Edge_ID, 0));
+		this->vEdgeStack.push_back(make_pair(prev_Edge_ID, 0));
+		this->vEdgeStack.push_back(make_pair(faceEdge, 0));
+		this->legalizeEdges();
     }
     else
     {
@@ -1264,9 +1615,12 @@ void Delaunay::splitNode(int pointIndex, int nodeIndex, int nTriangles)
 			flipCandidates[1] = prev_Edge_ID;
 
 			// Store nodes ID that are going to be updated.
-			oldNode1 = this->graph.getNodeAssigned(this->dcel.getRefEdge(collinear_Index)->getFace());
-			index = this->dcel.getRefEdge(collinear_Index)->getTwin() - 1;
-			oldNode2 = this->graph.getNodeAssigned(this->dcel.getRefEdge(index)->getFace());
+			if (this->isGraphUsed())
+			{
+				oldNode1 = this->graph.getNodeAssigned(this->dcel.getRefEdge(collinear_Index)->getFace());
+				index = this->dcel.getRefEdge(collinear_Index)->getTwin() - 1;
+				oldNode2 = this->graph.getNodeAssigned(this->dcel.getRefEdge(index)->getFace());
+			}
 
 #ifdef DEBUG_SPLIT_NODE
 			Logging::buildText(__FUNCTION__, __FILE__, "Nodes that share edge are ");
@@ -1280,44 +1634,44 @@ void Delaunay::splitNode(int pointIndex, int nodeIndex, int nTriangles)
 #endif
 
 			// Update current face with new edge: new_Edge_ID.
-			this->dcel.addEdge(this->dcel.getRefEdge(prev_Edge_ID-1)->getOrigin(), new_Edge_ID+1, next_Edge_ID,collinear_Edge_ID, ptrNode->getFace());
+			this->dcel.addEdge(this->dcel.getRefEdge(prev_Edge_ID-1)->getOrigin(), new_Edge_ID+1, next_Edge_ID,collinear_Edge_ID, faceId);
 
 			// Insert a new face with two new edges: new_Edge_ID+1 and new_Edge_ID+2.
 			this->dcel.addEdge(pointIndex+1, new_Edge_ID, new_Edge_ID+2, prev_Edge_ID, new_Face_ID);
 			this->dcel.addEdge(this->dcel.getRefEdge(collinear_Index)->getOrigin(), new_Edge_ID+3, prev_Edge_ID,new_Edge_ID+1, new_Face_ID);
 
 			this->dcel.updateVertex(new_Edge_ID+1, pointIndex);
-			this->dcel.updateFace(new_Edge_ID, ptrNode->getFace());
+			this->dcel.updateFace(new_Edge_ID, faceId);
 
 			// Update existing edges.
 			this->dcel.updateEdge(pointIndex+1, NO_UPDATE, new_Edge_ID, NO_UPDATE, NO_UPDATE, collinear_Index);
 			this->dcel.updateEdge(NO_UPDATE, NO_UPDATE, NO_UPDATE, new_Edge_ID, NO_UPDATE, next_Edge_ID-1);
 			this->dcel.updateEdge(NO_UPDATE, NO_UPDATE, new_Edge_ID+1, new_Edge_ID+2, new_Face_ID, prev_Edge_ID-1);
 
-			// Get node of current edge and update it.
-			ptrNode = this->graph.getRefNode(oldNode1);
-			ptrNode->setChildren(this->graph.getSize(), this->graph.getSize() + 1, INVALID);
-            this->graph.update(oldNode1, ptrNode);
-
-			// Insert two new nodes in first node splitted.
-            vector<int> vPoints = {this->dcel.getOrigin(this->dcel.getPrevious(collinear_Index)-1),
-                                   this->dcel.getOrigin(collinear_Index),
-                                   this->dcel.getOrigin(this->dcel.getNext(collinear_Index)-1)};
-	        newNode[0] = Node(vPoints, this->dcel.getFace(collinear_Index));
-			this->graph.insert(newNode[0]);
+			if (this->isGraphUsed())
+			{
+				// Get node of current edge and update it.
+				this->graph.setChildren(oldNode1, this->graph.getSize(), this->graph.getSize() + 1);
+
+				// Insert two new nodes in first node splitted.
+				newNode[0] = Node(this->dcel.getOrigin(this->dcel.getPrevious(collinear_Index)-1),
+								  this->dcel.getOrigin(collinear_Index),
+								  this->dcel.getOrigin(this->dcel.getNext(collinear_Index)-1),
+								  this->dcel.getFace(collinear_Index));
+				this->graph.insert(newNode[0]);
 #ifdef DEBUG_SPLIT_NODE
-			Logging::buildText(__FUNCTION__, __FILE__, "Splitting 1st triangle ");
-			Logging::buildText(__FUNCTION__, __FILE__, this->dcel.getRefFace(newNode[0].getFace())->toStr());
-			Logging::buildText(__FUNCTION__, __FILE__, "1st node is: ");
-			Logging::buildText(__FUNCTION__, __FILE__, newNode[0].toStr());
-			Logging::write(true, Info);
+				Logging::buildText(__FUNCTION__, __FILE__, "Splitting 1st triangle ");
+				Logging::buildText(__FUNCTION__, __FILE__, this->dcel.getRefFace(newNode[0].getFace())->toStr());
+				Logging::buildText(__FUNCTION__, __FILE__, "1st node is: ");
+				Logging::buildText(__FUNCTION__, __FILE__, newNode[0].toStr());
+				Logging::write(true, Info);
 #endif
-            vPoints.clear();
-            vPoints = {this->dcel.getOrigin(this->dcel.getPrevious(collinear_Index)-1),
-                       this->dcel.getOrigin(this->dcel.getPrevious(this->dcel.getTwin(this->dcel.getPrevious(collinear_Index)-1)-1)-1),
-                       this->dcel.getOrigin(this->dcel.getTwin(this->dcel.getPrevious(collinear_Index)-1)-1)};
-	        newNode[1] = Node(vPoints, new_Face_ID);
-			this->graph.insert(newNode[1]);
+				newNode[1] = Node(this->dcel.getOrigin(this->dcel.getPrevious(collinear_Index)-1),
+								  this->dcel.getOrigin(this->dcel.getPrevious(this->dcel.getTwin(this->dcel.getPrevious(collinear_Index)-1)-1)-1),
+								  this->dcel.getOrigin(this->dcel.getTwin(this->dcel.getPrevious(collinear_Index)-1)-1),
+								  new_Face_ID);
+				this->graph.insert(newNode[1]);
+			}
 
 			// Insert new face.
 			this->dcel.addFace(new_Edge_ID + 2);
@@ -1347,32 +1701,34 @@ void Delaunay::splitNode(int pointIndex, int nodeIndex, int nTriangles)
 			this->dcel.updateEdge(NO_UPDATE, NO_UPDATE, NO_UPDATE, new_Edge_ID+5, NO_UPDATE, collinear_Index);
 			this->dcel.updateEdge(NO_UPDATE, NO_UPDATE, new_Edge_ID+5, NO_UPDATE, NO_UPDATE, prev_Edge_ID-1);
 
-			// Get node of twin edge and update it.
-			ptrNode = this->graph.getRefNode(oldNode2);
-			ptrNode->setChildren(this->graph.getSize(), this->graph.getSize() + 1, INVALID);
-            this->graph.update(oldNode2, ptrNode);
-
-			// Insert two new nodes in first node splitted.
-            vPoints.clear();
-            vPoints = {	this->dcel.getOrigin(this->dcel.getPrevious(collinear_Index)-1),
-                        this->dcel.getOrigin(collinear_Index),
-                        this->dcel.getOrigin(this->dcel.getNext(collinear_Index)-1)};
-	        newNode[0] = Node(vPoints, this->dcel.getFace(collinear_Index));
-			this->graph.insert(newNode[0]);
+			if (this->isGraphUsed())
+			{
+				// Get node of twin edge and update it.
+				this->graph.setChildren(oldNode2, this->graph.getSize(), this->graph.getSize() + 1);
+
+				// Insert two new nodes in first node splitted.
+				newNode[0] = Node(this->dcel.getOrigin(this->dcel.getPrevious(collinear_Index)-1),
+								  this->dcel.getOrigin(collinear_Index),
+								  this->dcel.getOrigin(this->dcel.getNext(collinear_Index)-1),
+								  this->dcel.getFace(collinear_Index));
+				this->graph.insert(newNode[0]);
+			}
 
 			// Update face.
-			this->dcel.updateFace(collinear_Edge_ID, newNode[0].getFace());
+			this->dcel.updateFace(collinear_Edge_ID, this->dcel.getFace(collinear_Index));
 #ifdef DEBUG_SPLIT_NODE
 			Logging::buildText(__FUNCTION__, __FILE__, "Splitting first triangle ");
 			Logging::buildText(__FUNCTION__, __FILE__, this->dcel.getRefFace(newNode[0].getFace())->toStr());
 			Logging::write(true, Info);
 #endif
-            vPoints.clear();
-            vPoints = {	this->dcel.getOrigin(this->dcel.getPrevious(next_Edge_ID-1)-1),
-                        this->dcel.getOrigin(next_Edge_ID-1),
-                        this->dcel.getOrigin(this->dcel.getNext(next_Edge_ID-1)-1)};
-	        newNode[1] = Node(vPoints, this->dcel.getFace(next_Edge_ID-1));
-			this->graph.insert(newNode[1]);
+			if (this->isGraphUsed())
+			{
+				newNode[1] = Node(this->dcel.getOrigin(this->dcel.getPrevious(next_Edge_ID-1)-1),
+								  this->dcel.getOrigin(next_Edge_ID-1),
+								  this->dcel.getOrigin(this->dcel.getNext(next_Edge_ID-1)-1),
+								  this->dcel.getFace(next_Edge_ID-1));
+				this->graph.insert(newNode[1]);
+			}
 
 			// Insert new face.
 			this->dcel.addFace(new_Edge_ID + 4);
@@ -1382,13 +1738,12 @@ void Delaunay::splitNode(int pointIndex, int nodeIndex, int nTriangles)
 			Logging::write(true, Info);
 #endif
 
-			// Check candidates from first triangle.
-			this->checkEdge(flipCandidates[0]);
-			this->checkEdge(flipCandidates[1]);
-
-			// Check candidates from second triangle.
-			this->checkEdge(prev_Edge_ID);
-			this->checkEdge(next_Edge_ID);
+			// Check candidates from first and second triangles.
+			this->vEdgeStack.push_back(make_pair(next_Edge_ID, 0));
+			this->vEdgeStack.push_back(make_pair(prev_Edge_ID, 0));
+			this->vEdgeStack.push_back(make_pair(flipCandidates[1], 0));
+			this->vEdgeStack.push_back(make_pair(flipCandidates[0], 0));
+			this->legalizeEdges();
 		}
 #ifdef DEBUG_SPLIT_NODE
 		else
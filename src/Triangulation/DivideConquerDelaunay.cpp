@@ -0,0 +1,860 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "DivideConquerDelaunay.h"
+#include "Logging.h"
+#include "Parallel.h"
+#include "Predicates.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+
+/***********************************************************************************************************************
+* Public methods definitions
+***********************************************************************************************************************/
+DivideConquerDelaunay::DivideConquerDelaunay(vector<Point<TYPE>> &vPoints, size_t szNumThreadsIn) :
+                        Triangulation(vPoints), szNumThreads(Parallel::getNumThreads(szNumThreadsIn)), isBuilt(false)
+{
+}
+
+
+bool DivideConquerDelaunay::build()
+{
+    // Reset previous triangulation (if any)
+    this->dcel.reset(false);
+    this->dcel.reserveTriangulation(this->dcel.getNumVertex());
+    this->hull.reset();
+    this->isBuilt = false;
+
+    // Check minimum number of points
+    size_t szNumPoints = this->dcel.getNumVertex();
+    if (szNumPoints < NPOINTS_TRIANGLE)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Number of points must be at least 3 and it is ");
+        Logging::buildText(__FUNCTION__, __FILE__, szNumPoints);
+        Logging::write(true, Error);
+        return false;
+    }
+
+    // Sort points and check there are no duplicated points
+    this->times = DivideConquerTimes();
+    auto start = std::chrono::steady_clock::now();
+    if (!sortPoints())
+    {
+        return false;
+    }
+    auto sorted = std::chrono::steady_clock::now();
+    this->times.sort = std::chrono::duration<double>(sorted - start).count();
+
+    // Every sub-problem of k points never has more than 3k edges alive
+    vOrigin.assign(6*szNumPoints, INVALID);
+    vOnext.assign(6*szNumPoints, INVALID);
+    vOprev.assign(6*szNumPoints, INVALID);
+    vVertexEdge.assign(szNumPoints, INVALID);
+    EdgePool pool;
+    pool.vRanges.emplace_back(0, 3*szNumPoints);
+
+    // Compute triangulation
+    int ldo=INVALID, rdo=INVALID;
+    triangulate(0, (int) szNumPoints, getParallelDepth(), pool, ldo, rdo);
+    auto triangulated = std::chrono::steady_clock::now();
+    this->times.triangulate = std::chrono::duration<double>(triangulated - sorted).count();
+
+    // Copy half-edges into Dcel
+    buildDcel();
+    this->times.dcel = std::chrono::duration<double>(std::chrono::steady_clock::now() - triangulated).count();
+
+    // Free temporary resources
+    vector<Point<TYPE>>().swap(vSorted);
+    vector<int>().swap(vSortedIndex);
+    vector<int>().swap(vOrigin);
+    vector<int>().swap(vOnext);
+    vector<int>().swap(vOprev);
+    vector<int>().swap(vVertexEdge);
+
+    this->isBuilt = true;
+    return true;
+}
+
+
+bool DivideConquerDelaunay::convexHull()
+{
+    // Check triangulation exists
+    if (!isBuilt)
+    {
+        return false;
+    }
+
+    // Loop edges in external face
+    this->hull.reset();
+    int iFirstIdx = this->dcel.getFaceEdge(EXTERNAL_FACE) - 1;
+    int iCurrentIdx = iFirstIdx;
+    do
+    {
+        // Insert edge origin point
+        this->hull.add(*this->dcel.getRefPoint(this->dcel.getOrigin(iCurrentIdx)-1), iCurrentIdx+1);
+
+        // Get next edge.
+        iCurrentIdx = this->dcel.getNext(iCurrentIdx) - 1;
+    } while (iCurrentIdx != iFirstIdx);
+
+    return this->isConvexHullComputed();
+}
+
+
+/***************************************************************************
+* Name: 	findTwoClosest
+* IN:		NONE
+* OUT:		p		one of the closest points.
+* 			q		the other of the closest points.
+* RETURN:	true	if two closest points found.
+* 			false	i.o.c.
+* GLOBAL:	NONE
+* Description: 	the two closest points are a vertex and its nearest
+* 				neighbour so the result is the lowest distance of all
+* 				nearest neighbours computed in parallel.
+***************************************************************************/
+bool DivideConquerDelaunay::findTwoClosest(Point<TYPE> &p, Point<TYPE> &q)
+{
+    return this->isBuilt && this->reduceTwoClosest(p, q);
+}
+
+
+bool DivideConquerDelaunay::findFace(Point<TYPE> &origin, int &faceId)
+{
+    // Check there is at least one triangle
+    if (!isBuilt || (this->dcel.getNumFaces() <= 1))
+    {
+        faceId = EXTERNAL_FACE;
+        return isBuilt;
+    }
+
+    // Walk from first face towards point
+    int iEdgeIdx = this->dcel.getFaceEdge(1) - 1;
+    bool isFound=false;
+    while (!isFound)
+    {
+        // Check if point is at the right of any of the edges of current face
+        bool isMoved=false;
+        for (int i=0; (i<NPOINTS_TRIANGLE) && !isMoved ;i++)
+        {
+            Point<TYPE> *p = this->dcel.getRefPoint(this->dcel.getOrigin(iEdgeIdx)-1);
+            int iTwinIdx = this->dcel.getTwin(iEdgeIdx) - 1;
+            Point<TYPE> *q = this->dcel.getRefPoint(this->dcel.getOrigin(iTwinIdx)-1);
+            if (p->check_Turn(*q, origin) == RIGHT_TURN)
+            {
+                // Point is out of convex hull
+                if (this->dcel.getFace(iTwinIdx) == EXTERNAL_FACE)
+                {
+                    faceId = EXTERNAL_FACE;
+                    return true;
+                }
+
+                // Move to adjacent face skipping the edge already checked
+                iEdgeIdx = this->dcel.getNext(iTwinIdx) - 1;
+                isMoved = true;
+            }
+            else
+            {
+                iEdgeIdx = this->dcel.getNext(iEdgeIdx) - 1;
+            }
+        }
+
+        isFound = !isMoved;
+    }
+
+    faceId = this->dcel.getFace(iEdgeIdx);
+    return true;
+}
+
+
+/***************************************************************************
+* Name: 	findClosestPoint
+* IN:		in			input point whose closest is going to be located.
+* 			voronoi		not used.
+* OUT:		out			closest point to p
+* 			pointIndex 	index of the point in the DCEL.
+* RETURN:	true		if closest point found.
+* 			false		i.o.c.
+* GLOBAL:	NONE
+* Description: 	greedy walk through the triangulation. Every vertex that is
+* 				not the closest has a neighbor closer to the input point.
+***************************************************************************/
+bool DivideConquerDelaunay::findClosestPoint(Point<TYPE> &in, Voronoi *voronoi, Point<TYPE> &out, int &pointIndex)
+{
+    if (!isBuilt)
+    {
+        return false;
+    }
+
+    // Start at first point
+    pointIndex = 0;
+    TYPE lowestDistance = in.distance(*this->dcel.getRefPoint(pointIndex));
+    bool isMoved=true;
+    while (isMoved)
+    {
+        isMoved = false;
+
+        // Check all neighbors of current point
+        int iCurrentPoint = pointIndex;
+        int iFirstEdgeIdx = this->dcel.getPointEdge(iCurrentPoint) - 1;
+        int iEdgeIdx = iFirstEdgeIdx;
+        do
+        {
+            int iDestIdx = this->dcel.getOrigin(this->dcel.getTwin(iEdgeIdx)-1) - 1;
+            TYPE distance = in.distance(*this->dcel.getRefPoint(iDestIdx));
+            if (distance < lowestDistance)
+            {
+                lowestDistance = distance;
+                pointIndex = iDestIdx;
+                isMoved = true;
+            }
+
+            // Get next edge departing from current point
+            iEdgeIdx = this->dcel.getTwin(this->dcel.getPrevious(iEdgeIdx)-1) - 1;
+        } while (iEdgeIdx != iFirstEdgeIdx);
+    }
+
+    out = *this->dcel.getRefPoint(pointIndex);
+    return true;
+}
+
+
+bool DivideConquerDelaunay::findPath(Point<TYPE> &origin, Point<TYPE> &dest, vector<int> &vFacesId)
+{
+    bool found=false;
+
+    // Initialize output
+    vFacesId.clear();
+
+    // Build line whose path must be computed
+    Line line(origin, dest);
+
+    // Get extreme point faces.
+    int	 originFace=0;
+    int	 destinationFace=0;
+    if (this->findFace(origin, originFace) && this->findFace(dest, destinationFace))
+    {
+        bool computePath=false;
+        vector<int> vFaces;
+
+        // Add non external faces to set.
+        if (originFace != EXTERNAL_FACE)
+        {
+            vFaces.push_back(originFace);
+            computePath = true;
+        }
+
+        if (destinationFace != EXTERNAL_FACE)
+        {
+            vFaces.push_back(destinationFace);
+            computePath = true;
+        }
+
+        // Check if any of the faces is external to convex hull.
+        if (vFaces.size() != 2)
+        {
+            // Check if convex hull has not been computed.
+            if (!this->isConvexHullComputed())
+            {
+                this->convexHull();
+            }
+
+            vector<int> vEdges;
+            getConvexFacesIntersections(line, vFaces, vEdges);
+
+            // If vFaces is empty -> both points are external and there is no intersection with convex hull
+            if (vFaces.empty())
+            {
+                found = true;
+            }
+            else
+            {
+                computePath = true;
+            }
+        }
+
+        // If both points are external -> no path to compute.
+        if (computePath)
+        {
+            found = this->dcel.findPath(vFaces, line, vFacesId);
+        }
+    }
+
+    return found;
+}
+
+
+/***********************************************************************************************************************
+* Private methods definitions
+***********************************************************************************************************************/
+/**
+ * @fn      getParallelDepth
+ * @brief   Computes the number of recursion levels whose halves are computed in parallel
+ *
+ * @return  number of levels
+ */
+int DivideConquerDelaunay::getParallelDepth() const
+{
+    int depth=0;
+    while ((size_t(1) << depth) < szNumThreads)
+    {
+        depth++;
+    }
+
+    return depth;
+}
+
+
+/**
+ * @fn      sortPoints
+ * @brief   Sorts points lexicographically (x first, then y) and checks there are no duplicated points
+ *
+ * @return  true if no duplicated points
+ *          false otherwise
+ */
+bool DivideConquerDelaunay::sortPoints()
+{
+    // Copy points and initialize indexes
+    vSorted.clear();
+    this->dcel.getPoints(vSorted);
+    vSortedIndex.resize(vSorted.size());
+    for (size_t i=0; i<vSortedIndex.size() ;i++)
+    {
+        vSortedIndex[i] = (int) i;
+    }
+
+    // Sort indexes
+    auto compare = [this](int a, int b)
+    {
+        return (vSorted[a].getX() < vSorted[b].getX()) ||
+               ((vSorted[a].getX() == vSorted[b].getX()) && (vSorted[a].getY() < vSorted[b].getY()));
+    };
+    Parallel::sort(vSortedIndex, DIVIDE_CONQUER_MIN_POINTS_THREAD, szNumThreads, compare);
+
+    // Reorder points
+    vector<Point<TYPE>> vPoints(vSorted.size());
+    Parallel::runChunks(vSortedIndex.size(), DIVIDE_CONQUER_MIN_POINTS_THREAD, szNumThreads,
+                        [&](size_t first, size_t last)
+    {
+        for (size_t i=first; i<last ;i++)
+        {
+            vPoints[i] = vSorted[vSortedIndex[i]];
+        }
+        return true;
+    });
+    vSorted.swap(vPoints);
+
+    // Check duplicated points
+    bool isUnique = Parallel::runChunks(vSorted.size(), DIVIDE_CONQUER_MIN_POINTS_THREAD, szNumThreads,
+                                        [&](size_t first, size_t last)
+    {
+        for (size_t i=max(first, (size_t) 1); i<last ;i++)
+        {
+            if (vSorted[i] == vSorted[i-1])
+            {
+                return false;
+            }
+        }
+        return true;
+    });
+
+    // Log first duplicated point
+    for (size_t i=1; (i<vSorted.size()) && !isUnique ;i++)
+    {
+        if (vSorted[i] == vSorted[i-1])
+        {
+            Logging::buildText(__FUNCTION__, __FILE__, "Duplicated points at indexes ");
+            Logging::buildText(__FUNCTION__, __FILE__, vSortedIndex[i-1]);
+            Logging::buildText(__FUNCTION__, __FILE__, " and ");
+            Logging::buildText(__FUNCTION__, __FILE__, vSortedIndex[i]);
+            Logging::write(true, Error);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/**
+ * @fn      triangulate
+ * @brief   Computes the Delaunay triangulation of the sorted points in [first, last) range.
+ *
+ * @param   first   (IN)    First point
+ * @param   last    (IN)    Last point (not included)
+ * @param   depth   (IN)    Number of levels that can still be split in two threads
+ * @param   pool    (IN)    Half-edges that can be used. If depth is not zero then it must contain only the unused
+ *                          range assigned to the [first, last) points
+ * @param   ldo     (OUT)   Counterclockwise convex hull edge out of the leftmost point
+ * @param   rdo     (OUT)   Clockwise convex hull edge out of the rightmost point
+ */
+void DivideConquerDelaunay::triangulate(int first, int last, int depth, EdgePool &pool, int &ldo, int &rdo)
+{
+    int szNumPoints = last - first;
+    if (szNumPoints == 2)
+    {
+        int a = makeEdge(first, first+1, pool);
+        ldo = a;
+        rdo = sym(a);
+    }
+    else if (szNumPoints == NPOINTS_TRIANGLE)
+    {
+        int a = makeEdge(first, first+1, pool);
+        int b = makeEdge(first+1, first+2, pool);
+        splice(sym(a), b);
+
+        // Close the triangle depending on points orientation
+        if (isCounterClockwise(first, first+1, first+2))
+        {
+            connect(b, a, pool);
+            ldo = a;
+            rdo = sym(b);
+        }
+        else if (isCounterClockwise(first, first+2, first+1))
+        {
+            int c = connect(b, a, pool);
+            ldo = sym(c);
+            rdo = c;
+        }
+        // Collinear points
+        else
+        {
+            ldo = a;
+            rdo = sym(b);
+        }
+    }
+    else
+    {
+        int middle = first + szNumPoints/2;
+        int ldi=INVALID, rdi=INVALID;
+        if ((depth > 0) && (szNumPoints >= DIVIDE_CONQUER_MIN_POINTS_THREAD))
+        {
+            // Every half uses its own edges range
+            EdgePool leftPool, rightPool;
+            leftPool.vRanges.emplace_back(3*first, 3*middle);
+            rightPool.vRanges.emplace_back(3*middle, 3*last);
+
+            std::thread thread(&DivideConquerDelaunay::triangulate, this, first, middle, depth-1, std::ref(leftPool),
+                               std::ref(ldo), std::ref(ldi));
+            triangulate(middle, last, depth-1, rightPool, rdi, rdo);
+            thread.join();
+
+            // Edges not used by any half are available for merge
+            pool.vRanges = leftPool.vRanges;
+            pool.vRanges.insert(pool.vRanges.end(), rightPool.vRanges.begin(), rightPool.vRanges.end());
+            pool.vFreed = leftPool.vFreed;
+            pool.vFreed.insert(pool.vFreed.end(), rightPool.vFreed.begin(), rightPool.vFreed.end());
+        }
+        else
+        {
+            triangulate(first, middle, depth, pool, ldo, ldi);
+            triangulate(middle, last, depth, pool, rdi, rdo);
+        }
+
+        // Top level merge is timed apart because no other thread works while it runs
+        auto start = std::chrono::steady_clock::now();
+        merge(ldo, ldi, rdi, rdo, pool);
+        if ((first == 0) && (last == (int) vSorted.size()))
+        {
+            this->times.merge = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+    }
+}
+
+
+/**
+ * @fn      merge
+ * @brief   Merges two adjacent triangulations
+ *
+ * @param   ldo     (IN/OUT)    Counterclockwise convex hull edge out of the leftmost point of left triangulation
+ * @param   ldi     (IN)        Clockwise convex hull edge out of the rightmost point of left triangulation
+ * @param   rdi     (IN)        Counterclockwise convex hull edge out of the leftmost point of right triangulation
+ * @param   rdo     (IN/OUT)    Clockwise convex hull edge out of the rightmost point of right triangulation
+ * @param   pool    (IN)        Half-edges that can be used
+ */
+void DivideConquerDelaunay::merge(int &ldo, int ldi, int rdi, int &rdo, EdgePool &pool)
+{
+    // Compute lower common tangent
+    bool isTangent=false;
+    while (!isTangent)
+    {
+        if (isLeftOf(vOrigin[rdi], ldi))
+        {
+            ldi = lnext(ldi);
+        }
+        else if (isRightOf(vOrigin[ldi], rdi))
+        {
+            rdi = rprev(rdi);
+        }
+        else
+        {
+            isTangent = true;
+        }
+    }
+
+    // Create first cross edge from right to left triangulation
+    int basel = connect(sym(rdi), ldi, pool);
+    if (vOrigin[ldi] == vOrigin[ldo])
+    {
+        ldo = sym(basel);
+    }
+    if (vOrigin[rdi] == vOrigin[rdo])
+    {
+        rdo = basel;
+    }
+
+    // Add cross edges until upper common tangent is reached
+    bool isFinished=false;
+    while (!isFinished)
+    {
+        // Remove left edges that fail incircle test
+        int lcand = vOnext[sym(basel)];
+        bool isLeftValid = isRightOf(dest(lcand), basel);
+        if (isLeftValid)
+        {
+            while (isInCircle(dest(basel), vOrigin[basel], dest(lcand), dest(vOnext[lcand])))
+            {
+                int next = vOnext[lcand];
+                deleteEdge(lcand, pool);
+                lcand = next;
+            }
+        }
+
+        // Remove right edges that fail incircle test
+        int rcand = vOprev[basel];
+        bool isRightValid = isRightOf(dest(rcand), basel);
+        if (isRightValid)
+        {
+            while (isInCircle(dest(basel), vOrigin[basel], dest(rcand), dest(vOprev[rcand])))
+            {
+                int next = vOprev[rcand];
+                deleteEdge(rcand, pool);
+                rcand = next;
+            }
+        }
+
+        // Upper common tangent reached
+        isLeftValid = isRightOf(dest(lcand), basel);
+        isRightValid = isRightOf(dest(rcand), basel);
+        if (!isLeftValid && !isRightValid)
+        {
+            isFinished = true;
+        }
+        else if (!isLeftValid ||
+                 (isRightValid && isInCircle(dest(lcand), vOrigin[lcand], vOrigin[rcand], dest(rcand))))
+        {
+            basel = connect(rcand, sym(basel), pool);
+        }
+        else
+        {
+            basel = connect(sym(basel), sym(lcand), pool);
+        }
+    }
+}
+
+
+/**
+ * @fn      makeEdge
+ * @brief   Creates an isolated edge (and its twin)
+ *
+ * @param   origin  (IN)    Origin point
+ * @param   dest    (IN)    Destination point
+ * @param   pool    (IN)    Half-edges that can be used
+ * @return  new edge
+ */
+int DivideConquerDelaunay::makeEdge(int origin, int dest, EdgePool &pool)
+{
+    // Get free pair of half-edges
+    int pair;
+    if (!pool.vFreed.empty())
+    {
+        pair = pool.vFreed.back();
+        pool.vFreed.pop_back();
+    }
+    else if (!pool.vRanges.empty())
+    {
+        pair = pool.vRanges.back().first++;
+        if (pool.vRanges.back().first == pool.vRanges.back().second)
+        {
+            pool.vRanges.pop_back();
+        }
+    }
+    else
+    {
+        throw std::runtime_error("No free edges left in divide and conquer sub-problem");
+    }
+
+    int edge = 2*pair;
+    vOrigin[edge] = origin;
+    vOrigin[edge+1] = dest;
+    vOnext[edge] = edge;
+    vOprev[edge] = edge;
+    vOnext[edge+1] = edge+1;
+    vOprev[edge+1] = edge+1;
+    vVertexEdge[origin] = edge;
+    vVertexEdge[dest] = edge+1;
+
+    return edge;
+}
+
+
+/**
+ * @fn      splice
+ * @brief   Joins origin rings of both edges if they are different. Splits them otherwise.
+ *
+ * @param   a   (IN)    First edge
+ * @param   b   (IN)    Second edge
+ */
+void DivideConquerDelaunay::splice(int a, int b)
+{
+    int alpha = vOnext[a];
+    int beta = vOnext[b];
+
+    vOnext[a] = beta;
+    vOnext[b] = alpha;
+    vOprev[beta] = a;
+    vOprev[alpha] = b;
+}
+
+
+/**
+ * @fn      connect
+ * @brief   Creates a new edge from destination of "a" to origin of "b" so all three edges share left face
+ *
+ * @param   a       (IN)    Edge whose destination is the new edge origin
+ * @param   b       (IN)    Edge whose origin is the new edge destination
+ * @param   pool    (IN)    Half-edges that can be used
+ * @return  new edge
+ */
+int DivideConquerDelaunay::connect(int a, int b, EdgePool &pool)
+{
+    int edge = makeEdge(dest(a), vOrigin[b], pool);
+    splice(edge, lnext(a));
+    splice(sym(edge), b);
+
+    return edge;
+}
+
+
+/**
+ * @fn      deleteEdge
+ * @brief   Disconnects edge (and its twin) and releases it
+ *
+ * @param   edge    (IN)    Edge to delete
+ * @param   pool    (IN)    Pool where edge is released
+ */
+void DivideConquerDelaunay::deleteEdge(int edge, EdgePool &pool)
+{
+    // Move vertex edges to other edges of the same vertices
+    if (vVertexEdge[vOrigin[edge]] == edge)
+    {
+        vVertexEdge[vOrigin[edge]] = (vOnext[edge] != edge) ? vOnext[edge] : INVALID;
+    }
+    if (vVertexEdge[dest(edge)] == sym(edge))
+    {
+        vVertexEdge[dest(edge)] = (vOnext[sym(edge)] != sym(edge)) ? vOnext[sym(edge)] : INVALID;
+    }
+
+    splice(edge, vOprev[edge]);
+    splice(sym(edge), vOprev[sym(edge)]);
+
+    vOrigin[edge] = INVALID;
+    vOrigin[sym(edge)] = INVALID;
+    pool.vFreed.push_back(edge >> 1);
+}
+
+
+/**
+ * @fn      buildDcel
+ * @brief   Copies used half-edges into Dcel. Twin edges have consecutive identifiers and face 0 is the external face.
+ *          Half-edges are split in consecutive chunks processed by different threads. Edge and face identifiers of
+ *          every chunk start after the ones of the previous chunks so the Dcel does not depend on the threads.
+ */
+void DivideConquerDelaunay::buildDcel()
+{
+    size_t szNumHalfEdges = vOrigin.size();
+    size_t szNumChunks = min(szNumThreads, max(szNumHalfEdges / DIVIDE_CONQUER_MIN_POINTS_THREAD, (size_t) 1));
+    size_t szChunkSize = (szNumHalfEdges + szNumChunks - 1) / szNumChunks;
+
+    // Triangles are counterclockwise so any other cycle is the external face. Triangle is assigned to its lowest edge
+    auto isTriangleEdge = [this](int a)
+    {
+        int b = lnext(a);
+        int c = lnext(b);
+        return (lnext(c) == a) && (a < b) && (a < c) && isCounterClockwise(vOrigin[a], vOrigin[b], vOrigin[c]);
+    };
+
+    // Count edges and triangles of every chunk
+    vector<int> vFirstEdgeId(szNumChunks+1, 0);
+    vector<int> vFirstFace(szNumChunks+1, 0);
+    Parallel::runChunks(szNumChunks, 1, szNumChunks, [&](size_t firstChunk, size_t lastChunk)
+    {
+        for (size_t chunk=firstChunk; chunk<lastChunk ;chunk++)
+        {
+            size_t last = min((chunk + 1)*szChunkSize, szNumHalfEdges);
+            for (size_t i=chunk*szChunkSize; i<last ;i++)
+            {
+                if (vOrigin[i] != INVALID)
+                {
+                    vFirstEdgeId[chunk+1]++;
+                    vFirstFace[chunk+1] += isTriangleEdge((int) i) ? 1 : 0;
+                }
+            }
+        }
+        return true;
+    });
+
+    // First edge identifier and face of every chunk. Face 0 is the external face
+    vFirstFace[0] = 1;
+    for (size_t chunk=0; chunk<szNumChunks ;chunk++)
+    {
+        vFirstEdgeId[chunk+1] += vFirstEdgeId[chunk];
+        vFirstFace[chunk+1] += vFirstFace[chunk];
+    }
+    this->dcel.resize(vFirstEdgeId[szNumChunks], vFirstFace[szNumChunks]);
+
+    // Assign edge identifiers and triangles
+    vector<int> vEdgeId(szNumHalfEdges, INVALID);
+    vector<int> vFace(szNumHalfEdges, INVALID);
+    Parallel::runChunks(szNumChunks, 1, szNumChunks, [&](size_t firstChunk, size_t lastChunk)
+    {
+        for (size_t chunk=firstChunk; chunk<lastChunk ;chunk++)
+        {
+            int edgeId = vFirstEdgeId[chunk];
+            int face = vFirstFace[chunk];
+            size_t last = min((chunk + 1)*szChunkSize, szNumHalfEdges);
+            for (size_t i=chunk*szChunkSize; i<last ;i++)
+            {
+                if (vOrigin[i] != INVALID)
+                {
+                    vEdgeId[i] = ++edgeId;
+                    if (isTriangleEdge((int) i))
+                    {
+                        vFace[i] = face;
+                        vFace[lnext((int) i)] = face;
+                        vFace[lnext(lnext((int) i))] = face;
+                        this->dcel.setFaceEdge(face, edgeId);
+                        face++;
+                    }
+                }
+            }
+        }
+        return true;
+    });
+
+    // Add edges. External face starts at its lowest edge
+    vector<int> vExternalEdgeId(szNumChunks, INVALID);
+    Parallel::runChunks(szNumChunks, 1, szNumChunks, [&](size_t firstChunk, size_t lastChunk)
+    {
+        for (size_t chunk=firstChunk; chunk<lastChunk ;chunk++)
+        {
+            size_t last = min((chunk + 1)*szChunkSize, szNumHalfEdges);
+            for (size_t i=chunk*szChunkSize; i<last ;i++)
+            {
+                if (vOrigin[i] != INVALID)
+                {
+                    int edge = (int) i;
+                    int face = (vFace[edge] != INVALID) ? vFace[edge] : EXTERNAL_FACE;
+                    if ((face == EXTERNAL_FACE) && (vExternalEdgeId[chunk] == INVALID))
+                    {
+                        vExternalEdgeId[chunk] = vEdgeId[edge];
+                    }
+
+                    int edgeIndex = vEdgeId[edge] - 1;
+                    this->dcel.setOrigin(edgeIndex, vSortedIndex[vOrigin[edge]] + 1);
+                    this->dcel.setTwin(edgeIndex, vEdgeId[sym(edge)]);
+                    this->dcel.setPrevious(edgeIndex, vEdgeId[sym(vOnext[edge])]);
+                    this->dcel.setNext(edgeIndex, vEdgeId[lnext(edge)]);
+                    this->dcel.setFace(edgeIndex, face);
+                }
+            }
+        }
+        return true;
+    });
+
+    for (auto edgeId : vExternalEdgeId)
+    {
+        if (edgeId != INVALID)
+        {
+            this->dcel.setFaceEdge(EXTERNAL_FACE, edgeId);
+            break;
+        }
+    }
+
+    // Add vertices edges
+    Parallel::runChunks(vVertexEdge.size(), DIVIDE_CONQUER_MIN_POINTS_THREAD, szNumThreads,
+                        [&](size_t first, size_t last)
+    {
+        for (size_t i=first; i<last ;i++)
+        {
+            this->dcel.updateVertex(vEdgeId[vVertexEdge[i]], vSortedIndex[i]);
+        }
+        return true;
+    });
+}
+
+
+/**
+ * @fn    getConvexFacesIntersections
+ * @brief Get faces and edge in convex hull that intersects input line
+ *
+ * @param line      (IN) Line to check
+ * @param vFaces    (OUT) Faces in convex hull that intersect line
+ * @param vEdges    (OUT) Edges in convex hull that intersect line
+ */
+void DivideConquerDelaunay::getConvexFacesIntersections(Line &line, vector<int> &vFaces, vector<int> &vEdges)
+{
+    // Get convex hull edges
+    vector<int> vConvexEdges;
+    hull.getConvexHullEdges(vConvexEdges);
+
+    Point<TYPE> o;
+    Point<TYPE> d;
+    for (auto edgeId : vConvexEdges)
+    {
+        // Get edge extreme points
+        dcel.getEdgePoints(edgeId - 1, o, d);
+
+        // Build edge line
+        Line l(o, d);
+
+        // If line intersects -> add face
+        if (line.intersect(l))
+        {
+            int iTwinEdge = dcel.getTwin(edgeId - 1);
+            vFaces.push_back(dcel.getFace(iTwinEdge - 1));
+            vEdges.push_back(edgeId);
+        }
+    }
+}
+
+
+/**
+ * @fn      isCounterClockwise
+ * @brief   Checks if a-b-c sorted points are a counterclockwise triangle
+ *
+ * @return  true if counterclockwise
+ *          false otherwise (clockwise or collinear)
+ */
+bool DivideConquerDelaunay::isCounterClockwise(int a, int b, int c) const
+{
+    return Predicates::orient(vSorted[a], vSorted[b], vSorted[c]) > 0.0;
+}
+
+
+/**
+ * @fn      isInCircle
+ * @brief   Checks if sorted point d is strictly inside the circle of counterclockwise triangle a-b-c
+ *
+ * @return  true if d is inside circle
+ *          false otherwise
+ */
+bool DivideConquerDelaunay::isInCircle(int a, int b, int c, int d) const
+{
+    return Predicates::inCircle(vSorted[a], vSorted[b], vSorted[c], vSorted[d]);
+}
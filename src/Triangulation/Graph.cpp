@@ -5,6 +5,7 @@
 #include "Graph.h"
 #include "Logging.h"
 
+#include <algorithm>
 #include <iostream>
 using namespace std;
 
@@ -30,55 +31,139 @@ using namespace std;
 * GLOBAL:	NONE
 * Description: 	inserts a node in the last position of the nodes array.
 ***************************************************************************/
-void Graph::insert(Node &node)
+void Graph::insert(const Node &node)
 {
     // Copy node data.
-    this->vNodes.push_back(node);
+    int nodeId = this->getSize();
+    this->insert(node.getiPoint(0), node.getiPoint(1), node.getiPoint(2), node.getFace());
+    if (node.getNChildren() == TWO)
+    {
+        this->setChildren(nodeId, node.getiChild(0), node.getiChild(1));
+    }
+    else if (node.getNChildren() == MAX_CHILDREN)
+    {
+        this->setChildren(nodeId, node.getiChild(0), node.getiChild(1), node.getiChild(2));
+    }
+}
+
+
+/**
+ * @fn      insert
+ * @brief   Inserts a leaf node in the last position of the nodes arrays
+ *
+ * @param   id1     (IN)    First point id
+ * @param   id2     (IN)    Second point id
+ * @param   id3     (IN)    Third point id
+ * @param   face    (IN)    Face assigned to node
+ */
+void Graph::insert(int id1, int id2, int id3, int face)
+{
+    // Copy node data.
+    this->vPoints.push_back(id1);
+    this->vPoints.push_back(id2);
+    this->vPoints.push_back(id3);
+    this->vChildren.insert(this->vChildren.end(), MAX_CHILDREN, INVALID);
+    this->vNChildren.push_back(0);
+    this->vFaces.push_back(face);
 
     // Face is negative -> reading node from file with default node data.
-    if (node.getFace() > 0)
+    if (face > 0)
     {
-        if (node.getFace() >= this->vFaceNode.size())
+        if ((size_t) face >= this->vFaceNode.size())
         {
-            this->vFaceNode.resize(node.getFace()*2, 0);
+            this->vFaceNode.resize(std::max<size_t>(face*2, this->vFaceNode.capacity()), 0);
         }
 
-        this->vFaceNode.at(node.getFace()) = this->vNodes.size() - 1;
+        this->vFaceNode[face] = this->getSize() - 1;
     }
 }
 
 
 int Graph::getNodeAssigned(int face)
 {
-    if (face >= this->vFaceNode.size())
+    if ((size_t) face >= this->vFaceNode.size())
     {
         cout << "Error" << endl;
         return 0;
     }
 
-    return this->vFaceNode.at(face);
+    return this->vFaceNode[face];
 };
 
+
+void Graph::setNodeAssigned(int iIdx, int iValue)
+{
+    if ((size_t) iIdx >= this->vFaceNode.size())
+    {
+        this->vFaceNode.resize(iIdx + 1, 0);
+    }
+
+    this->vFaceNode[iIdx] = iValue;
+}
+
+
+/**
+ * @fn      getNode
+ * @brief   Returns a copy of the node data
+ *
+ * @param   nodeId  (IN)    Node index
+ * @return  node at nodeId position
+ */
+Node Graph::getNode(int nodeId) const
+{
+    const int *ptrPoints = &this->vPoints.at(nodeId*NODE_POINTS);
+    Node node(ptrPoints[0], ptrPoints[1], ptrPoints[2], this->vFaces[nodeId]);
+    if (this->vNChildren[nodeId] == TWO)
+    {
+        node.setChildren(this->getiChild(nodeId, 0), this->getiChild(nodeId, 1));
+    }
+    else if (this->vNChildren[nodeId] == MAX_CHILDREN)
+    {
+        node.setChildren(this->getiChild(nodeId, 0), this->getiChild(nodeId, 1), this->getiChild(nodeId, 2));
+    }
+
+    return node;
+}
+
+
+/***************************************************************************
+* Name: 	setChildren
+* IN:		nodeId		node index to update
+* 			id1			first child
+* 			id2			second child
+* OUT:		NONE
+* RETURN:	NONE
+* GLOBAL:	NONE
+* Description: 	sets the two children of the node at position "nodeId".
+***************************************************************************/
+void Graph::setChildren(int nodeId, int id1, int id2)
+{
+    int *ptrChildren = &this->vChildren.at(nodeId*MAX_CHILDREN);
+    ptrChildren[0] = id1;
+    ptrChildren[1] = id2;
+    ptrChildren[2] = INVALID;
+    this->vNChildren[nodeId] = TWO;
+}
+
+
 /***************************************************************************
-* Name: 	update
-* IN:		index		node index to update
-* 			node		pointer to node data
+* Name: 	setChildren
+* IN:		nodeId		node index to update
+* 			id1			first child
+* 			id2			second child
+* 			id3			third child
 * OUT:		NONE
 * RETURN:	NONE
 * GLOBAL:	NONE
-* Description: 	updates the node information of node at position "index".
+* Description: 	sets the three children of the node at position "nodeId".
 ***************************************************************************/
-void Graph::update(int index, Node *node)
+void Graph::setChildren(int nodeId, int id1, int id2, int id3)
 {
-	try
-	{
-		// Update values of node at position index.
-		this->vNodes.at(index) = (*node);
-	}
-	catch (exception &ex)
-	{
-		ex.what();
-	}
+    int *ptrChildren = &this->vChildren.at(nodeId*MAX_CHILDREN);
+    ptrChildren[0] = id1;
+    ptrChildren[1] = id2;
+    ptrChildren[2] = id3;
+    this->vNChildren[nodeId] = MAX_CHILDREN;
 }
 
 
@@ -93,12 +178,42 @@ void Graph::update(int index, Node *node)
 * RETURN:	N/A
 * Description: 	returns the three vertex id of the "node_Index" node.
 ***************************************************************************/
-void Graph::getVertices(int node_Index, int &index1, int &index2, int &index3)
+void Graph::getVertices(int node_Index, int &index1, int &index2, int &index3) const
 {
 	// Get point vertexes of node at node_Index position.
-	index1 = this->vNodes.at(node_Index).getiPoint(0);
-	index2 = this->vNodes.at(node_Index).getiPoint(1);
-	index3 = this->vNodes.at(node_Index).getiPoint(2);
+	const int *ptrPoints = &this->vPoints[node_Index*NODE_POINTS];
+	index1 = ptrPoints[0];
+	index2 = ptrPoints[1];
+	index3 = ptrPoints[2];
+}
+
+
+/**
+ * @fn      reserve
+ * @brief   Reserves memory for the nodes and faces created when a triangulation of szNumPoints points is built.
+ *          Root node is created first. Then every point creates 3 nodes if it is inside a face or 4 if it is on an
+ *          edge, and every edge flip creates 2 nodes, so the graph has at most 1 + 4n + 2f nodes. Every point creates
+ *          2 faces.
+ *
+ * @param   szNumPoints     (IN)    Number of points in triangulation
+ * @param   szNumFlips      (IN)    Number of edge flips done by the build
+ * @param   isHugePages     (IN)    Flag to advise the kernel to back nodes arrays with huge pages
+ */
+void Graph::reserve(size_t szNumPoints, size_t szNumFlips, bool isHugePages)
+{
+    size_t szNumNodes = 1 + 4*szNumPoints + 2*szNumFlips;
+    this->vPoints.reserve(szNumNodes*NODE_POINTS);
+    this->vChildren.reserve(szNumNodes*MAX_CHILDREN);
+    this->vNChildren.reserve(szNumNodes);
+    this->vFaces.reserve(szNumNodes);
+    this->vFaceNode.reserve(2*szNumPoints + 2);
+
+    if (isHugePages)
+    {
+        HugePages::advise(this->vPoints);
+        HugePages::advise(this->vChildren);
+        HugePages::advise(this->vFaces);
+    }
 }
 
 
@@ -113,6 +228,19 @@ void Graph::getVertices(int node_Index, int &index1, int &index2, int &index3)
 void Graph::reset()
 {
 	// Reset vectors
-	this->vNodes.clear();
+	this->vPoints.clear();
+	this->vChildren.clear();
+	this->vNChildren.clear();
+	this->vFaces.clear();
     this->vFaceNode.clear();
 }
+
+
+void Graph::swap(Graph &other)
+{
+    this->vFaceNode.swap(other.vFaceNode);
+    this->vPoints.swap(other.vPoints);
+    this->vChildren.swap(other.vChildren);
+    this->vNChildren.swap(other.vNChildren);
+    this->vFaces.swap(other.vFaces);
+}
@@ -0,0 +1,61 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "Logging.h"
+#include "MappedGraph.h"
+#include "MappedLayout.h"
+
+
+/***********************************************************************************************************************
+* Public methods definitions
+***********************************************************************************************************************/
+bool MappedGraph::open(const string &strFileName)
+{
+    this->close();
+    if (!this->file.open(strFileName))
+    {
+        return false;
+    }
+
+    vector<size_t> vElementSizes(MAPPED_GRAPH_NUM_SECTIONS, sizeof(int));
+    vElementSizes[MAPPED_GRAPH_NCHILDREN] = sizeof(unsigned char);
+    const MappedHeader *header = MappedLayout::check(this->file.getData(), this->file.getSize(), MAPPED_GRAPH_MAGIC,
+                                                     vElementSizes);
+
+    // Every node has NODE_POINTS points and MAX_CHILDREN children slots
+    const MappedSection *sections = (header != nullptr) ? header->arrSections : nullptr;
+    size_t szNumNodes = (sections != nullptr) ? sections[MAPPED_GRAPH_FACES].count : 0;
+    if ((sections == nullptr) || (sections[MAPPED_GRAPH_POINTS].count != szNumNodes*NODE_POINTS) ||
+        (sections[MAPPED_GRAPH_CHILDREN].count != szNumNodes*MAX_CHILDREN) ||
+        (sections[MAPPED_GRAPH_NCHILDREN].count != szNumNodes))
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Invalid mapped graph file: ");
+        Logging::buildText(__FUNCTION__, __FILE__, strFileName);
+        Logging::write(true, Error);
+        this->close();
+        return false;
+    }
+
+    const char *data = this->file.getData();
+    this->faceNode = (const int *) &data[sections[MAPPED_GRAPH_FACE_NODE].offset];
+    this->points = (const int *) &data[sections[MAPPED_GRAPH_POINTS].offset];
+    this->children = (const int *) &data[sections[MAPPED_GRAPH_CHILDREN].offset];
+    this->nChildren = (const unsigned char *) &data[sections[MAPPED_GRAPH_NCHILDREN].offset];
+    this->faces = (const int *) &data[sections[MAPPED_GRAPH_FACES].offset];
+    this->szNumNodes = szNumNodes;
+    this->szNumFaces = sections[MAPPED_GRAPH_FACE_NODE].count;
+    return true;
+}
+
+
+void MappedGraph::close()
+{
+    this->file.close();
+    this->faceNode = nullptr;
+    this->points = nullptr;
+    this->children = nullptr;
+    this->nChildren = nullptr;
+    this->faces = nullptr;
+    this->szNumNodes = 0;
+    this->szNumFaces = 0;
+}
@@ -3,6 +3,7 @@
 ***********************************************************************************************************************/
 #include "Node.h"
 
+#include <algorithm>
 #include <string>
 #include <stdexcept>
 using namespace std;
@@ -11,42 +12,58 @@ using namespace std;
 /***********************************************************************************************************************
 * Public methods definitions
 ***********************************************************************************************************************/
+Node::Node(vector<int> &vPointsIn, int faceIn) : Node()
+{
+    this->nPoints = std::min<int>(vPointsIn.size(), NODE_POINTS);
+    std::copy(vPointsIn.begin(), vPointsIn.begin() + this->nPoints, this->arrPointsId);
+    this->face = faceIn;
+}
+
+
+Node::Node(vector<int> &vChildrenIn, vector<int> &vPointsIn, int faceIn) : Node(vPointsIn, faceIn)
+{
+    this->nChildren = std::min<int>(vChildrenIn.size(), MAX_CHILDREN);
+    std::copy(vChildrenIn.begin(), vChildrenIn.begin() + this->nChildren, this->arrChildren);
+}
+
+
 void Node::setChildren(int id1, int id2)
 {
-    vChildren.clear();
-    vChildren.push_back(id1);
-    vChildren.push_back(id2);
+    nChildren = TWO;
+    arrChildren[0] = id1;
+    arrChildren[1] = id2;
+    arrChildren[2] = INVALID;
 }
 
 
 void Node::setChildren(int id1, int id2, int id3)
 {
-    vChildren.clear();
-    vChildren.push_back(id1);
-    vChildren.push_back(id2);
-    vChildren.push_back(id3);
+    nChildren = MAX_CHILDREN;
+    arrChildren[0] = id1;
+    arrChildren[1] = id2;
+    arrChildren[2] = id3;
 }
 
 
-int Node::getiChild(int index)
+int Node::getiChild(int index) const
 {
-    if (vChildren.empty() || (index > (getNChildren()-1)))
+    if ((index < 0) || (index > (getNChildren()-1)))
     {
         string srtMsg = &"Error accessing node child " [ (index+1)];
         throw std::runtime_error(srtMsg);
     }
 
-    return vChildren.at(index);
+    return arrChildren[index];
 }
 
 
-int Node::getiPoint(int index)
+int Node::getiPoint(int index) const
 {
-    if (vPointsId.empty() || (index > NODE_POINTS))
+    if ((index < 0) || (index >= nPoints))
     {
         string srtMsg = &"Error accessing node point " [ (index+1)];
         throw std::runtime_error(srtMsg);
     }
 
-    return vPointsId.at(index);
+    return arrPointsId[index];
 }
@@ -25,16 +25,16 @@ void NodeIO::print(Node &node, std::ostream& out)
         // Print node data.
     else
     {
-        out << "Node has " << node.vChildren.size() << " children: ";
-        for (auto value : node.vChildren)
+        out << "Node has " << node.nChildren << " children: ";
+        for (int i=0; i<node.nChildren; i++)
         {
-            out << value << " ";
+            out << node.arrChildren[i] << " ";
         }
     }
     out << ". Node points: ";
-    for (auto value : node.vPointsId)
+    for (int i=0; i<node.nPoints; i++)
     {
-        out << value << " ";
+        out << node.arrPointsId[i] << " ";
     }
     out << ". Assigned face " << node.face;
 }
@@ -54,17 +54,21 @@ void NodeIO::read(Node &node, std::istream& in)
     // Write node points.
     for (size_t i=0; i<NODE_POINTS; i++)
     {
-        in >> iValue;
-        node.vPointsId.push_back(iValue);
+        in >> node.arrPointsId[i];
     }
+    node.nPoints = NODE_POINTS;
 
     // Write node children.
     in >> iValue;
+    node.nChildren = 0;
     for (size_t  i=0; i<iValue; i++)
     {
         int iChild;
         in >> iChild;
-        node.vChildren.push_back(iChild);
+        if (i < MAX_CHILDREN)
+        {
+            node.arrChildren[node.nChildren++] = iChild;
+        }
     }
 
     // Write node face.
@@ -86,14 +90,14 @@ void NodeIO::write(Node &node, std::ostream& out)
     // Write node points.
     for (i=0; i<NODE_POINTS; i++)
     {
-        out << node.vPointsId.at(i) << " ";
+        out << node.arrPointsId[i] << " ";
     }
 
     // Write node children.
-    out << node.vChildren.size() << " ";
-    for (i=0; i<MAX_CHILDREN; i++)
+    out << node.nChildren << " ";
+    for (i=0; i<node.nChildren; i++)
     {
-        out << node.vChildren.at(i) << " ";
+        out << node.arrChildren[i] << " ";
     }
 
     // Write node face.
@@ -1,14 +1,17 @@
 /***********************************************************************************************************************
 * Includes
 ***********************************************************************************************************************/
-#include "Circle.h"
 #include "defines.h"
 #include "Logging.h"
+#include "Parallel.h"
+#include "Predicates.h"
 #include "Stack.h"
 #include "StarTriangulation.h"
 
+#include <algorithm>
 #include <cfloat>
 #include <queue>
+#include <thread>
 
 
 /***********************************************************************************************************************
@@ -33,6 +36,7 @@ struct ConvexPoint
 
 
 
+
 /***********************************************************************************************************************
 * Public methods definitions
 ***********************************************************************************************************************/
@@ -53,7 +57,7 @@ bool StarTriangulation::convexHull()
 		this->hull.reset();
 
         Point<TYPE> *point;			// Current point
-        Edge 	*currentEdge;		// Current edge
+        EdgeRef currentEdge;		// Current edge
 		while (!isHullBuilt)
 		{
 			// Get edge info.
@@ -437,6 +441,7 @@ bool StarTriangulation::build()
 
 	// Reset convex hull computed flag and set dcel.
 	this->reset();
+	this->dcel.reserveTriangulation(this->dcel.getNumVertex());
 
 	// Set lowest Y coordinates point first.
 	lowestPointIndex = this->dcel.getIndexLowest(&Point<TYPE>::lowerY);
@@ -678,24 +683,44 @@ bool StarTriangulation::build()
 	return isBuilt;
 }
 
+bool StarTriangulation::delaunay(size_t szNumThreads)
+{
+	// Use all available cores if number of threads not set
+	if (szNumThreads == 0)
+	{
+		szNumThreads = std::thread::hardware_concurrency();
+		if (szNumThreads == 0)
+		{
+			szNumThreads = 1;
+		}
+	}
+
+	if (szNumThreads == 1)
+	{
+		return this->sequentialDelaunay();
+	}
+
+	return this->parallelDelaunay(szNumThreads);
+}
+
+
 /***************************************************************************
-* Name: 		delaunay
+* Name: 		sequentialDelaunay
 * IN:			NONE
 * OUT:			NONE
 * RETURN:		true if the delaunay triangulation has been computed.
 * 				false otherwise
 * GLOBAL:		NONE
 * Description: 	transforms the star triangulation into a Delaunay
-* 				triangulation.
+* 				triangulation sweeping edges sequentially.
 ***************************************************************************/
-bool StarTriangulation::delaunay()
+bool StarTriangulation::sequentialDelaunay()
 {
 	// PENDING TO CHECK ERROR WHILE BUILDING DELAUNAY.
 	bool	built=true;			// Return value.
 	int		edgeIndex=0;		// Edge index.
-	int		originPoint;		// Origin point.
-	Edge	*edge;				// Pointer to current edge.
-	Edge	*twin;				// Pointer to twin edge of current edge.
+	EdgeRef	edge;				// Reference to current edge.
+	EdgeRef	twin;				// Reference to twin edge of current edge.
 #ifdef STATISTICS_STAR_TRIANGULATION
 	this->nFlips = 0;
 #endif
@@ -730,13 +755,6 @@ bool StarTriangulation::delaunay()
 			// Check edge is not in convex hull.
 			if (!this->dcel.isExternalEdge(edgeIndex))
 			{
-				// Create face circle.
-				vector<Point<TYPE>> vPoints;
-                vPoints.push_back(*this->dcel.getRefPoint(edge->getOrigin()-1));
-                vPoints.push_back(*this->dcel.getRefPoint(this->dcel.getOrigin(edge->getNext()-1)-1));
-                vPoints.push_back(*this->dcel.getRefPoint(this->dcel.getOrigin(edge->getPrevious()-1)-1));
-				Circle circle = Circle(vPoints);
-
 				// Get twin edge.
 				twin = this->dcel.getRefEdge(this->dcel.getTwin(edgeIndex)-1);
 #ifdef DEBUG_TRIANGULATION_DELAUNAY
@@ -753,7 +771,7 @@ bool StarTriangulation::delaunay()
 #endif
 
 				// Check if remaining point from adjacent face is in circle.
-				if (circle.inCircle(*this->dcel.getRefPoint(this->dcel.getOrigin(twin->getPrevious()-1)-1)))
+				if (this->isIllegalEdge(edgeIndex))
 				{
 #ifdef STATISTICS_STAR_TRIANGULATION
 					this->nFlips++;
@@ -771,34 +789,8 @@ bool StarTriangulation::delaunay()
 					this->dcel.updateVertex(twin->getNext(), edge->getOrigin()-1);
 					this->dcel.updateVertex(edge->getNext(), twin->getOrigin()-1);
 
-					// Update origin of current and twin edges.
-					originPoint = this->dcel.getOrigin(edge->getPrevious()-1);
-					this->dcel.setOrigin(twin->getTwin()-1, this->dcel.getOrigin(twin->getPrevious()-1));
-					this->dcel.setOrigin(edge->getTwin()-1, originPoint);
-
-					// Update next edges.
-					this->dcel.setNext(edge->getNext()-1, edge->getTwin());
-					this->dcel.setNext(twin->getNext()-1, twin->getTwin());
-					this->dcel.setNext(edge->getPrevious()-1, twin->getNext());
-					this->dcel.setNext(twin->getPrevious()-1, edge->getNext());
-					this->dcel.setNext(twin->getTwin()-1, this->dcel.getPrevious(twin->getTwin()-1));
-					this->dcel.setNext(edge->getTwin()-1, this->dcel.getPrevious(edge->getTwin()-1));
-
-					// Update previous edges.
-					this->dcel.setPrevious(twin->getTwin()-1, this->dcel.getNext(edge->getNext()-1));
-					this->dcel.setPrevious(edge->getTwin()-1, this->dcel.getNext(twin->getNext()-1));
-					this->dcel.setPrevious(edge->getNext()-1, this->dcel.getNext(edge->getPrevious()-1));
-					this->dcel.setPrevious(twin->getNext()-1, this->dcel.getNext(twin->getPrevious()-1));
-					this->dcel.setPrevious(edge->getPrevious()-1, this->dcel.getNext(twin->getTwin()-1));
-					this->dcel.setPrevious(twin->getPrevious()-1, this->dcel.getNext(edge->getTwin()-1));
-
-					// Update faces in edges.
-					this->dcel.setFace(edge->getPrevious()-1, edge->getFace());
-					this->dcel.setFace(twin->getPrevious()-1, twin->getFace());
-
-					// Update faces.
-					this->dcel.updateFace(twin->getTwin(), edge->getFace());
-					this->dcel.updateFace(edge->getTwin(), twin->getFace());
+					// Flip edge and its twin.
+					this->flipEdge(edgeIndex);
 
 					// Update pending edges.
 					edgeChecked[edgeIndex] = true;
@@ -921,3 +913,193 @@ bool StarTriangulation::setNotChecked(int index, bool *isEdgeChecked)
 
 	return(updated);
 }
+
+
+/**
+ * @fn			isIllegalEdge
+ * @brief		checks if the point of the twin face that is not in the edge is inside the circle of the edge face
+ *
+ * @param edgeIndex			(IN)	Edge index. Edge and its twin must not be in external face
+ *
+ * @return		true if edge must be flipped
+ * 				false otherwise
+ */
+bool StarTriangulation::isIllegalEdge(int edgeIndex)
+{
+	Point<TYPE> *p1 = this->dcel.getRefPoint(this->dcel.getOrigin(edgeIndex)-1);
+	Point<TYPE> *p2 = this->dcel.getRefPoint(this->dcel.getOrigin(this->dcel.getNext(edgeIndex)-1)-1);
+	Point<TYPE> *p3 = this->dcel.getRefPoint(this->dcel.getOrigin(this->dcel.getPrevious(edgeIndex)-1)-1);
+
+	int twinIndex = this->dcel.getTwin(edgeIndex)-1;
+	Point<TYPE> *q = this->dcel.getRefPoint(this->dcel.getOrigin(this->dcel.getPrevious(twinIndex)-1)-1);
+
+	return Predicates::inCircle(*p1, *p2, *p3, *q);
+}
+
+
+/**
+ * @fn			flipEdge
+ * @brief		replaces the edge and its twin by the other diagonal of the quadrilateral formed by their faces.
+ * 				Only edges and faces of the quadrilateral are updated so vertex edges must be updated by the caller
+ *
+ * @param edgeIndex			(IN)	Edge index. Edge and its twin must not be in external face
+ */
+void StarTriangulation::flipEdge(int edgeIndex)
+{
+	EdgeRef	edge = this->dcel.getRefEdge(edgeIndex);
+	EdgeRef	twin = this->dcel.getRefEdge(edge->getTwin()-1);
+
+	// Update origin of current and twin edges.
+	int originPoint = this->dcel.getOrigin(edge->getPrevious()-1);
+	this->dcel.setOrigin(twin->getTwin()-1, this->dcel.getOrigin(twin->getPrevious()-1));
+	this->dcel.setOrigin(edge->getTwin()-1, originPoint);
+
+	// Update next edges.
+	this->dcel.setNext(edge->getNext()-1, edge->getTwin());
+	this->dcel.setNext(twin->getNext()-1, twin->getTwin());
+	this->dcel.setNext(edge->getPrevious()-1, twin->getNext());
+	this->dcel.setNext(twin->getPrevious()-1, edge->getNext());
+	this->dcel.setNext(twin->getTwin()-1, this->dcel.getPrevious(twin->getTwin()-1));
+	this->dcel.setNext(edge->getTwin()-1, this->dcel.getPrevious(edge->getTwin()-1));
+
+	// Update previous edges.
+	this->dcel.setPrevious(twin->getTwin()-1, this->dcel.getNext(edge->getNext()-1));
+	this->dcel.setPrevious(edge->getTwin()-1, this->dcel.getNext(twin->getNext()-1));
+	this->dcel.setPrevious(edge->getNext()-1, this->dcel.getNext(edge->getPrevious()-1));
+	this->dcel.setPrevious(twin->getNext()-1, this->dcel.getNext(twin->getPrevious()-1));
+	this->dcel.setPrevious(edge->getPrevious()-1, this->dcel.getNext(twin->getTwin()-1));
+	this->dcel.setPrevious(twin->getPrevious()-1, this->dcel.getNext(edge->getTwin()-1));
+
+	// Update faces in edges.
+	this->dcel.setFace(edge->getPrevious()-1, edge->getFace());
+	this->dcel.setFace(twin->getPrevious()-1, twin->getFace());
+
+	// Update faces.
+	this->dcel.updateFace(twin->getTwin(), edge->getFace());
+	this->dcel.updateFace(edge->getTwin(), twin->getFace());
+}
+
+
+/**
+ * @fn			parallelDelaunay
+ * @brief		transforms the star triangulation into a Delaunay triangulation in rounds. Every round computes the in
+ * 				circle test of all candidate edges in parallel. Then illegal edges whose triangles are not used by any
+ * 				other flip of the round are flipped in parallel. The remaining illegal edges and the edges around the
+ * 				flipped quadrilaterals are the candidates of the next round. It finishes when no illegal edge remains
+ *
+ * @param szNumThreads		(IN)	Number of threads
+ *
+ * @return		true if the delaunay triangulation has been computed.
+ * 				false otherwise
+ */
+bool StarTriangulation::parallelDelaunay(size_t szNumThreads)
+{
+	int nEdges = this->dcel.getNumEdges();
+#ifdef STATISTICS_STAR_TRIANGULATION
+	this->nFlips = 0;
+#endif
+
+	// Initial candidates are all internal edges. Only the lowest edge of every twin pair is stored.
+	vector<int> vCandidates;
+	vCandidates.reserve(nEdges/2);
+	for (int edgeIndex=0; edgeIndex<nEdges ;edgeIndex++)
+	{
+		if ((edgeIndex < this->dcel.getTwin(edgeIndex)-1) && !this->dcel.isExternalEdge(edgeIndex))
+		{
+			vCandidates.push_back(edgeIndex);
+		}
+	}
+
+	vector<char> vIllegal;				// In circle test result of every candidate.
+	vector<int> vNextCandidates;		// Candidates of the next round.
+	vector<int> vBatch;					// Edges flipped in current round.
+	vector<int> vVertexEdges;			// New edge of the two vertices of every flipped edge.
+	vector<int> vFaceRound(this->dcel.getNumFaces(), 0);	// Last round that flipped an edge of every face.
+	vector<int> vEdgeRound(nEdges, 0);						// Last round that added every edge as candidate.
+	int round=0;
+
+	while (!vCandidates.empty())
+	{
+		round++;
+
+		// Check all candidates.
+		vIllegal.assign(vCandidates.size(), false);
+		Parallel::runChunks(vCandidates.size(), STAR_MIN_EDGES_THREAD, szNumThreads, [&](size_t first, size_t last)
+		{
+			for (size_t i=first; i<last ;i++)
+			{
+				vIllegal[i] = this->isIllegalEdge(vCandidates[i]);
+			}
+			return true;
+		});
+
+		// Select illegal edges that do not share triangles. Conflicting edges are checked again in next round.
+		vBatch.clear();
+		vNextCandidates.clear();
+		for (size_t i=0; i<vCandidates.size() ;i++)
+		{
+			if (vIllegal[i])
+			{
+				int edgeIndex = vCandidates[i];
+				int face = this->dcel.getFace(edgeIndex);
+				int twinFace = this->dcel.getFace(this->dcel.getTwin(edgeIndex)-1);
+				if ((vFaceRound[face] != round) && (vFaceRound[twinFace] != round))
+				{
+					vFaceRound[face] = round;
+					vFaceRound[twinFace] = round;
+					vBatch.push_back(edgeIndex);
+				}
+				else
+				{
+					vEdgeRound[edgeIndex] = round;
+					vNextCandidates.push_back(edgeIndex);
+				}
+			}
+		}
+#ifdef STATISTICS_STAR_TRIANGULATION
+		this->nFlips += (int) vBatch.size();
+#endif
+
+		// Flip edges. Vertices can be shared by several flips so their edges are updated after all flips.
+		vVertexEdges.resize(2*vBatch.size());
+		Parallel::runChunks(vBatch.size(), STAR_MIN_EDGES_THREAD, szNumThreads, [&](size_t first, size_t last)
+		{
+			for (size_t i=first; i<last ;i++)
+			{
+				int edgeIndex = vBatch[i];
+				int twinIndex = this->dcel.getTwin(edgeIndex)-1;
+				vVertexEdges[2*i] = this->dcel.getNext(twinIndex);
+				vVertexEdges[2*i+1] = this->dcel.getNext(edgeIndex);
+				this->flipEdge(edgeIndex);
+			}
+			return true;
+		});
+
+		for (size_t i=0; i<vBatch.size() ;i++)
+		{
+			// Flipped edges are not origin of any of their previous vertices.
+			this->dcel.updateVertex(vVertexEdges[2*i], this->dcel.getOrigin(vVertexEdges[2*i]-1)-1);
+			this->dcel.updateVertex(vVertexEdges[2*i+1], this->dcel.getOrigin(vVertexEdges[2*i+1]-1)-1);
+
+			// Edges of the new quadrilateral must be checked again.
+			int edgeIndex = vBatch[i];
+			int twinIndex = this->dcel.getTwin(edgeIndex)-1;
+			int vQuadEdges[] = {this->dcel.getPrevious(edgeIndex)-1, this->dcel.getNext(edgeIndex)-1,
+								this->dcel.getPrevious(twinIndex)-1, this->dcel.getNext(twinIndex)-1};
+			for (int quadEdge : vQuadEdges)
+			{
+				quadEdge = min(quadEdge, this->dcel.getTwin(quadEdge)-1);
+				if ((vEdgeRound[quadEdge] != round) && !this->dcel.isExternalEdge(quadEdge))
+				{
+					vEdgeRound[quadEdge] = round;
+					vNextCandidates.push_back(quadEdge);
+				}
+			}
+		}
+
+		vCandidates.swap(vNextCandidates);
+	}
+
+	this->nPending = 0;
+	return true;
+}
@@ -0,0 +1,983 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "SweepHullDelaunay.h"
+#include "Logging.h"
+#include "TriangleMesh.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <thread>
+
+
+/***********************************************************************************************************************
+* Public methods definitions
+***********************************************************************************************************************/
+SweepHullDelaunay::SweepHullDelaunay(vector<Point<TYPE>> &vPoints, size_t szNumThreadsIn) :
+                    Triangulation(vPoints), szNumThreads(szNumThreadsIn), szNumInside(0), isBuilt(false)
+{
+    // Use all available cores if number of threads not set
+    if (szNumThreads == 0)
+    {
+        szNumThreads = std::thread::hardware_concurrency();
+        if (szNumThreads == 0)
+        {
+            szNumThreads = 1;
+        }
+    }
+}
+
+
+bool SweepHullDelaunay::build()
+{
+    // Reset previous triangulation (if any)
+    this->dcel.reset(false);
+    this->hull.reset();
+    this->szNumInside = 0;
+    this->isBuilt = false;
+
+    // Check minimum number of points
+    size_t szNumPoints = this->dcel.getNumVertex();
+    if (szNumPoints < NPOINTS_TRIANGLE)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Number of points must be at least 3 and it is ");
+        Logging::buildText(__FUNCTION__, __FILE__, szNumPoints);
+        Logging::write(true, Error);
+        return false;
+    }
+    vPoints.clear();
+    this->dcel.getPoints(vPoints);
+
+    // Get first triangle and sort points by distance to its circumcenter
+    int first=INVALID, second=INVALID, third=INVALID;
+    if (!findSeed(first, second, third) || !sortPoints())
+    {
+        return false;
+    }
+
+    // A triangulation of n points has at most 2n-5 triangles
+    size_t szMaxEdges = NPOINTS_TRIANGLE*(2*szNumPoints - 5);
+    vCorners.clear();
+    vTwins.clear();
+    vCorners.reserve(szMaxEdges);
+    vTwins.reserve(szMaxEdges);
+    vHullNext.assign(szNumPoints, INVALID);
+    vHullPrevious.assign(szNumPoints, INVALID);
+    vHullEdge.assign(szNumPoints, INVALID);
+    vHullHash.assign((size_t) std::ceil(std::sqrt((double) szNumPoints)), INVALID);
+
+    // Initial convex hull is the seed triangle
+    addTriangle(first, second, third, INVALID, INVALID, INVALID);
+    vHullNext[first] = second;
+    vHullNext[second] = third;
+    vHullNext[third] = first;
+    vHullPrevious[first] = third;
+    vHullPrevious[second] = first;
+    vHullPrevious[third] = second;
+    vHullEdge[first] = 0;
+    vHullEdge[second] = 1;
+    vHullEdge[third] = 2;
+    vHullHash[getHashKey(vPoints[first])] = first;
+    vHullHash[getHashKey(vPoints[second])] = second;
+    vHullHash[getHashKey(vPoints[third])] = third;
+
+    // Add points in increasing distance order
+    bool isSuccess=true;
+    for (size_t i=0; (i<vSortedIndex.size()) && isSuccess ;i++)
+    {
+        int pointIndex = vSortedIndex[i];
+        if ((pointIndex != first) && (pointIndex != second) && (pointIndex != third))
+        {
+            isSuccess = insertPoint(pointIndex);
+        }
+    }
+
+    // Copy triangles into Dcel using 1-based identifiers
+    if (isSuccess)
+    {
+        for (size_t i=0; i<vCorners.size() ;i++)
+        {
+            vCorners[i]++;
+            vTwins[i] = (vTwins[i] == INVALID) ? NO_TWIN : vTwins[i] + 1;
+        }
+
+        TriangleMesh mesh;
+        mesh.set(vPoints, vCorners, vTwins);
+        isSuccess = mesh.toDcel(this->dcel);
+    }
+
+    // Free temporary resources
+    vector<Point<TYPE>>().swap(vPoints);
+    vector<double>().swap(vDistance);
+    vector<int>().swap(vSortedIndex);
+    vector<int>().swap(vCorners);
+    vector<int>().swap(vTwins);
+    vector<int>().swap(vHullNext);
+    vector<int>().swap(vHullPrevious);
+    vector<int>().swap(vHullEdge);
+    vector<int>().swap(vHullHash);
+    vector<int>().swap(vEdgeStack);
+
+    this->isBuilt = isSuccess;
+    return isSuccess;
+}
+
+
+bool SweepHullDelaunay::convexHull()
+{
+    // Check triangulation exists
+    if (!isBuilt)
+    {
+        return false;
+    }
+
+    // Loop edges in external face
+    this->hull.reset();
+    int iFirstIdx = this->dcel.getFaceEdge(EXTERNAL_FACE) - 1;
+    int iCurrentIdx = iFirstIdx;
+    do
+    {
+        // Insert edge origin point
+        this->hull.add(*this->dcel.getRefPoint(this->dcel.getOrigin(iCurrentIdx)-1), iCurrentIdx+1);
+
+        // Get next edge.
+        iCurrentIdx = this->dcel.getNext(iCurrentIdx) - 1;
+    } while (iCurrentIdx != iFirstIdx);
+
+    return this->isConvexHullComputed();
+}
+
+
+/***************************************************************************
+* Name: 	findTwoClosest
+* IN:		NONE
+* OUT:		p		one of the closest points.
+* 			q		the other of the closest points.
+* RETURN:	true	if two closest points found.
+* 			false	i.o.c.
+* GLOBAL:	NONE
+* Description: 	the two closest points are a vertex and its nearest
+* 				neighbour so the result is the lowest distance of all
+* 				nearest neighbours computed in parallel.
+***************************************************************************/
+bool SweepHullDelaunay::findTwoClosest(Point<TYPE> &p, Point<TYPE> &q)
+{
+    return this->isBuilt && this->reduceTwoClosest(p, q);
+}
+
+
+bool SweepHullDelaunay::findFace(Point<TYPE> &origin, int &faceId)
+{
+    // Check there is at least one triangle
+    if (!isBuilt || (this->dcel.getNumFaces() <= 1))
+    {
+        faceId = EXTERNAL_FACE;
+        return isBuilt;
+    }
+
+    // Walk from first face towards point
+    int iEdgeIdx = this->dcel.getFaceEdge(1) - 1;
+    bool isFound=false;
+    while (!isFound)
+    {
+        // Check if point is at the right of any of the edges of current face
+        bool isMoved=false;
+        for (int i=0; (i<NPOINTS_TRIANGLE) && !isMoved ;i++)
+        {
+            Point<TYPE> *p = this->dcel.getRefPoint(this->dcel.getOrigin(iEdgeIdx)-1);
+            int iTwinIdx = this->dcel.getTwin(iEdgeIdx) - 1;
+            Point<TYPE> *q = this->dcel.getRefPoint(this->dcel.getOrigin(iTwinIdx)-1);
+            if (Predicates::turn(*p, *q, origin) == RIGHT_TURN)
+            {
+                // Point is out of convex hull
+                if (this->dcel.getFace(iTwinIdx) == EXTERNAL_FACE)
+                {
+                    faceId = EXTERNAL_FACE;
+                    return true;
+                }
+
+                // Move to adjacent face skipping the edge already checked
+                iEdgeIdx = this->dcel.getNext(iTwinIdx) - 1;
+                isMoved = true;
+            }
+            else
+            {
+                iEdgeIdx = this->dcel.getNext(iEdgeIdx) - 1;
+            }
+        }
+
+        isFound = !isMoved;
+    }
+
+    faceId = this->dcel.getFace(iEdgeIdx);
+    return true;
+}
+
+
+/***************************************************************************
+* Name: 	findClosestPoint
+* IN:		in			input point whose closest is going to be located.
+* 			voronoi		not used.
+* OUT:		out			closest point to p
+* 			pointIndex 	index of the point in the DCEL.
+* RETURN:	true		if closest point found.
+* 			false		i.o.c.
+* GLOBAL:	NONE
+* Description: 	greedy walk through the triangulation. Every vertex that is
+* 				not the closest has a neighbor closer to the input point.
+***************************************************************************/
+bool SweepHullDelaunay::findClosestPoint(Point<TYPE> &in, Voronoi *voronoi, Point<TYPE> &out, int &pointIndex)
+{
+    if (!isBuilt)
+    {
+        return false;
+    }
+
+    // Start at first point
+    pointIndex = 0;
+    TYPE lowestDistance = in.distance(*this->dcel.getRefPoint(pointIndex));
+    bool isMoved=true;
+    while (isMoved)
+    {
+        isMoved = false;
+
+        // Check all neighbors of current point
+        int iCurrentPoint = pointIndex;
+        int iFirstEdgeIdx = this->dcel.getPointEdge(iCurrentPoint) - 1;
+        int iEdgeIdx = iFirstEdgeIdx;
+        do
+        {
+            int iDestIdx = this->dcel.getOrigin(this->dcel.getTwin(iEdgeIdx)-1) - 1;
+            TYPE distance = in.distance(*this->dcel.getRefPoint(iDestIdx));
+            if (distance < lowestDistance)
+            {
+                lowestDistance = distance;
+                pointIndex = iDestIdx;
+                isMoved = true;
+            }
+
+            // Get next edge departing from current point
+            iEdgeIdx = this->dcel.getTwin(this->dcel.getPrevious(iEdgeIdx)-1) - 1;
+        } while (iEdgeIdx != iFirstEdgeIdx);
+    }
+
+    out = *this->dcel.getRefPoint(pointIndex);
+    return true;
+}
+
+
+bool SweepHullDelaunay::findPath(Point<TYPE> &origin, Point<TYPE> &dest, vector<int> &vFacesId)
+{
+    bool found=false;
+
+    // Initialize output
+    vFacesId.clear();
+
+    // Build line whose path must be computed
+    Line line(origin, dest);
+
+    // Get extreme point faces.
+    int	 originFace=0;
+    int	 destinationFace=0;
+    if (this->findFace(origin, originFace) && this->findFace(dest, destinationFace))
+    {
+        bool computePath=false;
+        vector<int> vFaces;
+
+        // Add non external faces to set.
+        if (originFace != EXTERNAL_FACE)
+        {
+            vFaces.push_back(originFace);
+            computePath = true;
+        }
+
+        if (destinationFace != EXTERNAL_FACE)
+        {
+            vFaces.push_back(destinationFace);
+            computePath = true;
+        }
+
+        // Check if any of the faces is external to convex hull.
+        if (vFaces.size() != 2)
+        {
+            // Check if convex hull has not been computed.
+            if (!this->isConvexHullComputed())
+            {
+                this->convexHull();
+            }
+
+            vector<int> vEdges;
+            getConvexFacesIntersections(line, vFaces, vEdges);
+
+            // If vFaces is empty -> both points are external and there is no intersection with convex hull
+            if (vFaces.empty())
+            {
+                found = true;
+            }
+            else
+            {
+                computePath = true;
+            }
+        }
+
+        // If both points are external -> no path to compute.
+        if (computePath)
+        {
+            found = this->dcel.findPath(vFaces, line, vFacesId);
+        }
+    }
+
+    return found;
+}
+
+
+/***********************************************************************************************************************
+* Private methods definitions
+***********************************************************************************************************************/
+/**
+ * @fn      getParallelDepth
+ * @brief   Computes the number of sort levels whose halves are sorted in parallel
+ *
+ * @return  number of levels
+ */
+int SweepHullDelaunay::getParallelDepth() const
+{
+    int depth=0;
+    while ((size_t(1) << depth) < szNumThreads)
+    {
+        depth++;
+    }
+
+    return depth;
+}
+
+
+/**
+ * @fn      findSeed
+ * @brief   Gets the first triangle. First point is the closest to the bounding box center and second point is its
+ *          nearest neighbor so both define a Delaunay edge. Third point is the point at the left of the edge that
+ *          makes an empty circle, so the seed triangle is a Delaunay triangle.
+ *
+ * @param   first   (OUT)   First point of the seed triangle
+ * @param   second  (OUT)   Second point of the seed triangle
+ * @param   third   (OUT)   Third point of the seed triangle. Seed triangle is counterclockwise
+ * @return  true if seed triangle found
+ *          false if first point is duplicated or all points are collinear
+ */
+bool SweepHullDelaunay::findSeed(int &first, int &second, int &third)
+{
+    // Get bounding box center
+    TYPE minX=vPoints[0].getX(), maxX=vPoints[0].getX();
+    TYPE minY=vPoints[0].getY(), maxY=vPoints[0].getY();
+    for (auto &point : vPoints)
+    {
+        minX = min(minX, point.getX());
+        maxX = max(maxX, point.getX());
+        minY = min(minY, point.getY());
+        maxY = max(maxY, point.getY());
+    }
+    Point<TYPE> boxCenter((minX + maxX)/2, (minY + maxY)/2);
+
+    // Get closest point to center and its nearest neighbor
+    first = 0;
+    for (int i=1; i<(int) vPoints.size() ;i++)
+    {
+        if (vPoints[i].distance(boxCenter) < vPoints[first].distance(boxCenter))
+        {
+            first = i;
+        }
+    }
+
+    second = INVALID;
+    for (int i=0; i<(int) vPoints.size() ;i++)
+    {
+        if ((i != first) && ((second == INVALID) ||
+                             (vPoints[i].distance(vPoints[first]) < vPoints[second].distance(vPoints[first]))))
+        {
+            second = i;
+        }
+    }
+
+    if (vPoints[first] == vPoints[second])
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Duplicated points at indexes ");
+        Logging::buildText(__FUNCTION__, __FILE__, first);
+        Logging::buildText(__FUNCTION__, __FILE__, " and ");
+        Logging::buildText(__FUNCTION__, __FILE__, second);
+        Logging::write(true, Error);
+        return false;
+    }
+
+    // Parts at the left of the edge of the circles through first and second points are nested, so a left point
+    // inside the circle of the current candidate replaces it. Last candidate maximizes the angle first-third-second
+    // (not the radius) and its circle has no left point inside, so it is empty because first-second is a Delaunay
+    // edge. Check right side if left side is empty
+    third = INVALID;
+    for (int side=0; (side<2) && (third == INVALID) ;side++)
+    {
+        if (side == 1)
+        {
+            swap(first, second);
+        }
+
+        for (int i=0; i<(int) vPoints.size() ;i++)
+        {
+            if (Predicates::orient(vPoints[first], vPoints[second], vPoints[i]) > 0.0)
+            {
+                if ((third == INVALID) ||
+                    Predicates::inCircle(vPoints[first], vPoints[second], vPoints[third], vPoints[i]))
+                {
+                    third = i;
+                }
+            }
+        }
+    }
+
+    if (third == INVALID)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "All points are collinear");
+        Logging::write(true, Error);
+        return false;
+    }
+
+    // Compute circumcenter
+    double bx = vPoints[second].getX() - vPoints[first].getX();
+    double by = vPoints[second].getY() - vPoints[first].getY();
+    double cx = vPoints[third].getX() - vPoints[first].getX();
+    double cy = vPoints[third].getY() - vPoints[first].getY();
+    double bLength = bx*bx + by*by;
+    double cLength = cx*cx + cy*cy;
+    double det = 2.0*(bx*cy - by*cx);
+    center = Point<TYPE>(vPoints[first].getX() + (cy*bLength - by*cLength)/det,
+                         vPoints[first].getY() + (bx*cLength - cx*bLength)/det);
+
+    return true;
+}
+
+
+/**
+ * @fn      sortPoints
+ * @brief   Sorts points by distance to seed circle center and checks there are no duplicated points. Points at the
+ *          same distance are sorted lexicographically so duplicated points are consecutive.
+ *
+ * @return  true if no duplicated points
+ *          false otherwise
+ */
+bool SweepHullDelaunay::sortPoints()
+{
+    // Compute distances and initialize indexes
+    vDistance.resize(vPoints.size());
+    vSortedIndex.resize(vPoints.size());
+    for (size_t i=0; i<vPoints.size() ;i++)
+    {
+        double dx = vPoints[i].getX() - center.getX();
+        double dy = vPoints[i].getY() - center.getY();
+        vDistance[i] = dx*dx + dy*dy;
+        vSortedIndex[i] = (int) i;
+    }
+
+    // Sort indexes
+    sortRange(0, (int) vSortedIndex.size(), getParallelDepth());
+
+    // Check duplicated points
+    for (size_t i=1; i<vSortedIndex.size() ;i++)
+    {
+        if (vPoints[vSortedIndex[i]] == vPoints[vSortedIndex[i-1]])
+        {
+            Logging::buildText(__FUNCTION__, __FILE__, "Duplicated points at indexes ");
+            Logging::buildText(__FUNCTION__, __FILE__, vSortedIndex[i-1]);
+            Logging::buildText(__FUNCTION__, __FILE__, " and ");
+            Logging::buildText(__FUNCTION__, __FILE__, vSortedIndex[i]);
+            Logging::write(true, Error);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/**
+ * @fn      sortRange
+ * @brief   Sorts indexes in [first, last) range. Both halves are sorted in parallel while depth is not zero.
+ *
+ * @param   first   (IN)    First index position
+ * @param   last    (IN)    Last index position (not included)
+ * @param   depth   (IN)    Number of levels that can still be split in two threads
+ */
+void SweepHullDelaunay::sortRange(int first, int last, int depth)
+{
+    auto compare = [this](int a, int b)
+    {
+        if (vDistance[a] != vDistance[b])
+        {
+            return vDistance[a] < vDistance[b];
+        }
+        return (vPoints[a].getX() < vPoints[b].getX()) ||
+               ((vPoints[a].getX() == vPoints[b].getX()) && (vPoints[a].getY() < vPoints[b].getY()));
+    };
+
+    auto itBegin = vSortedIndex.begin();
+    if ((depth == 0) || ((last - first) < SWEEP_HULL_MIN_POINTS_THREAD))
+    {
+        std::sort(itBegin + first, itBegin + last, compare);
+    }
+    else
+    {
+        int middle = first + (last - first)/2;
+        std::thread thread(&SweepHullDelaunay::sortRange, this, first, middle, depth-1);
+        sortRange(middle, last, depth-1);
+        thread.join();
+        std::inplace_merge(itBegin + first, itBegin + middle, itBegin + last, compare);
+    }
+}
+
+
+/**
+ * @fn      insertPoint
+ * @brief   Joins a point out of the convex hull to all visible convex hull edges and legalizes the new triangles. If
+ *          no convex hull edge is visible then the point is inside the convex hull and it splits the triangle (or
+ *          the edge) that contains it
+ *
+ * @param   pointIndex  (IN)    Point to insert
+ * @return  true if point inserted
+ *          false if point is not out of the convex hull and no triangle contains it
+ */
+bool SweepHullDelaunay::insertPoint(int pointIndex)
+{
+    // Find a hull point close in angle to the new point. Removed hull points are skipped
+    int key = getHashKey(vPoints[pointIndex]);
+    int start=INVALID;
+    for (size_t i=0; i<vHullHash.size() ;i++)
+    {
+        start = vHullHash[(key + i) % vHullHash.size()];
+        if ((start != INVALID) && (vHullNext[start] != start))
+        {
+            break;
+        }
+    }
+
+    // Find first visible edge. Point is inside the convex hull if there is none
+    start = vHullPrevious[start];
+    int edgeStart = start;
+    while (!isVisible(pointIndex, edgeStart, vHullNext[edgeStart]))
+    {
+        edgeStart = vHullNext[edgeStart];
+        if (edgeStart == start)
+        {
+            return insertInside(pointIndex, vHullEdge[start]);
+        }
+    }
+
+    // Add triangle with first visible edge
+    int edgeEnd = vHullNext[edgeStart];
+    int triangle = addTriangle(edgeEnd, edgeStart, pointIndex, vHullEdge[edgeStart], INVALID, INVALID);
+    vHullEdge[edgeStart] = triangle + 1;
+    vHullEdge[pointIndex] = triangle + 2;
+    legalize(triangle);
+
+    // Add triangles with visible edges after first edge
+    while (isVisible(pointIndex, edgeEnd, vHullNext[edgeEnd]))
+    {
+        int next = vHullNext[edgeEnd];
+        triangle = addTriangle(next, edgeEnd, pointIndex, vHullEdge[edgeEnd], vHullEdge[pointIndex], INVALID);
+        vHullEdge[pointIndex] = triangle + 2;
+        vHullNext[edgeEnd] = edgeEnd;
+        legalize(triangle);
+        edgeEnd = next;
+    }
+
+    // Add triangles with visible edges before first edge
+    if (edgeStart == start)
+    {
+        while (isVisible(pointIndex, vHullPrevious[edgeStart], edgeStart))
+        {
+            int previous = vHullPrevious[edgeStart];
+            triangle = addTriangle(edgeStart, previous, pointIndex, vHullEdge[previous], INVALID,
+                                   vHullEdge[edgeStart]);
+            vHullEdge[previous] = triangle + 1;
+            vHullNext[edgeStart] = edgeStart;
+            legalize(triangle);
+            edgeStart = previous;
+        }
+    }
+
+    // Update convex hull
+    vHullPrevious[pointIndex] = edgeStart;
+    vHullNext[pointIndex] = edgeEnd;
+    vHullNext[edgeStart] = pointIndex;
+    vHullPrevious[edgeEnd] = pointIndex;
+    vHullHash[getHashKey(vPoints[pointIndex])] = pointIndex;
+    vHullHash[getHashKey(vPoints[edgeStart])] = edgeStart;
+
+    return true;
+}
+
+
+/**
+ * @fn      insertInside
+ * @brief   Inserts a point inside the convex hull. Distances to the seed circle center are rounded, so a nearly
+ *          collinear point can be sorted after points whose convex hull contains it. Triangle that contains the point
+ *          is split in three triangles, or the two triangles that share the edge that contains the point are split in
+ *          four, and new triangles are legalized
+ *
+ * @param   pointIndex  (IN)    Point to insert
+ * @param   edge        (IN)    Edge whose triangle is the start of the search
+ * @return  true if point inserted
+ *          false if no triangle contains the point
+ */
+bool SweepHullDelaunay::insertInside(int pointIndex, int edge)
+{
+    int triangle=INVALID;
+    int onEdge=INVALID;
+    if (!locateTriangle(pointIndex, edge, triangle, onEdge))
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "No triangle contains point ");
+        Logging::buildText(__FUNCTION__, __FILE__, pointIndex+1);
+        Logging::write(true, Error);
+        return false;
+    }
+
+    if (onEdge == INVALID)
+    {
+        splitTriangle(pointIndex, triangle);
+    }
+    else
+    {
+        splitEdge(pointIndex, onEdge);
+    }
+
+    this->szNumInside++;
+    return true;
+}
+
+
+/**
+ * @fn      locateTriangle
+ * @brief   Walks from the triangle of an edge to the triangle that contains a point. Every step moves to the
+ *          neighbour triangle across an edge that has the point at its right. First edge checked changes every
+ *          step so the walk does not cycle. If the walk takes too many steps then all triangles are checked
+ *
+ * @param   pointIndex  (IN)    Point to locate
+ * @param   edge        (IN)    Edge whose triangle is the start of the walk
+ * @param   triangle    (OUT)   First edge of the triangle that contains the point
+ * @param   onEdge      (OUT)   Edge of the triangle that contains the point. INVALID if point is interior
+ * @return  true if triangle found
+ *          false if point is out of the convex hull or it is equal to a vertex
+ */
+bool SweepHullDelaunay::locateTriangle(int pointIndex, int edge, int &triangle, int &onEdge) const
+{
+    // Checks if triangle contains point starting at its edge "offset". Gets the edge that contains the point (if any)
+    auto isInTriangle = [&](int first, int offset, int &rightEdge)
+    {
+        int numOnEdge=0;
+        rightEdge = INVALID;
+        onEdge = INVALID;
+        for (int i=0; (i<NPOINTS_TRIANGLE) && (rightEdge == INVALID) ;i++)
+        {
+            int current = first + (offset + i) % NPOINTS_TRIANGLE;
+            int next = first + (offset + i + 1) % NPOINTS_TRIANGLE;
+            double orientation = Predicates::orient(vPoints[vCorners[current]], vPoints[vCorners[next]],
+                                                    vPoints[pointIndex]);
+            if (orientation < 0.0)
+            {
+                rightEdge = current;
+            }
+            else if (orientation == 0.0)
+            {
+                onEdge = current;
+                numOnEdge++;
+            }
+        }
+
+        // Point on two edges is a vertex
+        return (rightEdge == INVALID) && (numOnEdge < 2);
+    };
+
+    size_t szNumTriangles = vCorners.size() / NPOINTS_TRIANGLE;
+    int current = edge - edge % NPOINTS_TRIANGLE;
+    for (size_t szStep=0; szStep<szNumTriangles ; szStep++)
+    {
+        int rightEdge;
+        if (isInTriangle(current, (int) (szStep % NPOINTS_TRIANGLE), rightEdge))
+        {
+            triangle = current;
+            return true;
+        }
+
+        // Point is out of the convex hull or equal to a vertex
+        if ((rightEdge == INVALID) || (vTwins[rightEdge] == INVALID))
+        {
+            return false;
+        }
+
+        int twin = vTwins[rightEdge];
+        current = twin - twin % NPOINTS_TRIANGLE;
+    }
+
+    // Walk failed -> check all triangles
+    for (size_t i=0; i<szNumTriangles ;i++)
+    {
+        int rightEdge;
+        triangle = (int) i*NPOINTS_TRIANGLE;
+        if (isInTriangle(triangle, 0, rightEdge))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+/**
+ * @fn      splitTriangle
+ * @brief   Splits triangle a-b-c in triangles a-b-p, b-c-p and c-a-p and legalizes edges opposite to point p
+ *
+ * @param   pointIndex  (IN)    Point p inside triangle
+ * @param   triangle    (IN)    First edge of the triangle (a-b)
+ */
+void SweepHullDelaunay::splitTriangle(int pointIndex, int triangle)
+{
+    int a = vCorners[triangle];
+    int b = vCorners[triangle+1];
+    int c = vCorners[triangle+2];
+    int bcTwin = vTwins[triangle+1];
+    int caTwin = vTwins[triangle+2];
+
+    // Triangle a-b-c becomes a-b-p
+    vCorners[triangle+2] = pointIndex;
+    int bcp = addTriangle(b, c, pointIndex, bcTwin, INVALID, triangle+1);
+    int cap = addTriangle(c, a, pointIndex, caTwin, triangle+2, bcp+1);
+    if (bcTwin == INVALID)
+    {
+        vHullEdge[b] = bcp;
+    }
+    if (caTwin == INVALID)
+    {
+        vHullEdge[c] = cap;
+    }
+
+    legalize(triangle);
+    legalize(bcp);
+    legalize(cap);
+}
+/**
+ * @fn      splitEdge
+ * @brief   Splits the triangles a-b-c and b-a-d that share edge a-b in triangles p-b-c, c-a-p, p-a-d and d-b-p and
+ *          legalizes edges opposite to point p. If a-b is a convex hull edge then only a-b-c is split and p is added
+ *          to the convex hull between a and b
+ *
+ * @param   pointIndex  (IN)    Point p in edge
+ * @param   edge        (IN)    Edge a-b
+ */
+void SweepHullDelaunay::splitEdge(int pointIndex, int edge)
+{
+    int first = edge - edge % NPOINTS_TRIANGLE;
+    int bc = first + (edge + 1) % NPOINTS_TRIANGLE;
+    int ca = first + (edge + 2) % NPOINTS_TRIANGLE;
+    int a = vCorners[edge];
+    int c = vCorners[ca];
+    int caTwin = vTwins[ca];
+    int twin = vTwins[edge];
+
+    // Triangle a-b-c becomes p-b-c
+    vCorners[edge] = pointIndex;
+    int cap = addTriangle(c, a, pointIndex, caTwin, twin, ca);
+    if (caTwin == INVALID)
+    {
+        vHullEdge[c] = cap;
+    }
+
+    if (twin == INVALID)
+    {
+        // Point splits convex hull edge a-b
+        int b = vHullNext[a];
+        vHullEdge[a] = cap + 1;
+        vHullEdge[pointIndex] = edge;
+        vHullNext[a] = pointIndex;
+        vHullPrevious[pointIndex] = a;
+        vHullNext[pointIndex] = b;
+        vHullPrevious[b] = pointIndex;
+        vHullHash[getHashKey(vPoints[pointIndex])] = pointIndex;
+    }
+    else
+    {
+        // Triangle b-a-d becomes p-a-d
+        int twinFirst = twin - twin % NPOINTS_TRIANGLE;
+        int ad = twinFirst + (twin + 1) % NPOINTS_TRIANGLE;
+        int db = twinFirst + (twin + 2) % NPOINTS_TRIANGLE;
+        int b = vCorners[twin];
+        int d = vCorners[db];
+        int dbTwin = vTwins[db];
+        vCorners[twin] = pointIndex;
+        int dbp = addTriangle(d, b, pointIndex, dbTwin, edge, db);
+        if (dbTwin == INVALID)
+        {
+            vHullEdge[d] = dbp;
+        }
+
+        legalize(ad);
+        legalize(dbp);
+    }
+
+    legalize(bc);
+    legalize(cap);
+}
+
+
+/**
+ * @fn      addTriangle
+ * @brief   Adds a counterclockwise triangle a-b-c
+ *
+ * @param   a, b, c         (IN)    Triangle points
+ * @param   ab, bc, ca      (IN)    Twin of every new edge. INVALID if edge is in convex hull
+ * @return  first edge of new triangle (a-b). Edges b-c and c-a are the next two edges
+ */
+int SweepHullDelaunay::addTriangle(int a, int b, int c, int ab, int bc, int ca)
+{
+    int edge = (int) vCorners.size();
+    vCorners.push_back(a);
+    vCorners.push_back(b);
+    vCorners.push_back(c);
+    vTwins.resize(vCorners.size(), INVALID);
+    link(edge, ab);
+    link(edge+1, bc);
+    link(edge+2, ca);
+
+    return edge;
+}
+
+
+/**
+ * @fn      link
+ * @brief   Sets two edges as twins. If twin is INVALID then edge is set as convex hull edge
+ */
+void SweepHullDelaunay::link(int edge, int twin)
+{
+    vTwins[edge] = twin;
+    if (twin != INVALID)
+    {
+        vTwins[twin] = edge;
+    }
+}
+
+
+/**
+ * @fn      legalize
+ * @brief   Flips edge while the point of the twin triangle is inside the circle of the edge triangle. Edges of the
+ *          new triangles opposite to the point just inserted are checked again. Edges are flipped in place so
+ *          the convex hull edges of the flipped triangles are updated.
+ *
+ * @param   edge    (IN)    Edge opposite to the point just inserted
+ */
+void SweepHullDelaunay::legalize(int edge)
+{
+    vEdgeStack.clear();
+    vEdgeStack.push_back(edge);
+    while (!vEdgeStack.empty())
+    {
+        int a = vEdgeStack.back();
+        vEdgeStack.pop_back();
+
+        // Convex hull edges are always legal
+        int b = vTwins[a];
+        if (b == INVALID)
+        {
+            continue;
+        }
+
+        // Edges of both triangles: a-al-ar and b-br-bl
+        int a0 = a - a % NPOINTS_TRIANGLE;
+        int b0 = b - b % NPOINTS_TRIANGLE;
+        int al = a0 + (a + 1) % NPOINTS_TRIANGLE;
+        int ar = a0 + (a + 2) % NPOINTS_TRIANGLE;
+        int br = b0 + (b + 1) % NPOINTS_TRIANGLE;
+        int bl = b0 + (b + 2) % NPOINTS_TRIANGLE;
+
+        // Check if opposite point is in circle
+        int p0 = vCorners[ar];
+        int pr = vCorners[a];
+        int pl = vCorners[al];
+        int p1 = vCorners[bl];
+        if (!Predicates::inCircle(vPoints[p0], vPoints[pr], vPoints[pl], vPoints[p1]))
+        {
+            continue;
+        }
+
+        // Flip edge: triangles become a-al-ar = p1-pl-p0 and b-br-bl = p0-pr-p1
+        vCorners[a] = p1;
+        vCorners[b] = p0;
+        int hbl = vTwins[bl];
+        int har = vTwins[ar];
+        if (hbl == INVALID)
+        {
+            vHullEdge[p1] = a;
+        }
+        if (har == INVALID)
+        {
+            vHullEdge[p0] = b;
+        }
+        link(a, hbl);
+        link(b, har);
+        link(ar, bl);
+
+        vEdgeStack.push_back(br);
+        vEdgeStack.push_back(a);
+    }
+}
+
+
+/**
+ * @fn      getHashKey
+ * @brief   Computes the hash position of a point using its pseudo-angle around seed circle center
+ *
+ * @param   point   (IN)    Point
+ * @return  hash position
+ */
+int SweepHullDelaunay::getHashKey(const Point<TYPE> &point) const
+{
+    double dx = point.getX() - center.getX();
+    double dy = point.getY() - center.getY();
+    double sum = std::fabs(dx) + std::fabs(dy);
+    double angle = (sum > 0.0) ? dx/sum : 0.0;
+    angle = ((dy > 0.0) ? 3.0 - angle : 1.0 + angle) / 4.0;
+
+    return (int) (std::floor(angle*(double) vHullHash.size())) % (int) vHullHash.size();
+}
+
+
+/**
+ * @fn    getConvexFacesIntersections
+ * @brief Get faces and edge in convex hull that intersects input line
+ *
+ * @param line      (IN) Line to check
+ * @param vFaces    (OUT) Faces in convex hull that intersect line
+ * @param vEdges    (OUT) Edges in convex hull that intersect line
+ */
+void SweepHullDelaunay::getConvexFacesIntersections(Line &line, vector<int> &vFaces, vector<int> &vEdges)
+{
+    // Get convex hull edges
+    vector<int> vConvexEdges;
+    hull.getConvexHullEdges(vConvexEdges);
+
+    Point<TYPE> o;
+    Point<TYPE> d;
+    for (auto edgeId : vConvexEdges)
+    {
+        // Get edge extreme points
+        dcel.getEdgePoints(edgeId - 1, o, d);
+
+        // Build edge line
+        Line l(o, d);
+
+        // If line intersects -> add face
+        if (line.intersect(l))
+        {
+            int iTwinEdge = dcel.getTwin(edgeId - 1);
+            vFaces.push_back(dcel.getFace(iTwinEdge - 1));
+            vEdges.push_back(edgeId);
+        }
+    }
+}
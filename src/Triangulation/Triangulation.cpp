@@ -0,0 +1,121 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "Triangulation.h"
+
+
+/***********************************************************************************************************************
+* Public methods definitions
+***********************************************************************************************************************/
+bool Triangulation::findFaces(const vector<Point<TYPE>> &vPoints, vector<int> &vFacesId, size_t szNumThreads) const
+{
+    vFacesId.assign(vPoints.size(), EXTERNAL_FACE);
+    if (vPoints.empty())
+    {
+        return true;
+    }
+
+    // Check there is at least one triangle
+    if (this->dcel.getNumFaces() <= 1)
+    {
+        return false;
+    }
+
+    // Every chunk walks from the face of its previous point. Threads write different output positions
+    return runHilbertChunks(vPoints, szNumThreads, [&](const vector<int> &vOrder, size_t first, size_t last)
+    {
+        int walkFace=1;
+        for (size_t i=first; i<last ;i++)
+        {
+            int index = vOrder[i];
+            if (!this->walkToFace(vPoints[index], walkFace, vFacesId[index]))
+            {
+                return false;
+            }
+        }
+        return true;
+    });
+}
+
+
+bool Triangulation::findAllNearest(vector<int> &vNeighbour, vector<TYPE> &vSquaredDistance, size_t szNumThreads) const
+{
+    size_t szNumVertex = this->dcel.getNumVertex();
+    vNeighbour.assign(szNumVertex, INVALID);
+    vSquaredDistance.assign(szNumVertex, std::numeric_limits<TYPE>::max());
+
+    // Check there is at least one triangle
+    if (this->dcel.getNumFaces() <= 1)
+    {
+        return false;
+    }
+
+    // Every thread walks the edges that depart from the vertices in its range so every edge is read once
+    int *neighbours = vNeighbour.data();
+    TYPE *distances = vSquaredDistance.data();
+    return Parallel::runChunks(szNumVertex, TRIANGULATION_MIN_VERTEX_THREAD, szNumThreads,
+                               [&](size_t first, size_t last)
+    {
+        for (size_t i=first; i<last ;i++)
+        {
+            // Skip vertices without edges
+            int firstEdgeIndex = this->dcel.getPointEdge((int) i) - 1;
+            if (firstEdgeIndex < 0)
+            {
+                continue;
+            }
+
+            const Point<TYPE> *origin = this->dcel.getRefPoint((int) i);
+            int edgeIndex = firstEdgeIndex;
+            do
+            {
+                // Skip imaginary points
+                int destId = this->dcel.getOrigin(this->dcel.getTwin(edgeIndex)-1);
+                if (destId > 0)
+                {
+                    const Point<TYPE> *dest = this->dcel.getRefPoint(destId-1);
+                    TYPE dx = dest->getX() - origin->getX();
+                    TYPE dy = dest->getY() - origin->getY();
+                    TYPE distance = dx*dx + dy*dy;
+                    if (distance < distances[i])
+                    {
+                        distances[i] = distance;
+                        neighbours[i] = destId-1;
+                    }
+                }
+                edgeIndex = this->dcel.getTwin(this->dcel.getPrevious(edgeIndex)-1) - 1;
+            } while (edgeIndex != firstEdgeIndex);
+        }
+        return true;
+    });
+}
+
+
+/***********************************************************************************************************************
+* Protected methods definitions
+***********************************************************************************************************************/
+bool Triangulation::walkToFace(const Point<TYPE> &point, int &walkFace, int &faceId) const
+{
+    return this->dcel.walkToFace(point, walkFace, faceId);
+}
+
+
+bool Triangulation::reduceTwoClosest(Point<TYPE> &p, Point<TYPE> &q, size_t szNumThreads) const
+{
+    vector<int> vNeighbour;
+    vector<TYPE> vSquaredDistance;
+    if (!this->findAllNearest(vNeighbour, vSquaredDistance, szNumThreads) || vNeighbour.empty())
+    {
+        return false;
+    }
+
+    size_t szClosest = std::min_element(vSquaredDistance.begin(), vSquaredDistance.end()) - vSquaredDistance.begin();
+    if (vNeighbour[szClosest] == INVALID)
+    {
+        return false;
+    }
+
+    p = *this->dcel.getRefPoint(std::min((int) szClosest, vNeighbour[szClosest]));
+    q = *this->dcel.getRefPoint(std::max((int) szClosest, vNeighbour[szClosest]));
+    return true;
+}
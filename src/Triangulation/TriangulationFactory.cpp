@@ -32,14 +32,96 @@ StarTriangulation *TriangulationFactory::createStar(vector<Point<TYPE>> &vPoints
 }
 
 
-Delaunay *TriangulationFactory::createDelaunay(vector<Point<TYPE>> &vPoints, bool &isSuccess)
+Delaunay *TriangulationFactory::createDelaunay(vector<Point<TYPE>> &vPoints, bool &isSuccess,
+                                               PointLocation_E location)
 {
     Delaunay *delaunay= nullptr;
 
     try
     {
         // Build Delaunay triangulation
-        delaunay = new Delaunay(vPoints);
+        delaunay = new Delaunay(vPoints, location);
+        isSuccess = delaunay->build();
+        if (!isSuccess)
+        {
+            delete delaunay;
+            delaunay = nullptr;
+        }
+    }
+    catch (bad_alloc &ex)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error allocating memory");
+        Logging::write( true, Error);
+        isSuccess = false;
+    }
+
+    return delaunay;
+}
+
+
+Delaunay *TriangulationFactory::createDelaunay(vector<Point<TYPE>> &&vPoints, bool &isSuccess,
+                                               PointLocation_E location)
+{
+    Delaunay *delaunay= nullptr;
+
+    try
+    {
+        // Build Delaunay triangulation
+        delaunay = new Delaunay(std::move(vPoints), location);
+        isSuccess = delaunay->build();
+        if (!isSuccess)
+        {
+            delete delaunay;
+            delaunay = nullptr;
+        }
+    }
+    catch (bad_alloc &ex)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error allocating memory");
+        Logging::write( true, Error);
+        isSuccess = false;
+    }
+
+    return delaunay;
+}
+
+
+DivideConquerDelaunay *TriangulationFactory::createDivideConquer(vector<Point<TYPE>> &vPoints, bool &isSuccess,
+                                                                 size_t szNumThreads)
+{
+    DivideConquerDelaunay *delaunay= nullptr;
+
+    try
+    {
+        // Build Delaunay triangulation
+        delaunay = new DivideConquerDelaunay(vPoints, szNumThreads);
+        isSuccess = delaunay->build();
+        if (!isSuccess)
+        {
+            delete delaunay;
+            delaunay = nullptr;
+        }
+    }
+    catch (bad_alloc &ex)
+    {
+        Logging::buildText(__FUNCTION__, __FILE__, "Error allocating memory");
+        Logging::write( true, Error);
+        isSuccess = false;
+    }
+
+    return delaunay;
+}
+
+
+SweepHullDelaunay *TriangulationFactory::createSweepHull(vector<Point<TYPE>> &vPoints, bool &isSuccess,
+                                                         size_t szNumThreads)
+{
+    SweepHullDelaunay *delaunay= nullptr;
+
+    try
+    {
+        // Build Delaunay triangulation
+        delaunay = new SweepHullDelaunay(vPoints, szNumThreads);
         isSuccess = delaunay->build();
         if (!isSuccess)
         {
@@ -34,6 +34,8 @@ using namespace std;
 #define FIGURES_EDGES_CRICLES_TEXT		"Edges circles"
 #define FIGURES_VORONOI_TEXT			"Voronoi"
 #define FIGURES_GABRIEL_TEXT			"Gabriel"
+#define FIGURES_SPANNING_TREE_TEXT		"Minimum spanning tree"
+#define FIGURES_RELATIVE_NEIGHBOURHOOD_TEXT	"Relative neighbourhood"
 #define FIGURES_FILTER_EDGES			"Filter edges"
 #define FIGURES_VORONOI_PATH_TEXT		"Voronoi path"
 #define	FIGURES_TRIANGULATION_PATH_TEXT	"StarTriangulation path"
@@ -145,6 +147,8 @@ void Menu::updateMenu()
 			if (service.isDelaunay())
             {
                 glutAddMenuEntry(FIGURES_VORONOI_TEXT, voronoi);
+                glutAddMenuEntry(FIGURES_SPANNING_TREE_TEXT, spanning_tree);
+                glutAddMenuEntry(FIGURES_RELATIVE_NEIGHBOURHOOD_TEXT, relative_neighbourhood);
             }
 			glutAddMenuEntry(LOCATION_CLOSEST_POINTS_TEXT, closest_point);
 			glutAddMenuEntry(LOCATION_2CLOSEST_POINTS_TEXT, two_closest);
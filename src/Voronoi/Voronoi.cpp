@@ -2,9 +2,11 @@
 * Includes
 ***********************************************************************************************************************/
 #include "Logging.h"
-#include "Circle.h"
 #include "Voronoi.h"
 #include "DcelWriter.h"
+#include "Parallel.h"
+
+#include <numeric>
 
 
 /***********************************************************************************************************************
@@ -15,9 +17,6 @@
 //#define DEBUG_VORONOI_EDGEEXISTS
 //#define DEBUG_VORONOI_BUILD
 //#define DEBUG_VORONOI_BUILDAREA
-//#define DEBUG_VORONOI_GETEXTREMEVORONOI
-//#define DEBUG_VORONOI_COMPUTE_CIRCUMCENTRES
-//#define DEBUG_ISBOTTOMOSTFACE
 //#define DEBUG_VORONOI_INNERTOAREA
 //#define DEBUG_VORONOI_EDGE_INTERSECTION
 //#define DEBUG_VORONOI_CORRECTBORDER
@@ -35,18 +34,51 @@ void Voronoi::reset()
 }
 
 
-bool Voronoi::build()
+bool Voronoi::build(size_t szNumThreads)
+{
+    // Compute Voronoi circumcentres for every face.
+    VoronoiView view(*this->triangulation);
+    if (!view.build(szNumThreads))
+    {
+        this->triangulation = nullptr;
+        return false;
+    }
+
+    return this->build(view, szNumThreads);
+}
+
+
+template <class M> bool Voronoi::build(const BasicVoronoiView<M> &view, size_t szNumThreads)
 {
+    this->reset();
+    if (!view.isValid())
+    {
+        return false;
+    }
+
     // Add first face
     this->dcel.addFace(INVALID);
+    this->triangulation = Voronoi::getAreaDcel(view);
 
-    // Compute Voronoi circumcentres for every non-imaginary face.
-    this->computeCircumcentres();
+    // Add circumcentres as Voronoi vertices.
+    for (size_t centreIndex=0; centreIndex<view.getNumCentres() ; centreIndex++)
+    {
+        Point<TYPE> centre;
+        view.getCentre((int) centreIndex, centre);
+        this->dcel.addVertex(&centre, INVALID);
+    }
 
     // Compute Voronoi area for every point in Delaunay triangulation.
-    for (size_t pointIndex=0; pointIndex< this->triangulation->getNumVertex() ; pointIndex++)
+    if ((Parallel::getNumThreads(szNumThreads) == 1) && (this->triangulation != nullptr))
     {
-        this->buildArea(pointIndex);
+        for (size_t pointIndex=0; pointIndex< this->triangulation->getNumVertex() ; pointIndex++)
+        {
+            this->buildArea(pointIndex);
+        }
+    }
+    else
+    {
+        this->buildAreas(view, szNumThreads);
     }
 
 	isBuilt = true;
@@ -115,85 +147,8 @@ bool Voronoi::isInnerToArea(const Point<TYPE> &p, int areaId)
 
 
 /***********************************************************************************************************************
-* Public methods definitions
+* Private methods definitions
 ***********************************************************************************************************************/
-/**
- * @fn      computeCircumcentres
- * @brief   comptues the voronoi centre of every face of the "dcel" triangulation and updates the "voronoi" vertex array
- */
-void Voronoi::computeCircumcentres()
-{
-	int			lastIamginaryFace=0;// Last imaginary face id.
-
-	// Loop all faces from 1 because zero face has no circumcentre.
-	for (int faceId=1; faceId< this->triangulation->getNumFaces() ; faceId++)
-	{
-        Point<TYPE>	invalidPoint;		// Point to use in imaginary faces.
-
-		// Skip imaginary faces.
-		if (!this->triangulation->imaginaryFace(faceId))
-		{
-            vector<Point<TYPE>> vPoints;
-            this->triangulation->getFacePoints(faceId, vPoints);
-
-		    // Build circle.
-            Circle circle = Circle(vPoints);
-
-			// Add circumcentre.
-			this->dcel.addVertex(circle.getRefCentre(), INVALID);
-        }
-		// Add invalid point for imaginary face.
-		else
-        {
-        	lastIamginaryFace = faceId;
-			this->dcel.addVertex(&invalidPoint, INVALID);
-        }
-	}
-
-    // Build imaginary faces circumcentres.
-    for (int faceId=1; faceId<=lastIamginaryFace ;faceId++)
-    {
-        // Skip face bottom most face because it has no adjacent real faces.
-        if (!this->isBottomMostFace(faceId))
-        {
-            // Parse only imaginary Delaunay faces.
-            if (this->triangulation->imaginaryFace(faceId))
-            {
-                // Get edge in current Delaunay face.
-                int edgeIndex = this->triangulation->getFaceEdge(faceId)-1;
-
-                bool isRealFaceFound = false;
-                int adjacentFaceId=0;
-                while (!isRealFaceFound)
-                {
-                    // Check if twin edge belongs to real Delaunay face.
-                    int twinEdgeIndex = this->triangulation->getTwin(edgeIndex)-1;
-                    adjacentFaceId = this->triangulation->getFace(twinEdgeIndex);
-                    if (!this->triangulation->imaginaryFace(adjacentFaceId))
-                    {
-                        // Adjacent face found.
-                        isRealFaceFound = true;
-                    }
-                    else
-                    {
-                        // Check next edge in current Delaunay face.
-                        edgeIndex = this->triangulation->getNext(edgeIndex)-1;
-                    }
-                }
-
-                // Get centre of adjacent Voronoi face.
-                Point<TYPE>	*centre = this->dcel.getRefPoint(adjacentFaceId - 1);
-
-                // Compute centre of external Delaunay face.
-                Point<TYPE>	externalCentre = this->computeExtremeVoronoi(edgeIndex, *centre);
-
-                // Update Voronoi point coordinates.
-                this->dcel.updateVertex(&externalCentre, faceId - 1);
-            }
-        }
-    }
-}
-
 /***************************************************************************
 * Name: 	build
 * IN:		pointIndex		index of the point whose area must be built
@@ -216,7 +171,7 @@ void Voronoi::buildArea(int pointIndex)
 	int				newEdgeId=0;		// New edge it to be inserted.
 	int				existingEdge=0;		// Existing edge id.
 	int				existingEdgeIndex=0;// Existing edge index.
-	Edge			*edge;
+	EdgeRef			edge;
 	bool			previousExist=false;
 	int				newVoronoiFaceId=0;	// Face id in Voronoi area.
 
@@ -316,11 +271,8 @@ void Voronoi::buildArea(int pointIndex)
 			Logging::write(true, Info);
 #endif
 
-			// Get current triangulation edge data.
-			edge = this->triangulation->getRefEdge(edgeIndex);
-
 			// Check if Voronoi edge already created.
-			if (this->edgeExists(*edge))
+			if (Voronoi::edgeExists(*this->triangulation, edgeIndex))
 			{
 				// Get one of the edges of existing Voronoi face.
 				existingEdge = this->dcel.getFaceEdge(this->triangulation->getOrigin(this->triangulation->getTwin(edgeIndex) - 1));
@@ -449,94 +401,109 @@ void Voronoi::buildArea(int pointIndex)
 }
 
 
-/***************************************************************************
-* Name: 	computeExtremeVoronoi
-* IN:		edgeIndex			edge index
-* 			centre				previous voronoi area centre.
-* OUT:		NONE
-* RETURN:	imaginary extreme point in border.
-* GLOBAL:	this->voronoi
-* Description: 	if a Voronoi area is an external area (not closed) it is
-* 				necessary to compute an imaginary point in border area. Given
-* 				the previous Voronoi area centre and a Delaunay edge whose
-* 				Voronoi edge is being computed it is possible to compute
-* 				this border point.
-***************************************************************************/
-Point<TYPE> Voronoi::computeExtremeVoronoi(int edgeIndex, Point<TYPE> &centre)
+/**
+ * @fn                  buildAreas
+ * @brief               Builds the Voronoi areas of all points in parallel. The sequential build creates a Voronoi
+ *                      edge and its twin when it finds a Delaunay edge whose destination is higher than its origin,
+ *                      so the edge ids are assigned first counting those edges in every area. Then every thread
+ *                      links the edges of its areas
+ *
+ * @param view          (IN) Built Voronoi view
+ * @param szNumThreads  (IN) Number of threads. All available cores if zero
+ */
+template <class M> void Voronoi::buildAreas(const BasicVoronoiView<M> &view, size_t szNumThreads)
 {
-	Point<TYPE> *origin, *destination;		// Origin and destination edge points.
-	Line line;								// Line data.
-	Point<TYPE> middlePoint;				// Edge middle point.
-	Edge *edge;								// Edge data.
-	enum Turn_T turn;						// Turn type (left, right collinear).
-	Point<TYPE> *p1, *p2;					// Aux points.
-	Point<TYPE>  extreme;					// Return value.
-
-	// Get real edge in current face.
-	edge = this->triangulation->getRefEdge(edgeIndex);
-
-	// Get Delaunay edge extreme points.
-	origin = this->triangulation->getRefPoint(edge->getOrigin() - 1);
-	destination = this->triangulation->getRefPoint(this->triangulation->getOrigin(edge->getTwin() - 1) - 1);
-
-	// Compute middle point in Delaunay triangulation edge.
-	line = Line(*origin, *destination);
-	line.getMiddle(middlePoint);
-
-#ifdef DEBUG_VORONOI_GETEXTREMEVORONOI
-	Logging::buildText(__FUNCTION__, __FILE__, "Middle point for edge ");
-	Logging::buildText(__FUNCTION__, __FILE__, edgeIndex+1);
-	Logging::buildText(__FUNCTION__, __FILE__, " whose vertex are ");
-	Logging::buildText(__FUNCTION__, __FILE__, edge->getOrigin());
-	Logging::buildText(__FUNCTION__, __FILE__, " and ");
-	Logging::buildText(__FUNCTION__, __FILE__, this->triangulation->getOrigin(edge->getTwin() - 1));
-	Logging::buildText(__FUNCTION__, __FILE__, " is ");
-	Logging::buildText(__FUNCTION__, __FILE__, &middlePoint);
-	Logging::write(true, Info);
-#endif
-	// Check turn between edge in convex hull and previous circumcentre.
-	turn = line.checkTurn(&centre);
-	if (turn == RIGHT_TURN)
-	{
-#ifdef DEBUG_VORONOI_GETEXTREMEVORONOI
-		Logging::buildText(__FUNCTION__, __FILE__,"RIGHT turn.");
-		Logging::write(true, Info);
-#endif
-		p1 = &centre;
-		p2 = &middlePoint;
-	}
-	// Check if voronoi centre is into the convex hull.
-	else if (turn == LEFT_TURN)
-	{
-#ifdef DEBUG_VORONOI_GETEXTREMEVORONOI
-		Logging::buildText(__FUNCTION__, __FILE__,"LEFT turn.");
-		Logging::write(true, Info);
-#endif
-		p1 = &middlePoint;
-		p2 = &centre;
-	}
-	else
-	{
-#ifdef DEBUG_VORONOI_GETEXTREMEVORONOI
-		Logging::buildText(__FUNCTION__, __FILE__, "COLLINEAR.");
-		Logging::write(true, Info);
-#endif
-		//printf("Collinear points in edge index %d\n", edgeID-1);
-		// PENDING
-		printf("CRITICAL ERROR\n");
-		exit(0);
-	}
+    const M &triangulation = *view.getDcel();
+    size_t szNumAreas = view.getNumAreas();
 
-	// Compute extreme of Voronoi edge.
-	line = Line(*p1, *p2);
-	line.extendToBoundary(extreme);
+    // Count new edges of every area and compute first new edge pair of every area.
+    vector<int> vFirstPair(szNumAreas + 1, 0);
+    Parallel::runChunks(szNumAreas, VORONOI_MIN_AREAS_THREAD, szNumThreads, [&](size_t first, size_t last)
+    {
+        for (size_t i=first; i<last ;i++)
+        {
+            int areaId = (int) i + 1;
+            int firstEdgeIndex = view.getFirstEdge(areaId);
+            int edgeIndex = firstEdgeIndex;
+            do
+            {
+                vFirstPair[i+1] += (Voronoi::edgeExists(triangulation, edgeIndex) ? 0 : 1);
+                edgeIndex = view.getNextEdge(edgeIndex);
+            } while (edgeIndex != firstEdgeIndex);
+        }
+        return true;
+    });
+    std::partial_sum(vFirstPair.begin(), vFirstPair.end(), vFirstPair.begin());
 
-	return(extreme);
+    // Assign Voronoi edge id to every real Delaunay edge. Twin edges are set by the area that creates them.
+    vector<int> vEdgeIds(triangulation.getNumEdges(), INVALID);
+    Parallel::runChunks(szNumAreas, VORONOI_MIN_AREAS_THREAD, szNumThreads, [&](size_t first, size_t last)
+    {
+        for (size_t i=first; i<last ;i++)
+        {
+            int newEdgeId = 2*vFirstPair[i] + 1;
+            int firstEdgeIndex = view.getFirstEdge((int) i + 1);
+            int edgeIndex = firstEdgeIndex;
+            do
+            {
+                if (!Voronoi::edgeExists(triangulation, edgeIndex))
+                {
+                    vEdgeIds[edgeIndex] = newEdgeId;
+                    vEdgeIds[triangulation.getTwin(edgeIndex)-1] = newEdgeId + 1;
+                    newEdgeId += 2;
+                }
+                edgeIndex = view.getNextEdge(edgeIndex);
+            } while (edgeIndex != firstEdgeIndex);
+        }
+        return true;
+    });
+
+    // Link edges of every area.
+    this->dcel.resize(2*vFirstPair[szNumAreas], szNumAreas + 1);
+    Parallel::runChunks(szNumAreas, VORONOI_MIN_AREAS_THREAD, szNumThreads, [&](size_t first, size_t last)
+    {
+        for (size_t i=first; i<last ;i++)
+        {
+            int areaId = (int) i + 1;
+            int firstEdgeIndex = view.getFirstEdge(areaId);
+            int edgeIndex = firstEdgeIndex;
+            int previousEdge = INVALID;
+            do
+            {
+                int edgeId = vEdgeIds[edgeIndex];
+                int twinIndex = triangulation.getTwin(edgeIndex)-1;
+                this->dcel.setOrigin(edgeId-1, triangulation.getFace(twinIndex));
+                this->dcel.setTwin(edgeId-1, vEdgeIds[twinIndex]);
+                this->dcel.setFace(edgeId-1, areaId);
+                if (previousEdge != INVALID)
+                {
+                    this->dcel.setPrevious(edgeId-1, previousEdge);
+                    this->dcel.setNext(previousEdge-1, edgeId);
+                }
+                previousEdge = edgeId;
+                edgeIndex = view.getNextEdge(edgeIndex);
+            } while (edgeIndex != firstEdgeIndex);
+
+            // Close area.
+            int firstEdge = vEdgeIds[firstEdgeIndex];
+            this->dcel.setPrevious(firstEdge-1, previousEdge);
+            this->dcel.setNext(previousEdge-1, firstEdge);
+            this->dcel.setFaceEdge(areaId, firstEdge);
+        }
+        return true;
+    });
+
+    // Vertex edge is the last created edge departing from it.
+    for (size_t edgeIndex=0; edgeIndex<this->dcel.getNumEdges() ; edgeIndex++)
+    {
+        this->dcel.updateVertex((int) edgeIndex + 1, this->dcel.getOrigin((int) edgeIndex) - 1);
+    }
 }
 
+
 /***************************************************************************
 * Name: 	edgeExists
-* IN:		edge			edge to check.
+* IN:		edgeIndex		index of the Delaunay edge to check.
 * OUT:		NONE
 * RETURN:	true 			if the Voronoi edge already created
 * 			false			i.o.c.
@@ -547,19 +514,19 @@ Point<TYPE> Voronoi::computeExtremeVoronoi(int edgeIndex, Point<TYPE> &centre)
 * 				lower than origin because Delaunay points are parsed in
 * 				ascending order.
 ***************************************************************************/
-bool Voronoi::edgeExists(Edge &edge)
+template <class M> bool Voronoi::edgeExists(const M &triangulation, int edgeIndex)
 {
 	bool 	exists=false;	// Return value.
 
 	// If destination point < origin point -> Voronoi edge already created.
-	if (this->triangulation->getOrigin(edge.getTwin()-1) < edge.getOrigin())
+	if (triangulation.getOrigin(triangulation.getTwin(edgeIndex)-1) < triangulation.getOrigin(edgeIndex))
 	{
 		exists = true;
 #ifdef DEBUG_VORONOI_EDGEEXISTS
 		Logging::buildText(__FUNCTION__, __FILE__, "Recovering already existing edge because destination ");
-		Logging::buildText(__FUNCTION__, __FILE__, this->triangulation->getOrigin(edge.getTwin()-1));
+		Logging::buildText(__FUNCTION__, __FILE__, triangulation.getOrigin(triangulation.getTwin(edgeIndex)-1));
 		Logging::buildText(__FUNCTION__, __FILE__, " is lower than origin point ");
-		Logging::buildText(__FUNCTION__, __FILE__, edge.getOrigin());
+		Logging::buildText(__FUNCTION__, __FILE__, triangulation.getOrigin(edgeIndex));
 		Logging::write(true, Info);
 #endif
 	}
@@ -568,41 +535,9 @@ bool Voronoi::edgeExists(Edge &edge)
 }
 
 
-/***************************************************************************
-* Name: 	isBottomMostFace
-* IN:		faceId			id of the face to check.
-* OUT:		NONE
-* RETURN:	true 			if the face os the bottom most face in the
-* 							triangulation
-* GLOBAL:	NONE
-* Description: 	Checks if the face is the bottom most face in a incremental
-* 				triangulation.
-***************************************************************************/
-bool Voronoi::isBottomMostFace(int faceId)
-{
-	int	i=0;				// Loop counter.
-	int	edgeIndex=0;		// Current edge index.
-	int	nImaginaryPoints=0;	// # imaginary points in face.
-
-	// Get edge in current face.
-	edgeIndex = this->triangulation->getFaceEdge(faceId)-1;
-
-	for (i=0; i<NPOINTS_TRIANGLE; i++)
-	{
-		// Check if origin point is lower than 0.
-		if (this->triangulation->getOrigin(edgeIndex) < 0)
-		{
-#ifdef DEBUG_ISBOTTOMOSTFACE
-			Logging::buildText(__FUNCTION__, __FILE__, "Edge ");
-			Logging::buildText(__FUNCTION__, __FILE__, edgeIndex+1);
-			Logging::buildText(__FUNCTION__, __FILE__, " origin is ");
-			Logging::buildText(__FUNCTION__, __FILE__, this->triangulation->getOrigin(edgeIndex));
-			Logging::write(true, Info);
-#endif
-			nImaginaryPoints++;
-		}
-		edgeIndex = this->triangulation->getNext(edgeIndex)-1;
-	}
-
-	return(nImaginaryPoints == 2);
-}
+/***********************************************************************************************************************
+* Explicit instantiations
+***********************************************************************************************************************/
+template bool Voronoi::build(const VoronoiView &view, size_t szNumThreads);
+template bool Voronoi::build(const MeshVoronoiView &view, size_t szNumThreads);
+template bool Voronoi::build(const MappedVoronoiView &view, size_t szNumThreads);
@@ -0,0 +1,327 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "Circle.h"
+#include "DcelQueries.h"
+#include "Parallel.h"
+#include "VoronoiView.h"
+
+
+/***********************************************************************************************************************
+* Public methods definitions
+***********************************************************************************************************************/
+template <class M> bool BasicVoronoiView<M>::build(size_t szNumThreads)
+{
+    // Check there is at least one face
+    this->reset();
+    size_t szNumFaces = this->triangulation->getNumFaces();
+    if (szNumFaces <= 1)
+    {
+        return false;
+    }
+
+    // Areas of convex hull points are closed by imaginary faces centres
+    int faceId=1;
+    while ((faceId < (int) szNumFaces) && !DcelQueries::imaginaryFace(*this->triangulation, faceId))
+    {
+        faceId++;
+    }
+    if (faceId == (int) szNumFaces)
+    {
+        return false;
+    }
+
+    // Zero face has no circumcentre. Imaginary faces keep an invalid point until their adjacent real face is computed
+    this->vCentres.resize(szNumFaces - 1);
+    Parallel::runChunks(this->vCentres.size(), VORONOI_MIN_FACES_THREAD, szNumThreads, [&](size_t first, size_t last)
+    {
+        for (size_t i=first; i<last ;i++)
+        {
+            int faceId = (int) i + 1;
+            if (!DcelQueries::imaginaryFace(*this->triangulation, faceId))
+            {
+                int ids[NPOINTS_TRIANGLE];
+                DcelQueries::getFaceVertices(*this->triangulation, faceId, ids);
+                Circle::computeCentre(*this->triangulation->getRefPoint(ids[0]-1),
+                                      *this->triangulation->getRefPoint(ids[1]-1),
+                                      *this->triangulation->getRefPoint(ids[2]-1), this->vCentres[i]);
+            }
+        }
+        return true;
+    });
+
+    // Imaginary faces only read real faces centres
+    this->isBuilt = Parallel::runChunks(this->vCentres.size(), VORONOI_MIN_FACES_THREAD, szNumThreads,
+                                        [&](size_t first, size_t last)
+    {
+        for (size_t i=first; i<last ;i++)
+        {
+            if (!this->computeExtremeCentre((int) i + 1))
+            {
+                return false;
+            }
+        }
+        return true;
+    });
+
+    if (!this->isBuilt)
+    {
+        this->vCentres.clear();
+    }
+    return this->isBuilt;
+}
+
+
+template <class M> void BasicVoronoiView<M>::reset()
+{
+    vCentres.clear();
+    isBuilt = false;
+}
+
+
+template <class M> int BasicVoronoiView<M>::getFirstEdge(int areaId) const
+{
+    // Skip edges in imaginary or external faces
+    int edgeIndex = this->triangulation->getPointEdge(areaId-1) - 1;
+    while (DcelQueries::imaginaryFace(*this->triangulation, this->triangulation->getFace(edgeIndex)) ||
+           DcelQueries::isExternalEdge(*this->triangulation, edgeIndex))
+    {
+        edgeIndex = this->triangulation->getTwin(this->triangulation->getPrevious(edgeIndex)-1) - 1;
+    }
+
+    return edgeIndex;
+}
+
+
+template <class M> int BasicVoronoiView<M>::getNextEdge(int edgeIndex) const
+{
+    do
+    {
+        edgeIndex = this->triangulation->getTwin(this->triangulation->getPrevious(edgeIndex)-1) - 1;
+    } while (!this->isAreaEdge(edgeIndex));
+
+    return edgeIndex;
+}
+
+
+template <class M> void BasicVoronoiView<M>::getEdgeCentres(int edgeIndex, Point<TYPE> &origin,
+                                                            Point<TYPE> &dest) const
+{
+    origin = this->vCentres.at(this->triangulation->getFace(this->triangulation->getTwin(edgeIndex)-1) - 1);
+    dest = this->vCentres.at(this->triangulation->getFace(edgeIndex) - 1);
+}
+
+
+template <class M> void BasicVoronoiView<M>::getArea(int areaId, vector<Point<TYPE>> &vPoints) const
+{
+    // Add edges extremes but do not add the same vertex twice (end edge vertex is origin in next edge).
+    vPoints.clear();
+    int firstEdgeIndex = this->getFirstEdge(areaId);
+    int edgeIndex = firstEdgeIndex;
+    do
+    {
+        Point<TYPE> vEdgePoints[2];
+        this->getEdgeCentres(edgeIndex, vEdgePoints[0], vEdgePoints[1]);
+        for (auto &point : vEdgePoints)
+        {
+            if (vPoints.empty() || (point != vPoints.back()))
+            {
+                vPoints.push_back(point);
+            }
+        }
+        edgeIndex = this->getNextEdge(edgeIndex);
+    } while (edgeIndex != firstEdgeIndex);
+
+    // Remove last element because it is already inserted as first element
+    vPoints.pop_back();
+}
+
+
+template <class M> bool BasicVoronoiView<M>::isInnerToArea(const Point<TYPE> &p, int areaId) const
+{
+    int firstEdgeIndex = this->getFirstEdge(areaId);
+    int edgeIndex = firstEdgeIndex;
+    do
+    {
+        // If right turn then it is not inner.
+        Point<TYPE> origin, dest;
+        this->getEdgeCentres(edgeIndex, origin, dest);
+        if (origin.check_Turn(dest, p) == RIGHT_TURN)
+        {
+            return false;
+        }
+        edgeIndex = this->getNextEdge(edgeIndex);
+    } while (edgeIndex != firstEdgeIndex);
+
+    return true;
+}
+
+
+template <class M> bool BasicVoronoiView<M>::findPath(const vector<int> &vExtremeAreas, Line &line,
+                                                      vector<int> &vAreasId) const
+{
+    int currentArea = vExtremeAreas.at(0);
+    int lastArea = vExtremeAreas.at(1);
+    int lastEdgeIndex = INVALID;
+    vector<int> vEdges;
+    while (currentArea != lastArea)
+    {
+        // Get area edges intersected by line
+        vEdges.clear();
+        int firstEdgeIndex = this->getFirstEdge(currentArea);
+        int edgeIndex = firstEdgeIndex;
+        do
+        {
+            Point<TYPE> origin, dest;
+            this->getEdgeCentres(edgeIndex, origin, dest);
+            Line edgeLine = Line(origin, dest);
+            if (line.intersect(edgeLine))
+            {
+                vEdges.push_back(edgeIndex);
+            }
+            edgeIndex = this->getNextEdge(edgeIndex);
+        } while (edgeIndex != firstEdgeIndex);
+
+        if (vEdges.empty())
+        {
+            return false;
+        }
+
+        // Move through first edge that is not the entry edge. The edge after it is not checked.
+        for (size_t i=0; i<vEdges.size() ;i++)
+        {
+            if (vEdges[i] != lastEdgeIndex)
+            {
+                vAreasId.push_back(currentArea);
+                lastEdgeIndex = this->triangulation->getTwin(vEdges[i]) - 1;
+                currentArea = this->triangulation->getOrigin(lastEdgeIndex);
+                i++;
+            }
+        }
+    }
+
+    // Insert last area
+    vAreasId.push_back(currentArea);
+    return true;
+}
+
+
+/***********************************************************************************************************************
+* Private methods definitions
+***********************************************************************************************************************/
+/**
+ * @fn              computeExtremeCentre
+ * @brief           Computes the centre of an imaginary face as the boundary extreme of the Voronoi edge of its first
+ *                  edge adjacent to a real face. Real faces and the bottom most face are skipped
+ *
+ * @param faceId    (IN) Delaunay face id
+ * @return          true if the centre is computed or the face is skipped
+ *                  false if the extreme cannot be computed
+ */
+template <class M> bool BasicVoronoiView<M>::computeExtremeCentre(int faceId)
+{
+    if (!DcelQueries::imaginaryFace(*this->triangulation, faceId) || this->isBottomMostFace(faceId))
+    {
+        return true;
+    }
+
+    // Find edge whose twin belongs to a real face.
+    int edgeIndex = this->triangulation->getFaceEdge(faceId) - 1;
+    for (int i=0; i<NPOINTS_TRIANGLE ;i++)
+    {
+        int adjacentFaceId = this->triangulation->getFace(this->triangulation->getTwin(edgeIndex)-1);
+        if (!DcelQueries::imaginaryFace(*this->triangulation, adjacentFaceId))
+        {
+            return this->computeExtremeVoronoi(edgeIndex, this->vCentres[adjacentFaceId-1], this->vCentres[faceId-1]);
+        }
+        edgeIndex = this->triangulation->getNext(edgeIndex) - 1;
+    }
+
+    return true;
+}
+
+
+/**
+ * @fn              computeExtremeVoronoi
+ * @brief           Computes the extreme in the boundary of the Voronoi edge that departs from the centre of a real
+ *                  face and crosses a convex hull edge
+ *
+ * @param edgeIndex (IN) Convex hull edge index
+ * @param centre    (IN) Centre of the real face
+ * @param extreme   (OUT) Boundary extreme
+ * @return          true if extreme computed
+ *                  false if centre is collinear to the edge
+ */
+template <class M> bool BasicVoronoiView<M>::computeExtremeVoronoi(int edgeIndex, const Point<TYPE> &centre,
+                                                                   Point<TYPE> &extreme) const
+{
+    // Compute middle point in Delaunay triangulation edge.
+    Point<TYPE> origin, destination;
+    DcelQueries::getEdgePoints(*this->triangulation, edgeIndex, origin, destination);
+    Line line = Line(origin, destination);
+    Point<TYPE> middlePoint;
+    line.getMiddle(middlePoint);
+
+    // Voronoi edge goes from the centre to the middle point if the centre is at the right of the edge.
+    Point<TYPE> centreCopy = centre;
+    enum Turn_T turn = line.checkTurn(&centreCopy);
+    if (turn == RIGHT_TURN)
+    {
+        line = Line(centre, middlePoint);
+    }
+    else if (turn == LEFT_TURN)
+    {
+        line = Line(middlePoint, centre);
+    }
+    else
+    {
+        return false;
+    }
+
+    line.extendToBoundary(extreme);
+    return true;
+}
+
+
+/**
+ * @fn              isBottomMostFace
+ * @brief           Checks if the face is the bottom most face in an incremental triangulation (two imaginary points)
+ *
+ * @param faceId    (IN) Delaunay face id
+ * @return          true if face has two imaginary points
+ *                  false otherwise
+ */
+template <class M> bool BasicVoronoiView<M>::isBottomMostFace(int faceId) const
+{
+    int ids[NPOINTS_TRIANGLE];
+    DcelQueries::getFaceVertices(*this->triangulation, faceId, ids);
+    int nImaginaryPoints=0;
+    for (int id : ids)
+    {
+        nImaginaryPoints += (id < 0) ? 1 : 0;
+    }
+
+    return nImaginaryPoints == 2;
+}
+
+
+/**
+ * @fn              isAreaEdge
+ * @brief           Checks if a Delaunay edge has a dual Voronoi edge (it has no imaginary vertex)
+ *
+ * @param edgeIndex (IN) Delaunay edge index
+ * @return          true if edge is real
+ *                  false otherwise
+ */
+template <class M> bool BasicVoronoiView<M>::isAreaEdge(int edgeIndex) const
+{
+    return !DcelQueries::hasNegativeVertex(*this->triangulation, edgeIndex+1);
+}
+
+
+/***********************************************************************************************************************
+* Explicit instantiations
+***********************************************************************************************************************/
+template class BasicVoronoiView<Dcel>;
+template class BasicVoronoiView<TriangleMeshView>;
+template class BasicVoronoiView<MappedDcel>;
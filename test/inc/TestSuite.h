@@ -18,7 +18,9 @@
 #define NUM_POINTS_10K              (10000)
 #define NUM_POINTS_100K             (100000)
 #define NUM_POINTS_1M               (1000000)
+#define NUM_POINTS_10M              (10000000)
 
+#define NUM_ITERATIONS_1            (1)
 #define NUM_ITERATIONS_10           (10)
 #define NUM_ITERATIONS_100          (100)
 #define NUM_ITERATIONS_1000         (1000)
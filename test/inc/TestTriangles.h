@@ -0,0 +1,39 @@
+#ifndef DELAUNAY_TESTTRIANGLES_H
+#define DELAUNAY_TESTTRIANGLES_H
+
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "Dcel.h"
+
+#include <array>
+#include <vector>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Types definition
+***********************************************************************************************************************/
+// Triangle as its three points coordinates sorted lexicographically
+typedef array<TYPE, 6> TestTriangle;
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+class TestTriangles
+{
+public:
+    /**
+     * @fn      getTriangles
+     * @brief   Gets the real triangles of a dcel (faces with imaginary points are skipped) as sorted coordinates so
+     *          triangulations built by different algorithms can be compared
+     *
+     * @param   dcel        (IN)    Dcel whose triangles are returned
+     * @param   vTriangles  (OUT)   Triangles sorted lexicographically
+     */
+    static void getTriangles(Dcel &dcel, vector<TestTriangle> &vTriangles);
+};
+
+
+#endif //DELAUNAY_TESTTRIANGLES_H
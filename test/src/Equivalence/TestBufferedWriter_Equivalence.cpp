@@ -0,0 +1,282 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "BackgroundWriter.h"
+#include "BufferedWriter.h"
+#include "DcelReader.h"
+#include "DcelWriter.h"
+#include "Delaunay.h"
+#include "GraphReader.h"
+#include "GraphWriter.h"
+#include "NodeIO.h"
+#include "PointFactory.h"
+#include "TestSuite.h"
+#include "Voronoi.h"
+#include "VoronoiIO.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <random>
+#include <sstream>
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+// Buffer size small enough to flush many times while writing test data sets.
+#define TEST_BUFFER_SIZE        (1000)
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestBufferedWriter_Equivalence : public ::testing::Test
+    {
+    public:
+
+        static string readFile(const string &strFileName);
+        static string printDcel(const DcelModel &dcel);
+        static string printGraph(const Graph &graph, int nFaceNodes);
+        static void checkGraph(const Graph &graph, const Graph &readGraph);
+    };
+
+
+    string TestBufferedWriter_Equivalence::readFile(const string &strFileName)
+    {
+        ifstream ifs(strFileName.c_str(), ios::in | ios::binary);
+        return string((istreambuf_iterator<char>(ifs)), istreambuf_iterator<char>());
+    }
+
+
+    /**
+     * @fn      printDcel
+     * @brief   Formats a Dcel in flat format using the records operator<<
+     *
+     * @param   dcel    (IN) Dcel to format
+     * @return  flat format text
+     */
+    string TestBufferedWriter_Equivalence::printDcel(const DcelModel &dcel)
+    {
+        ostringstream out;
+        out << dcel.getNumVertex() << std::endl;
+        for (size_t i=0; i<dcel.getNumVertex() ;i++)
+        {
+            Vertex vertex = dcel.getVertex(i);
+            out << vertex;
+        }
+        out << dcel.getNumEdges() << std::endl;
+        for (size_t i=0; i<dcel.getNumEdges() ;i++)
+        {
+            Edge edge = dcel.getEdge(i);
+            out << edge;
+        }
+        out << dcel.getNumFaces() << std::endl;
+        for (size_t i=0; i<dcel.getNumFaces() ;i++)
+        {
+            Face face(dcel.getFaceEdge(i));
+            out << face << std::endl;
+        }
+
+        return out.str();
+    }
+
+
+    /**
+     * @fn      printGraph
+     * @brief   Formats a graph in flat format using NodeIO::write
+     *
+     * @param   graph       (IN) Graph to format
+     * @param   nFaceNodes  (IN) Number of face-node relations to format
+     * @return  flat format text
+     */
+    string TestBufferedWriter_Equivalence::printGraph(const Graph &graph, int nFaceNodes)
+    {
+        Graph copy;
+        copy = graph;
+        ostringstream out;
+        out << graph.getSize() << endl;
+        for (int i=0; i<graph.getSize() ; i++)
+        {
+            Node node = graph.getNode(i);
+            NodeIO::write(node, out);
+            out << endl;
+        }
+        for (int i=0; i<nFaceNodes ; i++)
+        {
+            out << copy.getNodeAssigned(i) << endl;
+        }
+
+        return out.str();
+    }
+
+
+    void TestBufferedWriter_Equivalence::checkGraph(const Graph &graph, const Graph &readGraph)
+    {
+        ASSERT_EQ(graph.getSize(), readGraph.getSize());
+        for (int i=0; i<graph.getSize() ; i++)
+        {
+            ASSERT_EQ(graph.getFace(i), readGraph.getFace(i));
+            ASSERT_EQ(graph.getNChildren(i), readGraph.getNChildren(i));
+            for (int j=0; j<graph.getNChildren(i) ; j++)
+            {
+                ASSERT_EQ(graph.getiChild(i, j), readGraph.getiChild(i, j));
+            }
+            int ids[NODE_POINTS], readIds[NODE_POINTS];
+            graph.getVertices(i, ids[0], ids[1], ids[2]);
+            readGraph.getVertices(i, readIds[0], readIds[1], readIds[2]);
+            for (int j=0; j<NODE_POINTS ; j++)
+            {
+                ASSERT_EQ(ids[j], readIds[j]);
+            }
+        }
+    }
+}
+
+
+/**
+ * DESCRIPTION: Numbers are formatted as ostream does by default with and without background writing
+ *
+ */
+TEST_F(TestBufferedWriter_Equivalence, Test_Numbers_Format)
+{
+    std::mt19937_64 generator(1);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    vector<double> vValues = {0.0, -0.0, 1e-4, 9.99995e-5, 0.5, 2.5, 0.125, 99999.95, 999999.4, 999999.5, 1e6,
+                              123456.5, 1.0000005, NAN, INFINITY, -INFINITY, DBL_MAX, DBL_MIN};
+    for (size_t i=0; i<NUM_POINTS_100K ; i++)
+    {
+        vValues.push_back(pow(10.0, distribution(generator)*30.0 - 15.0)*((i % 2 == 0) ? 1.0 : -1.0));
+        vValues.push_back(std::round(distribution(generator)*2e6) / pow(10.0, (double) (i % 12)));
+        vValues.push_back((float) (distribution(generator)*1000.0));
+    }
+
+    ostringstream out;
+    for (auto value : vValues)
+    {
+        out << value << " " << (long long) (value*1e3) << "\n";
+    }
+
+    string strFileName = "bufferedNumbers.txt";
+    for (bool isBackground : {false, true})
+    {
+        BufferedWriter writer;
+        ASSERT_TRUE(writer.open(strFileName, isBackground, TEST_BUFFER_SIZE));
+        for (auto value : vValues)
+        {
+            writer.writeReal(value);
+            writer.writeChar(' ');
+            writer.writeInt((long long) (value*1e3));
+            writer.writeChar('\n');
+        }
+        ASSERT_TRUE(writer.close());
+        ASSERT_FALSE(writer.isOpen());
+        ASSERT_EQ(out.str(), readFile(strFileName));
+    }
+    std::remove(strFileName.c_str());
+
+    // File cannot be created
+    BufferedWriter writer;
+    ASSERT_FALSE(writer.open("missingFolder/bufferedNumbers.txt"));
+}
+
+
+/**
+ * DESCRIPTION: Dcel, Voronoi and graph files are equal to the records operator<< output and are read back equal
+ *
+ */
+TEST_F(TestBufferedWriter_Equivalence, Test_Dcel_Graph)
+{
+    vector<Point<TYPE>> vPoints;
+    PointFactory::generateRandom(NUM_POINTS_10K, vPoints);
+    Delaunay delaunay(vPoints);
+    ASSERT_TRUE(delaunay.build());
+    const Dcel &dcel = *delaunay.getRefDcel();
+    Voronoi voronoi(&dcel);
+    ASSERT_TRUE(voronoi.build());
+
+    string strFlatFileName = "bufferedDcel.txt";
+    string strBinaryFileName = "bufferedDcel.bin";
+    for (bool isBackground : {false, true})
+    {
+        // Dcel
+        ASSERT_TRUE(DcelWriter::write(strFlatFileName, dcel, isBackground));
+        ASSERT_EQ(printDcel(dcel), readFile(strFlatFileName));
+        Dcel readDcel;
+        ASSERT_TRUE(DcelReader::read(strFlatFileName, readDcel));
+        ASSERT_EQ(dcel.getNumEdges(), readDcel.getNumEdges());
+        ASSERT_TRUE(DcelWriter::write(strBinaryFileName, dcel, isBackground));
+        readDcel.reset();
+        ASSERT_TRUE(DcelReader::read(strBinaryFileName, readDcel));
+        ASSERT_TRUE(readDcel == dcel);
+
+        // Voronoi
+        ASSERT_TRUE(VoronoiIO::write(strFlatFileName, voronoi, isBackground));
+        ASSERT_EQ(printDcel(*voronoi.getRefDcel()), readFile(strFlatFileName));
+        ASSERT_TRUE(VoronoiIO::write(strBinaryFileName, voronoi, isBackground));
+        Voronoi readVoronoi;
+        ASSERT_TRUE(VoronoiIO::read(strBinaryFileName, readVoronoi));
+        ASSERT_TRUE(*readVoronoi.getRefDcel() == *voronoi.getRefDcel());
+
+        // Graph
+        const Graph &graph = *delaunay.getGraph();
+        ASSERT_TRUE(GraphWriter::write(strFlatFileName, graph, isBackground));
+        string strGraph = readFile(strFlatFileName);
+        auto nFaceNodes = (int) (std::count(strGraph.begin(), strGraph.end(), '\n') - graph.getSize() - 1);
+        ASSERT_EQ(printGraph(graph, nFaceNodes), strGraph);
+        Graph readGraph;
+        ASSERT_TRUE(GraphReader::read(strFlatFileName, readGraph));
+        checkGraph(graph, readGraph);
+        ASSERT_TRUE(GraphWriter::write(strBinaryFileName, graph, isBackground));
+        Graph readBinaryGraph;
+        ASSERT_TRUE(GraphReader::read(strBinaryFileName, readBinaryGraph));
+        checkGraph(graph, readBinaryGraph);
+    }
+    std::remove(strFlatFileName.c_str());
+    std::remove(strBinaryFileName.c_str());
+}
+
+
+/**
+ * DESCRIPTION: Next triangulation is built while previous one is written in background
+ *
+ */
+TEST_F(TestBufferedWriter_Equivalence, Test_Background_Writer)
+{
+    vector<string> vFileNames = {"background0.bin", "background1.bin", "background2.bin"};
+    vector<Dcel> vDcels(vFileNames.size());
+
+    BackgroundWriter writer;
+    ASSERT_FALSE(writer.isRunning());
+    for (size_t i=0; i<vFileNames.size() ; i++)
+    {
+        vector<Point<TYPE>> vPoints;
+        PointFactory::generateRandom(NUM_POINTS_10K, vPoints);
+        Delaunay delaunay(vPoints);
+        ASSERT_TRUE(delaunay.build());
+        vDcels[i] = *delaunay.getRefDcel();
+
+        const Dcel &dcel = vDcels[i];
+        const string &strFileName = vFileNames[i];
+        ASSERT_TRUE(writer.start([&dcel, &strFileName]() { return DcelWriter::write(strFileName, dcel); }));
+    }
+    ASSERT_TRUE(writer.wait());
+    ASSERT_FALSE(writer.isRunning());
+
+    for (size_t i=0; i<vFileNames.size() ; i++)
+    {
+        Dcel readDcel;
+        ASSERT_TRUE(DcelReader::read(vFileNames[i], readDcel));
+        ASSERT_TRUE(readDcel == vDcels[i]);
+        std::remove(vFileNames[i].c_str());
+    }
+
+    // Failed write is returned by wait
+    writer.start([]() { return DcelWriter::write("missingFolder/background.bin", Dcel()); });
+    ASSERT_FALSE(writer.wait());
+}
@@ -0,0 +1,245 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "CompressedReader.h"
+#include "CompressedWriter.h"
+#include "DcelReader.h"
+#include "Delaunay.h"
+#include "PointFactory.h"
+#include "StarTriangulation.h"
+#include "TestSuite.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestCompressed_Equivalence : public ::testing::Test
+    {
+    public:
+
+        static void checkTriangles(const TriangleMesh &mesh, const TriangleMesh &readMesh);
+        static void checkRenumbered(const TriangleMesh &mesh, const TriangleMesh &readMesh);
+        static string readFile(const string &strFileName);
+    };
+
+
+    void TestCompressed_Equivalence::checkTriangles(const TriangleMesh &mesh, const TriangleMesh &readMesh)
+    {
+        ASSERT_EQ(mesh.getNumVertex(), readMesh.getNumVertex());
+        ASSERT_EQ(mesh.getNumEdges(), readMesh.getNumEdges());
+        for (size_t i=0; i<mesh.getNumEdges() ; i++)
+        {
+            ASSERT_EQ(mesh.getOrigin(i), readMesh.getOrigin(i));
+            ASSERT_EQ(mesh.getTwin(i), readMesh.getTwin(i));
+        }
+    }
+
+
+    /**
+     * @fn      checkRenumbered
+     * @brief   Checks a mesh read from a file written from a Dcel has the same triangles (corners in the same order)
+     *          in a different order and its twins are consistent
+     */
+    void TestCompressed_Equivalence::checkRenumbered(const TriangleMesh &mesh, const TriangleMesh &readMesh)
+    {
+        ASSERT_EQ(mesh.getNumVertex(), readMesh.getNumVertex());
+        ASSERT_EQ(mesh.getNumEdges(), readMesh.getNumEdges());
+        vector<vector<int>> vTriangles, vReadTriangles;
+        for (size_t i=0; i<mesh.getNumEdges() ; i+=NPOINTS_TRIANGLE)
+        {
+            vTriangles.push_back({mesh.getOrigin(i), mesh.getOrigin(i+1), mesh.getOrigin(i+2)});
+            vReadTriangles.push_back({readMesh.getOrigin(i), readMesh.getOrigin(i+1), readMesh.getOrigin(i+2)});
+        }
+        ASSERT_NE(vTriangles, vReadTriangles);
+        std::sort(vTriangles.begin(), vTriangles.end());
+        std::sort(vReadTriangles.begin(), vReadTriangles.end());
+        ASSERT_EQ(vTriangles, vReadTriangles);
+
+        // Twin of edge (a, b) is edge (b, a)
+        for (size_t i=0; i<readMesh.getNumEdges() ; i++)
+        {
+            int twin = readMesh.getTwin(i);
+            if (twin != NO_TWIN)
+            {
+                ASSERT_EQ((int) i + 1, readMesh.getTwin(twin-1));
+                ASSERT_EQ(readMesh.getOrigin(i), readMesh.getOrigin(TriangleMesh::getNext(twin-1)-1));
+            }
+        }
+    }
+
+
+    string TestCompressed_Equivalence::readFile(const string &strFileName)
+    {
+        ifstream ifs(strFileName.c_str(), ios::in | ios::binary);
+        return string((istreambuf_iterator<char>(ifs)), istreambuf_iterator<char>());
+    }
+}
+
+
+/**
+ * DESCRIPTION: Mesh and Dcel read from a full precision compressed file are equal to the original ones. File does not
+ *              depend on the number of threads
+ *
+ */
+TEST_F(TestCompressed_Equivalence, Test_Full_Precision)
+{
+    vector<Point<TYPE>> vPoints;
+    PointFactory::generateRandom(NUM_POINTS_100K, vPoints);
+    Delaunay delaunay(vPoints);
+    ASSERT_TRUE(delaunay.build());
+    TriangleMesh mesh(*delaunay.getRefDcel());
+
+    string strFileName = "compressed.dat";
+    string strThreadsFileName = "compressedThreads.dat";
+    ASSERT_TRUE(CompressedWriter::write(strFileName, mesh, 0.0, 1));
+    ASSERT_TRUE(CompressedWriter::write(strThreadsFileName, mesh, 0.0, 3));
+    ASSERT_TRUE(CompressedReader::isCompressed(strFileName));
+    ASSERT_EQ(readFile(strFileName), readFile(strThreadsFileName));
+
+    TriangleMesh readMesh;
+    ASSERT_TRUE(CompressedReader::read(strFileName, readMesh, 3));
+    checkTriangles(mesh, readMesh);
+    for (size_t i=0; i<mesh.getNumVertex() ; i++)
+    {
+        ASSERT_EQ(*mesh.getRefPoint(i), *readMesh.getRefPoint(i));
+    }
+
+    // Dcel reader detects compressed files
+    Dcel dcel, readDcel;
+    ASSERT_TRUE(mesh.toDcel(dcel));
+    ASSERT_TRUE(DcelReader::read(strFileName, readDcel));
+    ASSERT_TRUE(readDcel == dcel);
+    std::remove(strFileName.c_str());
+    std::remove(strThreadsFileName.c_str());
+}
+
+
+/**
+ * DESCRIPTION: Quantized points are at most half a cell away from the original points and triangles do not change.
+ *              Triangles written from a Dcel are renumbered
+ *
+ */
+TEST_F(TestCompressed_Equivalence, Test_Quantized)
+{
+    vector<Point<TYPE>> vPoints;
+    PointFactory::generateRandom(NUM_POINTS_10K, vPoints);
+    StarTriangulation triangulation(vPoints);
+    ASSERT_TRUE(triangulation.build());
+    Dcel &dcel = *triangulation.getRefDcel();
+
+    string strFileName = "quantized.dat";
+    double cellSize = 0.01;
+    ASSERT_TRUE(CompressedWriter::write(strFileName, dcel, cellSize));
+    TriangleMesh mesh(dcel), readMesh;
+    ASSERT_TRUE(CompressedReader::read(strFileName, readMesh));
+    checkRenumbered(mesh, readMesh);
+    for (size_t i=0; i<mesh.getNumVertex() ; i++)
+    {
+        ASSERT_LE(std::fabs(mesh.getRefPoint(i)->getX() - readMesh.getRefPoint(i)->getX()), cellSize*0.501);
+        ASSERT_LE(std::fabs(mesh.getRefPoint(i)->getY() - readMesh.getRefPoint(i)->getY()), cellSize*0.501);
+    }
+
+    // Quantized file is smaller
+    ASSERT_TRUE(CompressedWriter::write(strFileName + ".full", mesh));
+    ASSERT_LT(readFile(strFileName).size(), readFile(strFileName + ".full").size());
+    std::remove(strFileName.c_str());
+    std::remove((strFileName + ".full").c_str());
+
+    // Cell size must be positive and points range must fit in the grid
+    ASSERT_FALSE(CompressedWriter::write(strFileName, mesh, -1.0));
+    ASSERT_FALSE(CompressedWriter::write(strFileName, mesh, 1e-300));
+    ASSERT_FALSE(CompressedReader::isCompressed(strFileName));
+}
+
+
+/**
+ * DESCRIPTION: Imaginary faces of incremental Dcels are not written and real faces are renumbered. Points ids, convex
+ *              hull and number of real faces do not change
+ *
+ */
+TEST_F(TestCompressed_Equivalence, Test_Dcel_Renumbered)
+{
+    vector<Point<TYPE>> vPoints;
+    PointFactory::generateRandom(NUM_POINTS_10K, vPoints);
+    Delaunay delaunay(vPoints);
+    ASSERT_TRUE(delaunay.build());
+    Dcel &dcel = *delaunay.getRefDcel();
+
+    string strFileName = "renumbered.dat";
+    ASSERT_TRUE(CompressedWriter::write(strFileName, dcel));
+    TriangleMesh mesh(dcel), readMesh;
+    ASSERT_TRUE(CompressedReader::read(strFileName, readMesh));
+    checkRenumbered(mesh, readMesh);
+    ASSERT_LT(mesh.getNumFaces(), dcel.getNumFaces());
+    ASSERT_FALSE(readMesh.hasImaginaryFaces());
+
+    // Dcel read is the Dcel of the mesh read
+    Dcel readDcel, meshDcel;
+    ASSERT_TRUE(CompressedReader::read(strFileName, readDcel));
+    ASSERT_TRUE(readMesh.toDcel(meshDcel));
+    ASSERT_TRUE(readDcel == meshDcel);
+    for (int i=0; i<(int) dcel.getNumVertex() ; i++)
+    {
+        ASSERT_EQ(*dcel.getRefPoint(i), *readDcel.getRefPoint(i));
+    }
+
+    // Same convex hull edges
+    vector<pair<int,int>> vHull, vReadHull;
+    for (size_t i=0; i<mesh.getNumEdges() ; i++)
+    {
+        if (mesh.isExternalEdge(i))
+        {
+            vHull.emplace_back(mesh.getOrigin(i), mesh.getOrigin(TriangleMesh::getNext(i)-1));
+        }
+        if (readMesh.isExternalEdge(i))
+        {
+            vReadHull.emplace_back(readMesh.getOrigin(i), readMesh.getOrigin(TriangleMesh::getNext(i)-1));
+        }
+    }
+    std::sort(vHull.begin(), vHull.end());
+    std::sort(vReadHull.begin(), vReadHull.end());
+    ASSERT_EQ(vHull, vReadHull);
+    std::remove(strFileName.c_str());
+}
+
+
+/**
+ * DESCRIPTION: Truncated and corrupted files are rejected
+ *
+ */
+TEST_F(TestCompressed_Equivalence, Test_Corrupted)
+{
+    vector<Point<TYPE>> vPoints;
+    PointFactory::generateRandom(NUM_POINTS_1K, vPoints);
+    Delaunay delaunay(vPoints);
+    ASSERT_TRUE(delaunay.build());
+
+    string strFileName = "corrupted.dat";
+    ASSERT_TRUE(CompressedWriter::write(strFileName, *delaunay.getRefDcel(), 0.01));
+    string strData = readFile(strFileName);
+
+    // Truncated file
+    ofstream ofs(strFileName.c_str(), ios::out | ios::binary);
+    ofs.write(strData.data(), (streamsize) (strData.size() - 1));
+    ofs.close();
+    TriangleMesh mesh;
+    ASSERT_FALSE(CompressedReader::read(strFileName, mesh));
+    ASSERT_EQ((size_t) 0, mesh.getNumEdges());
+
+    // Last varint of the last triangles block continues after the block end
+    strData.back() = (char) 0xFF;
+    ofs.open(strFileName.c_str(), ios::out | ios::binary);
+    ofs.write(strData.data(), (streamsize) strData.size());
+    ofs.close();
+    Dcel dcel;
+    ASSERT_FALSE(DcelReader::read(strFileName, dcel));
+    std::remove(strFileName.c_str());
+}
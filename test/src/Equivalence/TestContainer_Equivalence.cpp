@@ -0,0 +1,249 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "ContainerReader.h"
+#include "ContainerWriter.h"
+#include "Crc32.h"
+#include "DcelReader.h"
+#include "Delaunay.h"
+#include "Gabriel.h"
+#include "GraphReader.h"
+#include "PointFactory.h"
+#include "PointsReader.h"
+#include "TestSuite.h"
+#include "Voronoi.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <gtest/gtest.h>
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestContainer_Equivalence : public ::testing::Test
+    {
+    public:
+
+        static void checkGraph(const Graph &graph, const Graph &readGraph);
+        static void corruptFile(const string &strFileName, size_t szOffset, size_t szNewSize);
+    };
+
+
+    void TestContainer_Equivalence::checkGraph(const Graph &graph, const Graph &readGraph)
+    {
+        ASSERT_EQ(graph.getSize(), readGraph.getSize());
+        for (int i=0; i<graph.getSize() ; i++)
+        {
+            ASSERT_EQ(graph.getFace(i), readGraph.getFace(i));
+            ASSERT_EQ(graph.getNChildren(i), readGraph.getNChildren(i));
+            for (int j=0; j<graph.getNChildren(i) ; j++)
+            {
+                ASSERT_EQ(graph.getiChild(i, j), readGraph.getiChild(i, j));
+            }
+            int ids[NODE_POINTS], readIds[NODE_POINTS];
+            graph.getVertices(i, ids[0], ids[1], ids[2]);
+            readGraph.getVertices(i, readIds[0], readIds[1], readIds[2]);
+            for (int j=0; j<NODE_POINTS ; j++)
+            {
+                ASSERT_EQ(ids[j], readIds[j]);
+            }
+        }
+    }
+
+
+    /**
+     * @fn      corruptFile
+     * @brief   Flips a byte of a file and truncates it
+     *
+     * @param   strFileName     (IN) File name
+     * @param   szOffset        (IN) Offset of the byte to flip
+     * @param   szNewSize       (IN) File size after truncation
+     */
+    void TestContainer_Equivalence::corruptFile(const string &strFileName, size_t szOffset, size_t szNewSize)
+    {
+        ifstream ifs(strFileName.c_str(), ios::in | ios::binary);
+        string strData((istreambuf_iterator<char>(ifs)), istreambuf_iterator<char>());
+        ifs.close();
+        strData[szOffset] = (char) ~strData[szOffset];
+        ofstream ofs(strFileName.c_str(), ios::out | ios::binary);
+        ofs.write(strData.data(), (streamsize) min(szNewSize, strData.size()));
+        ofs.close();
+    }
+}
+
+
+/**
+ * DESCRIPTION: All data sets written to a container are read back equal and can be read independently
+ *
+ */
+TEST_F(TestContainer_Equivalence, Test_All_Sections)
+{
+    vector<Point<TYPE>> vPoints;
+    PointFactory::generateRandom(NUM_POINTS_10K, vPoints);
+    Delaunay delaunay(vPoints);
+    ASSERT_TRUE(delaunay.build());
+    const Dcel &dcel = *delaunay.getRefDcel();
+    Voronoi voronoi(&dcel);
+    ASSERT_TRUE(voronoi.build());
+    Gabriel gabriel(dcel);
+    ASSERT_TRUE(gabriel.build());
+
+    string strFileName = "container.dat";
+    ContainerWriter writer;
+    writer.addPoints(vPoints);
+    writer.addDcel(dcel);
+    writer.addGraph(*delaunay.getGraph());
+    writer.addVoronoi(voronoi);
+    writer.addGabriel(gabriel);
+    ASSERT_TRUE(writer.write(strFileName));
+    ASSERT_FALSE(ContainerReader::isContainer(strFileName + ".tmp"));
+    ASSERT_TRUE(ContainerReader::isContainer(strFileName));
+
+    // Data sets are read in any order
+    ContainerReader reader;
+    ASSERT_TRUE(reader.open(strFileName));
+    ASSERT_EQ(sizeof(TYPE), reader.getTypeSize());
+    Gabriel readGabriel(dcel);
+    ASSERT_TRUE(reader.readGabriel(readGabriel));
+    ASSERT_TRUE(readGabriel.isValid());
+    for (int i=0; i<gabriel.getSize() ; i++)
+    {
+        ASSERT_EQ(gabriel.isSet(i), readGabriel.isSet(i));
+    }
+    Voronoi readVoronoi;
+    ASSERT_TRUE(reader.readVoronoi(readVoronoi));
+    ASSERT_TRUE(*readVoronoi.getRefDcel() == *voronoi.getRefDcel());
+    Dcel readDcel;
+    ASSERT_TRUE(reader.readDcel(readDcel));
+    ASSERT_TRUE(readDcel == dcel);
+    Graph readGraph;
+    ASSERT_TRUE(reader.readGraph(readGraph));
+    checkGraph(*delaunay.getGraph(), readGraph);
+    vector<Point<TYPE>> vReadPoints;
+    ASSERT_TRUE(reader.readPoints(vReadPoints));
+    ASSERT_EQ(vPoints, vReadPoints);
+    reader.close();
+
+    // Existing readers detect containers
+    Dcel dcelReaderDcel;
+    ASSERT_TRUE(DcelReader::read(strFileName, dcelReaderDcel));
+    ASSERT_TRUE(dcelReaderDcel == dcel);
+    Graph graphReaderGraph;
+    ASSERT_TRUE(GraphReader::read(strFileName, graphReaderGraph));
+    checkGraph(*delaunay.getGraph(), graphReaderGraph);
+    vReadPoints.clear();
+    ASSERT_TRUE(PointsReader::read(strFileName, vReadPoints));
+    ASSERT_EQ(vPoints, vReadPoints);
+
+    // Container with Dcel only
+    writer.clear();
+    writer.addDcel(dcel);
+    ASSERT_TRUE(writer.write(strFileName));
+    ASSERT_TRUE(reader.open(strFileName));
+    ASSERT_TRUE(reader.hasGroup(CONTAINER_DCEL));
+    ASSERT_FALSE(reader.hasGroup(CONTAINER_GRAPH));
+    ASSERT_FALSE(reader.readGraph(readGraph));
+    ASSERT_EQ(0, readGraph.getSize());
+    ASSERT_TRUE(reader.readDcel(readDcel));
+    ASSERT_TRUE(readDcel == dcel);
+    std::remove(strFileName.c_str());
+}
+
+
+/**
+ * DESCRIPTION: Corrupted sections and truncated containers are detected
+ *
+ */
+TEST_F(TestContainer_Equivalence, Test_Corrupted)
+{
+    vector<Point<TYPE>> vPoints;
+    PointFactory::generateRandom(NUM_POINTS_1K, vPoints);
+    Delaunay delaunay(vPoints);
+    ASSERT_TRUE(delaunay.build());
+
+    string strFileName = "corrupted.dat";
+    ContainerWriter writer;
+    writer.addPoints(vPoints);
+    writer.addDcel(*delaunay.getRefDcel());
+    ASSERT_TRUE(writer.write(strFileName));
+
+    // Corrupt last byte of the Dcel faces (last section). Points are still valid
+    ifstream ifs(strFileName.c_str(), ios::in | ios::binary | ios::ate);
+    auto szSize = (size_t) ifs.tellg();
+    ifs.close();
+    corruptFile(strFileName, szSize - 1, szSize);
+    ContainerReader reader;
+    ASSERT_TRUE(reader.open(strFileName));
+    Dcel dcel;
+    ASSERT_FALSE(reader.readDcel(dcel));
+    ASSERT_EQ(0, dcel.getNumVertex());
+    vector<Point<TYPE>> vReadPoints;
+    ASSERT_TRUE(reader.readPoints(vReadPoints));
+    ASSERT_EQ(vPoints, vReadPoints);
+    reader.close();
+
+    // Truncated file
+    corruptFile(strFileName, 0, szSize - 1);
+    ASSERT_FALSE(ContainerReader::isContainer(strFileName));
+    corruptFile(strFileName, 0, szSize - 1);
+    ASSERT_TRUE(ContainerReader::isContainer(strFileName));
+    ASSERT_FALSE(reader.open(strFileName));
+    ASSERT_FALSE(reader.isOpen());
+
+    // Corrupted header
+    corruptFile(strFileName, CONTAINER_MAGIC_LENGTH, szSize);
+    ASSERT_FALSE(reader.open(strFileName));
+    std::remove(strFileName.c_str());
+}
+
+
+/**
+ * DESCRIPTION: Points written with the other coordinates type are converted
+ *
+ */
+TEST_F(TestContainer_Equivalence, Test_Coordinates_Type)
+{
+    // Points written by a build using the other coordinates type
+    typedef std::conditional<sizeof(TYPE) == sizeof(float), double, float>::type OTHER_TYPE;
+    vector<OTHER_TYPE> vCoordinates = {(OTHER_TYPE) 1.5, (OTHER_TYPE) -2.25, (OTHER_TYPE) 1e3, (OTHER_TYPE) 0.125};
+
+    ContainerSection section = {};
+    section.group = CONTAINER_POINTS;
+    section.elementSize = 2*sizeof(OTHER_TYPE);
+    section.offset = sizeof(ContainerHeader) + sizeof(ContainerSection);
+    section.count = vCoordinates.size() / 2;
+    section.crc = Crc32::compute(vCoordinates.data(), sizeof(OTHER_TYPE)*vCoordinates.size());
+    section.flags = CONTAINER_FLAG_COORDINATES;
+    ContainerHeader header = {};
+    memcpy(header.arrMagic, CONTAINER_MAGIC, CONTAINER_MAGIC_LENGTH);
+    header.version = CONTAINER_VERSION;
+    header.endianTag = CONTAINER_ENDIAN_TAG;
+    header.typeSize = sizeof(OTHER_TYPE);
+    header.numSections = 1;
+    header.tableCrc = Crc32::compute(&section, sizeof(section));
+    header.headerCrc = Crc32::compute(&header, sizeof(header));
+
+    string strFileName = "coordinates.dat";
+    ofstream ofs(strFileName.c_str(), ios::out | ios::binary);
+    ofs.write((const char *) &header, sizeof(header));
+    ofs.write((const char *) &section, sizeof(section));
+    ofs.write((const char *) vCoordinates.data(), (streamsize) (sizeof(OTHER_TYPE)*vCoordinates.size()));
+    ofs.close();
+
+    ContainerReader reader;
+    ASSERT_TRUE(reader.open(strFileName));
+    ASSERT_EQ(sizeof(OTHER_TYPE), reader.getTypeSize());
+    vector<Point<TYPE>> vPoints;
+    ASSERT_TRUE(reader.readPoints(vPoints));
+    vector<Point<TYPE>> vExpected = {Point<TYPE>(1.5, -2.25), Point<TYPE>(1e3, 0.125)};
+    ASSERT_EQ(vExpected, vPoints);
+    reader.close();
+    std::remove(strFileName.c_str());
+
+    // CRC of known data
+    ASSERT_EQ(0xCBF43926u, Crc32::compute("123456789", 9));
+}
@@ -0,0 +1,132 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include <algorithm>
+#include <iostream>
+#include <gtest/gtest.h>
+
+#include "Delaunay.h"
+#include "PointFactory.h"
+#include "TestTriangles.h"
+#include "TriangulationFactory.h"
+
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+#define NUM_POINTS_1K            (1000)
+#define NUM_POINTS_10K           (10000)
+
+#define NUM_ITERATIONS_10          (10)
+#define NUM_ITERATIONS_100         (100)
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestDelaunayWalk_Equivalence : public ::testing::Test
+    {
+
+    protected:
+
+        // You can remove any or all of the following functions if its body
+        // is empty.
+        // Constructor (called before each test case) - SetUp
+        TestDelaunayWalk_Equivalence() = default;
+
+        // Deconstructor (called after each test case) - TearDown
+        ~TestDelaunayWalk_Equivalence() override = default;
+
+    public:
+
+        static void executeSubtest(size_t szNumPoints, size_t szNumIterations);
+    };
+
+    void TestDelaunayWalk_Equivalence::executeSubtest(size_t szNumPoints, size_t szNumIterations)
+    {
+        // Execute test szNumIterations times
+        for (size_t i=0; i<szNumIterations ; i++)
+        {
+            // Generate random points set
+            vector<Point<TYPE>> vPoints;
+            PointFactory::generateRandom(szNumPoints, vPoints);
+
+            // Build Delaunay triangulation using history graph
+            bool isSuccess;
+            Delaunay *graph = TriangulationFactory::createDelaunay(vPoints, isSuccess, GRAPH_LOCATION);
+            ASSERT_TRUE(isSuccess);
+
+            // Build Delaunay triangulation using spatially sorted insertion and walk
+            Delaunay *walk = TriangulationFactory::createDelaunay(vPoints, isSuccess, WALK_LOCATION);
+            ASSERT_TRUE(isSuccess);
+
+            // Check both have the same set of triangles
+            vector<TestTriangle> vGraph;
+            vector<TestTriangle> vWalk;
+            TestTriangles::getTriangles(*graph->getRefDcel(), vGraph);
+            TestTriangles::getTriangles(*walk->getRefDcel(), vWalk);
+            cout << "Test " << (i+1) << "/" << szNumIterations << endl;
+            ASSERT_EQ(vGraph.size(), vWalk.size());
+            ASSERT_TRUE(vGraph == vWalk);
+
+            // Check random points are located in faces with the same points. Points that are equal to a vertex
+            // belong to several faces so they are skipped.
+            auto lexicographic = [](const Point<TYPE> &p, const Point<TYPE> &q)
+            {
+                return (p.getX() < q.getX()) || ((p.getX() == q.getX()) && (p.getY() < q.getY()));
+            };
+            vector<Point<TYPE>> vSorted(vPoints);
+            sort(vSorted.begin(), vSorted.end(), lexicographic);
+
+            vector<Point<TYPE>> vQueries;
+            PointFactory::generateRandom(szNumPoints, vQueries);
+            for (auto &query : vQueries)
+            {
+                if (binary_search(vSorted.begin(), vSorted.end(), query, lexicographic))
+                {
+                    continue;
+                }
+
+                int graphFace, walkFace;
+                ASSERT_TRUE(graph->findFace(query, graphFace));
+                ASSERT_TRUE(walk->findFace(query, walkFace));
+                ASSERT_EQ(graphFace == EXTERNAL_FACE, walkFace == EXTERNAL_FACE);
+                if (graphFace != EXTERNAL_FACE)
+                {
+                    vector<Point<TYPE>> vGraphPoints, vWalkPoints;
+                    graph->getRefDcel()->getFacePoints(graphFace, vGraphPoints);
+                    walk->getRefDcel()->getFacePoints(walkFace, vWalkPoints);
+                    ASSERT_TRUE(is_permutation(vGraphPoints.begin(), vGraphPoints.end(), vWalkPoints.begin()));
+                }
+            }
+
+            // Free resources
+            delete walk;
+            delete graph;
+        }
+    }
+}
+
+
+/**
+ * DESCRIPTION: walk location triangulation is equal to history graph triangulation using 1K points
+ *
+ */
+TEST_F(TestDelaunayWalk_Equivalence, Test_Num_Samples_1000_Iter_100)
+{
+    executeSubtest(NUM_POINTS_1K, NUM_ITERATIONS_100);
+}
+
+
+/**
+ * DESCRIPTION: walk location triangulation is equal to history graph triangulation using 10K points
+ *
+ */
+TEST_F(TestDelaunayWalk_Equivalence, Test_Num_Samples_10000_Iter_10)
+{
+    executeSubtest(NUM_POINTS_10K, NUM_ITERATIONS_10);
+}
@@ -0,0 +1,246 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <gtest/gtest.h>
+
+#include "Delaunay.h"
+#include "DivideConquerDelaunay.h"
+#include "PointFactory.h"
+#include "Predicates.h"
+#include "TestTriangles.h"
+#include "TriangulationFactory.h"
+
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+#define NUM_POINTS_1K            (1000)
+#define NUM_POINTS_10K           (10000)
+#define NUM_POINTS_100K          (100000)
+
+#define NUM_ITERATIONS_10          (10)
+#define NUM_ITERATIONS_100         (100)
+
+#define NUM_CIRCLE_POINTS          (2000)
+#define CIRCLE_RADIUS              (100.0)
+#define CIRCLE_OFFSET              (1e7)
+#define GRID_SIZE                  (40)
+#define GRID_JITTER                (1e-9)
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestDivideConquer_Equivalence : public ::testing::Test
+    {
+
+    protected:
+
+        // You can remove any or all of the following functions if its body
+        // is empty.
+        // Constructor (called before each test case) - SetUp
+        TestDivideConquer_Equivalence() = default;
+
+        // Deconstructor (called after each test case) - TearDown
+        ~TestDivideConquer_Equivalence() override = default;
+
+    public:
+
+        static void executeSubtest(size_t szNumPoints, size_t szNumIterations, size_t szNumThreads);
+
+        /**
+         * @fn      executeDegenerateSubtest
+         * @brief   Builds divide and conquer triangulation of a degenerate points set (cocircular or nearly
+         *          cocircular points) in one and several threads. Delaunay triangulation of these sets is not unique
+         *          so instead of comparing triangles it checks every point is a vertex, every triangle is
+         *          counterclockwise, every edge is locally Delaunay and the number of triangles matches the convex hull
+         *
+         * @param   vPoints     (IN)    Points to triangulate
+         */
+        static void executeDegenerateSubtest(vector<Point<TYPE>> &vPoints);
+
+        static void generateCircle(TYPE offset, vector<Point<TYPE>> &vPoints);
+    };
+
+    void TestDivideConquer_Equivalence::executeSubtest(size_t szNumPoints, size_t szNumIterations,
+                                                       size_t szNumThreads)
+    {
+        // Execute test szNumIterations times
+        for (size_t i=0; i<szNumIterations ; i++)
+        {
+            // Generate random points set
+            vector<Point<TYPE>> vPoints;
+            PointFactory::generateRandom(szNumPoints, vPoints);
+
+            // Build incremental Delaunay triangulation
+            bool isSuccess;
+            Delaunay *delaunay = TriangulationFactory::createDelaunay(vPoints, isSuccess);
+            ASSERT_TRUE(isSuccess);
+
+            // Build divide and conquer Delaunay triangulation
+            DivideConquerDelaunay *divideConquer = TriangulationFactory::createDivideConquer(vPoints, isSuccess,
+                                                                                             szNumThreads);
+            ASSERT_TRUE(isSuccess);
+
+            // Check both have the same set of triangles
+            vector<TestTriangle> vIncremental;
+            vector<TestTriangle> vDivideConquer;
+            TestTriangles::getTriangles(*delaunay->getRefDcel(), vIncremental);
+            TestTriangles::getTriangles(*divideConquer->getRefDcel(), vDivideConquer);
+            cout << "Test " << (i+1) << "/" << szNumIterations << endl;
+            ASSERT_EQ(vIncremental.size(), vDivideConquer.size());
+            ASSERT_TRUE(vIncremental == vDivideConquer);
+
+            // Check both have the same convex hull
+            Polygon hullIncremental;
+            Polygon hullDivideConquer;
+            ASSERT_TRUE(delaunay->convexHull());
+            ASSERT_TRUE(divideConquer->convexHull());
+            delaunay->getConvexHull(hullIncremental);
+            divideConquer->getConvexHull(hullDivideConquer);
+            ASSERT_TRUE(hullIncremental == hullDivideConquer);
+
+            // Free resources
+            delete divideConquer;
+            delete delaunay;
+        }
+    }
+
+    void TestDivideConquer_Equivalence::executeDegenerateSubtest(vector<Point<TYPE>> &vPoints)
+    {
+        for (size_t szNumThreads : {1, 4})
+        {
+            DivideConquerDelaunay divideConquer(vPoints, szNumThreads);
+            ASSERT_TRUE(divideConquer.build());
+            Dcel *dcel = divideConquer.getRefDcel();
+
+            // Triangulation of n points with h convex hull edges has 2n-h-2 triangles plus the external face
+            size_t szNumHullEdges=0;
+            for (size_t edgeIndex=0; edgeIndex<dcel->getNumEdges() ;edgeIndex++)
+            {
+                szNumHullEdges += (dcel->getFace(edgeIndex) == EXTERNAL_FACE) ? 1 : 0;
+            }
+            ASSERT_EQ(2*vPoints.size() - szNumHullEdges - 1, dcel->getNumFaces());
+
+            for (size_t pointIndex=0; pointIndex<dcel->getNumVertex() ;pointIndex++)
+            {
+                ASSERT_NE(INVALID, dcel->getPointEdge(pointIndex));
+            }
+
+            for (int edgeIndex=0; edgeIndex<(int) dcel->getNumEdges() ;edgeIndex++)
+            {
+                if (dcel->getFace(edgeIndex) == EXTERNAL_FACE)
+                {
+                    continue;
+                }
+
+                Point<TYPE> *p1 = dcel->getRefPoint(dcel->getOrigin(edgeIndex)-1);
+                Point<TYPE> *p2 = dcel->getRefPoint(dcel->getOrigin(dcel->getNext(edgeIndex)-1)-1);
+                Point<TYPE> *p3 = dcel->getRefPoint(dcel->getOrigin(dcel->getPrevious(edgeIndex)-1)-1);
+                ASSERT_EQ(LEFT_TURN, Predicates::turn(*p1, *p2, *p3));
+
+                int twinIndex = dcel->getTwin(edgeIndex) - 1;
+                if (dcel->getFace(twinIndex) != EXTERNAL_FACE)
+                {
+                    Point<TYPE> *q = dcel->getRefPoint(dcel->getOrigin(dcel->getPrevious(twinIndex)-1)-1);
+                    ASSERT_FALSE(Predicates::inCircle(*p1, *p2, *p3, *q));
+                }
+            }
+        }
+    }
+
+    void TestDivideConquer_Equivalence::generateCircle(TYPE offset, vector<Point<TYPE>> &vPoints)
+    {
+        vPoints.clear();
+        for (int i=0; i<NUM_CIRCLE_POINTS ;i++)
+        {
+            double angle = 2.0*M_PI*i/NUM_CIRCLE_POINTS;
+            vPoints.push_back(Point<TYPE>(offset + CIRCLE_RADIUS*cos(angle), offset + CIRCLE_RADIUS*sin(angle)));
+        }
+    }
+}
+
+
+/**
+ * DESCRIPTION: divide and conquer triangulation in one thread is equal to incremental triangulation
+ *
+ */
+TEST_F(TestDivideConquer_Equivalence, Test_Num_Samples_1000_Iter_100_Single_Thread)
+{
+    executeSubtest(NUM_POINTS_1K, NUM_ITERATIONS_100, 1);
+}
+
+
+/**
+ * DESCRIPTION: divide and conquer triangulation in several threads is equal to incremental triangulation
+ *
+ */
+TEST_F(TestDivideConquer_Equivalence, Test_Num_Samples_10000_Iter_10_Four_Threads)
+{
+    executeSubtest(NUM_POINTS_10K, NUM_ITERATIONS_10, 4);
+}
+
+
+/**
+ * DESCRIPTION: divide and conquer triangulation using all cores is equal to incremental triangulation
+ *
+ */
+TEST_F(TestDivideConquer_Equivalence, Test_Num_Samples_100000_Iter_10_All_Threads)
+{
+    executeSubtest(NUM_POINTS_100K, NUM_ITERATIONS_10, 0);
+}
+
+
+/**
+ * DESCRIPTION: divide and conquer triangulation of points on a circle is a valid Delaunay triangulation
+ *
+ */
+TEST_F(TestDivideConquer_Equivalence, Test_Cocircular)
+{
+    vector<Point<TYPE>> vPoints;
+    generateCircle(0.0, vPoints);
+    executeDegenerateSubtest(vPoints);
+}
+
+
+/**
+ * DESCRIPTION: divide and conquer triangulation of points on a circle far from the origin is a valid Delaunay
+ *              triangulation (determinants lose all precision without exact predicates)
+ *
+ */
+TEST_F(TestDivideConquer_Equivalence, Test_Cocircular_Offset)
+{
+    vector<Point<TYPE>> vPoints;
+    generateCircle(CIRCLE_OFFSET, vPoints);
+    executeDegenerateSubtest(vPoints);
+}
+
+
+/**
+ * DESCRIPTION: divide and conquer triangulation of a grid whose points are moved by tiny random amounts is a valid
+ *              Delaunay triangulation
+ *
+ */
+TEST_F(TestDivideConquer_Equivalence, Test_Jittered_Grid)
+{
+    std::mt19937_64 generator(1);
+    std::uniform_real_distribution<double> distribution(-GRID_JITTER, GRID_JITTER);
+
+    vector<Point<TYPE>> vPoints;
+    for (int i=0; i<GRID_SIZE ;i++)
+    {
+        for (int j=0; j<GRID_SIZE ;j++)
+        {
+            vPoints.push_back(Point<TYPE>(i + distribution(generator), j + distribution(generator)));
+        }
+    }
+    executeDegenerateSubtest(vPoints);
+}
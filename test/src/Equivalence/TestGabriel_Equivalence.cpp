@@ -0,0 +1,161 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "Delaunay.h"
+#include "figuresLib.h"
+#include "Gabriel.h"
+#include "PointFactory.h"
+#include "SweepHullDelaunay.h"
+#include "TestSuite.h"
+
+#include <gtest/gtest.h>
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+#define NUM_GABRIEL_THREADS         (4)
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestGabriel_Equivalence : public ::testing::Test
+    {
+    public:
+
+        /**
+         * @fn      execute
+         * @brief   Builds Gabriel graph of a Delaunay triangulation using its Voronoi diagram and in place using one
+         *          and several threads. Checks all graphs have the same edges
+         *
+         * @param   szNumPoints     (IN) Points set number of points
+         */
+        static void execute(size_t szNumPoints);
+
+        static bool isEmptyCircle(const Dcel &dcel, int edgeIndex);
+    };
+
+
+    void TestGabriel_Equivalence::execute(size_t szNumPoints)
+    {
+        vector<Point<TYPE>> vPoints;
+        PointFactory::generateRandom(szNumPoints, vPoints);
+
+        Delaunay delaunay(vPoints);
+        ASSERT_TRUE(delaunay.build());
+        Voronoi voronoi(delaunay.getRefDcel());
+        ASSERT_TRUE(voronoi.build());
+
+        Gabriel gabriel(*delaunay.getRefDcel(), voronoi);
+        ASSERT_TRUE(gabriel.build());
+        ASSERT_FALSE(gabriel.isInPlace());
+
+        Gabriel inPlace(*delaunay.getRefDcel());
+        ASSERT_TRUE(inPlace.build(1));
+        ASSERT_TRUE(inPlace.isInPlace());
+        Gabriel parallel(*delaunay.getRefDcel());
+        ASSERT_TRUE(parallel.build(NUM_GABRIEL_THREADS));
+
+        ASSERT_EQ(gabriel.getSize(), inPlace.getSize());
+        for (int edgeIndex=0; edgeIndex<gabriel.getSize() ; edgeIndex++)
+        {
+            ASSERT_EQ(gabriel.isSet(edgeIndex), inPlace.isSet(edgeIndex));
+            ASSERT_EQ(gabriel.isSet(edgeIndex), parallel.isSet(edgeIndex));
+        }
+
+        // Copy references the same triangulation
+        Gabriel copy(parallel);
+        ASSERT_EQ(parallel.getDcel(), copy.getDcel());
+        ASSERT_TRUE(copy.isSet(gabriel.getSize()-1) == parallel.isSet(gabriel.getSize()-1));
+    }
+
+
+    bool TestGabriel_Equivalence::isEmptyCircle(const Dcel &dcel, int edgeIndex)
+    {
+        Point<TYPE> origin, dest;
+        dcel.getEdgePoints(edgeIndex, origin, dest);
+        Point<TYPE> centre((origin.getX() + dest.getX()) / 2.0, (origin.getY() + dest.getY()) / 2.0);
+        TYPE radius = origin.distance(dest) / 2.0;
+        for (size_t i=0; i<dcel.getNumVertex() ; i++)
+        {
+            const Point<TYPE> *point = dcel.getRefPoint((int) i);
+            if ((*point != origin) && (*point != dest) && (point->distance(centre) < radius))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+
+/**
+ * DESCRIPTION: in place Gabriel graph is equal to Voronoi based graph
+ *
+ */
+TEST_F(TestGabriel_Equivalence, Test_Num_Samples_1000)
+{
+    execute(NUM_POINTS_1K);
+}
+
+
+/**
+ * DESCRIPTION: in place Gabriel graph is equal to Voronoi based graph
+ *
+ */
+TEST_F(TestGabriel_Equivalence, Test_Num_Samples_100000)
+{
+    execute(NUM_POINTS_100K);
+}
+
+
+/**
+ * DESCRIPTION: in place Gabriel graph of sweep hull triangulation is equal to brute force diametral circle test
+ *
+ */
+TEST_F(TestGabriel_Equivalence, Test_SweepHull_Num_Samples_1000)
+{
+    vector<Point<TYPE>> vPoints;
+    PointFactory::generateRandom(NUM_POINTS_1K, vPoints);
+    SweepHullDelaunay sweepHull(vPoints);
+    ASSERT_TRUE(sweepHull.build());
+
+    const Dcel &dcel = *sweepHull.getRefDcel();
+    Gabriel gabriel(dcel);
+    ASSERT_TRUE(gabriel.build(NUM_GABRIEL_THREADS));
+    for (int edgeIndex=0; edgeIndex<gabriel.getSize() ; edgeIndex++)
+    {
+        ASSERT_EQ(isEmptyCircle(dcel, edgeIndex), gabriel.isSet(edgeIndex));
+    }
+}
+
+
+/**
+ * DESCRIPTION: library returns both half-edges of every Gabriel edge
+ *
+ */
+TEST_F(TestGabriel_Equivalence, Test_Library_Num_Samples_1000)
+{
+    vector<Point<TYPE>> vPoints;
+    PointFactory::generateRandom(NUM_POINTS_1K, vPoints);
+    Delaunay delaunay(vPoints);
+    ASSERT_TRUE(delaunay.build());
+    Voronoi voronoi(delaunay.getRefDcel());
+    ASSERT_TRUE(voronoi.build());
+    Gabriel gabriel(*delaunay.getRefDcel(), voronoi);
+    ASSERT_TRUE(gabriel.build());
+
+    size_t szNumEdges=0;
+    for (int edgeIndex=0; edgeIndex<gabriel.getSize() ; edgeIndex++)
+    {
+        szNumEdges += gabriel.isSet(edgeIndex) ? 1 : 0;
+    }
+
+    vector<Point<TYPE>> vGabriel;
+    ASSERT_TRUE(getGabriel(vPoints, vGabriel));
+    ASSERT_EQ(2*szNumEdges, vGabriel.size());
+}
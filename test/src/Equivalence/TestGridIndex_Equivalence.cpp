@@ -0,0 +1,291 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "DcelGridIndex.h"
+#include "Delaunay.h"
+#include "GridIndexReader.h"
+#include "GridIndexWriter.h"
+#include "PointFactory.h"
+#include "StarTriangulation.h"
+#include "SweepHullDelaunay.h"
+#include "TestSuite.h"
+
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+#define NUM_GRID_QUERIES            (100000)
+#define NUM_GRID_THREADS            (4)
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestGridIndex_Equivalence : public ::testing::Test
+    {
+    public:
+
+        /**
+         * @fn      executeSubtest
+         * @brief   Builds grid index of Delaunay, Star and Sweep Hull triangulations and checks every query is located
+         *          in a face that contains it or out of the convex hull like the Delaunay graph
+         *
+         * @param   szNumPoints     (IN) Points set number of points
+         */
+        static void executeSubtest(size_t szNumPoints);
+
+        /**
+         * @fn      executeFileSubtest
+         * @brief   Writes grid index to file, reads it and checks seeds are equal
+         *
+         * @param   strFileName     (IN) File name. Binary format if extension is binary
+         */
+        static void executeFileSubtest(const string &strFileName);
+
+        static void generateQueries(vector<Point<TYPE>> &vQueries);
+        static void checkIndex(const DcelGridIndex &index, Dcel &dcel, const vector<Point<TYPE>> &vQueries,
+                               const vector<int> &vExpectedFaces);
+        static bool isInFace(Dcel &dcel, const Point<TYPE> &point, int faceId);
+    };
+
+
+    void TestGridIndex_Equivalence::executeSubtest(size_t szNumPoints)
+    {
+        vector<Point<TYPE>> vPoints;
+        PointFactory::generateRandom(szNumPoints, vPoints);
+        vector<Point<TYPE>> vQueries;
+        generateQueries(vQueries);
+
+        // Graph location is the reference
+        Delaunay delaunay(vPoints);
+        ASSERT_TRUE(delaunay.build());
+        vector<int> vExpectedFaces;
+        ASSERT_TRUE(delaunay.findFaces(vQueries, vExpectedFaces));
+
+        DcelGridIndex index;
+        ASSERT_TRUE(index.build(*delaunay.getRefDcel(), NUM_GRID_THREADS));
+        checkIndex(index, *delaunay.getRefDcel(), vQueries, vExpectedFaces);
+
+        // Same seeds using one thread
+        DcelGridIndex sequentialIndex;
+        ASSERT_TRUE(sequentialIndex.build(*delaunay.getRefDcel(), 1));
+        ASSERT_EQ(index.getNumColumns()*index.getNumRows(),
+                  sequentialIndex.getNumColumns()*sequentialIndex.getNumRows());
+        for (size_t i=0; i<index.getNumColumns()*index.getNumRows() ; i++)
+        {
+            ASSERT_EQ(index.getSeed(i), sequentialIndex.getSeed(i));
+        }
+
+        SweepHullDelaunay sweepHull(vPoints);
+        ASSERT_TRUE(sweepHull.build());
+        ASSERT_TRUE(index.build(*sweepHull.getRefDcel(), NUM_GRID_THREADS));
+        checkIndex(index, *sweepHull.getRefDcel(), vQueries, vExpectedFaces);
+
+        // Index is still valid after star triangulation faces are flipped and updated
+        StarTriangulation star(vPoints);
+        ASSERT_TRUE(star.build());
+        ASSERT_TRUE(index.build(*star.getRefDcel(), NUM_GRID_THREADS));
+        checkIndex(index, *star.getRefDcel(), vQueries, vExpectedFaces);
+        ASSERT_TRUE(star.delaunay());
+        checkIndex(index, *star.getRefDcel(), vQueries, vExpectedFaces);
+        for (size_t i=1; i<star.getRefDcel()->getNumFaces() ; i++)
+        {
+            index.update((int) i);
+        }
+        checkIndex(index, *star.getRefDcel(), vQueries, vExpectedFaces);
+    }
+
+
+    void TestGridIndex_Equivalence::executeFileSubtest(const string &strFileName)
+    {
+        vector<Point<TYPE>> vPoints;
+        PointFactory::generateRandom(NUM_POINTS_10K, vPoints);
+        vector<Point<TYPE>> vQueries;
+        generateQueries(vQueries);
+
+        Delaunay delaunay(vPoints);
+        ASSERT_TRUE(delaunay.build());
+        vector<int> vExpectedFaces;
+        ASSERT_TRUE(delaunay.findFaces(vQueries, vExpectedFaces));
+
+        DcelGridIndex index;
+        ASSERT_TRUE(index.build(*delaunay.getRefDcel()));
+        ASSERT_TRUE(GridIndexWriter::write(strFileName, index));
+
+        // Read index and locate queries
+        DcelGridIndex readIndex;
+        ASSERT_TRUE(GridIndexReader::read(strFileName, *delaunay.getRefDcel(), readIndex));
+        std::remove(strFileName.c_str());
+        ASSERT_EQ(index.getNumColumns(), readIndex.getNumColumns());
+        ASSERT_EQ(index.getNumRows(), readIndex.getNumRows());
+        for (size_t i=0; i<index.getNumColumns()*index.getNumRows() ; i++)
+        {
+            ASSERT_EQ(index.getSeed(i), readIndex.getSeed(i));
+        }
+        for (size_t i=0; i<vQueries.size() ; i+=100)
+        {
+            ASSERT_EQ(index.getCell(vQueries[i]), readIndex.getCell(vQueries[i]));
+        }
+        checkIndex(readIndex, *delaunay.getRefDcel(), vQueries, vExpectedFaces);
+
+        // Missing file
+        ASSERT_FALSE(GridIndexReader::read(strFileName, *delaunay.getRefDcel(), readIndex));
+        ASSERT_FALSE(readIndex.isBuilt());
+    }
+
+
+    void TestGridIndex_Equivalence::generateQueries(vector<Point<TYPE>> &vQueries)
+    {
+        // Points not equal to any vertex (some of them out of convex hull)
+        PointFactory::generateRandom(NUM_GRID_QUERIES, vQueries);
+        for (size_t i=0; i<vQueries.size() ; i++)
+        {
+            TYPE x = vQueries[i].getX() + 0.5;
+            vQueries[i] = Point<TYPE>((i % 10 == 0) ? -x : x, vQueries[i].getY() + 0.25);
+        }
+    }
+
+
+    void TestGridIndex_Equivalence::checkIndex(const DcelGridIndex &index, Dcel &dcel,
+                                               const vector<Point<TYPE>> &vQueries, const vector<int> &vExpectedFaces)
+    {
+        for (size_t i=0; i<vQueries.size() ; i++)
+        {
+            int faceId=0;
+            ASSERT_TRUE(index.findFace(vQueries[i], faceId));
+            ASSERT_EQ(vExpectedFaces[i] == EXTERNAL_FACE, faceId == EXTERNAL_FACE);
+            if (faceId != EXTERNAL_FACE)
+            {
+                ASSERT_TRUE(isInFace(dcel, vQueries[i], faceId));
+            }
+        }
+    }
+
+
+    bool TestGridIndex_Equivalence::isInFace(Dcel &dcel, const Point<TYPE> &point, int faceId)
+    {
+        int ids[NPOINTS_TRIANGLE];
+        dcel.getFaceVertices(faceId, ids);
+        return (dcel.returnTurn(&point, ids[0], ids[1]) != RIGHT_TURN) &&
+               (dcel.returnTurn(&point, ids[1], ids[2]) != RIGHT_TURN) &&
+               (dcel.returnTurn(&point, ids[2], ids[0]) != RIGHT_TURN);
+    }
+}
+
+
+/**
+ * DESCRIPTION: grid index locates points in the same face than Delaunay graph in all triangulations
+ *
+ */
+TEST_F(TestGridIndex_Equivalence, Test_Num_Samples_1000)
+{
+    executeSubtest(NUM_POINTS_1K);
+}
+
+
+/**
+ * DESCRIPTION: grid index locates points in the same face than Delaunay graph in all triangulations
+ *
+ */
+TEST_F(TestGridIndex_Equivalence, Test_Num_Samples_100000)
+{
+    executeSubtest(NUM_POINTS_100K);
+}
+
+
+/**
+ * DESCRIPTION: grid of points in a thin bounding box has no more cells per side than vertices
+ *
+ */
+TEST_F(TestGridIndex_Equivalence, Test_Thin_Bounding_Box)
+{
+    vector<Point<TYPE>> vPoints;
+    PointFactory::generateRandom(NUM_POINTS_10K, vPoints);
+    for (auto &point : vPoints)
+    {
+        point = Point<TYPE>(point.getX(), point.getY()*1e-9);
+    }
+    vector<Point<TYPE>> vQueries;
+    PointFactory::generateRandom(NUM_GRID_QUERIES, vQueries);
+    for (auto &query : vQueries)
+    {
+        query = Point<TYPE>(query.getX() + 0.5, query.getY()*1e-9);
+    }
+
+    Delaunay delaunay(vPoints);
+    ASSERT_TRUE(delaunay.build());
+    vector<int> vExpectedFaces;
+    ASSERT_TRUE(delaunay.findFaces(vQueries, vExpectedFaces));
+
+    DcelGridIndex index;
+    ASSERT_TRUE(index.build(*delaunay.getRefDcel(), NUM_GRID_THREADS));
+    ASSERT_LE(index.getNumColumns(), vPoints.size() + 1);
+    ASSERT_LE(index.getNumRows(), vPoints.size() + 1);
+    ASSERT_LE(index.getNumColumns()*index.getNumRows(), 3*vPoints.size() + 1);
+    checkIndex(index, *delaunay.getRefDcel(), vQueries, vExpectedFaces);
+}
+
+
+/**
+ * DESCRIPTION: grid dimensions that do not fit in the file are rejected before seeds are allocated
+ *
+ */
+TEST_F(TestGridIndex_Equivalence, Test_Invalid_Dimensions)
+{
+    vector<Point<TYPE>> vPoints;
+    PointFactory::generateRandom(NUM_POINTS_1K, vPoints);
+    Delaunay delaunay(vPoints);
+    ASSERT_TRUE(delaunay.build());
+
+    string strFileName = "gridIndexHeader.txt";
+    for (const string &strHeader : {"4000000000 4000000000 0 0 1\n1 1\n", "0 2 0 0 1\n", "3 3 0 0 1\n1 1\n"})
+    {
+        ofstream ofs(strFileName.c_str(), ios::out);
+        ofs << strHeader;
+        ofs.close();
+        DcelGridIndex index;
+        ASSERT_FALSE(GridIndexReader::read(strFileName, *delaunay.getRefDcel(), index)) << strHeader;
+        ASSERT_FALSE(index.isBuilt());
+    }
+    std::remove(strFileName.c_str());
+
+    // Number of cells overflows
+    strFileName = "gridIndexHeader.bin";
+    size_t vDimensions[2] = {((size_t) 1 << 62) + 1, 4};
+    TYPE vGeometry[3] = {0.0, 0.0, 1.0};
+    int vSeeds[4] = {1, 1, 1, 1};
+    ofstream ofs(strFileName.c_str(), ios::out | ios::binary);
+    ofs.write((const char *) vDimensions, sizeof(vDimensions));
+    ofs.write((const char *) vGeometry, sizeof(vGeometry));
+    ofs.write((const char *) vSeeds, sizeof(vSeeds));
+    ofs.close();
+    DcelGridIndex index;
+    ASSERT_FALSE(GridIndexReader::read(strFileName, *delaunay.getRefDcel(), index));
+    std::remove(strFileName.c_str());
+}
+
+
+/**
+ * DESCRIPTION: grid index read from a flat file is equal to written index
+ *
+ */
+TEST_F(TestGridIndex_Equivalence, Test_Flat_File)
+{
+    executeFileSubtest("gridIndex.txt");
+}
+
+
+/**
+ * DESCRIPTION: grid index read from a binary file is equal to written index
+ *
+ */
+TEST_F(TestGridIndex_Equivalence, Test_Binary_File)
+{
+    executeFileSubtest("gridIndex.bin");
+}
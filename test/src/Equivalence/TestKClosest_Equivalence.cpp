@@ -0,0 +1,143 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "Delaunay.h"
+#include "PointFactory.h"
+#include "TestSuite.h"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+#define NUM_K_QUERIES               (10000)
+#define MAX_K                       (64)
+#define QUERY_RADIUS                (250.0)
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestKClosest_Equivalence : public ::testing::Test
+    {
+    public:
+
+        /**
+         * @fn      execute
+         * @brief   Computes k closest points and points in radius of a set of queries (some of them out of convex hull)
+         *          expanding Delaunay neighbours one by one and in batch. Checks distances are equal to brute force
+         *
+         * @param   szNumPoints     (IN) Points set number of points
+         * @param   location        (IN) Point location used by Delaunay
+         */
+        static void execute(size_t szNumPoints, PointLocation_E location);
+
+        /**
+         * @fn      getBruteForce
+         * @brief   Sorts distances from a query to all points in a set
+         *
+         * @param   query       (IN) Query point
+         * @param   vPoints     (IN) Points set
+         * @param   vDistances  (OUT) Sorted distances
+         */
+        static void getBruteForce(const Point<TYPE> &query, const vector<Point<TYPE>> &vPoints,
+                                  vector<TYPE> &vDistances);
+    };
+
+
+    void TestKClosest_Equivalence::execute(size_t szNumPoints, PointLocation_E location)
+    {
+        vector<Point<TYPE>> vPoints;
+        PointFactory::generateRandom(szNumPoints, vPoints);
+        vector<Point<TYPE>> vQueries;
+        PointFactory::generateRandom(NUM_K_QUERIES, vQueries);
+        for (size_t i=0; i<vQueries.size() ; i++)
+        {
+            TYPE x = vQueries[i].getX() + 0.5;
+            vQueries[i] = Point<TYPE>((i % 10 == 0) ? -x : x, vQueries[i].getY() + 0.25);
+        }
+
+        Delaunay delaunay(vPoints, location);
+        ASSERT_TRUE(delaunay.build());
+        Dcel *dcel = delaunay.getRefDcel();
+
+        // Batch queries
+        vector<int> vBatchClosest;
+        ASSERT_TRUE(delaunay.findKClosest(vQueries, MAX_K, vBatchClosest));
+        vector<vector<int>> vBatchInRadius;
+        ASSERT_TRUE(delaunay.findInRadius(vQueries, QUERY_RADIUS, vBatchInRadius));
+
+        DelaunayQueryContext context;
+        vector<TYPE> vDistances;
+        for (size_t i=0; i<vQueries.size() ; i+=10)
+        {
+            getBruteForce(vQueries[i], vPoints, vDistances);
+
+            // k closest points for different k
+            for (size_t k : {(size_t) 1, (size_t) 8, (size_t) MAX_K})
+            {
+                vector<int> vClosest;
+                ASSERT_TRUE(delaunay.findKClosest(vQueries[i], k, vClosest, context));
+                ASSERT_EQ(k, vClosest.size());
+                for (size_t j=0; j<k ; j++)
+                {
+                    ASSERT_EQ(vDistances[j], vQueries[i].distance(*dcel->getRefPoint(vClosest[j])));
+                    ASSERT_EQ(vClosest[j], vBatchClosest[i*MAX_K + j]);
+                }
+            }
+
+            // Points in radius
+            vector<int> vInRadius;
+            ASSERT_TRUE(delaunay.findInRadius(vQueries[i], QUERY_RADIUS, vInRadius, context));
+            size_t szNumInRadius = std::upper_bound(vDistances.begin(), vDistances.end(), QUERY_RADIUS) -
+                                   vDistances.begin();
+            ASSERT_EQ(szNumInRadius, vInRadius.size());
+            ASSERT_EQ(vInRadius, vBatchInRadius[i]);
+            for (size_t j=0; j<vInRadius.size() ; j++)
+            {
+                ASSERT_EQ(vDistances[j], vQueries[i].distance(*dcel->getRefPoint(vInRadius[j])));
+            }
+        }
+
+        // More neighbours than points
+        vector<int> vAll;
+        ASSERT_TRUE(delaunay.findKClosest(vQueries[0], szNumPoints + 1, vAll, context));
+        ASSERT_EQ(szNumPoints, vAll.size());
+    }
+
+
+    void TestKClosest_Equivalence::getBruteForce(const Point<TYPE> &query, const vector<Point<TYPE>> &vPoints,
+                                                 vector<TYPE> &vDistances)
+    {
+        vDistances.clear();
+        for (auto &point : vPoints)
+        {
+            vDistances.push_back(query.distance(point));
+        }
+        std::sort(vDistances.begin(), vDistances.end());
+    }
+}
+
+
+/**
+ * DESCRIPTION: k closest and radius queries using graph location are equal to brute force
+ *
+ */
+TEST_F(TestKClosest_Equivalence, Test_Graph_Num_Samples_10000)
+{
+    execute(NUM_POINTS_10K, GRAPH_LOCATION);
+}
+
+
+/**
+ * DESCRIPTION: k closest and radius queries using walk location are equal to brute force
+ *
+ */
+TEST_F(TestKClosest_Equivalence, Test_Walk_Num_Samples_10000)
+{
+    execute(NUM_POINTS_10K, WALK_LOCATION);
+}
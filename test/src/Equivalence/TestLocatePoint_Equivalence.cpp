@@ -7,6 +7,7 @@
 #include "Delaunay.h"
 #include "PointFactory.h"
 #include "StarTriangulation.h"
+#include "SweepHullDelaunay.h"
 #include "Voronoi.h"
 
 using namespace std;
@@ -23,6 +24,8 @@ using namespace std;
 #define NUM_ITERATIONS_100          (100)
 #define NUM_ITERATIONS_1000         (1000)
 
+#define NUM_BATCH_THREADS           (4)
+
 
 /***********************************************************************************************************************
 * Test Class Definition
@@ -45,6 +48,9 @@ namespace
     public:
 
         static void executeSubtest(size_t szNumPoints, size_t szNumIterations);
+        static void executeWalkSubtest(size_t szNumPoints, size_t szNumQueries);
+        static void executeBatchSubtest(size_t szNumPoints, size_t szNumQueries);
+        static bool isInFace(Dcel &dcel, const Point<TYPE> &point, int faceId);
     };
 
     void TestLocatePoint_Equivalence::executeSubtest(size_t szNumPoints, size_t szNumIterations)
@@ -97,6 +103,108 @@ namespace
             delete delaunay;
         }
     }
+
+    void TestLocatePoint_Equivalence::executeWalkSubtest(size_t szNumPoints, size_t szNumQueries)
+    {
+        // Generate random points set and points to find (some of them out of the convex hull)
+        vector<Point<TYPE>> vPoints;
+        PointFactory::generateRandom(szNumPoints, vPoints);
+        vector<Point<TYPE>> vPointsToFind;
+        PointFactory::generateRandom(szNumQueries, vPointsToFind);
+        for (size_t i=0; i<szNumQueries ; i+=10)
+        {
+            vPointsToFind[i] = Point<TYPE>(vPointsToFind[i].getX()*3, -vPointsToFind[i].getY());
+        }
+
+        // Build triangulations using both point location methods and star triangulation
+        Delaunay graphDelaunay(vPoints);
+        ASSERT_TRUE(graphDelaunay.build());
+        Delaunay walkDelaunay(vPoints, WALK_LOCATION);
+        ASSERT_TRUE(walkDelaunay.build());
+        StarTriangulation starTriangulation(vPoints);
+        ASSERT_TRUE(starTriangulation.build());
+
+        for (auto &point : vPointsToFind)
+        {
+            // Closest point walking triangulations (no Voronoi)
+            int pointIndex=0;
+            Point<TYPE> closestGraph;
+            ASSERT_TRUE(graphDelaunay.findClosestPoint(point, closestGraph, pointIndex));
+            Point<TYPE> closestWalk;
+            ASSERT_TRUE(walkDelaunay.findClosestPoint(point, closestWalk, pointIndex));
+
+            // Brute force closest point
+            Point<TYPE> closestStar;
+            ASSERT_TRUE(starTriangulation.findClosestPoint(point, nullptr, closestStar, pointIndex));
+
+            ASSERT_TRUE(closestStar == closestGraph);
+            ASSERT_TRUE(closestStar == closestWalk);
+        }
+    }
+
+    void TestLocatePoint_Equivalence::executeBatchSubtest(size_t szNumPoints, size_t szNumQueries)
+    {
+        // Generate random points set and points to locate not equal to any vertex (some of them out of convex hull)
+        vector<Point<TYPE>> vPoints;
+        PointFactory::generateRandom(szNumPoints, vPoints);
+        vector<Point<TYPE>> vPointsToFind;
+        PointFactory::generateRandom(szNumQueries, vPointsToFind);
+        for (size_t i=0; i<szNumQueries ; i++)
+        {
+            TYPE x = vPointsToFind[i].getX() + 0.5;
+            vPointsToFind[i] = Point<TYPE>((i % 10 == 0) ? -x : x, vPointsToFind[i].getY() + 0.25);
+        }
+
+        // Build triangulations
+        Delaunay graphDelaunay(vPoints);
+        ASSERT_TRUE(graphDelaunay.build());
+        Delaunay walkDelaunay(vPoints, WALK_LOCATION);
+        ASSERT_TRUE(walkDelaunay.build());
+        StarTriangulation starTriangulation(vPoints);
+        ASSERT_TRUE(starTriangulation.build());
+        SweepHullDelaunay sweepHull(vPoints);
+        ASSERT_TRUE(sweepHull.build());
+
+        // Locate all points in batch
+        vector<int> vGraphFaces;
+        ASSERT_TRUE(graphDelaunay.findFaces(vPointsToFind, vGraphFaces, NUM_BATCH_THREADS));
+        vector<int> vWalkFaces;
+        ASSERT_TRUE(walkDelaunay.findFaces(vPointsToFind, vWalkFaces, 1));
+        vector<int> vStarFaces;
+        ASSERT_TRUE(starTriangulation.findFaces(vPointsToFind, vStarFaces, NUM_BATCH_THREADS));
+        vector<int> vSweepHullFaces;
+        ASSERT_TRUE(sweepHull.findFaces(vPointsToFind, vSweepHullFaces, NUM_BATCH_THREADS));
+        ASSERT_EQ(szNumQueries, vGraphFaces.size());
+
+        for (size_t i=0; i<szNumQueries ; i++)
+        {
+            // Same face than locating points one by one
+            int faceId=0;
+            ASSERT_TRUE(graphDelaunay.findFace(vPointsToFind[i], faceId));
+            ASSERT_EQ(faceId, vGraphFaces[i]);
+            ASSERT_TRUE(walkDelaunay.findFace(vPointsToFind[i], faceId));
+            ASSERT_EQ(faceId, vWalkFaces[i]);
+
+            // Point out of convex hull in all triangulations or interior to returned face
+            bool isExternal = (vGraphFaces[i] == EXTERNAL_FACE);
+            ASSERT_EQ(isExternal, vStarFaces[i] == EXTERNAL_FACE);
+            ASSERT_EQ(isExternal, vSweepHullFaces[i] == EXTERNAL_FACE);
+            if (!isExternal)
+            {
+                ASSERT_TRUE(isInFace(*starTriangulation.getRefDcel(), vPointsToFind[i], vStarFaces[i]));
+                ASSERT_TRUE(isInFace(*sweepHull.getRefDcel(), vPointsToFind[i], vSweepHullFaces[i]));
+            }
+        }
+    }
+
+    bool TestLocatePoint_Equivalence::isInFace(Dcel &dcel, const Point<TYPE> &point, int faceId)
+    {
+        int ids[NPOINTS_TRIANGLE];
+        dcel.getFaceVertices(faceId, ids);
+        return (dcel.returnTurn(&point, ids[0], ids[1]) != RIGHT_TURN) &&
+               (dcel.returnTurn(&point, ids[1], ids[2]) != RIGHT_TURN) &&
+               (dcel.returnTurn(&point, ids[2], ids[0]) != RIGHT_TURN);
+    }
 }
 
 
@@ -128,3 +236,23 @@ TEST_F(TestLocatePoint_Equivalence, Test_Num_Samples_1000_Iter_10)
 {
     executeSubtest(NUM_POINTS_1K, NUM_ITERATIONS_1000);
 }
+
+
+/**
+ * DESCRIPTION: closest point found walking the triangulation without Voronoi diagram
+ *
+ */
+TEST_F(TestLocatePoint_Equivalence, Test_Walk_Num_Samples_10000_Queries_1000)
+{
+    executeWalkSubtest(NUM_POINTS_10K, NUM_ITERATIONS_1000);
+}
+
+
+/**
+ * DESCRIPTION: batch location in all triangulations returns the same faces than locating points one by one
+ *
+ */
+TEST_F(TestLocatePoint_Equivalence, Test_Batch_Num_Samples_10000_Queries_100000)
+{
+    executeBatchSubtest(NUM_POINTS_10K, NUM_POINTS_100K);
+}
@@ -1,12 +1,16 @@
 /***********************************************************************************************************************
 * Includes
 ***********************************************************************************************************************/
+#include <algorithm>
+#include <cfloat>
 #include <iostream>
 #include <gtest/gtest.h>
 
 #include "Delaunay.h"
+#include "DivideConquerDelaunay.h"
 #include "PointFactory.h"
 #include "StarTriangulation.h"
+#include "SweepHullDelaunay.h"
 
 using namespace std;
 
@@ -22,6 +26,8 @@ using namespace std;
 #define NUM_ITERATIONS_100         (100)
 #define NUM_ITERATIONS_1000        (1000)
 
+#define NUM_NEAREST_THREADS        (4)
+
 
 /***********************************************************************************************************************
 * Test Class Definition
@@ -44,6 +50,8 @@ namespace
     public:
 
         static void executeSubtest(size_t szNumPoints, size_t szNumIterations);
+        static void executeNearestSubtest(size_t szNumPoints);
+        static void checkNearest(Triangulation &triangulation, const vector<TYPE> &vSquaredDistance);
     };
 
     void TestLocateTwoClosest_Equivalence::executeSubtest(size_t szNumPoints, size_t szNumIterations)
@@ -87,6 +95,62 @@ namespace
             delete delaunay;
         }
     }
+
+    void TestLocateTwoClosest_Equivalence::executeNearestSubtest(size_t szNumPoints)
+    {
+        vector<Point<TYPE>> vPoints;
+        PointFactory::generateRandom(szNumPoints, vPoints);
+
+        // Brute force nearest neighbour squared distance
+        vector<TYPE> vSquaredDistance(szNumPoints, DBL_MAX);
+        for (size_t i=0; i<szNumPoints ; i++)
+        {
+            for (size_t j=i+1; j<szNumPoints ; j++)
+            {
+                TYPE dx = vPoints[i].getX() - vPoints[j].getX();
+                TYPE dy = vPoints[i].getY() - vPoints[j].getY();
+                vSquaredDistance[i] = min(vSquaredDistance[i], dx*dx + dy*dy);
+                vSquaredDistance[j] = min(vSquaredDistance[j], dx*dx + dy*dy);
+            }
+        }
+
+        Delaunay delaunay(vPoints);
+        ASSERT_TRUE(delaunay.build());
+        checkNearest(delaunay, vSquaredDistance);
+
+        SweepHullDelaunay sweepHull(vPoints);
+        ASSERT_TRUE(sweepHull.build());
+        checkNearest(sweepHull, vSquaredDistance);
+
+        DivideConquerDelaunay divideConquer(vPoints);
+        ASSERT_TRUE(divideConquer.build());
+        checkNearest(divideConquer, vSquaredDistance);
+    }
+
+    void TestLocateTwoClosest_Equivalence::checkNearest(Triangulation &triangulation,
+                                                        const vector<TYPE> &vSquaredDistance)
+    {
+        // Vertices can be reordered by triangulations so compare sorted distances
+        vector<int> vNeighbour;
+        vector<TYPE> vNearest;
+        ASSERT_TRUE(triangulation.findAllNearest(vNeighbour, vNearest, NUM_NEAREST_THREADS));
+        ASSERT_EQ(vSquaredDistance.size(), vNearest.size());
+        for (auto neighbour : vNeighbour)
+        {
+            ASSERT_NE(INVALID, neighbour);
+        }
+        vector<TYPE> vExpected(vSquaredDistance);
+        std::sort(vExpected.begin(), vExpected.end());
+        std::sort(vNearest.begin(), vNearest.end());
+        ASSERT_EQ(vExpected, vNearest);
+
+        // Two closest points are the lowest nearest neighbour distance
+        Point<TYPE> p, q;
+        ASSERT_TRUE(triangulation.findTwoClosest(p, q));
+        TYPE dx = p.getX() - q.getX();
+        TYPE dy = p.getY() - q.getY();
+        ASSERT_EQ(vExpected.front(), dx*dx + dy*dy);
+    }
 }
 
 
@@ -118,3 +182,13 @@ TEST_F(TestLocateTwoClosest_Equivalence, Test_Num_Samples_1000_Iter_10)
 {
     executeSubtest(NUM_POINTS_1K, NUM_ITERATIONS_1000);
 }
+
+
+/**
+ * DESCRIPTION: nearest neighbour of every point is equal to brute force in all Delaunay triangulations
+ *
+ */
+TEST_F(TestLocateTwoClosest_Equivalence, Test_All_Nearest_Num_Samples_10000)
+{
+    executeNearestSubtest(NUM_POINTS_10K);
+}
@@ -0,0 +1,281 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "DcelGridIndex.h"
+#include "DcelQueries.h"
+#include "DcelReader.h"
+#include "DcelWriter.h"
+#include "Delaunay.h"
+#include "GraphWriter.h"
+#include "GridIndexReader.h"
+#include "GridIndexWriter.h"
+#include "MappedDcel.h"
+#include "MappedGraph.h"
+#include "PointFactory.h"
+#include "TestSuite.h"
+#include "VoronoiView.h"
+
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <limits>
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+// Number of closest points of every query.
+#define NUM_CLOSEST_POINTS          (10)
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestMappedDcel_Equivalence : public ::testing::Test
+    {
+    public:
+
+        /**
+         * @fn      execute
+         * @brief   Builds Delaunay triangulation and writes its Dcel and its graph in mapped format. Checks mapped data
+         *          is equal to the original data and to the Dcel read from a binary file
+         *
+         * @param   szNumPoints     (IN) Points set number of points
+         */
+        static void execute(size_t szNumPoints);
+
+        /**
+         * @fn      executeQueries
+         * @brief   Builds Delaunay triangulation and writes its Dcel and its graph in mapped format. Checks point
+         *          location, closest points, grid index and Voronoi areas computed on the mapped files are equal to
+         *          the ones computed by the triangulation
+         *
+         * @param   szNumPoints     (IN) Points set number of points
+         * @param   szNumQueries    (IN) Number of query points
+         */
+        static void executeQueries(size_t szNumPoints, size_t szNumQueries);
+    };
+
+
+    void TestMappedDcel_Equivalence::execute(size_t szNumPoints)
+    {
+        vector<Point<TYPE>> vPoints;
+        PointFactory::generateRandom(szNumPoints, vPoints);
+        Delaunay delaunay(vPoints);
+        ASSERT_TRUE(delaunay.build());
+        const Dcel &dcel = *delaunay.getRefDcel();
+
+        // Dcel arrays
+        string strDcelFileName = "mappedDcel.map";
+        ASSERT_TRUE(DcelWriter::writeMapped(strDcelFileName, dcel));
+        MappedDcel mapped;
+        ASSERT_TRUE(mapped.open(strDcelFileName));
+        ASSERT_EQ(dcel.getNumVertex(), mapped.getNumVertex());
+        ASSERT_EQ(dcel.getNumEdges(), mapped.getNumEdges());
+        ASSERT_EQ(dcel.getNumFaces(), mapped.getNumFaces());
+        for (int i=0; i<(int) dcel.getNumVertex() ; i++)
+        {
+            ASSERT_EQ(*dcel.getRefPoint(i), *mapped.getRefPoint(i));
+            ASSERT_EQ(dcel.getPointEdge(i), mapped.getPointEdge(i));
+        }
+        for (int i=0; i<(int) dcel.getNumEdges() ; i++)
+        {
+            ASSERT_EQ(dcel.getOrigin(i), mapped.getOrigin(i));
+            ASSERT_EQ(dcel.getTwin(i), mapped.getTwin(i));
+            ASSERT_EQ(dcel.getPrevious(i), mapped.getPrevious(i));
+            ASSERT_EQ(dcel.getNext(i), mapped.getNext(i));
+            ASSERT_EQ(dcel.getFace(i), mapped.getFace(i));
+        }
+        for (int i=0; i<(int) dcel.getNumFaces() ; i++)
+        {
+            ASSERT_EQ(dcel.getFaceEdge(i), mapped.getFaceEdge(i));
+        }
+
+        // Copied Dcel is equal to original Dcel and to binary Dcel
+        Dcel copy;
+        ASSERT_TRUE(mapped.toDcel(copy));
+        ASSERT_TRUE(copy == dcel);
+        string strBinaryFileName = "mappedDcel.bin";
+        ASSERT_TRUE(DcelWriter::write(strBinaryFileName, dcel));
+        Dcel binary;
+        ASSERT_TRUE(DcelReader::read(strBinaryFileName, binary));
+        ASSERT_TRUE(copy == binary);
+        std::remove(strBinaryFileName.c_str());
+
+        // Graph arrays
+        const Graph &graph = *delaunay.getGraph();
+        string strGraphFileName = "mappedGraph.map";
+        ASSERT_TRUE(GraphWriter::writeMapped(strGraphFileName, graph));
+        MappedGraph mappedGraph;
+        ASSERT_TRUE(mappedGraph.open(strGraphFileName));
+        ASSERT_EQ(graph.getSize(), mappedGraph.getSize());
+        for (int i=0; i<graph.getSize() ; i++)
+        {
+            ASSERT_EQ(graph.getFace(i), mappedGraph.getFace(i));
+            ASSERT_EQ(graph.getNChildren(i), mappedGraph.getNChildren(i));
+            for (int j=0; j<graph.getNChildren(i) ; j++)
+            {
+                ASSERT_EQ(graph.getiChild(i, j), mappedGraph.getiChild(i, j));
+            }
+            int ids[NODE_POINTS], mappedIds[NODE_POINTS];
+            graph.getVertices(i, ids[0], ids[1], ids[2]);
+            mappedGraph.getVertices(i, mappedIds[0], mappedIds[1], mappedIds[2]);
+            for (int j=0; j<NODE_POINTS ; j++)
+            {
+                ASSERT_EQ(ids[j], mappedIds[j]);
+            }
+        }
+        for (int face=1; face<(int) mappedGraph.getNumFaces() ; face++)
+        {
+            ASSERT_EQ(delaunay.getGraph()->getNodeAssigned(face), mappedGraph.getNodeAssigned(face));
+        }
+
+        // Files of other kind are rejected
+        MappedDcel wrongDcel;
+        ASSERT_FALSE(wrongDcel.open(strGraphFileName));
+        ASSERT_FALSE(wrongDcel.isOpen());
+        MappedGraph wrongGraph;
+        ASSERT_FALSE(wrongGraph.open(strDcelFileName));
+        mapped.close();
+        mappedGraph.close();
+        std::remove(strGraphFileName.c_str());
+
+        // Truncated file is rejected
+        ifstream ifs(strDcelFileName.c_str(), ios::in | ios::binary);
+        string strData((istreambuf_iterator<char>(ifs)), istreambuf_iterator<char>());
+        ifs.close();
+        ofstream ofs(strDcelFileName.c_str(), ios::out | ios::binary);
+        ofs.write(strData.data(), (streamsize) (strData.size() - 1));
+        ofs.close();
+        ASSERT_FALSE(mapped.open(strDcelFileName));
+        std::remove(strDcelFileName.c_str());
+
+        // Missing file
+        ASSERT_FALSE(mapped.open(strDcelFileName));
+    }
+
+
+    void TestMappedDcel_Equivalence::executeQueries(size_t szNumPoints, size_t szNumQueries)
+    {
+        vector<Point<TYPE>> vPoints, vQueries;
+        PointFactory::generateRandom(szNumPoints, vPoints);
+        PointFactory::generateRandom(szNumQueries, vQueries);
+        Delaunay delaunay(vPoints);
+        ASSERT_TRUE(delaunay.build());
+        const Dcel &dcel = *delaunay.getRefDcel();
+
+        string strDcelFileName = "queriesDcel.map";
+        string strGraphFileName = "queriesGraph.map";
+        ASSERT_TRUE(DcelWriter::writeMapped(strDcelFileName, dcel));
+        ASSERT_TRUE(GraphWriter::writeMapped(strGraphFileName, *delaunay.getGraph()));
+        MappedDcel mapped;
+        MappedGraph mappedGraph;
+        ASSERT_TRUE(mapped.open(strDcelFileName));
+        ASSERT_TRUE(mappedGraph.open(strGraphFileName));
+
+        // Grid indexes of Dcel and mapped Dcel have the same seeds
+        DcelGridIndex index;
+        MappedDcelGridIndex mappedIndex;
+        ASSERT_TRUE(index.build(dcel));
+        ASSERT_TRUE(mappedIndex.build(mapped));
+        ASSERT_EQ(index.getNumColumns(), mappedIndex.getNumColumns());
+        ASSERT_EQ(index.getNumRows(), mappedIndex.getNumRows());
+        for (size_t i=0; i<index.getNumColumns()*index.getNumRows() ; i++)
+        {
+            ASSERT_EQ(index.getSeed(i), mappedIndex.getSeed(i));
+        }
+
+        // Index written from a mapped Dcel is attached to the mapped Dcel
+        string strIndexFileName = "queriesIndex.bin";
+        MappedDcelGridIndex readIndex;
+        ASSERT_TRUE(GridIndexWriter::write(strIndexFileName, mappedIndex));
+        ASSERT_TRUE(GridIndexReader::read(strIndexFileName, mapped, readIndex));
+        std::remove(strIndexFileName.c_str());
+
+        DelaunayQueryContext context;
+        ExpansionContext mappedContext;
+        for (auto &query : vQueries)
+        {
+            // Graph location
+            int faceId=0, mappedFaceId=0;
+            ASSERT_TRUE(delaunay.findFace(query, faceId, context));
+            ASSERT_TRUE(DcelQueries::locateFace(mappedGraph, mapped, query, mappedFaceId));
+            ASSERT_EQ(faceId, mappedFaceId);
+
+            // Grid location
+            int indexFaceId=0, mappedIndexFaceId=0, readFaceId=0;
+            ASSERT_TRUE(index.findFace(query, indexFaceId));
+            ASSERT_TRUE(mappedIndex.findFace(query, mappedIndexFaceId));
+            ASSERT_TRUE(readIndex.findFace(query, readFaceId));
+            ASSERT_EQ(indexFaceId, mappedIndexFaceId);
+            ASSERT_EQ(indexFaceId, readFaceId);
+
+            // Closest point from the leaf node of the graph
+            Point<TYPE> closest;
+            int pointIndex=0, mappedPointIndex=0, nodeIndex=0;
+            int ids[NPOINTS_TRIANGLE];
+            ASSERT_TRUE(delaunay.findClosestPoint(query, closest, pointIndex, context));
+            ASSERT_TRUE(DcelQueries::locateNode(mappedGraph, mapped, query, nodeIndex));
+            mappedGraph.getVertices(nodeIndex, ids[0], ids[1], ids[2]);
+            ASSERT_TRUE(DcelQueries::findClosestPoint(mapped, query, ids, mappedPointIndex));
+            ASSERT_EQ(pointIndex, mappedPointIndex);
+
+            // K closest points
+            vector<int> vClosest, vMappedClosest;
+            ASSERT_TRUE(delaunay.findKClosest(query, NUM_CLOSEST_POINTS, vClosest, context));
+            DcelQueries::expandClosest(mapped, query, mappedPointIndex, NUM_CLOSEST_POINTS,
+                                       std::numeric_limits<TYPE>::max(), vMappedClosest, mappedContext);
+            ASSERT_EQ(vClosest, vMappedClosest);
+        }
+
+        // Voronoi areas
+        VoronoiView view(dcel);
+        MappedVoronoiView mappedView(mapped);
+        ASSERT_TRUE(view.build(1));
+        ASSERT_TRUE(mappedView.build(1));
+        for (int areaId=1; areaId<=(int) dcel.getNumVertex() ; areaId++)
+        {
+            vector<Point<TYPE>> vArea, vMappedArea;
+            view.getArea(areaId, vArea);
+            mappedView.getArea(areaId, vMappedArea);
+            ASSERT_EQ(vArea, vMappedArea);
+        }
+
+        mapped.close();
+        mappedGraph.close();
+        std::remove(strDcelFileName.c_str());
+        std::remove(strGraphFileName.c_str());
+    }
+}
+
+
+/**
+ * DESCRIPTION: Mapped Dcel and graph are equal to Delaunay Dcel and graph
+ *
+ */
+TEST_F(TestMappedDcel_Equivalence, Test_Num_Samples_1000)
+{
+    execute(NUM_POINTS_1K);
+}
+
+
+/**
+ * DESCRIPTION: Mapped Dcel and graph are equal to Delaunay Dcel and graph
+ *
+ */
+TEST_F(TestMappedDcel_Equivalence, Test_Num_Samples_100000)
+{
+    execute(NUM_POINTS_100K);
+}
+
+
+/**
+ * DESCRIPTION: Queries computed on mapped Dcel and graph without copying them are equal to Delaunay queries
+ *
+ */
+TEST_F(TestMappedDcel_Equivalence, Test_Queries_Num_Samples_10000)
+{
+    executeQueries(NUM_POINTS_10K, NUM_POINTS_1K);
+}
@@ -0,0 +1,143 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "PointFactory.h"
+#include "PointsParser.h"
+#include "PointsReader.h"
+#include "PointsWriter.h"
+#include "TestSuite.h"
+
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+#define NUM_PARSER_THREADS          (4)
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestPointsParser_Equivalence : public ::testing::Test
+    {
+    public:
+
+        /**
+         * @fn      checkFile
+         * @brief   Reads a text file with stream reader and with text reader using one and several threads and
+         *          checks all points sets are equal
+         *
+         * @param   strFileName     (IN) File name
+         * @param   szNumPoints     (IN) Expected number of points
+         */
+        static void checkFile(const string &strFileName, size_t szNumPoints);
+
+        /**
+         * @fn      writeFile
+         * @brief   Writes points one per line with full precision and the given separator
+         *
+         * @param   strFileName     (IN) File name
+         * @param   vPoints         (IN) Points set
+         * @param   strSeparator    (IN) Coordinates separator
+         */
+        static void writeFile(const string &strFileName, const vector<Point<TYPE>> &vPoints,
+                              const string &strSeparator);
+    };
+
+
+    void TestPointsParser_Equivalence::checkFile(const string &strFileName, size_t szNumPoints)
+    {
+        vector<Point<TYPE>> vExpected;
+        ASSERT_TRUE(PointsReader::readFlat(strFileName, vExpected));
+        ASSERT_EQ(szNumPoints, vExpected.size());
+        for (size_t szNumThreads : {(size_t) 1, (size_t) NUM_PARSER_THREADS})
+        {
+            vector<Point<TYPE>> vPoints;
+            ASSERT_TRUE(PointsReader::readText(strFileName, vPoints, szNumThreads));
+            ASSERT_EQ(vExpected, vPoints);
+        }
+    }
+
+
+    void TestPointsParser_Equivalence::writeFile(const string &strFileName, const vector<Point<TYPE>> &vPoints,
+                                                 const string &strSeparator)
+    {
+        ofstream ofs(strFileName.c_str(), ios::out);
+        ofs.precision(17);
+        for (auto &point : vPoints)
+        {
+            ofs << point.getX() << strSeparator << point.getY() << "\n";
+        }
+        ofs.close();
+    }
+}
+
+
+/**
+ * DESCRIPTION: Text reader reads the same points than stream reader in a single line file written by PointsWriter
+ *
+ */
+TEST_F(TestPointsParser_Equivalence, Test_Writer_File)
+{
+    vector<Point<TYPE>> vPoints;
+    PointFactory::generateRandom(NUM_POINTS_1M, vPoints);
+    string strFileName = "parserWriter.txt";
+    ASSERT_TRUE(PointsWriter::write(strFileName, vPoints));
+    checkFile(strFileName, vPoints.size());
+    std::remove(strFileName.c_str());
+}
+
+
+/**
+ * DESCRIPTION: Text reader reads full precision coordinates exactly and accepts comma separator
+ *
+ */
+TEST_F(TestPointsParser_Equivalence, Test_Full_Precision_Lines)
+{
+    vector<Point<TYPE>> vPoints;
+    PointFactory::generateRandom(NUM_POINTS_100K, vPoints);
+    for (size_t i=0; i<vPoints.size() ; i+=3)
+    {
+        vPoints[i] = Point<TYPE>(vPoints[i].getX()*1e-7 - 0.5, vPoints[i].getY()*1e9);
+    }
+
+    string strFileName = "parserLines.txt";
+    writeFile(strFileName, vPoints, " ");
+    checkFile(strFileName, vPoints.size());
+
+    vector<Point<TYPE>> vCommaPoints;
+    writeFile(strFileName, vPoints, ", ");
+    ASSERT_TRUE(PointsReader::readText(strFileName, vCommaPoints, NUM_PARSER_THREADS));
+    vector<Point<TYPE>> vExpected;
+    writeFile(strFileName, vPoints, "\t");
+    ASSERT_TRUE(PointsReader::readFlat(strFileName, vExpected));
+    ASSERT_EQ(vExpected, vCommaPoints);
+    std::remove(strFileName.c_str());
+}
+
+
+/**
+ * DESCRIPTION: Invalid numbers and points without Y coordinate are rejected and no point is added
+ *
+ */
+TEST_F(TestPointsParser_Equivalence, Test_Invalid_Numbers)
+{
+    for (const string &strText : {"1 2\n3 x\n", "1 2\n3,,4\n", ",1 2\n", "1 2\n1e 2\n", "1.2.3 4\n", "- 1\n",
+                                  "1 2\n3\n", "1,2 -3.5e1 +.25\n\r\n 5. 6e-1,\n7"})
+    {
+        vector<Point<TYPE>> vPoints;
+        ASSERT_FALSE(PointsParser::parse(strText.c_str(), strText.size(), vPoints)) << strText;
+        ASSERT_TRUE(vPoints.empty());
+    }
+
+    string strText = "1,2 -3.5e1 +.25\n\r\n 5. 6e-1,\n";
+    vector<Point<TYPE>> vPoints;
+    ASSERT_TRUE(PointsParser::parse(strText.c_str(), strText.size(), vPoints));
+    vector<Point<TYPE>> vExpected = {Point<TYPE>(1, 2), Point<TYPE>(-35, 0.25), Point<TYPE>(5, 0.6)};
+    ASSERT_EQ(vExpected, vPoints);
+}
@@ -0,0 +1,214 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "Delaunay.h"
+#include "figuresLib.h"
+#include "Gabriel.h"
+#include "MinimumSpanningTree.h"
+#include "PointFactory.h"
+#include "RelativeNeighbourhood.h"
+#include "SweepHullDelaunay.h"
+#include "TestSuite.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+#define NUM_GRAPH_THREADS           (4)
+#define LENGTH_TOLERANCE            (1e-6)
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestSpanningTree_Equivalence : public ::testing::Test
+    {
+    public:
+
+        /**
+         * @fn      execute
+         * @brief   Builds minimum spanning tree and relative neighbourhood graph of a Delaunay triangulation.
+         *          Checks tree length is equal to Prim brute force, relative neighbourhood edges are equal to checking
+         *          all points and tree is a subgraph of the relative neighbourhood graph, which is a subgraph of the
+         *          Gabriel graph
+         *
+         * @param   dcel        (IN) Delaunay triangulation
+         * @param   voronoi     (IN) Voronoi diagram of the triangulation. Not used if null
+         */
+        static void execute(Dcel &dcel, Voronoi *voronoi);
+
+        static TYPE getPrimLength(const vector<Point<TYPE>> &vPoints);
+        static bool isEmptyLune(Dcel &dcel, int edgeIndex);
+    };
+
+
+    void TestSpanningTree_Equivalence::execute(Dcel &dcel, Voronoi *voronoi)
+    {
+        vector<Point<TYPE>> vPoints;
+        dcel.getPoints(vPoints);
+
+        MinimumSpanningTree tree(dcel);
+        ASSERT_TRUE(tree.build(NUM_GRAPH_THREADS));
+        ASSERT_EQ(vPoints.size()-1, tree.getNumTreeEdges());
+        TYPE primLength = getPrimLength(vPoints);
+        ASSERT_NEAR(primLength, tree.getLength(), primLength*LENGTH_TOLERANCE);
+
+        // Same tree using one thread
+        MinimumSpanningTree sequentialTree(dcel);
+        ASSERT_TRUE(sequentialTree.build(1));
+
+        RelativeNeighbourhood graph(dcel);
+        ASSERT_TRUE(graph.build(NUM_GRAPH_THREADS));
+        RelativeNeighbourhood sequentialGraph(dcel);
+        ASSERT_TRUE(sequentialGraph.build(1));
+
+        Gabriel *gabriel = nullptr;
+        if (voronoi != nullptr)
+        {
+            gabriel = new Gabriel(dcel, *voronoi);
+            ASSERT_TRUE(gabriel->build());
+        }
+
+        for (int edgeIndex=0; edgeIndex<(int) dcel.getNumEdges() ; edgeIndex++)
+        {
+            ASSERT_EQ(tree.isSet(edgeIndex), sequentialTree.isSet(edgeIndex));
+            ASSERT_EQ(graph.isSet(edgeIndex), sequentialGraph.isSet(edgeIndex));
+            ASSERT_TRUE(!tree.isSet(edgeIndex) || graph.isSet(edgeIndex));
+            if (gabriel != nullptr)
+            {
+                ASSERT_TRUE(!graph.isSet(edgeIndex) || gabriel->isSet(edgeIndex));
+            }
+
+            bool isRealEdge = !dcel.hasNegativeVertex(edgeIndex+1);
+            ASSERT_EQ(isRealEdge && isEmptyLune(dcel, edgeIndex), graph.isSet(edgeIndex));
+        }
+
+        delete gabriel;
+    }
+
+
+    TYPE TestSpanningTree_Equivalence::getPrimLength(const vector<Point<TYPE>> &vPoints)
+    {
+        vector<TYPE> vDistances(vPoints.size(), std::numeric_limits<TYPE>::max());
+        vector<bool> vInTree(vPoints.size(), false);
+        TYPE length=0.0;
+        size_t current=0;
+        for (size_t i=1; i<vPoints.size() ; i++)
+        {
+            vInTree[current] = true;
+            size_t closest=0;
+            TYPE closestDistance=std::numeric_limits<TYPE>::max();
+            for (size_t j=0; j<vPoints.size() ; j++)
+            {
+                if (!vInTree[j])
+                {
+                    vDistances[j] = std::min(vDistances[j], vPoints[current].distance(vPoints[j]));
+                    if (vDistances[j] < closestDistance)
+                    {
+                        closestDistance = vDistances[j];
+                        closest = j;
+                    }
+                }
+            }
+            length += closestDistance;
+            current = closest;
+        }
+
+        return length;
+    }
+
+
+    bool TestSpanningTree_Equivalence::isEmptyLune(Dcel &dcel, int edgeIndex)
+    {
+        Point<TYPE> origin, dest;
+        dcel.getEdgePoints(edgeIndex, origin, dest);
+        TYPE length = origin.distance(dest);
+        for (size_t i=0; i<dcel.getNumVertex() ; i++)
+        {
+            Point<TYPE> *point = dcel.getRefPoint((int) i);
+            if ((point->distance(origin) < length) && (point->distance(dest) < length))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+
+/**
+ * DESCRIPTION: minimum spanning tree and relative neighbourhood graph of incremental Delaunay are equal to brute force
+ *
+ */
+TEST_F(TestSpanningTree_Equivalence, Test_Delaunay_Num_Samples_1000)
+{
+    vector<Point<TYPE>> vPoints;
+    PointFactory::generateRandom(NUM_POINTS_1K, vPoints);
+    Delaunay delaunay(vPoints);
+    ASSERT_TRUE(delaunay.build());
+    Voronoi voronoi(delaunay.getRefDcel());
+    ASSERT_TRUE(voronoi.build());
+    execute(*delaunay.getRefDcel(), &voronoi);
+}
+
+
+/**
+ * DESCRIPTION: minimum spanning tree and relative neighbourhood graph of incremental Delaunay are equal to brute force
+ *
+ */
+TEST_F(TestSpanningTree_Equivalence, Test_Delaunay_Num_Samples_10000)
+{
+    vector<Point<TYPE>> vPoints;
+    PointFactory::generateRandom(NUM_POINTS_10K, vPoints);
+    Delaunay delaunay(vPoints);
+    ASSERT_TRUE(delaunay.build());
+    execute(*delaunay.getRefDcel(), nullptr);
+}
+
+
+/**
+ * DESCRIPTION: minimum spanning tree and relative neighbourhood graph of sweep hull Delaunay are equal to brute force
+ *
+ */
+TEST_F(TestSpanningTree_Equivalence, Test_SweepHull_Num_Samples_10000)
+{
+    vector<Point<TYPE>> vPoints;
+    PointFactory::generateRandom(NUM_POINTS_10K, vPoints);
+    SweepHullDelaunay sweepHull(vPoints);
+    ASSERT_TRUE(sweepHull.build());
+    execute(*sweepHull.getRefDcel(), nullptr);
+}
+
+
+/**
+ * DESCRIPTION: library functions return one segment per tree and graph edge
+ *
+ */
+TEST_F(TestSpanningTree_Equivalence, Test_Library_Num_Samples_1000)
+{
+    vector<Point<TYPE>> vPoints;
+    PointFactory::generateRandom(NUM_POINTS_1K, vPoints);
+
+    vector<Point<TYPE>> vTree;
+    ASSERT_TRUE(getMinimumSpanningTree(vPoints, vTree));
+    ASSERT_EQ(2*(vPoints.size()-1), vTree.size());
+    TYPE length=0.0;
+    for (size_t i=0; i<vTree.size() ; i+=2)
+    {
+        length += vTree[i].distance(vTree[i+1]);
+    }
+    TYPE primLength = getPrimLength(vPoints);
+    ASSERT_NEAR(primLength, length, primLength*LENGTH_TOLERANCE);
+
+    vector<Point<TYPE>> vGraph;
+    ASSERT_TRUE(getRelativeNeighbourhood(vPoints, vGraph));
+    ASSERT_EQ(0, vGraph.size() % 2);
+    ASSERT_LE(vTree.size(), vGraph.size());
+}
@@ -0,0 +1,116 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include <algorithm>
+#include <iostream>
+#include <gtest/gtest.h>
+
+#include "Delaunay.h"
+#include "PointFactory.h"
+#include "StarTriangulation.h"
+#include "TestTriangles.h"
+#include "TriangulationFactory.h"
+
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+#define NUM_POINTS_1K            (1000)
+#define NUM_POINTS_10K           (10000)
+
+#define NUM_ITERATIONS_10          (10)
+#define NUM_ITERATIONS_100         (100)
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestStarDelaunay_Equivalence : public ::testing::Test
+    {
+    public:
+
+        static void executeSubtest(size_t szNumPoints, size_t szNumIterations, size_t szNumThreads);
+    };
+
+    void TestStarDelaunay_Equivalence::executeSubtest(size_t szNumPoints, size_t szNumIterations,
+                                                      size_t szNumThreads)
+    {
+        // Execute test szNumIterations times
+        for (size_t i=0; i<szNumIterations ; i++)
+        {
+            // Generate random points set
+            vector<Point<TYPE>> vPoints;
+            PointFactory::generateRandom(szNumPoints, vPoints);
+
+            // Build star triangulation and convert a copy using sequential and parallel flips
+            bool isSuccess;
+            StarTriangulation *sequential = TriangulationFactory::createStar(vPoints, isSuccess);
+            ASSERT_TRUE(isSuccess);
+            auto *parallel = new StarTriangulation(*sequential);
+            ASSERT_TRUE(sequential->delaunay());
+            ASSERT_TRUE(parallel->delaunay(szNumThreads));
+
+            // Build incremental Delaunay triangulation
+            Delaunay *delaunay = TriangulationFactory::createDelaunay(vPoints, isSuccess);
+            ASSERT_TRUE(isSuccess);
+
+            // Check all have the same set of triangles
+            vector<TestTriangle> vSequential;
+            vector<TestTriangle> vParallel;
+            vector<TestTriangle> vIncremental;
+            TestTriangles::getTriangles(*sequential->getRefDcel(), vSequential);
+            TestTriangles::getTriangles(*parallel->getRefDcel(), vParallel);
+            TestTriangles::getTriangles(*delaunay->getRefDcel(), vIncremental);
+            cout << "Test " << (i+1) << "/" << szNumIterations << endl;
+            ASSERT_EQ(vSequential.size(), vParallel.size());
+            ASSERT_TRUE(vSequential == vParallel);
+            ASSERT_TRUE(vSequential == vIncremental);
+
+            // Check every vertex edge starts at the vertex
+            Dcel *dcel = parallel->getRefDcel();
+            for (int vertexIndex=0; vertexIndex<(int) dcel->getNumVertex() ;vertexIndex++)
+            {
+                ASSERT_EQ(vertexIndex+1, dcel->getOrigin(dcel->getPointEdge(vertexIndex)-1));
+            }
+
+            // Free resources
+            delete delaunay;
+            delete parallel;
+            delete sequential;
+        }
+    }
+}
+
+
+/**
+ * DESCRIPTION: parallel flips are equal to sequential flips when rounds are too small to be split between threads
+ *
+ */
+TEST_F(TestStarDelaunay_Equivalence, Test_Num_Samples_1000_Iter_100_Two_Threads)
+{
+    executeSubtest(NUM_POINTS_1K, NUM_ITERATIONS_100, 2);
+}
+
+
+/**
+ * DESCRIPTION: parallel flips in several threads are equal to sequential flips
+ *
+ */
+TEST_F(TestStarDelaunay_Equivalence, Test_Num_Samples_10000_Iter_10_Four_Threads)
+{
+    executeSubtest(NUM_POINTS_10K, NUM_ITERATIONS_10, 4);
+}
+
+
+/**
+ * DESCRIPTION: parallel flips using all cores are equal to sequential flips
+ *
+ */
+TEST_F(TestStarDelaunay_Equivalence, Test_Num_Samples_10000_Iter_10_All_Threads)
+{
+    executeSubtest(NUM_POINTS_10K, NUM_ITERATIONS_10, 0);
+}
@@ -0,0 +1,123 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include <algorithm>
+#include <iostream>
+#include <gtest/gtest.h>
+
+#include "Delaunay.h"
+#include "SweepHullDelaunay.h"
+#include "PointFactory.h"
+#include "TestTriangles.h"
+#include "TriangulationFactory.h"
+
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+#define NUM_POINTS_1K            (1000)
+#define NUM_POINTS_10K           (10000)
+#define NUM_POINTS_100K          (100000)
+
+#define NUM_ITERATIONS_10          (10)
+#define NUM_ITERATIONS_100         (100)
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestSweepHull_Equivalence : public ::testing::Test
+    {
+
+    protected:
+
+        // You can remove any or all of the following functions if its body
+        // is empty.
+        // Constructor (called before each test case) - SetUp
+        TestSweepHull_Equivalence() = default;
+
+        // Deconstructor (called after each test case) - TearDown
+        ~TestSweepHull_Equivalence() override = default;
+
+    public:
+
+        static void executeSubtest(size_t szNumPoints, size_t szNumIterations, size_t szNumThreads);
+    };
+
+    void TestSweepHull_Equivalence::executeSubtest(size_t szNumPoints, size_t szNumIterations,
+                                                       size_t szNumThreads)
+    {
+        // Execute test szNumIterations times
+        for (size_t i=0; i<szNumIterations ; i++)
+        {
+            // Generate random points set
+            vector<Point<TYPE>> vPoints;
+            PointFactory::generateRandom(szNumPoints, vPoints);
+
+            // Build incremental Delaunay triangulation
+            bool isSuccess;
+            Delaunay *delaunay = TriangulationFactory::createDelaunay(vPoints, isSuccess);
+            ASSERT_TRUE(isSuccess);
+
+            // Build sweep hull Delaunay triangulation
+            SweepHullDelaunay *sweepHull = TriangulationFactory::createSweepHull(vPoints, isSuccess, szNumThreads);
+            ASSERT_TRUE(isSuccess);
+
+            // Check both have the same set of triangles
+            vector<TestTriangle> vIncremental;
+            vector<TestTriangle> vSweepHull;
+            TestTriangles::getTriangles(*delaunay->getRefDcel(), vIncremental);
+            TestTriangles::getTriangles(*sweepHull->getRefDcel(), vSweepHull);
+            cout << "Test " << (i+1) << "/" << szNumIterations << endl;
+            ASSERT_EQ(vIncremental.size(), vSweepHull.size());
+            ASSERT_TRUE(vIncremental == vSweepHull);
+
+            // Check both have the same convex hull
+            Polygon hullIncremental;
+            Polygon hullSweepHull;
+            ASSERT_TRUE(delaunay->convexHull());
+            ASSERT_TRUE(sweepHull->convexHull());
+            delaunay->getConvexHull(hullIncremental);
+            sweepHull->getConvexHull(hullSweepHull);
+            ASSERT_TRUE(hullIncremental == hullSweepHull);
+
+            // Free resources
+            delete sweepHull;
+            delete delaunay;
+        }
+    }
+}
+
+
+/**
+ * DESCRIPTION: sweep hull triangulation sorting in one thread is equal to incremental triangulation
+ *
+ */
+TEST_F(TestSweepHull_Equivalence, Test_Num_Samples_1000_Iter_100_Single_Thread)
+{
+    executeSubtest(NUM_POINTS_1K, NUM_ITERATIONS_100, 1);
+}
+
+
+/**
+ * DESCRIPTION: sweep hull triangulation sorting in several threads is equal to incremental triangulation
+ *
+ */
+TEST_F(TestSweepHull_Equivalence, Test_Num_Samples_10000_Iter_10_Four_Threads)
+{
+    executeSubtest(NUM_POINTS_10K, NUM_ITERATIONS_10, 4);
+}
+
+
+/**
+ * DESCRIPTION: sweep hull triangulation using all cores is equal to incremental triangulation
+ *
+ */
+TEST_F(TestSweepHull_Equivalence, Test_Num_Samples_100000_Iter_10_All_Threads)
+{
+    executeSubtest(NUM_POINTS_100K, NUM_ITERATIONS_10, 0);
+}
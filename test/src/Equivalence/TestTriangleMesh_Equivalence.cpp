@@ -0,0 +1,320 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <gtest/gtest.h>
+
+#include "DcelFigureBuilder.h"
+#include "DcelQueries.h"
+#include "DcelWriter.h"
+#include "Delaunay.h"
+#include "Gabriel.h"
+#include "PointFactory.h"
+#include "TriangleMesh.h"
+#include "TriangleMeshView.h"
+#include "TestTriangles.h"
+#include "TriangulationFactory.h"
+#include "Voronoi.h"
+
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+#define NUM_POINTS_1K            (1000)
+#define NUM_POINTS_10K           (10000)
+
+#define NUM_ITERATIONS_10          (10)
+#define NUM_ITERATIONS_100         (100)
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestTriangleMesh_Equivalence : public ::testing::Test
+    {
+
+    protected:
+
+        // You can remove any or all of the following functions if its body
+        // is empty.
+        // Constructor (called before each test case) - SetUp
+        TestTriangleMesh_Equivalence() = default;
+
+        // Deconstructor (called after each test case) - TearDown
+        ~TestTriangleMesh_Equivalence() override = default;
+
+    public:
+
+        static void executeSubtest(size_t szNumPoints, size_t szNumIterations);
+
+        /**
+         * @fn      readFile
+         * @brief   Reads a whole file
+         *
+         * @param   strFileName     (IN) File name
+         * @return  file content
+         */
+        static string readFile(const string &strFileName);
+
+        /**
+         * @fn      sortPoints
+         * @brief   Sorts points lexicographically so areas that start at different vertices can be compared
+         *
+         * @param   vPoints     (IN/OUT) Points to sort
+         */
+        static void sortPoints(vector<Point<TYPE>> &vPoints);
+
+        /**
+         * @fn      isConvexHullPoint
+         * @brief   Checks if a point of an incremental triangulation is connected to an imaginary point
+         *
+         * @param   dcel        (IN) Incremental triangulation
+         * @param   pointIndex  (IN) Point index
+         * @return  true if point is in the convex hull
+         *          false otherwise
+         */
+        static bool isConvexHullPoint(const Dcel &dcel, int pointIndex);
+    };
+
+
+    string TestTriangleMesh_Equivalence::readFile(const string &strFileName)
+    {
+        ifstream ifs(strFileName.c_str(), ios::in | ios::binary);
+        return string((istreambuf_iterator<char>(ifs)), istreambuf_iterator<char>());
+    }
+
+
+    bool TestTriangleMesh_Equivalence::isConvexHullPoint(const Dcel &dcel, int pointIndex)
+    {
+        int firstEdgeIndex = dcel.getPointEdge(pointIndex) - 1;
+        int edgeIndex = firstEdgeIndex;
+        do
+        {
+            if (DcelQueries::hasNegativeVertex(dcel, edgeIndex+1))
+            {
+                return true;
+            }
+            edgeIndex = dcel.getTwin(dcel.getPrevious(edgeIndex)-1) - 1;
+        } while (edgeIndex != firstEdgeIndex);
+
+        return false;
+    }
+
+
+    void TestTriangleMesh_Equivalence::sortPoints(vector<Point<TYPE>> &vPoints)
+    {
+        sort(vPoints.begin(), vPoints.end(), [](const Point<TYPE> &p, const Point<TYPE> &q)
+        {
+            return (p.getX() < q.getX()) || ((p.getX() == q.getX()) && (p.getY() < q.getY()));
+        });
+    }
+
+    void TestTriangleMesh_Equivalence::executeSubtest(size_t szNumPoints, size_t szNumIterations)
+    {
+        // Execute test szNumIterations times
+        for (size_t i=0; i<szNumIterations ; i++)
+        {
+            // Generate random points set
+            vector<Point<TYPE>> vPoints;
+            PointFactory::generateRandom(szNumPoints, vPoints);
+
+            // Build incremental Delaunay triangulation
+            bool isSuccess;
+            Delaunay *delaunay = TriangulationFactory::createDelaunay(vPoints, isSuccess);
+            ASSERT_TRUE(isSuccess);
+
+            // Convert to mesh and back to dcel
+            TriangleMesh mesh(*delaunay->getRefDcel());
+            Dcel dcel;
+            ASSERT_TRUE(mesh.toDcel(dcel));
+
+            // Check both have the same set of triangles
+            vector<TestTriangle> vDelaunay;
+            vector<TestTriangle> vMesh;
+            TestTriangles::getTriangles(*delaunay->getRefDcel(), vDelaunay);
+            TestTriangles::getTriangles(dcel, vMesh);
+            cout << "Test " << (i+1) << "/" << szNumIterations << endl;
+            ASSERT_EQ(vDelaunay.size(), vMesh.size());
+            ASSERT_TRUE(vDelaunay == vMesh);
+
+            // Check all edges are linked
+            for (int edgeIndex=0; edgeIndex<dcel.getNumEdges() ;edgeIndex++)
+            {
+                int twinIndex = dcel.getTwin(edgeIndex) - 1;
+                ASSERT_EQ(edgeIndex+1, dcel.getTwin(twinIndex));
+                ASSERT_EQ(dcel.getOrigin(dcel.getNext(edgeIndex)-1), dcel.getOrigin(twinIndex));
+                ASSERT_EQ(edgeIndex+1, dcel.getPrevious(dcel.getNext(edgeIndex)-1));
+            }
+
+            // Free resources
+            delete delaunay;
+        }
+    }
+}
+
+
+/**
+ * DESCRIPTION: triangle mesh built from incremental triangulation is converted back to an equivalent dcel
+ *
+ */
+TEST_F(TestTriangleMesh_Equivalence, Test_Num_Samples_1000_Iter_100)
+{
+    executeSubtest(NUM_POINTS_1K, NUM_ITERATIONS_100);
+}
+
+
+/**
+ * DESCRIPTION: triangle mesh built from incremental triangulation is converted back to an equivalent dcel
+ *
+ */
+TEST_F(TestTriangleMesh_Equivalence, Test_Num_Samples_10000_Iter_10)
+{
+    executeSubtest(NUM_POINTS_10K, NUM_ITERATIONS_10);
+}
+
+
+/**
+ * DESCRIPTION: triangle mesh written through its view is equal to the dcel built by toDcel written to file
+ *
+ */
+TEST_F(TestTriangleMesh_Equivalence, Test_Writer_Num_Samples_10000)
+{
+    vector<Point<TYPE>> vPoints;
+    PointFactory::generateRandom(NUM_POINTS_10K, vPoints);
+    bool isSuccess;
+    Delaunay *delaunay = TriangulationFactory::createDelaunay(vPoints, isSuccess);
+    ASSERT_TRUE(isSuccess);
+
+    // Meshes with and without imaginary faces
+    for (bool isImaginaryKept : {false, true})
+    {
+        TriangleMesh mesh(*delaunay->getRefDcel(), isImaginaryKept);
+        Dcel dcel;
+        ASSERT_TRUE(mesh.toDcel(dcel));
+        ASSERT_EQ(isImaginaryKept, mesh.hasImaginaryFaces());
+
+        for (const string &strFileName : {string("meshView.txt"), string("meshView.bin")})
+        {
+            string strDcelFileName = "meshDcel" + strFileName.substr(strFileName.find('.'));
+            ASSERT_TRUE(DcelWriter::write(strFileName, mesh));
+            ASSERT_TRUE(DcelWriter::write(strDcelFileName, dcel));
+            ASSERT_EQ(readFile(strDcelFileName), readFile(strFileName));
+            std::remove(strFileName.c_str());
+            std::remove(strDcelFileName.c_str());
+        }
+    }
+
+    delete delaunay;
+}
+
+
+/**
+ * DESCRIPTION: Voronoi diagram read from a triangle mesh that keeps imaginary faces has the same centres and areas
+ *              than the one read from the incremental triangulation dcel
+ *
+ */
+TEST_F(TestTriangleMesh_Equivalence, Test_Voronoi_Num_Samples_10000)
+{
+    vector<Point<TYPE>> vPoints;
+    PointFactory::generateRandom(NUM_POINTS_10K, vPoints);
+    bool isSuccess;
+    Delaunay *delaunay = TriangulationFactory::createDelaunay(vPoints, isSuccess);
+    ASSERT_TRUE(isSuccess);
+    const Dcel &dcel = *delaunay->getRefDcel();
+
+    TriangleMesh mesh(*delaunay->getRefDcel(), true);
+    TriangleMeshView meshView(mesh);
+    ASSERT_TRUE(meshView.build());
+    ASSERT_EQ(dcel.getNumFaces(), meshView.getNumFaces());
+
+    VoronoiView view(dcel);
+    ASSERT_TRUE(view.build());
+    MeshVoronoiView meshVoronoiView(meshView);
+    ASSERT_TRUE(meshVoronoiView.build());
+
+    // Same faces so same centres
+    ASSERT_EQ(view.getNumCentres(), meshVoronoiView.getNumCentres());
+    for (size_t i=0; i<view.getNumCentres() ; i++)
+    {
+        Point<TYPE> centre, meshCentre;
+        view.getCentre((int) i, centre);
+        meshVoronoiView.getCentre((int) i, meshCentre);
+        ASSERT_EQ(centre, meshCentre);
+    }
+
+    // Areas start at different edges. Convex hull areas are open and drop a different boundary extreme
+    Voronoi voronoi, meshVoronoi;
+    ASSERT_TRUE(voronoi.build(view));
+    ASSERT_TRUE(meshVoronoi.build(meshVoronoiView));
+    ASSERT_EQ(voronoi.getRefDcel()->getNumFaces(), meshVoronoi.getRefDcel()->getNumFaces());
+    for (int areaId=1; areaId<=(int) view.getNumAreas() ; areaId++)
+    {
+        vector<Point<TYPE>> vArea, vMeshArea, vMeshFace;
+        view.getArea(areaId, vArea);
+        meshVoronoiView.getArea(areaId, vMeshArea);
+        DcelFigureBuilder::getFacePoints(areaId, *meshVoronoi.getRefDcel(), vMeshFace);
+        ASSERT_EQ(vMeshArea, vMeshFace);
+        if (!isConvexHullPoint(dcel, areaId-1))
+        {
+            sortPoints(vArea);
+            sortPoints(vMeshArea);
+            ASSERT_EQ(vArea, vMeshArea);
+        }
+    }
+
+    // Mesh without imaginary faces cannot close convex hull areas
+    TriangleMesh realMesh(*delaunay->getRefDcel());
+    TriangleMeshView realView(realMesh);
+    ASSERT_TRUE(realView.build());
+    MeshVoronoiView realVoronoiView(realView);
+    ASSERT_FALSE(realVoronoiView.build());
+
+    delete delaunay;
+}
+
+
+/**
+ * DESCRIPTION: in place Gabriel graph read from a triangle mesh view is equal to the one read from the dcel built by
+ *              toDcel, with and without imaginary faces
+ *
+ */
+TEST_F(TestTriangleMesh_Equivalence, Test_Gabriel_Num_Samples_10000)
+{
+    vector<Point<TYPE>> vPoints;
+    PointFactory::generateRandom(NUM_POINTS_10K, vPoints);
+    bool isSuccess;
+    Delaunay *delaunay = TriangulationFactory::createDelaunay(vPoints, isSuccess);
+    ASSERT_TRUE(isSuccess);
+
+    for (bool isImaginaryKept : {false, true})
+    {
+        TriangleMesh mesh(*delaunay->getRefDcel(), isImaginaryKept);
+        Dcel dcel;
+        ASSERT_TRUE(mesh.toDcel(dcel));
+        TriangleMeshView meshView(mesh);
+        ASSERT_TRUE(meshView.build());
+
+        Gabriel gabriel(dcel);
+        ASSERT_TRUE(gabriel.build());
+        Gabriel meshGabriel(meshView);
+        ASSERT_TRUE(meshGabriel.build());
+        ASSERT_TRUE(meshGabriel.isInPlace());
+        ASSERT_EQ(&meshView, meshGabriel.getMeshView());
+
+        ASSERT_EQ(gabriel.getSize(), meshGabriel.getSize());
+        for (int edgeIndex=0; edgeIndex<gabriel.getSize() ; edgeIndex++)
+        {
+            ASSERT_EQ(gabriel.isSet(edgeIndex), meshGabriel.isSet(edgeIndex));
+        }
+    }
+
+    delete delaunay;
+}
@@ -0,0 +1,182 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "DcelFigureBuilder.h"
+#include "Delaunay.h"
+#include "Gabriel.h"
+#include "PointFactory.h"
+#include "TestSuite.h"
+#include "VoronoiView.h"
+
+#include <gtest/gtest.h>
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+#define NUM_VIEW_QUERIES            (1000)
+#define NUM_VIEW_PATHS              (20)
+#define NUM_VIEW_THREADS            (4)
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestVoronoiView_Equivalence : public ::testing::Test
+    {
+    public:
+
+        /**
+         * @fn      execute
+         * @brief   Builds the Voronoi diagram and the Voronoi view of a Delaunay triangulation. Checks both have the
+         *          same centres, areas, inner points and paths and that Gabriel graph is the same using any of them
+         *
+         * @param   szNumPoints     (IN) Points set number of points
+         */
+        static void execute(size_t szNumPoints);
+    };
+
+
+    void TestVoronoiView_Equivalence::execute(size_t szNumPoints)
+    {
+        vector<Point<TYPE>> vPoints;
+        PointFactory::generateRandom(szNumPoints, vPoints);
+        vector<Point<TYPE>> vQueries;
+        PointFactory::generateRandom(NUM_VIEW_QUERIES, vQueries);
+        for (auto &query : vQueries)
+        {
+            query = Point<TYPE>(query.getX() + 0.5, query.getY() + 0.25);
+        }
+
+        Delaunay delaunay(vPoints);
+        ASSERT_TRUE(delaunay.build());
+        const Dcel &dcel = *delaunay.getRefDcel();
+        Voronoi voronoi(&dcel);
+        ASSERT_TRUE(voronoi.build());
+        Dcel &voronoiDcel = *voronoi.getRefDcel();
+        VoronoiView view(dcel);
+        ASSERT_TRUE(view.build(NUM_VIEW_THREADS));
+
+        // Centres
+        ASSERT_EQ(voronoiDcel.getNumVertex(), view.getNumCentres());
+        for (size_t i=0; i<view.getNumCentres() ; i++)
+        {
+            Point<TYPE> centre;
+            view.getCentre((int) i, centre);
+            ASSERT_EQ(*voronoiDcel.getRefPoint((int) i), centre);
+        }
+
+        // Areas
+        ASSERT_EQ(voronoiDcel.getNumFaces(), view.getNumAreas() + 1);
+        for (int areaId=1; areaId<=(int) view.getNumAreas() ; areaId++)
+        {
+            vector<Point<TYPE>> vFacePoints;
+            DcelFigureBuilder::getFacePoints(areaId, voronoiDcel, vFacePoints);
+            vector<Point<TYPE>> vAreaPoints;
+            view.getArea(areaId, vAreaPoints);
+            ASSERT_EQ(vFacePoints, vAreaPoints);
+        }
+
+        // Closest point area and its neighbour areas
+        for (auto &query : vQueries)
+        {
+            Point<TYPE> closest;
+            int pointIndex;
+            ASSERT_TRUE(delaunay.findClosestPoint(query, closest, pointIndex));
+            ASSERT_TRUE(view.isInnerToArea(query, pointIndex+1));
+            ASSERT_EQ(voronoi.isInnerToArea(query, pointIndex+1), view.isInnerToArea(query, pointIndex+1));
+
+            int neighbourId = dcel.getOrigin(dcel.getTwin(dcel.getPointEdge(pointIndex)-1)-1);
+            if (neighbourId > 0)
+            {
+                ASSERT_EQ(voronoi.isInnerToArea(query, neighbourId), view.isInnerToArea(query, neighbourId));
+            }
+        }
+
+        // Paths between queries
+        for (size_t i=0; i<NUM_VIEW_PATHS ; i++)
+        {
+            Point<TYPE> origin = vQueries[i];
+            Point<TYPE> dest = vQueries[vQueries.size() - 1 - i];
+            vector<int> vExtremes(2);
+            Point<TYPE> closest;
+            ASSERT_TRUE(delaunay.findClosestPoint(origin, closest, vExtremes[0]));
+            ASSERT_TRUE(delaunay.findClosestPoint(dest, closest, vExtremes[1]));
+            vExtremes[0]++;
+            vExtremes[1]++;
+
+            Line line(origin, dest);
+            vector<int> vVoronoiPath;
+            ASSERT_TRUE(voronoiDcel.findPath(vExtremes, line, vVoronoiPath));
+            vector<int> vViewPath;
+            ASSERT_TRUE(view.findPath(vExtremes, line, vViewPath));
+            ASSERT_EQ(vVoronoiPath, vViewPath);
+        }
+
+        // Gabriel graph
+        Gabriel gabriel(*delaunay.getRefDcel(), voronoi);
+        ASSERT_TRUE(gabriel.build());
+        Gabriel viewGabriel(dcel, view);
+        ASSERT_TRUE(viewGabriel.build());
+        ASSERT_TRUE(viewGabriel.isVoronoiUsed());
+        for (int edgeIndex=0; edgeIndex<gabriel.getSize() ; edgeIndex++)
+        {
+            ASSERT_EQ(gabriel.isSet(edgeIndex), viewGabriel.isSet(edgeIndex));
+        }
+
+        // Voronoi DCEL built from view is equal to Voronoi DCEL
+        Voronoi materialized;
+        ASSERT_TRUE(materialized.build(view));
+        ASSERT_TRUE(*materialized.getRefDcel() == voronoiDcel);
+    }
+}
+
+
+/**
+ * DESCRIPTION: Voronoi view is equal to Voronoi diagram
+ *
+ */
+TEST_F(TestVoronoiView_Equivalence, Test_Num_Samples_1000)
+{
+    execute(NUM_POINTS_1K);
+}
+
+
+/**
+ * DESCRIPTION: Voronoi view is equal to Voronoi diagram
+ *
+ */
+TEST_F(TestVoronoiView_Equivalence, Test_Num_Samples_100000)
+{
+    execute(NUM_POINTS_100K);
+}
+
+
+/**
+ * DESCRIPTION: Voronoi diagram built in parallel is equal to sequential Voronoi diagram
+ *
+ */
+TEST_F(TestVoronoiView_Equivalence, Test_Parallel_Num_Samples_100000)
+{
+    vector<Point<TYPE>> vPoints;
+    PointFactory::generateRandom(NUM_POINTS_100K, vPoints);
+    Delaunay delaunay(vPoints);
+    ASSERT_TRUE(delaunay.build());
+    VoronoiView view(*delaunay.getRefDcel());
+    ASSERT_TRUE(view.build(NUM_VIEW_THREADS));
+
+    Voronoi sequential;
+    ASSERT_TRUE(sequential.build(view, 1));
+    for (size_t szNumThreads : {(size_t) 2, (size_t) NUM_VIEW_THREADS})
+    {
+        Voronoi parallel;
+        ASSERT_TRUE(parallel.build(view, szNumThreads));
+        ASSERT_TRUE(*parallel.getRefDcel() == *sequential.getRefDcel());
+    }
+
+    Voronoi voronoi(delaunay.getRefDcel());
+    ASSERT_TRUE(voronoi.build(NUM_VIEW_THREADS));
+    ASSERT_TRUE(*voronoi.getRefDcel() == *sequential.getRefDcel());
+}
@@ -0,0 +1,80 @@
+#include "defines.h"
+#include "Dcel.h"
+#include "DcelReader.h"
+#include "DcelWriter.h"
+
+#include <cstdio>
+#include <gtest/gtest.h>
+
+
+/**
+ * DESCRIPTION: builds a triangle and checks edges data is accessed and updated using edge references.
+ *
+ */
+TEST (DcelUnitTest, Test_Edge_Reference)
+{
+    Dcel dcel;
+    Point<TYPE> p1(0, 0), p2(10, 0), p3(0, 10);
+    dcel.addVertex(&p1, 1);
+    dcel.addVertex(&p2, 2);
+    dcel.addVertex(&p3, 3);
+    dcel.addEdge(1, 4, 3, 2, 1);
+    dcel.addEdge(2, 6, 1, 3, 1);
+    dcel.addEdge(3, 5, 2, 1, 1);
+    dcel.addFace(INVALID);
+    dcel.addFace(1);
+
+    EXPECT_EQ(3, dcel.getNumVertex());
+    EXPECT_EQ(3, dcel.getNumEdges());
+    EXPECT_EQ(2, dcel.getNumFaces());
+    EXPECT_EQ(p2, *dcel.getRefPoint(1));
+    EXPECT_EQ(2, dcel.getPointEdge(1));
+
+    // Update edge using reference and check arrays data.
+    EdgeRef edge = dcel.getRefEdge(1);
+    EXPECT_EQ(2, edge->getOrigin());
+    EXPECT_EQ(6, edge->getTwin());
+    edge->setTwin(7);
+    edge->setFace(0);
+    EXPECT_EQ(7, dcel.getTwin(1));
+    EXPECT_EQ(0, dcel.getFace(1));
+    EXPECT_TRUE(Edge(2, 7, 1, 3, 0) == dcel.getEdge(1));
+
+    int ids[3];
+    dcel.getFaceVertices(1, ids);
+    EXPECT_EQ(1, ids[0]);
+    EXPECT_EQ(2, ids[1]);
+    EXPECT_EQ(3, ids[2]);
+}
+
+
+/**
+ * DESCRIPTION: writes dcel in flat and binary formats and checks the dcel read is equal.
+ *
+ */
+TEST (DcelUnitTest, Test_Write_Read)
+{
+    Dcel dcel;
+    Point<TYPE> p1(0, 0), p2(10, 0), p3(0, 10);
+    dcel.addVertex(&p1, 1);
+    dcel.addVertex(&p2, 2);
+    dcel.addVertex(&p3, 3);
+    dcel.addEdge(1, 4, 3, 2, 1);
+    dcel.addEdge(2, 6, 1, 3, 1);
+    dcel.addEdge(3, 5, 2, 1, 1);
+    dcel.addEdge(2, 1, 6, 5, 0);
+    dcel.addEdge(1, 3, 4, 6, 0);
+    dcel.addEdge(3, 2, 5, 4, 0);
+    dcel.addFace(4);
+    dcel.addFace(1);
+
+    vector<string> vFileNames = {"dcelUnitTest.txt", "dcelUnitTest.bin"};
+    for (auto &strFileName : vFileNames)
+    {
+        Dcel dcelRead;
+        ASSERT_TRUE(DcelWriter::write(strFileName, dcel));
+        ASSERT_TRUE(DcelReader::read(strFileName, dcelRead));
+        remove(strFileName.c_str());
+        EXPECT_TRUE(dcel == dcelRead);
+    }
+}
@@ -0,0 +1,105 @@
+#include "defines.h"
+#include "Graph.h"
+#include "GraphReader.h"
+#include "GraphWriter.h"
+
+#include <cstdio>
+#include <gtest/gtest.h>
+
+
+/**
+ * DESCRIPTION: inserts nodes in graph and checks nodes data and face assigned.
+ *
+ */
+TEST (GraphUnitTest, Test_Insert_Set_Children)
+{
+    Graph graph;
+    graph.reserve(10, 0);
+    EXPECT_EQ(0, graph.getSize());
+
+    // Insert root node and split it.
+    graph.insert(1, P_MINUS_2, P_MINUS_1, 1);
+    graph.setChildren(0, 1, 2, 3);
+    graph.insert(2, 1, P_MINUS_2, 1);
+    graph.insert(2, P_MINUS_2, P_MINUS_1, 2);
+    vector<int> vPoints = {2, P_MINUS_1, 1};
+    Node node(vPoints, 3);
+    graph.insert(node);
+
+    // Check root node.
+    int id1, id2, id3;
+    EXPECT_EQ(4, graph.getSize());
+    EXPECT_FALSE(graph.isLeaf(0));
+    EXPECT_EQ(3, graph.getNChildren(0));
+    EXPECT_EQ(1, graph.getiChild(0, 0));
+    EXPECT_EQ(2, graph.getiChild(0, 1));
+    EXPECT_EQ(3, graph.getiChild(0, 2));
+    graph.getVertices(0, id1, id2, id3);
+    EXPECT_EQ(1, id1);
+    EXPECT_EQ(P_MINUS_2, id2);
+    EXPECT_EQ(P_MINUS_1, id3);
+
+    // Check leaves and face assigned.
+    for (int i=1; i<graph.getSize() ;i++)
+    {
+        EXPECT_TRUE(graph.isLeaf(i));
+        EXPECT_EQ(i, graph.getFace(i));
+        EXPECT_EQ(i, graph.getNodeAssigned(i));
+    }
+    graph.getVertices(3, id1, id2, id3);
+    EXPECT_EQ(2, id1);
+    EXPECT_EQ(P_MINUS_1, id2);
+    EXPECT_EQ(1, id3);
+
+    // Check node copy.
+    graph.setChildren(3, 4, 5);
+    node = graph.getNode(3);
+    EXPECT_TRUE(node.isSplitted());
+    EXPECT_EQ(4, node.getiChild(0));
+    EXPECT_EQ(5, node.getiChild(1));
+    EXPECT_EQ(2, node.getiPoint(0));
+    EXPECT_EQ(3, node.getFace());
+}
+
+
+/**
+ * DESCRIPTION: writes graph in flat and binary formats and checks the graph read is equal.
+ *
+ */
+TEST (GraphUnitTest, Test_Write_Read)
+{
+    Graph graph;
+    graph.insert(1, P_MINUS_2, P_MINUS_1, 1);
+    graph.insert(2, 1, P_MINUS_2, 1);
+    graph.insert(2, P_MINUS_2, P_MINUS_1, 2);
+    graph.setChildren(0, 1, 2);
+
+    vector<string> vFileNames = {"graphUnitTest.txt", "graphUnitTest.bin"};
+    for (auto &strFileName : vFileNames)
+    {
+        Graph graphRead;
+        ASSERT_TRUE(GraphWriter::write(strFileName, graph));
+        ASSERT_TRUE(GraphReader::read(strFileName, graphRead));
+        remove(strFileName.c_str());
+
+        ASSERT_EQ(graph.getSize(), graphRead.getSize());
+        for (int i=0; i<graph.getSize() ;i++)
+        {
+            int id1, id2, id3;
+            int idRead1, idRead2, idRead3;
+            graph.getVertices(i, id1, id2, id3);
+            graphRead.getVertices(i, idRead1, idRead2, idRead3);
+            EXPECT_EQ(id1, idRead1);
+            EXPECT_EQ(id2, idRead2);
+            EXPECT_EQ(id3, idRead3);
+            EXPECT_EQ(graph.getFace(i), graphRead.getFace(i));
+            ASSERT_EQ(graph.getNChildren(i), graphRead.getNChildren(i));
+            for (int j=0; j<graph.getNChildren(i) ;j++)
+            {
+                EXPECT_EQ(graph.getiChild(i, j), graphRead.getiChild(i, j));
+            }
+        }
+        EXPECT_EQ(graph.getNodeAssigned(1), graphRead.getNodeAssigned(1));
+        EXPECT_EQ(graph.getNodeAssigned(2), graphRead.getNodeAssigned(2));
+    }
+}
@@ -0,0 +1,50 @@
+#include "Parallel.h"
+
+#include <gtest/gtest.h>
+#include <random>
+
+
+/**
+ * DESCRIPTION: sorts vectors whose size is not a multiple of the chunk size using several numbers of threads, so merge
+ * passes split pairs of sorted chunks between threads, and checks result is equal to std::sort.
+ *
+ */
+TEST (ParallelUnitTest, Test_Sort)
+{
+    std::mt19937 generator(1);
+    for (size_t szSize : {0, 1, 7, 1000, 10007})
+    {
+        for (size_t szNumThreads : {1, 2, 3, 8})
+        {
+            vector<int> vElements(szSize);
+            for (auto &element : vElements)
+            {
+                element = (int) (generator() % 1000);
+            }
+            vector<int> vExpected = vElements;
+            std::sort(vExpected.begin(), vExpected.end());
+
+            Parallel::sort(vElements, 16, szNumThreads, std::less<int>());
+            EXPECT_EQ(vExpected, vElements);
+        }
+    }
+}
+
+
+/**
+ * DESCRIPTION: merges of chunks with many equal keys split their output between threads without losing or duplicating
+ * elements.
+ *
+ */
+TEST (ParallelUnitTest, Test_Sort_Equal_Keys)
+{
+    vector<int> vKeys(1000);
+    for (size_t i=0; i<vKeys.size() ;i++)
+    {
+        vKeys[i] = (int) (i % 2);
+    }
+
+    Parallel::sort(vKeys, 100, 7, std::less<int>());
+    EXPECT_EQ(500, std::count(vKeys.begin(), vKeys.end(), 0));
+    EXPECT_TRUE(std::is_sorted(vKeys.begin(), vKeys.end()));
+}
@@ -0,0 +1,64 @@
+#include "defines.h"
+#include "Point.h"
+#include "Predicates.h"
+
+#include <cfloat>
+#include <gtest/gtest.h>
+
+
+/**
+ * DESCRIPTION: checks turns of non degenerate and exactly collinear points.
+ *
+ */
+TEST (PredicatesUnitTest, Test_Turn)
+{
+    Point<TYPE> a(0.0, 0.0);
+    Point<TYPE> b(10.0, 0.0);
+    EXPECT_EQ(LEFT_TURN, Predicates::turn(a, b, Point<TYPE>(5.0, 1.0)));
+    EXPECT_EQ(RIGHT_TURN, Predicates::turn(a, b, Point<TYPE>(5.0, -1.0)));
+    EXPECT_EQ(COLLINEAR, Predicates::turn(a, b, Point<TYPE>(20.0, 0.0)));
+}
+
+
+/**
+ * DESCRIPTION: checks points closer to a line than the old collinear threshold are not reported as collinear and
+ * turns are consistent when points are permuted.
+ *
+ */
+TEST (PredicatesUnitTest, Test_Turn_Near_Collinear)
+{
+    Point<TYPE> a(0.5, 0.5);
+    Point<TYPE> b(12.0, 12.0);
+    Point<TYPE> c(24.0, 24.0);
+    for (int i=1; i<256 ;i++)
+    {
+        Point<TYPE> p(0.5 + i*DBL_EPSILON, 0.5);
+        Turn_T turn = Predicates::turn(p, b, c);
+        EXPECT_NE(COLLINEAR, turn);
+        EXPECT_EQ(turn, Predicates::turn(b, c, p));
+        EXPECT_EQ(turn, Predicates::turn(c, p, b));
+    }
+    EXPECT_EQ(COLLINEAR, Predicates::turn(a, b, c));
+}
+
+
+/**
+ * DESCRIPTION: checks points inside, outside and in the circumference.
+ *
+ */
+TEST (PredicatesUnitTest, Test_InCircle)
+{
+    Point<TYPE> a(0.0, 2.0);
+    Point<TYPE> b(2.0, 0.0);
+    Point<TYPE> c(4.0, 2.0);
+    EXPECT_TRUE(Predicates::inCircle(a, b, c, Point<TYPE>(2.0, 2.0)));
+    EXPECT_FALSE(Predicates::inCircle(a, b, c, Point<TYPE>(5.0, 5.0)));
+    EXPECT_FALSE(Predicates::inCircle(a, b, c, Point<TYPE>(2.0, 4.0)));
+    EXPECT_EQ(0.0, Predicates::inCircleDet(a, b, c, Point<TYPE>(2.0, 4.0)));
+
+    // Point almost in the circumference
+    Point<TYPE> d(2.0, 4.0 - 4*DBL_EPSILON);
+    Point<TYPE> e(2.0, 4.0 + 4*DBL_EPSILON);
+    EXPECT_TRUE(Predicates::inCircle(a, b, c, d));
+    EXPECT_FALSE(Predicates::inCircle(a, b, c, e));
+}
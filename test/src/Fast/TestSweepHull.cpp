@@ -0,0 +1,125 @@
+#include "defines.h"
+#include "Predicates.h"
+#include "SweepHullDelaunay.h"
+
+#include <gtest/gtest.h>
+
+
+/**
+ * DESCRIPTION: triangulates a regular grid (many cocircular points) and checks number of triangles, convex hull and
+ * that no point is inside the circle of an adjacent triangle.
+ *
+ */
+TEST (SweepHullUnitTest, Test_Grid)
+{
+    vector<Point<TYPE>> vPoints;
+    for (int i=0; i<10 ;i++)
+    {
+        for (int j=0; j<10 ;j++)
+        {
+            vPoints.push_back(Point<TYPE>(i, j));
+        }
+    }
+
+    SweepHullDelaunay sweepHull(vPoints, 1);
+    ASSERT_TRUE(sweepHull.build());
+    Dcel *dcel = sweepHull.getRefDcel();
+
+    // 2*9*9 triangles plus external face
+    ASSERT_EQ(163, dcel->getNumFaces());
+    ASSERT_TRUE(sweepHull.convexHull());
+    EXPECT_EQ(36, sweepHull.getConvexHullLen());
+
+    for (int edgeIndex=0; edgeIndex<dcel->getNumEdges() ;edgeIndex++)
+    {
+        int twinIndex = dcel->getTwin(edgeIndex) - 1;
+        ASSERT_EQ(edgeIndex+1, dcel->getTwin(twinIndex));
+        if ((dcel->getFace(edgeIndex) == EXTERNAL_FACE) || (dcel->getFace(twinIndex) == EXTERNAL_FACE))
+        {
+            continue;
+        }
+
+        Point<TYPE> *p1 = dcel->getRefPoint(dcel->getOrigin(edgeIndex)-1);
+        Point<TYPE> *p2 = dcel->getRefPoint(dcel->getOrigin(dcel->getNext(edgeIndex)-1)-1);
+        Point<TYPE> *p3 = dcel->getRefPoint(dcel->getOrigin(dcel->getPrevious(edgeIndex)-1)-1);
+        Point<TYPE> *q = dcel->getRefPoint(dcel->getOrigin(dcel->getPrevious(twinIndex)-1)-1);
+        ASSERT_EQ(LEFT_TURN, Predicates::turn(*p1, *p2, *p3));
+        ASSERT_FALSE(Predicates::inCircle(*p1, *p2, *p3, *q));
+    }
+}
+
+
+/**
+ * DESCRIPTION: checks triangulation fails if points are duplicated or collinear.
+ *
+ */
+TEST (SweepHullUnitTest, Test_Invalid_Points)
+{
+    vector<Point<TYPE>> vDuplicated = {Point<TYPE>(0, 0), Point<TYPE>(10, 0), Point<TYPE>(5, 5), Point<TYPE>(10, 0)};
+    SweepHullDelaunay duplicated(vDuplicated, 1);
+    EXPECT_FALSE(duplicated.build());
+
+    vector<Point<TYPE>> vCollinear = {Point<TYPE>(0, 0), Point<TYPE>(1, 1), Point<TYPE>(2, 2), Point<TYPE>(3, 3)};
+    SweepHullDelaunay collinear(vCollinear, 1);
+    EXPECT_FALSE(collinear.build());
+}
+
+
+/**
+ * DESCRIPTION: nearly collinear points make a seed circle so large that the distances used to sort points are
+ * rounded, so a point can be inside the convex hull of the points inserted before it. Such points must split the
+ * triangle that contains them, so every point is a vertex and the triangulation is Delaunay.
+ *
+ */
+TEST (SweepHullUnitTest, Test_Nearly_Collinear)
+{
+    vector<Point<TYPE>> vPoints;
+    for (int i=0; i<1000 ;i++)
+    {
+        vPoints.push_back(Point<TYPE>(i*0.5, i*0.25 + ((i % 3) - 1)*1e-9));
+    }
+
+    SweepHullDelaunay sweepHull(vPoints, 1);
+    ASSERT_TRUE(sweepHull.build());
+    EXPECT_GT(sweepHull.getNumInsidePoints(), 0);
+    Dcel *dcel = sweepHull.getRefDcel();
+
+    // Every point is a vertex of a triangle
+    for (size_t pointIndex=0; pointIndex<dcel->getNumVertex() ;pointIndex++)
+    {
+        ASSERT_NE(INVALID, dcel->getPointEdge(pointIndex));
+    }
+
+    // Triangulation of n points with h convex hull edges has 2n-h-2 triangles plus the external face
+    size_t szNumHullEdges=0;
+    for (size_t edgeIndex=0; edgeIndex<dcel->getNumEdges() ;edgeIndex++)
+    {
+        szNumHullEdges += (dcel->getFace(edgeIndex) == EXTERNAL_FACE) ? 1 : 0;
+    }
+    EXPECT_EQ(2*vPoints.size() - szNumHullEdges - 1, dcel->getNumFaces());
+
+    // Triangles are counterclockwise and no point is inside the circle of an adjacent triangle
+    for (int edgeIndex=0; edgeIndex<(int) dcel->getNumEdges() ;edgeIndex++)
+    {
+        int twinIndex = dcel->getTwin(edgeIndex) - 1;
+        if (dcel->getFace(edgeIndex) == EXTERNAL_FACE)
+        {
+            continue;
+        }
+
+        Point<TYPE> *p1 = dcel->getRefPoint(dcel->getOrigin(edgeIndex)-1);
+        Point<TYPE> *p2 = dcel->getRefPoint(dcel->getOrigin(dcel->getNext(edgeIndex)-1)-1);
+        Point<TYPE> *p3 = dcel->getRefPoint(dcel->getOrigin(dcel->getPrevious(edgeIndex)-1)-1);
+        ASSERT_EQ(LEFT_TURN, Predicates::turn(*p1, *p2, *p3));
+        if (dcel->getFace(twinIndex) != EXTERNAL_FACE)
+        {
+            Point<TYPE> *q = dcel->getRefPoint(dcel->getOrigin(dcel->getPrevious(twinIndex)-1)-1);
+            ASSERT_FALSE(Predicates::inCircle(*p1, *p2, *p3, *q));
+        }
+    }
+
+    Point<TYPE> closest;
+    int closestIndex;
+    ASSERT_TRUE(sweepHull.findClosestPoint(vPoints[0], nullptr, closest, closestIndex));
+    EXPECT_EQ(vPoints[0], closest);
+}
@@ -0,0 +1,138 @@
+#include "defines.h"
+#include "Dcel.h"
+#include "TriangleMesh.h"
+#include "TriangleMeshView.h"
+
+#include <gtest/gtest.h>
+
+
+/**
+ * DESCRIPTION: checks next, previous and face are computed from edge index.
+ *
+ */
+TEST (TriangleMeshUnitTest, Test_Implicit_Fields)
+{
+    // Edge ids 1, 2, 3 in face 1 and 4, 5, 6 in face 2.
+    EXPECT_EQ(2, TriangleMesh::getNext(0));
+    EXPECT_EQ(3, TriangleMesh::getNext(1));
+    EXPECT_EQ(1, TriangleMesh::getNext(2));
+    EXPECT_EQ(4, TriangleMesh::getNext(5));
+    EXPECT_EQ(3, TriangleMesh::getPrevious(0));
+    EXPECT_EQ(1, TriangleMesh::getPrevious(1));
+    EXPECT_EQ(5, TriangleMesh::getPrevious(5));
+    EXPECT_EQ(1, TriangleMesh::getFace(2));
+    EXPECT_EQ(2, TriangleMesh::getFace(3));
+    EXPECT_EQ(4, TriangleMesh::getFaceEdge(2));
+}
+
+
+/**
+ * DESCRIPTION: converts a dcel with two triangles to mesh and back and checks triangles and external face.
+ *
+ */
+TEST (TriangleMeshUnitTest, Test_Dcel_Conversion)
+{
+    // Square split by diagonal 1-3.
+    Dcel dcel;
+    Point<TYPE> p1(0, 0), p2(10, 0), p3(10, 10), p4(0, 10);
+    dcel.addVertex(&p1, 1);
+    dcel.addVertex(&p2, 2);
+    dcel.addVertex(&p3, 3);
+    dcel.addVertex(&p4, 5);
+    dcel.addEdge(1, 7, 3, 2, 1);
+    dcel.addEdge(2, 8, 1, 3, 1);
+    dcel.addEdge(3, 4, 2, 1, 1);
+    dcel.addEdge(1, 3, 6, 5, 2);
+    dcel.addEdge(3, 9, 4, 6, 2);
+    dcel.addEdge(4, 10, 5, 4, 2);
+    dcel.addEdge(2, 1, 8, 10, 0);
+    dcel.addEdge(3, 2, 9, 7, 0);
+    dcel.addEdge(4, 5, 10, 8, 0);
+    dcel.addEdge(1, 6, 7, 9, 0);
+    dcel.addFace(7);
+    dcel.addFace(1);
+    dcel.addFace(4);
+
+    TriangleMesh mesh(dcel);
+    ASSERT_EQ(4, mesh.getNumVertex());
+    ASSERT_EQ(6, mesh.getNumEdges());
+    ASSERT_EQ(3, mesh.getNumFaces());
+    EXPECT_EQ(4, mesh.getTwin(2));
+    EXPECT_EQ(3, mesh.getTwin(3));
+    EXPECT_TRUE(mesh.isExternalEdge(0));
+    EXPECT_TRUE(mesh.isExternalEdge(5));
+
+    Dcel dcelOut;
+    ASSERT_TRUE(mesh.toDcel(dcelOut));
+    ASSERT_EQ(dcel.getNumEdges(), dcelOut.getNumEdges());
+    ASSERT_EQ(dcel.getNumFaces(), dcelOut.getNumFaces());
+    for (int faceId=1; faceId<dcel.getNumFaces() ;faceId++)
+    {
+        vector<Point<TYPE>> vPoints, vPointsOut;
+        dcel.getFacePoints(faceId, vPoints);
+        dcelOut.getFacePoints(faceId, vPointsOut);
+        EXPECT_TRUE(vPoints == vPointsOut);
+    }
+
+    // Check every edge is consistent and external face is a 4 edges cycle.
+    for (int edgeIndex=0; edgeIndex<dcelOut.getNumEdges() ;edgeIndex++)
+    {
+        int twinIndex = dcelOut.getTwin(edgeIndex) - 1;
+        EXPECT_EQ(edgeIndex+1, dcelOut.getTwin(twinIndex));
+        EXPECT_EQ(dcelOut.getOrigin(dcelOut.getNext(edgeIndex)-1), dcelOut.getOrigin(twinIndex));
+        EXPECT_EQ(edgeIndex+1, dcelOut.getPrevious(dcelOut.getNext(edgeIndex)-1));
+    }
+    int edgeIndex = dcelOut.getFaceEdge(EXTERNAL_FACE) - 1;
+    for (int i=0; i<4 ;i++)
+    {
+        EXPECT_EQ(EXTERNAL_FACE, dcelOut.getFace(edgeIndex));
+        edgeIndex = dcelOut.getNext(edgeIndex) - 1;
+    }
+    EXPECT_EQ(dcelOut.getFaceEdge(EXTERNAL_FACE) - 1, edgeIndex);
+}
+
+
+/**
+ * DESCRIPTION: mesh view returns the same vertices, edges and faces than the dcel built by toDcel.
+ *
+ */
+TEST (TriangleMeshUnitTest, Test_View)
+{
+    // Square split by diagonal 1-3 stored as mesh.
+    vector<Point<TYPE>> vPoints = {Point<TYPE>(0, 0), Point<TYPE>(10, 0), Point<TYPE>(10, 10), Point<TYPE>(0, 10)};
+    vector<int> vCorners = {1, 2, 3, 1, 3, 4};
+    vector<int> vTwins = {NO_TWIN, NO_TWIN, 4, 3, NO_TWIN, NO_TWIN};
+    TriangleMesh mesh;
+    mesh.set(vPoints, vCorners, vTwins);
+
+    Dcel dcel;
+    ASSERT_TRUE(mesh.toDcel(dcel));
+    TriangleMeshView view(mesh);
+    ASSERT_TRUE(view.build());
+    ASSERT_EQ(dcel.getNumVertex(), view.getNumVertex());
+    ASSERT_EQ(dcel.getNumEdges(), view.getNumEdges());
+    ASSERT_EQ(dcel.getNumFaces(), view.getNumFaces());
+    for (int pointIndex=0; pointIndex<(int) dcel.getNumVertex() ;pointIndex++)
+    {
+        EXPECT_EQ(*dcel.getRefPoint(pointIndex), *view.getRefPoint(pointIndex));
+        EXPECT_EQ(dcel.getPointEdge(pointIndex), view.getPointEdge(pointIndex));
+    }
+    for (int edgeIndex=0; edgeIndex<(int) dcel.getNumEdges() ;edgeIndex++)
+    {
+        EXPECT_EQ(dcel.getOrigin(edgeIndex), view.getOrigin(edgeIndex));
+        EXPECT_EQ(dcel.getTwin(edgeIndex), view.getTwin(edgeIndex));
+        EXPECT_EQ(dcel.getPrevious(edgeIndex), view.getPrevious(edgeIndex));
+        EXPECT_EQ(dcel.getNext(edgeIndex), view.getNext(edgeIndex));
+        EXPECT_EQ(dcel.getFace(edgeIndex), view.getFace(edgeIndex));
+    }
+    for (int faceId=0; faceId<(int) dcel.getNumFaces() ;faceId++)
+    {
+        EXPECT_EQ(dcel.getFaceEdge(faceId), view.getFaceEdge(faceId));
+    }
+
+    // Convex hull point with two external edges
+    vCorners = {1, 2, 3, 1, 3, 2};
+    vTwins = {NO_TWIN, NO_TWIN, NO_TWIN, NO_TWIN, NO_TWIN, NO_TWIN};
+    mesh.set(vPoints, vCorners, vTwins);
+    EXPECT_FALSE(view.build());
+}
@@ -0,0 +1,243 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <new>
+
+#include "Delaunay.h"
+#include "PointFactory.h"
+#include "TestSuite.h"
+#include "TriangulationArena.h"
+
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Allocation hook
+***********************************************************************************************************************/
+namespace
+{
+    // Allocations made by the thread that counts them (other threads are not counted).
+    thread_local bool   isCounting=false;
+    thread_local size_t szNumAllocations=0;
+}
+
+/**
+ * Replaces the global allocation functions of the test binary so every vector growth is counted, not only the arrays
+ * whose capacity is checked. Array versions call these ones.
+ */
+void *operator new(size_t szSize)
+{
+    if (isCounting)
+    {
+        szNumAllocations++;
+    }
+
+    void *ptr = std::malloc((szSize > 0) ? szSize : 1);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    /**
+     * Scoped hook that counts the memory allocations of the current thread while it is alive.
+     */
+    class AllocationCounter
+    {
+        size_t  szFirst;
+
+    public:
+        AllocationCounter() : szFirst(szNumAllocations) { isCounting = true; }
+        ~AllocationCounter() { isCounting = false; }
+
+        size_t getAllocations() const { return szNumAllocations - this->szFirst; }
+    };
+
+
+    class TestDelaunayAllocations_Integration : public ::testing::Test
+    {
+    public:
+        /**
+         * @fn      countAllocations
+         * @brief   Builds Delaunay triangulation whose memory is already reserved and counts the allocations made by
+         *          build, except the ones of the convex hull that is computed at the end. Checks the dcel has exactly
+         *          the reserved number of edges and faces.
+         *
+         * @param   delaunay        (IN/OUT)    Triangulation to build
+         * @return  number of allocations while triangulation was built
+         */
+        static size_t countAllocations(Delaunay &delaunay);
+
+        /**
+         * @fn      generateCircle
+         * @brief   Generates points on a circle. All points are cocircular so the in circle tests of build fall back
+         *          to exact arithmetic
+         *
+         * @param   szNumPoints     (IN)    Number of points
+         * @param   vPoints         (OUT)   Points on the circle
+         */
+        static void generateCircle(size_t szNumPoints, vector<Point<TYPE>> &vPoints);
+    };
+
+    size_t TestDelaunayAllocations_Integration::countAllocations(Delaunay &delaunay)
+    {
+        size_t szNumAllocations;
+        bool isSuccess;
+        {
+            AllocationCounter counter;
+            isSuccess = delaunay.build();
+            szNumAllocations = counter.getAllocations();
+        }
+        EXPECT_TRUE(isSuccess);
+
+        // Convex hull grows from empty, so adding the same points and edges allocates the same memory
+        size_t szNumHullAllocations;
+        {
+            vector<int> vEdges;
+            EXPECT_TRUE(delaunay.getConvexHullEdges(vEdges));
+            Dcel *dcel = delaunay.getRefDcel();
+            ConvexHull hull;
+            AllocationCounter counter;
+            for (int edgeId : vEdges)
+            {
+                hull.add(*dcel->getRefPoint(dcel->getOrigin(edgeId-1)-1), edgeId);
+            }
+            szNumHullAllocations = counter.getAllocations();
+        }
+
+        // Triangulation of n points plus two imaginary points has 6n half-edges and 2n faces
+        Dcel *dcel = delaunay.getRefDcel();
+        size_t szNumPoints = dcel->getNumVertex();
+        EXPECT_EQ(6*szNumPoints, dcel->getNumEdges());
+        EXPECT_EQ(2*szNumPoints, dcel->getNumFaces());
+        EXPECT_EQ(6*szNumPoints, dcel->getEdgesCapacity());
+        EXPECT_EQ(2*szNumPoints, dcel->getFacesCapacity());
+
+        return szNumAllocations - szNumHullAllocations;
+    }
+
+    void TestDelaunayAllocations_Integration::generateCircle(size_t szNumPoints, vector<Point<TYPE>> &vPoints)
+    {
+        vPoints.resize(szNumPoints);
+        for (size_t i=0; i<szNumPoints ;i++)
+        {
+            TYPE angle = 2.0*M_PI*(TYPE) i / (TYPE) szNumPoints;
+            vPoints[i] = Point<TYPE>(1000.0 + 500.0*cos(angle), 1000.0 + 500.0*sin(angle));
+        }
+    }
+}
+
+
+/**
+ * DESCRIPTION: points are moved into the triangulation instead of copied
+ *
+ */
+TEST_F(TestDelaunayAllocations_Integration, Test_Move_Points)
+{
+    vector<Point<TYPE>> vPoints;
+    PointFactory::generateRandom(NUM_POINTS_1K, vPoints);
+    const Point<TYPE> *data = vPoints.data();
+
+    Delaunay delaunay(std::move(vPoints));
+    EXPECT_TRUE(vPoints.empty());
+    EXPECT_EQ(data, delaunay.getRefDcel()->getRefPoint(0));
+}
+
+
+/**
+ * DESCRIPTION: build does not allocate memory when graph is used, also for cocircular points whose in circle tests
+ *              use exact arithmetic
+ *
+ */
+TEST_F(TestDelaunayAllocations_Integration, Test_Graph_Location)
+{
+    for (size_t szNumPoints : {NUM_POINTS_1K, NUM_POINTS_10K})
+    {
+        vector<Point<TYPE>> vPoints;
+        PointFactory::generateRandom(szNumPoints, vPoints);
+        Delaunay delaunay(std::move(vPoints), GRAPH_LOCATION);
+        delaunay.reserve();
+        EXPECT_EQ(0, countAllocations(delaunay));
+    }
+
+    // Cocircular points
+    vector<Point<TYPE>> vPoints;
+    generateCircle(NUM_POINTS_1K, vPoints);
+    Delaunay delaunay(std::move(vPoints), GRAPH_LOCATION);
+    delaunay.reserve();
+    EXPECT_EQ(0, countAllocations(delaunay));
+}
+
+
+/**
+ * DESCRIPTION: build does not allocate memory when walk is used. Insertion order and its sort keys are reserved
+ *
+ */
+TEST_F(TestDelaunayAllocations_Integration, Test_Walk_Location)
+{
+    for (size_t szNumPoints : {NUM_POINTS_1K, NUM_POINTS_10K})
+    {
+        vector<Point<TYPE>> vPoints;
+        PointFactory::generateRandom(szNumPoints, vPoints);
+        Delaunay delaunay(std::move(vPoints), WALK_LOCATION);
+        delaunay.reserve();
+        EXPECT_EQ(0, countAllocations(delaunay));
+    }
+}
+
+
+/**
+ * DESCRIPTION: triangulations built in an arena reserved using the flips of a previous build do not allocate memory,
+ *              are equal to the triangulations built in their own memory, and give the memory back to the arena
+ *
+ */
+TEST_F(TestDelaunayAllocations_Integration, Test_Arena)
+{
+    vector<Point<TYPE>> vPoints;
+    PointFactory::generateRandom(NUM_POINTS_10K, vPoints);
+    Delaunay reference(vPoints);
+    ASSERT_TRUE(reference.build());
+
+    TriangulationArena arena;
+    arena.reserve(vPoints.size(), reference.getFlips(), true);
+    size_t szEdgesCapacity = arena.getEdgesCapacity();
+    size_t szNodesCapacity = arena.getNodesCapacity();
+
+    // Arena memory is reused by consecutive triangulations
+    for (int i=0; i<2 ;i++)
+    {
+        Delaunay delaunay(vPoints);
+        delaunay.attach(arena);
+        EXPECT_EQ(0, arena.getEdgesCapacity());
+        EXPECT_EQ(0, countAllocations(delaunay));
+        EXPECT_EQ(szNodesCapacity, delaunay.getGraph()->getNodesCapacity());
+        EXPECT_EQ(reference.getGraph()->getSize(), delaunay.getGraph()->getSize());
+        EXPECT_TRUE(*reference.getRefDcel() == *delaunay.getRefDcel());
+
+        delaunay.detach();
+        EXPECT_FALSE(delaunay.isValid());
+        EXPECT_EQ(szEdgesCapacity, arena.getEdgesCapacity());
+        EXPECT_EQ(szNodesCapacity, arena.getNodesCapacity());
+    }
+}
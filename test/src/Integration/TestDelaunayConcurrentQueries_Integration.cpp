@@ -0,0 +1,149 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include <gtest/gtest.h>
+
+#include "Delaunay.h"
+#include "PointFactory.h"
+#include "TestSuite.h"
+
+#include <atomic>
+#include <thread>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+#define NUM_QUERY_THREADS               (32)
+#define NUM_QUERIES                     (4096)
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestDelaunayConcurrentQueries_Integration : public ::testing::Test
+    {
+    public:
+        /**
+         * @fn      executeSubtest
+         * @brief   Builds a Delaunay triangulation and computes the expected result of locate, closest point and path
+         *          queries in one thread. Then NUM_QUERY_THREADS threads run the same queries mixed against the same
+         *          triangulation and every result is compared with the expected one.
+         *
+         * @param   location    (IN)    Point location used in triangulation
+         */
+        static void executeSubtest(PointLocation_E location);
+    };
+
+    void TestDelaunayConcurrentQueries_Integration::executeSubtest(PointLocation_E location)
+    {
+        vector<Point<TYPE>> vPoints;
+        PointFactory::generateRandom(NUM_POINTS_10K, vPoints);
+        Delaunay delaunay(vPoints, location);
+        ASSERT_TRUE(delaunay.build());
+        const Delaunay &triangulation = delaunay;
+
+        // Queries are moved away from the triangulation points (paths through a vertex are not supported) and some
+        // of them are out of the convex hull.
+        vector<Point<TYPE>> vQueries;
+        for (size_t i=0; i<NUM_QUERIES+1 ; i++)
+        {
+            vQueries.push_back(Point<TYPE>(vPoints[i].getX() + 0.5, vPoints[i].getY() + 0.25));
+        }
+        for (size_t i=0; i<vQueries.size() ; i+=16)
+        {
+            vQueries[i] = Point<TYPE>(-vQueries[i].getX(), vQueries[i].getY());
+        }
+
+        vector<int> vExpectedFace(NUM_QUERIES);
+        vector<int> vExpectedClosest(NUM_QUERIES);
+        vector<vector<int>> vExpectedPath(NUM_QUERIES);
+        DelaunayQueryContext context;
+        for (size_t i=0; i<NUM_QUERIES ; i++)
+        {
+            Point<TYPE> closest;
+            ASSERT_TRUE(triangulation.findFace(vQueries[i], vExpectedFace[i], context));
+            ASSERT_TRUE(triangulation.findClosestPoint(vQueries[i], closest, vExpectedClosest[i], context));
+            ASSERT_TRUE(triangulation.findPath(vQueries[i], vQueries[i+1], vExpectedPath[i], context));
+        }
+
+        // Every thread runs a different mix of queries using its own context
+        std::atomic<size_t> szErrors(0);
+        vector<std::thread> vThreads;
+        for (size_t t=0; t<NUM_QUERY_THREADS ; t++)
+        {
+            vThreads.emplace_back([&, t]()
+            {
+                DelaunayQueryContext threadContext;
+                vector<int> vPath;
+                for (size_t j=0; j<NUM_QUERIES ; j++)
+                {
+                    size_t i = (j*NUM_QUERY_THREADS + t) % NUM_QUERIES;
+                    switch ((i + t) % 3)
+                    {
+                        case 0:
+                        {
+                            int faceId=0;
+                            if (!triangulation.findFace(vQueries[i], faceId, threadContext) ||
+                                (faceId != vExpectedFace[i]))
+                            {
+                                szErrors++;
+                            }
+                            break;
+                        }
+                        case 1:
+                        {
+                            int pointIndex=0;
+                            Point<TYPE> closest;
+                            if (!triangulation.findClosestPoint(vQueries[i], closest, pointIndex, threadContext) ||
+                                (pointIndex != vExpectedClosest[i]))
+                            {
+                                szErrors++;
+                            }
+                            break;
+                        }
+                        default:
+                        {
+                            if (!triangulation.findPath(vQueries[i], vQueries[i+1], vPath, threadContext) ||
+                                (vPath != vExpectedPath[i]))
+                            {
+                                szErrors++;
+                            }
+                            break;
+                        }
+                    }
+                }
+            });
+        }
+
+        for (auto &thread : vThreads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(0, szErrors);
+    }
+}
+
+
+/**
+ * DESCRIPTION: 32 threads query a triangulation built using history graph
+ *
+ */
+TEST_F(TestDelaunayConcurrentQueries_Integration, Test_Graph_Location_32_Threads)
+{
+    executeSubtest(GRAPH_LOCATION);
+}
+
+
+/**
+ * DESCRIPTION: 32 threads query a triangulation built using walk location
+ *
+ */
+TEST_F(TestDelaunayConcurrentQueries_Integration, Test_Walk_Location_32_Threads)
+{
+    executeSubtest(WALK_LOCATION);
+}
@@ -0,0 +1,115 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include <gtest/gtest.h>
+
+#include "Delaunay.h"
+#include "PointFactory.h"
+#include "Predicates.h"
+#include "TriangulationFactory.h"
+
+#include <cmath>
+using namespace std;
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+#define GRID_SIDE_32                    (32)
+#define NUM_POINTS_CIRCLE_1000          (1000)
+#define NUM_POINTS_RANDOM_10000         (10000)
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestDelaunayFlips_Integration : public ::testing::Test
+    {
+    public:
+        static void executeSubtest(vector<Point<TYPE>> &vPoints, PointLocation_E location);
+    };
+
+    void TestDelaunayFlips_Integration::executeSubtest(vector<Point<TYPE>> &vPoints, PointLocation_E location)
+    {
+        bool isSuccess;
+        Delaunay *delaunay = TriangulationFactory::createDelaunay(vPoints, isSuccess, location);
+        ASSERT_TRUE(isSuccess);
+
+        // Check flip counters are available
+        EXPECT_GT(delaunay->getFlips(), 0);
+        EXPECT_GT(delaunay->getMaxFlipDepth(), 0);
+        EXPECT_LE(delaunay->getLastInsertionFlips(), delaunay->getFlips());
+        EXPECT_LE(delaunay->getLastInsertionFlipDepth(), delaunay->getMaxFlipDepth());
+
+        // Check every edge between real triangles is legal
+        Dcel *dcel = delaunay->getRefDcel();
+        for (int edgeIndex=0; edgeIndex<dcel->getNumEdges() ;edgeIndex++)
+        {
+            int twinIndex = dcel->getTwin(edgeIndex) - 1;
+            if (dcel->imaginaryFace(dcel->getFace(edgeIndex)) || dcel->imaginaryFace(dcel->getFace(twinIndex)))
+            {
+                continue;
+            }
+
+            Point<TYPE> *p1 = dcel->getRefPoint(dcel->getOrigin(edgeIndex)-1);
+            Point<TYPE> *p2 = dcel->getRefPoint(dcel->getOrigin(dcel->getNext(edgeIndex)-1)-1);
+            Point<TYPE> *p3 = dcel->getRefPoint(dcel->getOrigin(dcel->getPrevious(edgeIndex)-1)-1);
+            Point<TYPE> *q = dcel->getRefPoint(dcel->getOrigin(dcel->getPrevious(twinIndex)-1)-1);
+            ASSERT_FALSE(Predicates::inCircle(*p1, *p2, *p3, *q));
+        }
+
+        delete delaunay;
+    }
+}
+
+
+/**
+ * DESCRIPTION: points in a regular grid are triangulated without illegal edges
+ *
+ */
+TEST_F(TestDelaunayFlips_Integration, Test_Grid)
+{
+    vector<Point<TYPE>> vPoints;
+    for (int i=0; i<GRID_SIDE_32 ;i++)
+    {
+        for (int j=0; j<GRID_SIDE_32 ;j++)
+        {
+            vPoints.push_back(Point<TYPE>(i*10.0 + 0.5, j*10.0 + 0.5));
+        }
+    }
+    executeSubtest(vPoints, GRAPH_LOCATION);
+    executeSubtest(vPoints, WALK_LOCATION);
+}
+
+
+/**
+ * DESCRIPTION: points in a circle and its centre are triangulated without illegal edges
+ *
+ */
+TEST_F(TestDelaunayFlips_Integration, Test_Circle)
+{
+    vector<Point<TYPE>> vPoints;
+    vPoints.push_back(Point<TYPE>(5000.0, 5000.0));
+    for (int i=0; i<NUM_POINTS_CIRCLE_1000 ;i++)
+    {
+        double angle = 2.0*PI*i/NUM_POINTS_CIRCLE_1000;
+        vPoints.push_back(Point<TYPE>(5000.0 + 4000.0*cos(angle), 5000.0 + 4000.0*sin(angle)));
+    }
+    executeSubtest(vPoints, GRAPH_LOCATION);
+    executeSubtest(vPoints, WALK_LOCATION);
+}
+
+
+/**
+ * DESCRIPTION: random points are triangulated without illegal edges
+ *
+ */
+TEST_F(TestDelaunayFlips_Integration, Test_Random)
+{
+    vector<Point<TYPE>> vPoints;
+    PointFactory::generateRandom(NUM_POINTS_RANDOM_10000, vPoints);
+    executeSubtest(vPoints, GRAPH_LOCATION);
+    executeSubtest(vPoints, WALK_LOCATION);
+}
@@ -0,0 +1,97 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "PointFactory.h"
+#include "TestSuite.h"
+#include "TriangulationFactory.h"
+
+#include <chrono>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iostream>
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestAllNearest_Profiling : public ::testing::Test
+    {
+    public:
+
+        /**
+         * @fn      execute
+         * @brief   Builds sweep hull Delaunay triangulation of a set of random points and computes the nearest
+         *          neighbour of every point using one thread and all cores, and the two closest points. Writes the
+         *          execution times to a report.
+         *
+         * @param   szNumPoints     (IN) Points set number of points
+         * @param   strFileName     (IN) Report file name
+         */
+        static void execute(size_t szNumPoints, const string& strFileName);
+    };
+
+
+    void TestAllNearest_Profiling::execute(size_t szNumPoints, const string& strFileName)
+    {
+        vector<Point<TYPE>> vPoints;
+        PointFactory::generateRandom(szNumPoints, vPoints);
+
+        bool isSuccess;
+        SweepHullDelaunay *sweepHull = TriangulationFactory::createSweepHull(vPoints, isSuccess);
+        ASSERT_TRUE(isSuccess);
+
+        // Sequential
+        vector<int> vNeighbour;
+        vector<TYPE> vSquaredDistance;
+        auto start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(sweepHull->findAllNearest(vNeighbour, vSquaredDistance, 1));
+        std::chrono::duration<double> sequential = std::chrono::steady_clock::now() - start;
+
+        // All cores
+        start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(sweepHull->findAllNearest(vNeighbour, vSquaredDistance));
+        std::chrono::duration<double> parallel = std::chrono::steady_clock::now() - start;
+
+        // Two closest points reduced from all nearest neighbours
+        Point<TYPE> p, q;
+        start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(sweepHull->findTwoClosest(p, q));
+        std::chrono::duration<double> twoClosest = std::chrono::steady_clock::now() - start;
+
+        delete sweepHull;
+
+        ofstream ofs(strFileName.c_str(), ios::out);
+        if (ofs.is_open())
+        {
+            ofs << "Sequential: " << sequential.count() << endl;
+            ofs << "Parallel: " << parallel.count() << endl;
+            ofs << "Two closest: " << twoClosest.count() << endl;
+            ofs.close();
+        }
+    }
+}
+
+
+/**
+* @brief   Computes all nearest neighbours of 1M points and writes a report
+ */
+TEST_F(TestAllNearest_Profiling, Test_AllNearest_1M)
+{
+    string strFileName="AllNearest_1M.txt";
+    cout << strFileName << "..." << endl;
+    execute(NUM_POINTS_1M, strFileName);
+    cout << strFileName << "...Done" << endl;
+}
+
+/**
+* @brief   Computes all nearest neighbours of 10M points and writes a report
+ */
+TEST_F(TestAllNearest_Profiling, Test_AllNearest_10M)
+{
+    string strFileName="AllNearest_10M.txt";
+    cout << strFileName << "..." << endl;
+    execute(NUM_POINTS_10M, strFileName);
+    cout << strFileName << "...Done" << endl;
+}
@@ -0,0 +1,122 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "DcelWriter.h"
+#include "Delaunay.h"
+#include "PointFactory.h"
+#include "TestSuite.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iostream>
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestBufferedWriter_Profiling : public ::testing::Test
+    {
+    public:
+
+        /**
+         * @fn      execute
+         * @brief   Writes the Delaunay Dcel of a set of random points in flat format using the records operator<<
+         *          and using DcelWriter (with and without background writing) and in binary format. Writes the write
+         *          times to a report
+         *
+         * @param   szNumPoints     (IN) Points set number of points
+         * @param   strFileName     (IN) Report file name
+         */
+        static void execute(size_t szNumPoints, const string& strFileName);
+        static void writeStream(const string& strFileName, const DcelModel &dcel);
+    };
+
+
+    void TestBufferedWriter_Profiling::execute(size_t szNumPoints, const string& strFileName)
+    {
+        vector<Point<TYPE>> vPoints;
+        PointFactory::generateRandom(szNumPoints, vPoints);
+        Delaunay delaunay(vPoints);
+        ASSERT_TRUE(delaunay.build());
+        const Dcel &dcel = *delaunay.getRefDcel();
+
+        string strFlatFileName = "profilingBuffered.txt";
+        string strBinaryFileName = "profilingBuffered.bin";
+        auto start = std::chrono::steady_clock::now();
+        writeStream(strFlatFileName, dcel);
+        std::chrono::duration<double> streamTime = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(DcelWriter::write(strFlatFileName, dcel));
+        std::chrono::duration<double> flatTime = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(DcelWriter::write(strFlatFileName, dcel, true));
+        std::chrono::duration<double> backgroundTime = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(DcelWriter::write(strBinaryFileName, dcel, true));
+        std::chrono::duration<double> binaryTime = std::chrono::steady_clock::now() - start;
+
+        std::remove(strFlatFileName.c_str());
+        std::remove(strBinaryFileName.c_str());
+
+        ofstream ofs(strFileName.c_str(), ios::out);
+        if (ofs.is_open())
+        {
+            ofs << "Flat operator<< write time: " << streamTime.count() << endl;
+            ofs << "Flat write time: " << flatTime.count() << endl;
+            ofs << "Flat background write time: " << backgroundTime.count() << endl;
+            ofs << "Binary background write time: " << binaryTime.count() << endl;
+            ofs.close();
+        }
+    }
+
+
+    /**
+     * @fn      writeStream
+     * @brief   Writes a Dcel in flat format using ofstream and the records operator<<
+     *
+     * @param   strFileName     (IN) File name
+     * @param   dcel            (IN) Dcel to write
+     */
+    void TestBufferedWriter_Profiling::writeStream(const string& strFileName, const DcelModel &dcel)
+    {
+        ofstream ofs(strFileName.c_str(), ios::out);
+        ofs << dcel.getNumVertex() << std::endl;
+        for (size_t i=0; i<dcel.getNumVertex() ;i++)
+        {
+            Vertex vertex = dcel.getVertex(i);
+            ofs << vertex;
+        }
+        ofs << dcel.getNumEdges() << std::endl;
+        for (size_t i=0; i<dcel.getNumEdges() ;i++)
+        {
+            Edge edge = dcel.getEdge(i);
+            ofs << edge;
+        }
+        ofs << dcel.getNumFaces() << std::endl;
+        for (size_t i=0; i<dcel.getNumFaces() ;i++)
+        {
+            Face face(dcel.getFaceEdge(i));
+            ofs << face << std::endl;
+        }
+        ofs.close();
+    }
+}
+
+
+/**
+* @brief   Writes Dcel of 1M points in flat and binary formats and writes a report
+ */
+TEST_F(TestBufferedWriter_Profiling, Test_BufferedWriter_1M)
+{
+    string strFileName="BufferedWriter_1M.txt";
+    cout << strFileName << "..." << endl;
+    execute(NUM_POINTS_1M, strFileName);
+    cout << strFileName << "...Done" << endl;
+}
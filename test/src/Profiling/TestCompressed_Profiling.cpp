@@ -0,0 +1,127 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "CompressedReader.h"
+#include "CompressedWriter.h"
+#include "DcelReader.h"
+#include "DcelWriter.h"
+#include "Delaunay.h"
+#include "PointFactory.h"
+#include "TestSuite.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iostream>
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+#define MIN_COMPRESSION_RATIO       (4.0)
+#define QUANTIZATION_CELL_SIZE      (1e-3)
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestCompressed_Profiling : public ::testing::Test
+    {
+    public:
+
+        /**
+         * @fn      execute
+         * @brief   Writes the Delaunay Dcel of a set of random points in binary and compressed formats (full precision
+         *          and quantized coordinates). Writes to a report the files sizes and read times. Compressed file
+         *          must be smaller and must not be slower to read than the binary file
+         *
+         * @param   szNumPoints     (IN) Points set number of points
+         * @param   strFileName     (IN) Report file name
+         */
+        static void execute(size_t szNumPoints, const string& strFileName);
+        static size_t getFileSize(const string& strFileName);
+    };
+
+
+    void TestCompressed_Profiling::execute(size_t szNumPoints, const string& strFileName)
+    {
+        vector<Point<TYPE>> vPoints;
+        PointFactory::generateRandom(szNumPoints, vPoints);
+        Delaunay delaunay(vPoints);
+        ASSERT_TRUE(delaunay.build());
+
+        string strBinaryFileName = "profilingCompressed.bin";
+        string strFullFileName = "profilingCompressed.dat";
+        string strQuantizedFileName = "profilingQuantized.dat";
+        ASSERT_TRUE(DcelWriter::write(strBinaryFileName, *delaunay.getRefDcel()));
+        auto start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(CompressedWriter::write(strFullFileName, *delaunay.getRefDcel()));
+        std::chrono::duration<double> writeTime = std::chrono::steady_clock::now() - start;
+        ASSERT_TRUE(CompressedWriter::write(strQuantizedFileName, *delaunay.getRefDcel(), QUANTIZATION_CELL_SIZE));
+
+        // Binary reader
+        start = std::chrono::steady_clock::now();
+        Dcel binary;
+        ASSERT_TRUE(DcelReader::read(strBinaryFileName, binary));
+        std::chrono::duration<double> readTime = std::chrono::steady_clock::now() - start;
+
+        // Compressed readers
+        start = std::chrono::steady_clock::now();
+        TriangleMesh mesh;
+        ASSERT_TRUE(CompressedReader::read(strFullFileName, mesh));
+        std::chrono::duration<double> meshTime = std::chrono::steady_clock::now() - start;
+        start = std::chrono::steady_clock::now();
+        Dcel full;
+        ASSERT_TRUE(CompressedReader::read(strFullFileName, full));
+        std::chrono::duration<double> fullTime = std::chrono::steady_clock::now() - start;
+        start = std::chrono::steady_clock::now();
+        Dcel quantized;
+        ASSERT_TRUE(CompressedReader::read(strQuantizedFileName, quantized));
+        std::chrono::duration<double> quantizedTime = std::chrono::steady_clock::now() - start;
+
+        size_t szBinarySize = getFileSize(strBinaryFileName);
+        size_t szFullSize = getFileSize(strFullFileName);
+        size_t szQuantizedSize = getFileSize(strQuantizedFileName);
+        std::remove(strBinaryFileName.c_str());
+        std::remove(strFullFileName.c_str());
+        std::remove(strQuantizedFileName.c_str());
+        ASSERT_GE((double) szBinarySize, MIN_COMPRESSION_RATIO*(double) szFullSize);
+        ASSERT_LE(fullTime.count(), readTime.count());
+
+        ofstream ofs(strFileName.c_str(), ios::out);
+        if (ofs.is_open())
+        {
+            ofs << "Binary size: " << szBinarySize << endl;
+            ofs << "Compressed size: " << szFullSize << endl;
+            ofs << "Compressed quantized size: " << szQuantizedSize << endl;
+            ofs << "Compressed write time: " << writeTime.count() << endl;
+            ofs << "Binary read time: " << readTime.count() << endl;
+            ofs << "Compressed read to mesh time: " << meshTime.count() << endl;
+            ofs << "Compressed read time: " << fullTime.count() << endl;
+            ofs << "Compressed quantized read time: " << quantizedTime.count() << endl;
+            ofs.close();
+        }
+    }
+
+
+    size_t TestCompressed_Profiling::getFileSize(const string& strFileName)
+    {
+        ifstream ifs(strFileName.c_str(), ios::in | ios::binary | ios::ate);
+        return (size_t) ifs.tellg();
+    }
+}
+
+
+/**
+* @brief   Writes and reads Dcel of 1M points in binary and compressed formats and writes a report
+ */
+TEST_F(TestCompressed_Profiling, Test_Compressed_1M)
+{
+    string strFileName="Compressed_1M.txt";
+    cout << strFileName << "..." << endl;
+    execute(NUM_POINTS_1M, strFileName);
+    cout << strFileName << "...Done" << endl;
+}
@@ -8,8 +8,10 @@
 #include "TestSuiteReader.h"
 
 #include <chrono>
+#include <fstream>
 #include <gtest/gtest.h>
 #include <iostream>
+#include <sstream>
 
 
 /***********************************************************************************************************************
@@ -28,24 +30,48 @@ namespace
          *
          * @param   szNumPoints         (IN) Points set number of points
          * @param   szNumIterations     (IN) Number of times the triangulation is computed
+         * @param   location            (IN) Point location used to build the triangulation
          */
-        static void execute(size_t szNumPoints, size_t szNumIterations, const string& strFileName);
+        static void execute(size_t szNumPoints, size_t szNumIterations, const string& strFileName,
+                            PointLocation_E location=GRAPH_LOCATION);
+
+        /**
+         * @fn      resetPeakMemory
+         * @brief   Resets the process resident memory high-water mark to the current resident memory
+         *
+         * @return  true if high-water mark reset
+         *          false otherwise
+         */
+        static bool resetPeakMemory();
+
+        /**
+         * @fn      getMemoryStatus
+         * @brief   Returns a resident memory field of the process status in bytes (VmRSS current, VmHWM peak)
+         *
+         * @param   strField        (IN) Status field name
+         * @return  field value in bytes. Zero if field not found
+         */
+        static size_t getMemoryStatus(const string &strField);
 
         /**
          * @fn      writeReport
          * @brief   Writes a report to a file. The report contains one execution time per line and the last two lines
-         *          are total and average tim
+         *          are total and average tim. If memory is not empty then the average peak memory is written too.
          *
          * @param   strFileName     (IN) Output file name
          * @param   vTimes          (IN) Vector that contains execution times
+         * @param   vMemory         (IN) Vector that contains peak resident bytes of every execution
          */
-        static void writeReport(const string& strFileName, const vector<std::chrono::duration<double>>& vTimes);
+        static void writeReport(const string& strFileName, const vector<std::chrono::duration<double>>& vTimes,
+                                const vector<size_t>& vMemory=vector<size_t>());
     };
 
 
-    void TestDelaunay_Profiling::execute(size_t szNumPoints, size_t szNumIterations, const string& strFileName)
+    void TestDelaunay_Profiling::execute(size_t szNumPoints, size_t szNumIterations, const string& strFileName,
+                                         PointLocation_E location)
     {
         vector<std::chrono::duration<double>> vTimes;
+        vector<size_t> vMemory;
 
         // Execute test szNumIterations times
         for (size_t i=0; i<szNumIterations ; i++)
@@ -56,28 +82,60 @@ namespace
             // Generate random points set
             PointFactory::generateRandom(szNumPoints, vPoints);
 
-            // Get init time
+            // Get init time and memory. Peak is measured from the resident memory before build
+            bool isPeakReset = resetPeakMemory();
+            size_t szInitMemory = getMemoryStatus("VmRSS");
             auto start = std::chrono::steady_clock::now();
 
             // Build first Delaunay triangulation
             bool isSuccess;
-            Delaunay *delaunay = TriangulationFactory::createDelaunay(vPoints, isSuccess);
+            Delaunay *delaunay = TriangulationFactory::createDelaunay(vPoints, isSuccess, location);
             ASSERT_TRUE(isSuccess);
 
             // Get end time and time elapsed
             auto end = std::chrono::steady_clock::now();
             std::chrono::duration<double> elapsed = end - start;
             vTimes.push_back(elapsed);
+            if (isPeakReset)
+            {
+                vMemory.push_back(getMemoryStatus("VmHWM") - szInitMemory);
+            }
 
             // Free resources
             delete delaunay;
         }
 
         // Write report
-        writeReport(strFileName, vTimes);
+        writeReport(strFileName, vTimes, vMemory);
     }
 
-    void TestDelaunay_Profiling::writeReport(const string& strFileName, const vector<std::chrono::duration<double>>& vTimes)
+    bool TestDelaunay_Profiling::resetPeakMemory()
+    {
+        ofstream ofs("/proc/self/clear_refs");
+        ofs << "5";
+        ofs.close();
+        return !ofs.fail();
+    }
+
+    size_t TestDelaunay_Profiling::getMemoryStatus(const string &strField)
+    {
+        ifstream ifs("/proc/self/status");
+        string strLine;
+        while (getline(ifs, strLine))
+        {
+            if (strLine.compare(0, strField.size() + 1, strField + ":") == 0)
+            {
+                size_t szKiloBytes=0;
+                istringstream(strLine.substr(strField.size() + 1)) >> szKiloBytes;
+                return szKiloBytes*1024;
+            }
+        }
+
+        return 0;
+    }
+
+    void TestDelaunay_Profiling::writeReport(const string& strFileName, const vector<std::chrono::duration<double>>& vTimes,
+                                             const vector<size_t>& vMemory)
     {
         // Open file.
         ofstream ofs(strFileName.c_str(), ios::out);
@@ -91,6 +149,15 @@ namespace
             }
             ofs << "Total: " << total << endl;
             ofs << "Avg: " << (total / vTimes.size()) << endl;
+            if (!vMemory.empty())
+            {
+                double totalMemory=0.0;
+                for (auto memory : vMemory)
+                {
+                    totalMemory += (double) memory;
+                }
+                ofs << "Avg peak memory (bytes): " << (totalMemory / vMemory.size()) << endl;
+            }
 
             // Close file.
             ofs.close();
@@ -147,3 +214,25 @@ TEST_F(TestDelaunay_Profiling, Test_Delaunay_1M_100)
     cout << strFileName << "...Done" << endl;
 }
 
+
+/**
+* @brief   Computes Delaunay triangulation 10 times using 100K points, spatially sorted insertion and walk location
+ */
+TEST_F(TestDelaunay_Profiling, Test_Delaunay_Walk_100K_10)
+{
+    string strFileName="Delaunay_Walk_100K_10.txt";
+    cout << strFileName << "..." << endl;
+    execute(NUM_POINTS_100K, NUM_ITERATIONS_10, strFileName, WALK_LOCATION);
+    cout << strFileName << "...Done" << endl;
+}
+
+/**
+* @brief   Computes Delaunay triangulation 10 times using 1M points, spatially sorted insertion and walk location
+ */
+TEST_F(TestDelaunay_Profiling, Test_Delaunay_Walk_1M_10)
+{
+    string strFileName="Delaunay_Walk_1M_10.txt";
+    cout << strFileName << "..." << endl;
+    execute(NUM_POINTS_1M, NUM_ITERATIONS_10, strFileName, WALK_LOCATION);
+    cout << strFileName << "...Done" << endl;
+}
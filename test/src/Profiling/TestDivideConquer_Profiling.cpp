@@ -0,0 +1,134 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "PointFactory.h"
+#include "TestSuite.h"
+#include "TriangulationFactory.h"
+
+#include <chrono>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <thread>
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+// Highest number of threads used in scaling report.
+#define MAX_SCALING_THREADS             (16)
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestDivideConquer_Profiling : public ::testing::Test
+    {
+    public:
+
+        /**
+         * @fn      execute
+         * @brief   Generates a set of random points and computes its divide and conquer Delaunay triangulation using
+         *          1, 2, 4, 8 and 16 threads. Writes the total time, the speedup against one thread and the parallel
+         *          efficiency (speedup divided by threads) of every number of threads to a report. It also writes the
+         *          time of every build phase and of the convex hull, so the parts that do not scale can be seen.
+         *
+         * @param   szNumPoints         (IN) Points set number of points
+         * @param   szNumIterations     (IN) Number of times every triangulation is computed
+         * @param   strFileName         (IN) Report file name
+         */
+        static void execute(size_t szNumPoints, size_t szNumIterations, const string& strFileName);
+    };
+
+
+    void TestDivideConquer_Profiling::execute(size_t szNumPoints, size_t szNumIterations, const string& strFileName)
+    {
+        vector<size_t> vThreads;
+        for (size_t szNumThreads=1; szNumThreads<=MAX_SCALING_THREADS ; szNumThreads *= 2)
+        {
+            vThreads.push_back(szNumThreads);
+        }
+        vector<std::chrono::duration<double>> vTimes(vThreads.size(), std::chrono::duration<double>(0.0));
+        vector<std::chrono::duration<double>> vHullTimes(vThreads.size(), std::chrono::duration<double>(0.0));
+        vector<DivideConquerTimes> vPhases(vThreads.size());
+
+        for (size_t i=0; i<szNumIterations ; i++)
+        {
+            vector<Point<TYPE>> vPoints;
+            PointFactory::generateRandom(szNumPoints, vPoints);
+
+            // Same points set triangulated using every number of threads
+            for (size_t j=0; j<vThreads.size() ; j++)
+            {
+                bool isSuccess;
+                auto start = std::chrono::steady_clock::now();
+                DivideConquerDelaunay *delaunay = TriangulationFactory::createDivideConquer(vPoints, isSuccess,
+                                                                                            vThreads[j]);
+                vTimes[j] += std::chrono::steady_clock::now() - start;
+                ASSERT_TRUE(isSuccess);
+
+                start = std::chrono::steady_clock::now();
+                ASSERT_TRUE(delaunay->convexHull());
+                vHullTimes[j] += std::chrono::steady_clock::now() - start;
+
+                const DivideConquerTimes &times = delaunay->getTimes();
+                vPhases[j].sort += times.sort;
+                vPhases[j].triangulate += times.triangulate;
+                vPhases[j].merge += times.merge;
+                vPhases[j].dcel += times.dcel;
+                delete delaunay;
+            }
+        }
+
+        ofstream ofs(strFileName.c_str(), ios::out);
+        if (ofs.is_open())
+        {
+            ofs << "Hardware threads: " << std::thread::hardware_concurrency() << endl;
+            for (size_t j=0; j<vThreads.size() ; j++)
+            {
+                double speedup = vTimes[0].count() / vTimes[j].count();
+                ofs << "Threads " << vThreads[j] << ": " << vTimes[j].count() << " speedup " << speedup
+                    << " efficiency " << speedup / (double) vThreads[j] << " sort " << vPhases[j].sort
+                    << " triangulate " << vPhases[j].triangulate << " top merge " << vPhases[j].merge << " dcel "
+                    << vPhases[j].dcel << " hull " << vHullTimes[j].count() << endl;
+            }
+            ofs.close();
+        }
+    }
+}
+
+
+/**
+* @brief   Computes triangulations 10 times using 100K points with 1 to 16 threads and writes a report
+ */
+TEST_F(TestDivideConquer_Profiling, Test_DivideConquer_Scaling_100K_10)
+{
+    string strFileName="DivideConquer_Scaling_100K_10.txt";
+    cout << strFileName << "..." << endl;
+    execute(NUM_POINTS_100K, NUM_ITERATIONS_10, strFileName);
+    cout << strFileName << "...Done" << endl;
+}
+
+/**
+* @brief   Computes triangulations once using 1M points with 1 to 16 threads and writes a report
+ */
+TEST_F(TestDivideConquer_Profiling, Test_DivideConquer_Scaling_1M_1)
+{
+    string strFileName="DivideConquer_Scaling_1M_1.txt";
+    cout << strFileName << "..." << endl;
+    execute(NUM_POINTS_1M, NUM_ITERATIONS_1, strFileName);
+    cout << strFileName << "...Done" << endl;
+}
+
+/**
+* @brief   Computes triangulations once using 10M points with 1 to 16 threads and writes a report
+ */
+TEST_F(TestDivideConquer_Profiling, Test_DivideConquer_Scaling_10M_1)
+{
+    string strFileName="DivideConquer_Scaling_10M_1.txt";
+    cout << strFileName << "..." << endl;
+    execute(NUM_POINTS_10M, NUM_ITERATIONS_1, strFileName);
+    cout << strFileName << "...Done" << endl;
+}
@@ -0,0 +1,129 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "DcelGenerator.h"
+#include "DcelGridIndex.h"
+#include "PointFactory.h"
+#include "TestSuite.h"
+#include "TriangulationFactory.h"
+
+#include <chrono>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iostream>
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+#define NUM_QUERY_CLUSTERS          (100)
+#define QUERY_CLUSTER_RADIUS        (100.0)
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestFindFaces_Profiling : public ::testing::Test
+    {
+    public:
+
+        /**
+         * @fn      execute
+         * @brief   Builds Delaunay triangulation of a set of random points and locates a set of queries one by one
+         *          using the graph, in a batch using one thread, in a batch using all cores and one by one using a
+         *          grid index. Writes the number of queries per second of every method to a report.
+         *
+         * @param   szNumPoints     (IN) Points set number of points
+         * @param   vQueries        (IN) Points to locate
+         * @param   strFileName     (IN) Report file name
+         */
+        static void execute(size_t szNumPoints, const vector<Point<TYPE>> &vQueries, const string& strFileName);
+    };
+
+
+    void TestFindFaces_Profiling::execute(size_t szNumPoints, const vector<Point<TYPE>> &vQueries,
+                                          const string& strFileName)
+    {
+        vector<Point<TYPE>> vPoints;
+        PointFactory::generateRandom(szNumPoints, vPoints);
+
+        bool isSuccess;
+        Delaunay *delaunay = TriangulationFactory::createDelaunay(vPoints, isSuccess);
+        ASSERT_TRUE(isSuccess);
+
+        // One by one from graph root
+        auto start = std::chrono::steady_clock::now();
+        for (auto point : vQueries)
+        {
+            int faceId=0;
+            ASSERT_TRUE(delaunay->findFace(point, faceId));
+        }
+        std::chrono::duration<double> single = std::chrono::steady_clock::now() - start;
+
+        // Batch in one thread
+        vector<int> vFacesId;
+        start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(delaunay->findFaces(vQueries, vFacesId, 1));
+        std::chrono::duration<double> batch = std::chrono::steady_clock::now() - start;
+
+        // Batch using all cores
+        start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(delaunay->findFaces(vQueries, vFacesId));
+        std::chrono::duration<double> parallel = std::chrono::steady_clock::now() - start;
+
+        // One by one from grid index seeds
+        DcelGridIndex index;
+        start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(index.build(*delaunay->getRefDcel()));
+        std::chrono::duration<double> indexBuild = std::chrono::steady_clock::now() - start;
+        start = std::chrono::steady_clock::now();
+        for (auto &point : vQueries)
+        {
+            int faceId=0;
+            ASSERT_TRUE(index.findFace(point, faceId));
+        }
+        std::chrono::duration<double> grid = std::chrono::steady_clock::now() - start;
+
+        delete delaunay;
+
+        ofstream ofs(strFileName.c_str(), ios::out);
+        if (ofs.is_open())
+        {
+            ofs << "Single queries/s: " << double(vQueries.size()) / single.count() << endl;
+            ofs << "Batch queries/s: " << double(vQueries.size()) / batch.count() << endl;
+            ofs << "Parallel batch queries/s: " << double(vQueries.size()) / parallel.count() << endl;
+            ofs << "Grid index build time: " << indexBuild.count() << endl;
+            ofs << "Grid index queries/s: " << double(vQueries.size()) / grid.count() << endl;
+            ofs.close();
+        }
+    }
+}
+
+
+/**
+* @brief   Locates 1M uniform random queries in Delaunay triangulation of 100K points and writes a report
+ */
+TEST_F(TestFindFaces_Profiling, Test_FindFaces_Uniform_100K_1M)
+{
+    string strFileName="FindFaces_Uniform_100K_1M.txt";
+    cout << strFileName << "..." << endl;
+    vector<Point<TYPE>> vQueries;
+    PointFactory::generateRandom(NUM_POINTS_1M, vQueries);
+    execute(NUM_POINTS_100K, vQueries, strFileName);
+    cout << strFileName << "...Done" << endl;
+}
+
+/**
+* @brief   Locates 1M clustered queries in Delaunay triangulation of 100K points and writes a report
+ */
+TEST_F(TestFindFaces_Profiling, Test_FindFaces_Clustered_100K_1M)
+{
+    string strFileName="FindFaces_Clustered_100K_1M.txt";
+    cout << strFileName << "..." << endl;
+    vector<Point<TYPE>> vQueries;
+    ASSERT_TRUE(DcelGenerator::generateClusters(NUM_POINTS_1M, NUM_QUERY_CLUSTERS, QUERY_CLUSTER_RADIUS, vQueries));
+    execute(NUM_POINTS_100K, vQueries, strFileName);
+    cout << strFileName << "...Done" << endl;
+}
@@ -0,0 +1,99 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "Gabriel.h"
+#include "PointFactory.h"
+#include "TestSuite.h"
+#include "TriangulationFactory.h"
+
+#include <chrono>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <malloc.h>
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestGabriel_Profiling : public ::testing::Test
+    {
+    public:
+
+        /**
+         * @fn      execute
+         * @brief   Builds Delaunay triangulation of a set of random points and computes its Gabriel graph using the
+         *          Voronoi diagram and in place. Writes time and heap memory used by every method to a report.
+         *
+         * @param   szNumPoints     (IN) Points set number of points
+         * @param   strFileName     (IN) Report file name
+         */
+        static void execute(size_t szNumPoints, const string& strFileName);
+
+        static size_t getHeapSize() { return mallinfo2().uordblks; };
+    };
+
+
+    void TestGabriel_Profiling::execute(size_t szNumPoints, const string& strFileName)
+    {
+        vector<Point<TYPE>> vPoints;
+        PointFactory::generateRandom(szNumPoints, vPoints);
+
+        bool isSuccess;
+        Delaunay *delaunay = TriangulationFactory::createDelaunay(vPoints, isSuccess);
+        ASSERT_TRUE(isSuccess);
+        Dcel *dcel = delaunay->getRefDcel();
+
+        // Voronoi diagram and copies of triangulation and diagram
+        size_t szHeapSize = getHeapSize();
+        auto start = std::chrono::steady_clock::now();
+        auto *voronoi = new Voronoi(dcel);
+        ASSERT_TRUE(voronoi->build());
+        auto *gabriel = new Gabriel(*dcel, *voronoi);
+        ASSERT_TRUE(gabriel->build());
+        std::chrono::duration<double> voronoiTime = std::chrono::steady_clock::now() - start;
+        size_t szVoronoiMemory = getHeapSize() - szHeapSize;
+        delete gabriel;
+        delete voronoi;
+
+        // In place using one thread and all cores
+        szHeapSize = getHeapSize();
+        start = std::chrono::steady_clock::now();
+        gabriel = new Gabriel(*dcel);
+        ASSERT_TRUE(gabriel->build(1));
+        std::chrono::duration<double> inPlaceTime = std::chrono::steady_clock::now() - start;
+        size_t szInPlaceMemory = getHeapSize() - szHeapSize;
+        start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(gabriel->build());
+        std::chrono::duration<double> parallelTime = std::chrono::steady_clock::now() - start;
+        delete gabriel;
+
+        delete delaunay;
+        ASSERT_LT(2*szInPlaceMemory, szVoronoiMemory);
+
+        ofstream ofs(strFileName.c_str(), ios::out);
+        if (ofs.is_open())
+        {
+            ofs << "Voronoi Gabriel time: " << voronoiTime.count() << endl;
+            ofs << "Voronoi Gabriel memory (bytes): " << szVoronoiMemory << endl;
+            ofs << "In place Gabriel time: " << inPlaceTime.count() << endl;
+            ofs << "In place Gabriel memory (bytes): " << szInPlaceMemory << endl;
+            ofs << "Parallel in place Gabriel time: " << parallelTime.count() << endl;
+            ofs.close();
+        }
+    }
+}
+
+
+/**
+* @brief   Computes Gabriel graph of 1M points and writes a report
+ */
+TEST_F(TestGabriel_Profiling, Test_Gabriel_1M)
+{
+    string strFileName="Gabriel_1M.txt";
+    cout << strFileName << "..." << endl;
+    execute(NUM_POINTS_1M, strFileName);
+    cout << strFileName << "...Done" << endl;
+}
@@ -0,0 +1,132 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "PointFactory.h"
+#include "TestSuite.h"
+#include "TriangulationFactory.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iostream>
+
+
+/***********************************************************************************************************************
+* Defines
+***********************************************************************************************************************/
+#define NUM_PROFILING_QUERIES       (1000)
+#define PROFILING_K                 (64)
+#define PROFILING_RADIUS            (100.0)
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestKClosest_Profiling : public ::testing::Test
+    {
+    public:
+
+        /**
+         * @fn      execute
+         * @brief   Builds Delaunay triangulation of a set of random points and computes k closest points and points in
+         *          radius of a set of queries using brute force and Delaunay batch queries. Writes the number of
+         *          queries per second of every method to a report.
+         *
+         * @param   szNumPoints     (IN) Points set number of points
+         * @param   strFileName     (IN) Report file name
+         */
+        static void execute(size_t szNumPoints, const string& strFileName);
+    };
+
+
+    void TestKClosest_Profiling::execute(size_t szNumPoints, const string& strFileName)
+    {
+        vector<Point<TYPE>> vPoints;
+        PointFactory::generateRandom(szNumPoints, vPoints);
+        vector<Point<TYPE>> vQueries(NUM_PROFILING_QUERIES);
+        for (auto &query : vQueries)
+        {
+            query.random();
+        }
+
+        bool isSuccess;
+        Delaunay *delaunay = TriangulationFactory::createDelaunay(vPoints, isSuccess);
+        ASSERT_TRUE(isSuccess);
+
+        // Brute force k closest and radius
+        vector<pair<TYPE,int>> vDistances(szNumPoints);
+        vector<int> vInRadius;
+        std::chrono::duration<double> bruteKClosest(0.0);
+        std::chrono::duration<double> bruteRadius(0.0);
+        for (auto &query : vQueries)
+        {
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i=0; i<szNumPoints ; i++)
+            {
+                vDistances[i] = make_pair(query.distance(vPoints[i]), (int) i);
+            }
+            std::partial_sort(vDistances.begin(), vDistances.begin() + PROFILING_K, vDistances.end());
+            bruteKClosest += std::chrono::steady_clock::now() - start;
+
+            start = std::chrono::steady_clock::now();
+            vInRadius.clear();
+            for (size_t i=0; i<szNumPoints ; i++)
+            {
+                if (query.distance(vPoints[i]) <= PROFILING_RADIUS)
+                {
+                    vInRadius.push_back((int) i);
+                }
+            }
+            bruteRadius += std::chrono::steady_clock::now() - start;
+        }
+
+        // Delaunay batch queries
+        vector<int> vClosest;
+        auto start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(delaunay->findKClosest(vQueries, PROFILING_K, vClosest));
+        std::chrono::duration<double> kClosest = std::chrono::steady_clock::now() - start;
+
+        vector<vector<int>> vBatchInRadius;
+        start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(delaunay->findInRadius(vQueries, PROFILING_RADIUS, vBatchInRadius));
+        std::chrono::duration<double> radius = std::chrono::steady_clock::now() - start;
+
+        delete delaunay;
+
+        ofstream ofs(strFileName.c_str(), ios::out);
+        if (ofs.is_open())
+        {
+            ofs << "Brute force k closest queries/s: " << double(vQueries.size()) / bruteKClosest.count() << endl;
+            ofs << "Delaunay k closest queries/s: " << double(vQueries.size()) / kClosest.count() << endl;
+            ofs << "Brute force radius queries/s: " << double(vQueries.size()) / bruteRadius.count() << endl;
+            ofs << "Delaunay radius queries/s: " << double(vQueries.size()) / radius.count() << endl;
+            ofs.close();
+        }
+    }
+}
+
+
+/**
+* @brief   Computes 64 closest points and points in radius of 1K queries in a set of 100K points and writes a report
+ */
+TEST_F(TestKClosest_Profiling, Test_KClosest_100K)
+{
+    string strFileName="KClosest_100K.txt";
+    cout << strFileName << "..." << endl;
+    execute(NUM_POINTS_100K, strFileName);
+    cout << strFileName << "...Done" << endl;
+}
+
+/**
+* @brief   Computes 64 closest points and points in radius of 1K queries in a set of 1M points and writes a report
+ */
+TEST_F(TestKClosest_Profiling, Test_KClosest_1M)
+{
+    string strFileName="KClosest_1M.txt";
+    cout << strFileName << "..." << endl;
+    execute(NUM_POINTS_1M, strFileName);
+    cout << strFileName << "...Done" << endl;
+}
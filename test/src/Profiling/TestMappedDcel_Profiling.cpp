@@ -0,0 +1,130 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "DcelGridIndex.h"
+#include "DcelReader.h"
+#include "DcelWriter.h"
+#include "Delaunay.h"
+#include "MappedDcel.h"
+#include "PointFactory.h"
+#include "TestSuite.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iostream>
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestMappedDcel_Profiling : public ::testing::Test
+    {
+    public:
+
+        /**
+         * @fn      execute
+         * @brief   Writes the Delaunay Dcel of a set of random points in binary and mapped formats. Writes to a report
+         *          the time to read the binary file, to map the mapped file and to copy the mapped data to a Dcel. Also
+         *          writes the time to build a grid index and locate a set of points in the mapped file and in its copy.
+         *          Mapped queries must be faster because the copy is not needed
+         *
+         * @param   szNumPoints     (IN) Points set number of points
+         * @param   strFileName     (IN) Report file name
+         */
+        static void execute(size_t szNumPoints, const string& strFileName);
+    };
+
+
+    void TestMappedDcel_Profiling::execute(size_t szNumPoints, const string& strFileName)
+    {
+        vector<Point<TYPE>> vPoints;
+        PointFactory::generateRandom(szNumPoints, vPoints);
+        Delaunay delaunay(vPoints);
+        ASSERT_TRUE(delaunay.build());
+
+        string strBinaryFileName = "profilingDcel.bin";
+        string strMappedFileName = "profilingDcel.map";
+        ASSERT_TRUE(DcelWriter::write(strBinaryFileName, *delaunay.getRefDcel()));
+        ASSERT_TRUE(DcelWriter::writeMapped(strMappedFileName, *delaunay.getRefDcel()));
+
+        // Binary reader
+        auto start = std::chrono::steady_clock::now();
+        Dcel binary;
+        ASSERT_TRUE(DcelReader::read(strBinaryFileName, binary));
+        std::chrono::duration<double> readTime = std::chrono::steady_clock::now() - start;
+
+        // Map and touch one edge per page
+        start = std::chrono::steady_clock::now();
+        MappedDcel mapped;
+        ASSERT_TRUE(mapped.open(strMappedFileName));
+        std::chrono::duration<double> openTime = std::chrono::steady_clock::now() - start;
+        long sum = 0;
+        for (size_t i=0; i<mapped.getNumEdges() ; i+=1024)
+        {
+            sum += mapped.getTwin((int) i);
+        }
+        std::chrono::duration<double> touchTime = std::chrono::steady_clock::now() - start;
+        ASSERT_GT(sum, 0);
+
+        // Copy mapped data
+        start = std::chrono::steady_clock::now();
+        Dcel copy;
+        ASSERT_TRUE(mapped.toDcel(copy));
+        std::chrono::duration<double> copyTime = std::chrono::steady_clock::now() - start;
+
+        // Locate points in the copy and in the mapped file
+        vector<Point<TYPE>> vQueries;
+        PointFactory::generateRandom(NUM_POINTS_10K, vQueries);
+        start = std::chrono::steady_clock::now();
+        DcelGridIndex index;
+        ASSERT_TRUE(index.build(copy));
+        for (auto &query : vQueries)
+        {
+            int faceId=0;
+            ASSERT_TRUE(index.findFace(query, faceId));
+        }
+        std::chrono::duration<double> queryTime = std::chrono::steady_clock::now() - start;
+        start = std::chrono::steady_clock::now();
+        MappedDcelGridIndex mappedIndex;
+        ASSERT_TRUE(mappedIndex.build(mapped));
+        for (auto &query : vQueries)
+        {
+            int faceId=0;
+            ASSERT_TRUE(mappedIndex.findFace(query, faceId));
+        }
+        std::chrono::duration<double> mappedQueryTime = std::chrono::steady_clock::now() - start;
+
+        std::remove(strBinaryFileName.c_str());
+        std::remove(strMappedFileName.c_str());
+        ASSERT_LT(openTime.count(), readTime.count());
+        ASSERT_LT(mappedQueryTime.count(), copyTime.count() + queryTime.count());
+
+        ofstream ofs(strFileName.c_str(), ios::out);
+        if (ofs.is_open())
+        {
+            ofs << "Binary read time: " << readTime.count() << endl;
+            ofs << "Mapped open time: " << openTime.count() << endl;
+            ofs << "Mapped open and touch time: " << touchTime.count() << endl;
+            ofs << "Mapped copy to Dcel time: " << copyTime.count() << endl;
+            ofs << "Copy grid index and queries time: " << queryTime.count() << endl;
+            ofs << "Mapped grid index and queries time: " << mappedQueryTime.count() << endl;
+            ofs.close();
+        }
+    }
+}
+
+
+/**
+* @brief   Reads Dcel of 1M points from binary and mapped files and writes a report
+ */
+TEST_F(TestMappedDcel_Profiling, Test_MappedDcel_1M)
+{
+    string strFileName="MappedDcel_1M.txt";
+    cout << strFileName << "..." << endl;
+    execute(NUM_POINTS_1M, strFileName);
+    cout << strFileName << "...Done" << endl;
+}
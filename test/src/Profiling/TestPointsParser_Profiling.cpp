@@ -0,0 +1,90 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "PointFactory.h"
+#include "PointsReader.h"
+#include "PointsWriter.h"
+#include "TestSuite.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <sys/stat.h>
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestPointsParser_Profiling : public ::testing::Test
+    {
+    public:
+
+        /**
+         * @fn      execute
+         * @brief   Writes a text file of random points and reads it with stream reader and with text reader using one
+         *          thread and all cores. Writes throughput of every reader to a report
+         *
+         * @param   szNumPoints     (IN) Points set number of points
+         * @param   strFileName     (IN) Report file name
+         */
+        static void execute(size_t szNumPoints, const string& strFileName);
+    };
+
+
+    void TestPointsParser_Profiling::execute(size_t szNumPoints, const string& strFileName)
+    {
+        vector<Point<TYPE>> vPoints;
+        PointFactory::generateRandom(szNumPoints, vPoints);
+        string strPointsFileName = "profilingPoints.txt";
+        ASSERT_TRUE(PointsWriter::write(strPointsFileName, vPoints));
+        struct stat results = {};
+        stat(strPointsFileName.c_str(), &results);
+        double megaBytes = (double) results.st_size / (1024.0*1024.0);
+
+        auto start = std::chrono::steady_clock::now();
+        vector<Point<TYPE>> vFlatPoints;
+        ASSERT_TRUE(PointsReader::readFlat(strPointsFileName, vFlatPoints));
+        std::chrono::duration<double> flatTime = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        vector<Point<TYPE>> vTextPoints;
+        ASSERT_TRUE(PointsReader::readText(strPointsFileName, vTextPoints, 1));
+        std::chrono::duration<double> textTime = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        vector<Point<TYPE>> vParallelPoints;
+        ASSERT_TRUE(PointsReader::readText(strPointsFileName, vParallelPoints));
+        std::chrono::duration<double> parallelTime = std::chrono::steady_clock::now() - start;
+
+        std::remove(strPointsFileName.c_str());
+        ASSERT_EQ(vFlatPoints, vTextPoints);
+        ASSERT_EQ(vFlatPoints, vParallelPoints);
+        ASSERT_LT(textTime.count(), flatTime.count());
+
+        ofstream ofs(strFileName.c_str(), ios::out);
+        if (ofs.is_open())
+        {
+            ofs << "File size (MB): " << megaBytes << endl;
+            ofs << "Stream reader (MB/s): " << megaBytes / flatTime.count() << endl;
+            ofs << "Text reader one thread (MB/s): " << megaBytes / textTime.count() << endl;
+            ofs << "Text reader all cores (MB/s): " << megaBytes / parallelTime.count() << endl;
+            ofs.close();
+        }
+    }
+}
+
+
+/**
+* @brief   Reads a text file of 10M points and writes a report
+ */
+TEST_F(TestPointsParser_Profiling, Test_PointsParser_10M)
+{
+    string strFileName="PointsParser_10M.txt";
+    cout << strFileName << "..." << endl;
+    execute(NUM_POINTS_10M, strFileName);
+    cout << strFileName << "...Done" << endl;
+}
@@ -0,0 +1,89 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "Point.h"
+#include "PointFactory.h"
+#include "Predicates.h"
+#include "TestSuite.h"
+
+#include <chrono>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iostream>
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestPredicates_Profiling : public ::testing::Test
+    {
+    public:
+
+        /**
+         * @fn      execute
+         * @brief   Evaluates in circle test over random points using floating point determinant with pow and filtered
+         *          predicates. Writes both execution times to a report.
+         *
+         * @param   szNumPoints         (IN) Points set number of points
+         * @param   szNumIterations     (IN) Number of times every point set is evaluated
+         * @param   strFileName         (IN) Report file name
+         */
+        static void execute(size_t szNumPoints, size_t szNumIterations, const string& strFileName);
+    };
+
+
+    void TestPredicates_Profiling::execute(size_t szNumPoints, size_t szNumIterations, const string& strFileName)
+    {
+        vector<Point<TYPE>> vPoints;
+        PointFactory::generateRandom(szNumPoints, vPoints);
+
+        // Evaluate every four consecutive points using determinant with pow
+        size_t szInsideLegacy=0;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i=0; i<szNumIterations ; i++)
+        {
+            for (size_t j=0; j+3<vPoints.size() ; j++)
+            {
+                szInsideLegacy += Point<TYPE>::inCircle(&vPoints[j], &vPoints[j+1], &vPoints[j+2], &vPoints[j+3]);
+            }
+        }
+        std::chrono::duration<double> legacy = std::chrono::steady_clock::now() - start;
+
+        // Evaluate every four consecutive points using filtered predicate
+        size_t szInsideFiltered=0;
+        start = std::chrono::steady_clock::now();
+        for (size_t i=0; i<szNumIterations ; i++)
+        {
+            for (size_t j=0; j+3<vPoints.size() ; j++)
+            {
+                szInsideFiltered += Predicates::inCircle(vPoints[j], vPoints[j+1], vPoints[j+2], vPoints[j+3]);
+            }
+        }
+        std::chrono::duration<double> filtered = std::chrono::steady_clock::now() - start;
+
+        // Random points are not degenerate so both must agree
+        EXPECT_EQ(szInsideLegacy, szInsideFiltered);
+
+        ofstream ofs(strFileName.c_str(), ios::out);
+        if (ofs.is_open())
+        {
+            ofs << "pow: " << legacy.count() << endl;
+            ofs << "Filtered: " << filtered.count() << endl;
+            ofs.close();
+        }
+    }
+}
+
+
+/**
+* @brief   Evaluates 1M in circle tests 10 times and writes a report
+ */
+TEST_F(TestPredicates_Profiling, Test_InCircle_1M_10)
+{
+    string strFileName="Predicates_InCircle_1M_10.txt";
+    cout << strFileName << "..." << endl;
+    execute(NUM_POINTS_1M, NUM_ITERATIONS_10, strFileName);
+    cout << strFileName << "...Done" << endl;
+}
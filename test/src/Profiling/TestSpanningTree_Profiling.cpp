@@ -0,0 +1,100 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "Gabriel.h"
+#include "MinimumSpanningTree.h"
+#include "PointFactory.h"
+#include "RelativeNeighbourhood.h"
+#include "TestSuite.h"
+#include "TriangulationFactory.h"
+
+#include <chrono>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iostream>
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestSpanningTree_Profiling : public ::testing::Test
+    {
+    public:
+
+        /**
+         * @fn      execute
+         * @brief   Builds Delaunay triangulation of a set of random points and computes its Gabriel graph, minimum
+         *          spanning tree and relative neighbourhood graph using one thread and all cores. Writes the time
+         *          of every graph to a report.
+         *
+         * @param   szNumPoints     (IN) Points set number of points
+         * @param   strFileName     (IN) Report file name
+         */
+        static void execute(size_t szNumPoints, const string& strFileName);
+    };
+
+
+    void TestSpanningTree_Profiling::execute(size_t szNumPoints, const string& strFileName)
+    {
+        vector<Point<TYPE>> vPoints;
+        PointFactory::generateRandom(szNumPoints, vPoints);
+
+        bool isSuccess;
+        Delaunay *delaunay = TriangulationFactory::createDelaunay(vPoints, isSuccess);
+        ASSERT_TRUE(isSuccess);
+        Dcel *dcel = delaunay->getRefDcel();
+
+        // Gabriel graph including Voronoi diagram
+        auto start = std::chrono::steady_clock::now();
+        Voronoi voronoi(dcel);
+        ASSERT_TRUE(voronoi.build());
+        Gabriel gabriel(*dcel, voronoi);
+        ASSERT_TRUE(gabriel.build());
+        std::chrono::duration<double> gabrielTime = std::chrono::steady_clock::now() - start;
+
+        // Minimum spanning tree
+        MinimumSpanningTree tree(*dcel);
+        start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(tree.build(1));
+        std::chrono::duration<double> treeTime = std::chrono::steady_clock::now() - start;
+        start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(tree.build());
+        std::chrono::duration<double> parallelTreeTime = std::chrono::steady_clock::now() - start;
+
+        // Relative neighbourhood graph
+        RelativeNeighbourhood graph(*dcel);
+        start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(graph.build(1));
+        std::chrono::duration<double> graphTime = std::chrono::steady_clock::now() - start;
+        start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(graph.build());
+        std::chrono::duration<double> parallelGraphTime = std::chrono::steady_clock::now() - start;
+
+        delete delaunay;
+
+        ofstream ofs(strFileName.c_str(), ios::out);
+        if (ofs.is_open())
+        {
+            ofs << "Gabriel time: " << gabrielTime.count() << endl;
+            ofs << "Minimum spanning tree time: " << treeTime.count() << endl;
+            ofs << "Parallel minimum spanning tree time: " << parallelTreeTime.count() << endl;
+            ofs << "Relative neighbourhood time: " << graphTime.count() << endl;
+            ofs << "Parallel relative neighbourhood time: " << parallelGraphTime.count() << endl;
+            ofs.close();
+        }
+    }
+}
+
+
+/**
+* @brief   Computes minimum spanning tree and relative neighbourhood graph of 1M points and writes a report
+ */
+TEST_F(TestSpanningTree_Profiling, Test_SpanningTree_1M)
+{
+    string strFileName="SpanningTree_1M.txt";
+    cout << strFileName << "..." << endl;
+    execute(NUM_POINTS_1M, strFileName);
+    cout << strFileName << "...Done" << endl;
+}
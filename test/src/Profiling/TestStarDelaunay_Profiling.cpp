@@ -0,0 +1,96 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "PointFactory.h"
+#include "StarTriangulation.h"
+#include "TestSuite.h"
+#include "TriangulationFactory.h"
+
+#include <chrono>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iostream>
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestStarDelaunay_Profiling : public ::testing::Test
+    {
+    public:
+
+        /**
+         * @fn      execute
+         * @brief   Generates a set of random points, computes its star triangulation and converts two copies into
+         *          Delaunay triangulation using sequential and parallel flips. Writes both execution times to a report.
+         *
+         * @param   szNumPoints         (IN) Points set number of points
+         * @param   szNumIterations     (IN) Number of times the triangulation is converted
+         * @param   strFileName         (IN) Report file name
+         */
+        static void execute(size_t szNumPoints, size_t szNumIterations, const string& strFileName);
+    };
+
+
+    void TestStarDelaunay_Profiling::execute(size_t szNumPoints, size_t szNumIterations, const string& strFileName)
+    {
+        std::chrono::duration<double> sequential(0.0);
+        std::chrono::duration<double> parallel(0.0);
+
+        for (size_t i=0; i<szNumIterations ; i++)
+        {
+            vector<Point<TYPE>> vPoints;
+            PointFactory::generateRandom(szNumPoints, vPoints);
+
+            bool isSuccess;
+            StarTriangulation *star = TriangulationFactory::createStar(vPoints, isSuccess);
+            ASSERT_TRUE(isSuccess);
+            StarTriangulation copy(*star);
+
+            // Sequential sweep
+            auto start = std::chrono::steady_clock::now();
+            ASSERT_TRUE(star->delaunay());
+            sequential += std::chrono::steady_clock::now() - start;
+
+            // Parallel rounds using all cores
+            start = std::chrono::steady_clock::now();
+            ASSERT_TRUE(copy.delaunay(0));
+            parallel += std::chrono::steady_clock::now() - start;
+
+            delete star;
+        }
+
+        ofstream ofs(strFileName.c_str(), ios::out);
+        if (ofs.is_open())
+        {
+            ofs << "Sequential: " << sequential.count() << endl;
+            ofs << "Parallel: " << parallel.count() << endl;
+            ofs.close();
+        }
+    }
+}
+
+
+/**
+* @brief   Converts star triangulation of 100K points 10 times and writes a report
+ */
+TEST_F(TestStarDelaunay_Profiling, Test_StarDelaunay_100K_10)
+{
+    string strFileName="StarDelaunay_100K_10.txt";
+    cout << strFileName << "..." << endl;
+    execute(NUM_POINTS_100K, NUM_ITERATIONS_10, strFileName);
+    cout << strFileName << "...Done" << endl;
+}
+
+/**
+* @brief   Converts star triangulation of 1M points once and writes a report
+ */
+TEST_F(TestStarDelaunay_Profiling, Test_StarDelaunay_1M_1)
+{
+    string strFileName="StarDelaunay_1M_1.txt";
+    cout << strFileName << "..." << endl;
+    execute(NUM_POINTS_1M, NUM_ITERATIONS_1, strFileName);
+    cout << strFileName << "...Done" << endl;
+}
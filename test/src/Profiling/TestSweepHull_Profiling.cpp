@@ -0,0 +1,148 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "PointFactory.h"
+#include "TestSuite.h"
+#include "TriangulationFactory.h"
+
+#include <chrono>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iostream>
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestSweepHull_Profiling : public ::testing::Test
+    {
+    public:
+
+        /**
+         * @fn      execute
+         * @brief   Generates a set of random points and computes its Delaunay triangulation using sweep hull,
+         *          incremental and star triangulation plus flips. Writes the total time of every algorithm to a report.
+         *
+         * @param   szNumPoints         (IN) Points set number of points
+         * @param   szNumIterations     (IN) Number of times every triangulation is computed
+         * @param   strFileName         (IN) Report file name
+         * @param   isSweepHullOnly     (IN) Flag to skip incremental and star triangulations
+         */
+        static void execute(size_t szNumPoints, size_t szNumIterations, const string& strFileName,
+                            bool isSweepHullOnly=false);
+    };
+
+
+    void TestSweepHull_Profiling::execute(size_t szNumPoints, size_t szNumIterations, const string& strFileName,
+                                          bool isSweepHullOnly)
+    {
+        std::chrono::duration<double> sweepHull(0.0);
+        std::chrono::duration<double> incremental(0.0);
+        std::chrono::duration<double> star(0.0);
+
+        for (size_t i=0; i<szNumIterations ; i++)
+        {
+            vector<Point<TYPE>> vPoints;
+            PointFactory::generateRandom(szNumPoints, vPoints);
+
+            // Sweep hull using all cores to sort points
+            bool isSuccess;
+            auto start = std::chrono::steady_clock::now();
+            SweepHullDelaunay *sweepHullDelaunay = TriangulationFactory::createSweepHull(vPoints, isSuccess);
+            sweepHull += std::chrono::steady_clock::now() - start;
+            ASSERT_TRUE(isSuccess);
+            delete sweepHullDelaunay;
+
+            if (isSweepHullOnly)
+            {
+                continue;
+            }
+
+            // Incremental
+            start = std::chrono::steady_clock::now();
+            Delaunay *delaunay = TriangulationFactory::createDelaunay(vPoints, isSuccess);
+            incremental += std::chrono::steady_clock::now() - start;
+            ASSERT_TRUE(isSuccess);
+            delete delaunay;
+
+            // Star triangulation converted into Delaunay
+            start = std::chrono::steady_clock::now();
+            StarTriangulation *starTriangulation = TriangulationFactory::createStar(vPoints, isSuccess);
+            ASSERT_TRUE(isSuccess);
+            ASSERT_TRUE(starTriangulation->delaunay());
+            star += std::chrono::steady_clock::now() - start;
+            delete starTriangulation;
+        }
+
+        ofstream ofs(strFileName.c_str(), ios::out);
+        if (ofs.is_open())
+        {
+            ofs << "Sweep hull: " << sweepHull.count() << endl;
+            if (!isSweepHullOnly)
+            {
+                ofs << "Incremental: " << incremental.count() << endl;
+                ofs << "Star: " << star.count() << endl;
+            }
+            ofs.close();
+        }
+    }
+}
+
+
+/**
+* @brief   Computes triangulations 100 times using 1K points and writes a report
+ */
+TEST_F(TestSweepHull_Profiling, Test_SweepHull_1K_100)
+{
+    string strFileName="SweepHull_1K_100.txt";
+    cout << strFileName << "..." << endl;
+    execute(NUM_POINTS_1K, NUM_ITERATIONS_100, strFileName);
+    cout << strFileName << "...Done" << endl;
+}
+
+/**
+* @brief   Computes triangulations 10 times using 10K points and writes a report
+ */
+TEST_F(TestSweepHull_Profiling, Test_SweepHull_10K_10)
+{
+    string strFileName="SweepHull_10K_10.txt";
+    cout << strFileName << "..." << endl;
+    execute(NUM_POINTS_10K, NUM_ITERATIONS_10, strFileName);
+    cout << strFileName << "...Done" << endl;
+}
+
+/**
+* @brief   Computes triangulations 10 times using 100K points and writes a report
+ */
+TEST_F(TestSweepHull_Profiling, Test_SweepHull_100K_10)
+{
+    string strFileName="SweepHull_100K_10.txt";
+    cout << strFileName << "..." << endl;
+    execute(NUM_POINTS_100K, NUM_ITERATIONS_10, strFileName);
+    cout << strFileName << "...Done" << endl;
+}
+
+/**
+* @brief   Computes triangulations once using 1M points and writes a report
+ */
+TEST_F(TestSweepHull_Profiling, Test_SweepHull_1M_1)
+{
+    string strFileName="SweepHull_1M_1.txt";
+    cout << strFileName << "..." << endl;
+    execute(NUM_POINTS_1M, NUM_ITERATIONS_1, strFileName);
+    cout << strFileName << "...Done" << endl;
+}
+
+/**
+* @brief   Computes sweep hull triangulation once using 10M points and writes a report. Incremental and star
+*          triangulations are skipped because of their memory and time
+ */
+TEST_F(TestSweepHull_Profiling, Test_SweepHull_10M_1)
+{
+    string strFileName="SweepHull_10M_1.txt";
+    cout << strFileName << "..." << endl;
+    execute(NUM_POINTS_10M, NUM_ITERATIONS_1, strFileName, true);
+    cout << strFileName << "...Done" << endl;
+}
@@ -0,0 +1,103 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "PointFactory.h"
+#include "TestSuite.h"
+#include "TriangulationFactory.h"
+#include "Voronoi.h"
+#include "VoronoiView.h"
+
+#include <chrono>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <malloc.h>
+
+
+/***********************************************************************************************************************
+* Test Class Definition
+***********************************************************************************************************************/
+namespace
+{
+    class TestVoronoiView_Profiling : public ::testing::Test
+    {
+    public:
+
+        /**
+         * @fn      execute
+         * @brief   Builds Delaunay triangulation of a set of random points and computes its Voronoi diagram and its
+         *          Voronoi view using one thread and all cores. Writes time and heap memory used by both to a report.
+         *
+         * @param   szNumPoints     (IN) Points set number of points
+         * @param   strFileName     (IN) Report file name
+         */
+        static void execute(size_t szNumPoints, const string& strFileName);
+
+        static size_t getHeapSize() { return mallinfo2().uordblks; };
+    };
+
+
+    void TestVoronoiView_Profiling::execute(size_t szNumPoints, const string& strFileName)
+    {
+        vector<Point<TYPE>> vPoints;
+        PointFactory::generateRandom(szNumPoints, vPoints);
+
+        bool isSuccess;
+        Delaunay *delaunay = TriangulationFactory::createDelaunay(vPoints, isSuccess);
+        ASSERT_TRUE(isSuccess);
+        Dcel *dcel = delaunay->getRefDcel();
+
+        // Voronoi DCEL using one thread and all cores
+        size_t szHeapSize = getHeapSize();
+        auto start = std::chrono::steady_clock::now();
+        auto *voronoi = new Voronoi(dcel);
+        ASSERT_TRUE(voronoi->build(1));
+        std::chrono::duration<double> voronoiTime = std::chrono::steady_clock::now() - start;
+        size_t szVoronoiMemory = getHeapSize() - szHeapSize;
+        delete voronoi;
+        start = std::chrono::steady_clock::now();
+        voronoi = new Voronoi(dcel);
+        ASSERT_TRUE(voronoi->build());
+        std::chrono::duration<double> parallelVoronoiTime = std::chrono::steady_clock::now() - start;
+        delete voronoi;
+
+        // Voronoi view using one thread and all cores
+        szHeapSize = getHeapSize();
+        start = std::chrono::steady_clock::now();
+        auto *view = new VoronoiView(*dcel);
+        ASSERT_TRUE(view->build(1));
+        std::chrono::duration<double> viewTime = std::chrono::steady_clock::now() - start;
+        size_t szViewMemory = getHeapSize() - szHeapSize;
+        start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(view->build());
+        std::chrono::duration<double> parallelTime = std::chrono::steady_clock::now() - start;
+        delete view;
+
+        delete delaunay;
+        ASSERT_LT(2*szViewMemory, szVoronoiMemory);
+
+        ofstream ofs(strFileName.c_str(), ios::out);
+        if (ofs.is_open())
+        {
+            ofs << "Voronoi time: " << voronoiTime.count() << endl;
+            ofs << "Voronoi memory (bytes): " << szVoronoiMemory << endl;
+            ofs << "Parallel Voronoi time: " << parallelVoronoiTime.count() << endl;
+            ofs << "Voronoi view time: " << viewTime.count() << endl;
+            ofs << "Voronoi view memory (bytes): " << szViewMemory << endl;
+            ofs << "Parallel Voronoi view time: " << parallelTime.count() << endl;
+            ofs.close();
+        }
+    }
+}
+
+
+/**
+* @brief   Computes Voronoi diagram and Voronoi view of 1M points and writes a report
+ */
+TEST_F(TestVoronoiView_Profiling, Test_VoronoiView_1M)
+{
+    string strFileName="VoronoiView_1M.txt";
+    cout << strFileName << "..." << endl;
+    execute(NUM_POINTS_1M, strFileName);
+    cout << strFileName << "...Done" << endl;
+}
@@ -0,0 +1,41 @@
+/***********************************************************************************************************************
+* Includes
+***********************************************************************************************************************/
+#include "TestTriangles.h"
+
+#include <algorithm>
+
+
+/***********************************************************************************************************************
+* Public method definitions
+***********************************************************************************************************************/
+void TestTriangles::getTriangles(Dcel &dcel, vector<TestTriangle> &vTriangles)
+{
+    vTriangles.clear();
+    for (size_t i=1; i<dcel.getNumFaces() ; i++)
+    {
+        // Skip faces with imaginary points
+        if (dcel.imaginaryFace((int) i))
+        {
+            continue;
+        }
+
+        // Sort face points
+        vector<Point<TYPE>> vPoints;
+        dcel.getFacePoints((int) i, vPoints);
+        sort(vPoints.begin(), vPoints.end(), [](const Point<TYPE> &p, const Point<TYPE> &q)
+        {
+            return (p.getX() < q.getX()) || ((p.getX() == q.getX()) && (p.getY() < q.getY()));
+        });
+
+        TestTriangle triangle;
+        for (size_t j=0; j<vPoints.size() ; j++)
+        {
+            triangle[2*j] = vPoints.at(j).getX();
+            triangle[2*j+1] = vPoints.at(j).getY();
+        }
+        vTriangles.push_back(triangle);
+    }
+
+    sort(vTriangles.begin(), vTriangles.end());
+}
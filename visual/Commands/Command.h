@@ -14,9 +14,11 @@
 #include "DcelFigureBuilder.h"
 #include "FigureIO.h"
 #include "LineFactory.h"
+#include "MinimumSpanningTree.h"
 #include "PointFactory.h"
 #include "PointsReader.h"
 #include "PointsWriter.h"
+#include "RelativeNeighbourhood.h"
 #include "VoronoiIO.h"
 
 
@@ -782,9 +784,9 @@ public:
 
         if (isRunSuccess)
         {
-            Point<TYPE> *vertex1;	    // First vertex.
-            Point<TYPE> *vertex2;	    // Second vertex.
-            Dcel	*dcelRef;
+            const Point<TYPE> *vertex1;	    // First vertex.
+            const Point<TYPE> *vertex2;	    // Second vertex.
+            const Dcel	*dcelRef;
 
             // Get reference to gabriel dcel.
             dcelRef = gabriel->getDcel();
@@ -839,6 +841,194 @@ public:
 };
 
 
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+class CommandSpanningTree : public Command
+{
+    vector<Line> vLines;
+public:
+
+    /*******************************************************************************************************************
+    * Public class methods
+    *******************************************************************************************************************/
+    explicit CommandSpanningTree(StoreService *storeServiceIn) : Command(storeServiceIn) {};
+
+
+    /**
+     * @fn       printRunnableMsg
+     * @brief    Prints message to explain that Delaunay triangulation is required
+     */
+    void printRunnableMsg() override
+    {
+        cout << "Delaunay triangulation is required" << endl;
+    }
+
+
+    /**
+     * @fn      isRunnable
+     * @brief   Checks Delaunay triangulation has been created
+     *
+     * @return  true if command can be ran
+     *          false otherwise
+     */
+    bool isRunnable() override
+    {
+        return in.getStoreService()->isDelaunay();
+    }
+
+
+    /**
+     * @fn      run
+     * @brief   Builds Euclidean minimum spanning tree of Delaunay triangulation points
+     *
+     * @return  true built was successfully
+     *          false otherwise
+     */
+    CommandResult * runCommand() override
+    {
+        // Build minimum spanning tree.
+        Dcel *dcelRef = in.getStoreService()->getDelaunay()->getRefDcel();
+        MinimumSpanningTree graph(*dcelRef);
+        bool isRunSuccess = graph.build();
+
+        if (isRunSuccess)
+        {
+            // Draw every edge once.
+            for (int edgeIndex=0; edgeIndex<graph.getSize() ;edgeIndex++)
+            {
+                if (graph.isSet(edgeIndex) && (edgeIndex < dcelRef->getTwin(edgeIndex)-1))
+                {
+                    Point<TYPE> *vertex1 = dcelRef->getRefPoint(dcelRef->getOrigin(edgeIndex)-1);
+                    Point<TYPE> *vertex2 = dcelRef->getRefPoint(dcelRef->getOrigin(dcelRef->getTwin(edgeIndex)-1)-1);
+                    vLines.emplace_back(*vertex1, *vertex2);
+                }
+            }
+        }
+
+        // Build result
+        setIsSuccess(isRunSuccess);
+        return createResult();
+    }
+
+
+    /**
+     * @fn      createResult
+     * @brief   Creates command result
+     */
+    CommandResult *createResult() override
+    {
+        // Add items to display
+        vector<Displayable*> vDisplayable;
+        if (getSuccess())
+        {
+            // Add Delaunay and minimum spanning tree
+            Delaunay *delaunay = in.getStoreService()->getDelaunay();
+            Displayable *displayDcel = DisplayableFactory::createDcel(delaunay->getRefDcel());
+            displayDcel->setDashedLines();
+            vDisplayable.push_back(displayDcel);
+            vDisplayable.push_back(DisplayableFactory::createPolyLine(vLines));
+        }
+
+        return new CommandResult(getSuccess(), vDisplayable);
+    }
+};
+
+
+/***********************************************************************************************************************
+* Class declaration
+***********************************************************************************************************************/
+class CommandRelativeNeighbourhood : public Command
+{
+    vector<Line> vLines;
+public:
+
+    /*******************************************************************************************************************
+    * Public class methods
+    *******************************************************************************************************************/
+    explicit CommandRelativeNeighbourhood(StoreService *storeServiceIn) : Command(storeServiceIn) {};
+
+
+    /**
+     * @fn       printRunnableMsg
+     * @brief    Prints message to explain that Delaunay triangulation is required
+     */
+    void printRunnableMsg() override
+    {
+        cout << "Delaunay triangulation is required" << endl;
+    }
+
+
+    /**
+     * @fn      isRunnable
+     * @brief   Checks Delaunay triangulation has been created
+     *
+     * @return  true if command can be ran
+     *          false otherwise
+     */
+    bool isRunnable() override
+    {
+        return in.getStoreService()->isDelaunay();
+    }
+
+
+    /**
+     * @fn      run
+     * @brief   Builds relative neighbourhood graph of Delaunay triangulation points
+     *
+     * @return  true built was successfully
+     *          false otherwise
+     */
+    CommandResult * runCommand() override
+    {
+        // Build relative neighbourhood graph.
+        Dcel *dcelRef = in.getStoreService()->getDelaunay()->getRefDcel();
+        RelativeNeighbourhood graph(*dcelRef);
+        bool isRunSuccess = graph.build();
+
+        if (isRunSuccess)
+        {
+            // Draw every edge once.
+            for (int edgeIndex=0; edgeIndex<graph.getSize() ;edgeIndex++)
+            {
+                if (graph.isSet(edgeIndex) && (edgeIndex < dcelRef->getTwin(edgeIndex)-1))
+                {
+                    Point<TYPE> *vertex1 = dcelRef->getRefPoint(dcelRef->getOrigin(edgeIndex)-1);
+                    Point<TYPE> *vertex2 = dcelRef->getRefPoint(dcelRef->getOrigin(dcelRef->getTwin(edgeIndex)-1)-1);
+                    vLines.emplace_back(*vertex1, *vertex2);
+                }
+            }
+        }
+
+        // Build result
+        setIsSuccess(isRunSuccess);
+        return createResult();
+    }
+
+
+    /**
+     * @fn      createResult
+     * @brief   Creates command result
+     */
+    CommandResult *createResult() override
+    {
+        // Add items to display
+        vector<Displayable*> vDisplayable;
+        if (getSuccess())
+        {
+            // Add Delaunay and relative neighbourhood graph
+            Delaunay *delaunay = in.getStoreService()->getDelaunay();
+            Displayable *displayDcel = DisplayableFactory::createDcel(delaunay->getRefDcel());
+            displayDcel->setDashedLines();
+            vDisplayable.push_back(displayDcel);
+            vDisplayable.push_back(DisplayableFactory::createPolyLine(vLines));
+        }
+
+        return new CommandResult(getSuccess(), vDisplayable);
+    }
+};
+
+
 /***********************************************************************************************************************
 * Class declaration
 ***********************************************************************************************************************/
@@ -110,6 +110,18 @@ Command *CommandFactory::createGabriel(StoreService *storeService)
     return new CommandGabriel(storeService);
 }
 
+Command *CommandFactory::createSpanningTree(StoreService *storeService)
+{
+    // Create command
+    return new CommandSpanningTree(storeService);
+}
+
+Command *CommandFactory::createRelativeNeighbourhood(StoreService *storeService)
+{
+    // Create command
+    return new CommandRelativeNeighbourhood(storeService);
+}
+
 Command *CommandFactory::createTriangulationPath(StoreService *storeService)
 {
     // Create command
@@ -238,6 +250,9 @@ void CommandFactory::initialize()
     mapFactories.insert(std::pair<int, pfuncCommandCreate>(convex_hull, CommandFactory::createConvexHull));
     mapFactories.insert(std::pair<int, pfuncCommandCreate>(voronoi, CommandFactory::createVoronoi));
     mapFactories.insert(std::pair<int, pfuncCommandCreate>(gabriel, CommandFactory::createGabriel));
+    mapFactories.insert(std::pair<int, pfuncCommandCreate>(spanning_tree, CommandFactory::createSpanningTree));
+    mapFactories.insert(std::pair<int, pfuncCommandCreate>(relative_neighbourhood,
+                                                           CommandFactory::createRelativeNeighbourhood));
     mapFactories.insert(std::pair<int, pfuncCommandCreate>(triangulation_path, CommandFactory::createTriangulationPath));
     mapFactories.insert(std::pair<int, pfuncCommandCreate>(voronoi_path, CommandFactory::createVoronoiPath));
     mapFactories.insert(std::pair<int, pfuncCommandCreate>(closest_point, CommandFactory::createClosestPoint));
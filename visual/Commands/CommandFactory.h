@@ -35,6 +35,8 @@ class CommandFactory
     static Command *createConvexHull(StoreService *storeService);
     static Command *createVoronoi(StoreService *storeService);
     static Command *createGabriel(StoreService *storeService);
+    static Command *createSpanningTree(StoreService *storeService);
+    static Command *createRelativeNeighbourhood(StoreService *storeService);
     static Command *createTriangulationPath(StoreService *storeService);
     static Command *createVoronoiPath(StoreService *storeService);
     static Command *createClosestPoint(StoreService *storeService);
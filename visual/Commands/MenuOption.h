@@ -38,6 +38,8 @@ enum MenuOption
     write_triangulation = 28,
     write_delaunay = 29,
     write_voronoi = 30,
+    spanning_tree = 31,
+    relative_neighbourhood = 32,
 };
 
 #endif //DELAUNAY_MENUOPTION_H